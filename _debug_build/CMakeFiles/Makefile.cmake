@@ -0,0 +1,148 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "libantlr3c-3.4-prefix/tmp/libantlr3c-3.4-mkdirs.cmake"
+  "/root/repo/cmake/FindDreal.cmake"
+  "/root/repo/cmake/FindLibPoly.cmake"
+  "/root/repo/cmake/FindMathSAT5.cmake"
+  "/root/repo/cmake/FindOpenSMT2.cmake"
+  "/root/repo/cmake/FindZ3.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/ai/CMakeLists.txt"
+  "/root/repo/src/command/CMakeLists.txt"
+  "/root/repo/src/engine/CMakeLists.txt"
+  "/root/repo/src/expr/CMakeLists.txt"
+  "/root/repo/src/parser/CMakeLists.txt"
+  "/root/repo/src/smt/CMakeLists.txt"
+  "/root/repo/src/system/CMakeLists.txt"
+  "/root/repo/src/utils/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/regress/CMakeLists.txt"
+  "/root/repo/test/unit/CMakeLists.txt"
+  "/root/repo/test/unit/engine/CMakeLists.txt"
+  "/root/repo/test/unit/expr/CMakeLists.txt"
+  "/root/repo/test/unit/smt/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/boost_atomic-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/boost_atomic-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/libboost_atomic-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/libboost_atomic-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/boost_iostreams-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/boost_iostreams-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/libboost_iostreams-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/libboost_iostreams-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/boost_program_options-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/boost_program_options-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/libboost_program_options-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/libboost_program_options-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/boost_thread-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/boost_thread-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/libboost_thread-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/libboost_thread-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/RepositoryInfo.txt.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/cfgcmd.txt.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/extractfile.cmake.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/mkdirs.cmake.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/verify.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "libantlr3c-3.4-prefix/tmp/libantlr3c-3.4-mkdirs.cmake"
+  "libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp/verify-libantlr3c-3.4.cmake"
+  "libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp/extract-libantlr3c-3.4.cmake"
+  "libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp/libantlr3c-3.4-urlinfo.txt"
+  "libantlr3c-3.4-prefix/tmp/libantlr3c-3.4-cfgcmd.txt"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/expr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/smt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/system/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/command/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/parser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ai/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/engine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit/expr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit/smt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit/engine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/regress/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/check.dir/DependInfo.cmake"
+  "CMakeFiles/libantlr3c-3.4.dir/DependInfo.cmake"
+  "src/CMakeFiles/sally.dir/DependInfo.cmake"
+  "src/CMakeFiles/sally-replay.dir/DependInfo.cmake"
+  "src/utils/CMakeFiles/utils.dir/DependInfo.cmake"
+  "src/expr/CMakeFiles/expr.dir/DependInfo.cmake"
+  "src/smt/CMakeFiles/smt.dir/DependInfo.cmake"
+  "src/system/CMakeFiles/system.dir/DependInfo.cmake"
+  "src/command/CMakeFiles/command.dir/DependInfo.cmake"
+  "src/parser/CMakeFiles/parser.dir/DependInfo.cmake"
+  "src/ai/CMakeFiles/ai.dir/DependInfo.cmake"
+  "src/engine/CMakeFiles/engine.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/sally_test.dir/DependInfo.cmake"
+  "test/unit/expr/CMakeFiles/expr_test.dir/DependInfo.cmake"
+  "test/unit/smt/CMakeFiles/smt_test.dir/DependInfo.cmake"
+  "test/unit/engine/CMakeFiles/engine_test.dir/DependInfo.cmake"
+  )
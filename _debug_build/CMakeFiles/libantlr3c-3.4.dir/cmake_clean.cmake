@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libantlr3c-3.4"
+  "CMakeFiles/libantlr3c-3.4-complete"
+  "libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp/libantlr3c-3.4-build"
+  "libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp/libantlr3c-3.4-configure"
+  "libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp/libantlr3c-3.4-download"
+  "libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp/libantlr3c-3.4-install"
+  "libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp/libantlr3c-3.4-mkdir"
+  "libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp/libantlr3c-3.4-patch"
+  "libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp/libantlr3c-3.4-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/libantlr3c-3.4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+if("/root/repo/antlr/libantlr3c-3.4.tar.gz" STREQUAL "")
+  message(FATAL_ERROR "LOCAL can't be empty")
+endif()
+
+if(NOT EXISTS "/root/repo/antlr/libantlr3c-3.4.tar.gz")
+  message(FATAL_ERROR "File not found: /root/repo/antlr/libantlr3c-3.4.tar.gz")
+endif()
+
+if("MD5" STREQUAL "")
+  message(WARNING "File will not be verified since no URL_HASH specified")
+  return()
+endif()
+
+if("08b1420129d5dccd0f4461cedf2a0d7d" STREQUAL "")
+  message(FATAL_ERROR "EXPECT_VALUE can't be empty")
+endif()
+
+message(STATUS "verifying file...
+     file='/root/repo/antlr/libantlr3c-3.4.tar.gz'")
+
+file("MD5" "/root/repo/antlr/libantlr3c-3.4.tar.gz" actual_value)
+
+if(NOT "${actual_value}" STREQUAL "08b1420129d5dccd0f4461cedf2a0d7d")
+  message(FATAL_ERROR "error: MD5 hash of
+  /root/repo/antlr/libantlr3c-3.4.tar.gz
+does not match expected value
+  expected: '08b1420129d5dccd0f4461cedf2a0d7d'
+    actual: '${actual_value}'
+")
+endif()
+
+message(STATUS "verifying file... done")
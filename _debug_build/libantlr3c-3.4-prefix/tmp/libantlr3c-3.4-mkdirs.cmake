@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_debug_build/libantlr3c-3.4-prefix/src/libantlr3c-3.4"
+  "/root/repo/_debug_build/libantlr3c-3.4-prefix/src/libantlr3c-3.4-build"
+  "/root/repo/_debug_build/libantlr3c-3.4-prefix"
+  "/root/repo/_debug_build/libantlr3c-3.4-prefix/tmp"
+  "/root/repo/_debug_build/libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp"
+  "/root/repo/_debug_build/libantlr3c-3.4-prefix/src"
+  "/root/repo/_debug_build/libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_debug_build/libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_debug_build/libantlr3c-3.4-prefix/src/libantlr3c-3.4-stamp${cfgdir}") # cfgdir has leading slash
+endif()
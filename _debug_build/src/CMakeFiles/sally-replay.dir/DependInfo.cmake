@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/sally_replay.cpp" "src/CMakeFiles/sally-replay.dir/sally_replay.cpp.o" "gcc" "src/CMakeFiles/sally-replay.dir/sally_replay.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/src/smt/CMakeFiles/smt.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/expr/CMakeFiles/expr.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/utils/CMakeFiles/utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sally-replay.dir/sally_replay.cpp.o"
+  "CMakeFiles/sally-replay.dir/sally_replay.cpp.o.d"
+  "sally-replay"
+  "sally-replay.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sally-replay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sally.dir/sally.cpp.o"
+  "CMakeFiles/sally.dir/sally.cpp.o.d"
+  "sally"
+  "sally.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sally.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
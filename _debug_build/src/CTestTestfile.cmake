@@ -0,0 +1,660 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src
+# Build directory: /root/repo/_debug_build/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(/root/repo/test/regress/aig/invariant_certificate.mcmt "sally" "--engine" "aig" "--aig-no-sweep" "--show-invariant" "/root/repo/test/regress/aig/invariant_certificate.mcmt")
+set_tests_properties(/root/repo/test/regress/aig/invariant_certificate.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+\\(invariant 1 (.*\\(not b\\).*\\(not a\\)|.*\\(not a\\).*\\(not b\\))" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/aig/shift.mcmt "sally" "--engine" "aig" "/root/repo/test/regress/aig/shift.mcmt")
+set_tests_properties(/root/repo/test/regress/aig/shift.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/aig/sweep.mcmt "sally" "--engine" "aig" "/root/repo/test/regress/aig/sweep.mcmt")
+set_tests_properties(/root/repo/test/regress/aig/sweep.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/adding.1.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "6" "--bmc-max" "6" "/root/repo/test/regress/bmc/beem/adding.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/adding.1.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/adding.1.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "15" "--bmc-max" "15" "/root/repo/test/regress/bmc/beem/adding.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/adding.1.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/adding.2.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "11" "--bmc-max" "11" "/root/repo/test/regress/bmc/beem/adding.2.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/adding.2.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/anderson.1.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "3" "--bmc-max" "3" "/root/repo/test/regress/bmc/beem/anderson.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/anderson.1.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/anderson.1.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "13" "--bmc-max" "13" "/root/repo/test/regress/bmc/beem/anderson.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/anderson.1.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/anderson.3.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "3" "--bmc-max" "3" "/root/repo/test/regress/bmc/beem/anderson.3.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/anderson.3.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/bakery.2.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "5" "--bmc-max" "5" "/root/repo/test/regress/bmc/beem/bakery.2.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/bakery.2.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/bakery.2.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "18" "--bmc-max" "18" "/root/repo/test/regress/bmc/beem/bakery.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/bakery.2.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/bakery.4.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "24" "--bmc-max" "24" "/root/repo/test/regress/bmc/beem/bakery.4.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/bakery.4.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/collision.2.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "12" "--bmc-max" "12" "/root/repo/test/regress/bmc/beem/collision.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/collision.2.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/elevator_planning.1.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "15" "--bmc-max" "15" "/root/repo/test/regress/bmc/beem/elevator_planning.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/elevator_planning.1.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/elevator_planning.3.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "8" "--bmc-max" "8" "/root/repo/test/regress/bmc/beem/elevator_planning.3.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/elevator_planning.3.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/elevator_planning.3.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "14" "--bmc-max" "14" "/root/repo/test/regress/bmc/beem/elevator_planning.3.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/elevator_planning.3.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/fischer.2.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "9" "--bmc-max" "9" "/root/repo/test/regress/bmc/beem/fischer.2.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/fischer.2.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/fischer.2.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "14" "--bmc-max" "14" "/root/repo/test/regress/bmc/beem/fischer.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/fischer.2.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/krebs.1.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "7" "--bmc-max" "7" "/root/repo/test/regress/bmc/beem/krebs.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/krebs.1.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/krebs.1.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "7" "--bmc-max" "7" "/root/repo/test/regress/bmc/beem/krebs.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/krebs.1.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/krebs.2.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "30" "--bmc-max" "30" "/root/repo/test/regress/bmc/beem/krebs.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/krebs.2.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/lann.1.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "14" "--bmc-max" "14" "/root/repo/test/regress/bmc/beem/lann.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/lann.1.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/loyd.1.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "11" "--bmc-max" "11" "/root/repo/test/regress/bmc/beem/loyd.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/loyd.1.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/loyd.1.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "16" "--bmc-max" "16" "/root/repo/test/regress/bmc/beem/loyd.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/loyd.1.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/peterson.2.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "6" "--bmc-max" "6" "/root/repo/test/regress/bmc/beem/peterson.2.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/peterson.2.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/peterson.2.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "22" "--bmc-max" "22" "/root/repo/test/regress/bmc/beem/peterson.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/peterson.2.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/peterson.3.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "3" "--bmc-max" "3" "/root/repo/test/regress/bmc/beem/peterson.3.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/peterson.3.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/peterson.3.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "16" "--bmc-max" "16" "/root/repo/test/regress/bmc/beem/peterson.3.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/peterson.3.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/protocols.1.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "4" "--bmc-max" "4" "/root/repo/test/regress/bmc/beem/protocols.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/protocols.1.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/protocols.1.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "6" "--bmc-max" "6" "/root/repo/test/regress/bmc/beem/protocols.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/protocols.1.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/protocols.2.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "4" "--bmc-max" "4" "/root/repo/test/regress/bmc/beem/protocols.2.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/protocols.2.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/protocols.2.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "6" "--bmc-max" "6" "/root/repo/test/regress/bmc/beem/protocols.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/protocols.2.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/protocols.3.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "4" "--bmc-max" "4" "/root/repo/test/regress/bmc/beem/protocols.3.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/protocols.3.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/protocols.3.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "6" "--bmc-max" "6" "/root/repo/test/regress/bmc/beem/protocols.3.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/protocols.3.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/protocols.4.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "4" "--bmc-max" "4" "/root/repo/test/regress/bmc/beem/protocols.4.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/protocols.4.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/protocols.4.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "6" "--bmc-max" "6" "/root/repo/test/regress/bmc/beem/protocols.4.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/protocols.4.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/protocols.5.prop1-back-serstep.btor "sally" "--engine" "bmc" "--bmc-min" "4" "--bmc-max" "4" "/root/repo/test/regress/bmc/beem/protocols.5.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/protocols.5.prop1-back-serstep.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/protocols.5.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "6" "--bmc-max" "6" "/root/repo/test/regress/bmc/beem/protocols.5.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/protocols.5.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/beem/schedule_world.1.prop1-func-interl.btor "sally" "--engine" "bmc" "--bmc-min" "6" "--bmc-max" "6" "/root/repo/test/regress/bmc/beem/schedule_world.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/bmc/beem/schedule_world.1.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/example0.mcmt "sally" "--engine" "bmc" "/root/repo/test/regress/bmc/example0.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/example0.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/example2.mcmt "sally" "--engine" "bmc" "/root/repo/test/regress/bmc/example2.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/example2.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/example3.a.mcmt "sally" "--engine" "bmc" "/root/repo/test/regress/bmc/example3.a.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/example3.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/example3.b.mcmt "sally" "--engine" "bmc" "/root/repo/test/regress/bmc/example3.b.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/example3.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/example4.a.mcmt "sally" "--engine" "bmc" "/root/repo/test/regress/bmc/example4.a.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/example4.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/example4.b.mcmt "sally" "--engine" "bmc" "/root/repo/test/regress/bmc/example4.b.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/example4.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/example5.a.mcmt "sally" "--engine" "bmc" "/root/repo/test/regress/bmc/example5.a.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/example5.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/example5.b.mcmt "sally" "--engine" "bmc" "/root/repo/test/regress/bmc/example5.b.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/example5.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/example6.a.mcmt "sally" "--engine" "bmc" "/root/repo/test/regress/bmc/example6.a.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/example6.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/example6.b.mcmt "sally" "--engine" "bmc" "/root/repo/test/regress/bmc/example6.b.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/example6.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/example7.mcmt "sally" "--engine" "bmc" "/root/repo/test/regress/bmc/example7.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/example7.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/algebraic.mcmt "sally" "--engine" "bmc" "--show-trace" "/root/repo/test/regress/bmc/nra/algebraic.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/algebraic.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid.*1792728671193156477399422023279.*1267650600228229401496703205376.*
+
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/arrowsmith_and_place_fig_1_31_page_14.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/arrowsmith_and_place_fig_1_31_page_14.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/arrowsmith_and_place_fig_1_31_page_14.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/arrowsmith_and_place_fig_3_1_page_72.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/arrowsmith_and_place_fig_3_1_page_72.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/arrowsmith_and_place_fig_3_1_page_72.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/arrowsmith_and_place_fig_3_8_page_82.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/arrowsmith_and_place_fig_3_8_page_82.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/arrowsmith_and_place_fig_3_8_page_82.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/ball_count_1d_plain.hydi.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/ball_count_1d_plain.hydi.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/ball_count_1d_plain.hydi.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/cfa_test0005.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "--bmc-max" "16" "/root/repo/test/regress/bmc/nra/cfa_test0005.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/cfa_test0005.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/cfa_test0013.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/cfa_test0013.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/cfa_test0013.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/cfa_test0016.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/cfa_test0016.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/cfa_test0016.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/collin_goriely_page_60.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/collin_goriely_page_60.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/collin_goriely_page_60.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/darboux_christoffel_int_goriely_page_58.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/darboux_christoffel_int_goriely_page_58.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/darboux_christoffel_int_goriely_page_58.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_11.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_11.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_11.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_15_i.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_15_i.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_15_i.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_15_ii.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_15_ii.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_15_ii.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_9.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_9.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_10_9.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_5_1_ii.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_5_1_ii.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_5_1_ii.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_5_2_ii.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_5_2_ii.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/dumortier_llibre_artes_ex_5_2_ii.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/example_4.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/example_4.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/example_4.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/sas13-floatitp-rangevMain1.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/sas13-floatitp-rangevMain1.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/sas13-floatitp-rangevMain1.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/sas13-floatitp-rangevMain5.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/sas13-floatitp-rangevMain5.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/sas13-floatitp-rangevMain5.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/sas13-floatitp-test1.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "/root/repo/test/regress/bmc/nra/sas13-floatitp-test1.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/sas13-floatitp-test1.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/sas13-floatitp-test2.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "--bmc-max" "11" "/root/repo/test/regress/bmc/nra/sas13-floatitp-test2.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/sas13-floatitp-test2.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/nra/sas13-floatitp-test3.mcmt "sally" "--engine" "bmc" "--lsal-extensions" "--bmc-max" "11" "/root/repo/test/regress/bmc/nra/sas13-floatitp-test3.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/nra/sas13-floatitp-test3.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bmc/time_limit.mcmt "sally" "--engine" "bmc" "--bmc-max" "1000000" "--query-time-limit" "1" "/root/repo/test/regress/bmc/time_limit.mcmt")
+set_tests_properties(/root/repo/test/regress/bmc/time_limit.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "query interrupted: time limit reached.*bmc::bound = [1-9]" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bv/test_00.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/bv/test_00.mcmt")
+set_tests_properties(/root/repo/test/regress/bv/test_00.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bv/test_01.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/bv/test_01.mcmt")
+set_tests_properties(/root/repo/test/regress/bv/test_01.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/bv/test_02.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/bv/test_02.mcmt")
+set_tests_properties(/root/repo/test/regress/bv/test_02.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/explicit/counter.mcmt "sally" "--engine" "explicit" "/root/repo/test/regress/explicit/counter.mcmt")
+set_tests_properties(/root/repo/test/regress/explicit/counter.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/explicit/nondet.mcmt "sally" "--engine" "explicit" "/root/repo/test/regress/explicit/nondet.mcmt")
+set_tests_properties(/root/repo/test/regress/explicit/nondet.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/houdini/bound.mcmt "sally" "--engine" "kind" "--kind-max" "10" "--ai" "houdini" "--houdini-simulation-steps" "5" "/root/repo/test/regress/houdini/bound.mcmt")
+set_tests_properties(/root/repo/test/regress/houdini/bound.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/houdini/equality.mcmt "sally" "--engine" "kind" "--kind-max" "1" "--ai" "houdini" "--show-invariant" "/root/repo/test/regress/houdini/equality.mcmt")
+set_tests_properties(/root/repo/test/regress/houdini/equality.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+\\(invariant 1 .*\\(= w 3\\).*\\(= x y\\)" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/ic3/counter.mcmt "sally" "--engine" "ic3" "/root/repo/test/regress/ic3/counter.mcmt")
+set_tests_properties(/root/repo/test/regress/ic3/counter.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/ic3/example0.mcmt "sally" "--engine" "ic3" "/root/repo/test/regress/ic3/example0.mcmt")
+set_tests_properties(/root/repo/test/regress/ic3/example0.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/ic3/example2.mcmt "sally" "--engine" "ic3" "/root/repo/test/regress/ic3/example2.mcmt")
+set_tests_properties(/root/repo/test/regress/ic3/example2.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/ic3/example3.a.mcmt "sally" "--engine" "ic3" "/root/repo/test/regress/ic3/example3.a.mcmt")
+set_tests_properties(/root/repo/test/regress/ic3/example3.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/ic3/example3.b.mcmt "sally" "--engine" "ic3" "/root/repo/test/regress/ic3/example3.b.mcmt")
+set_tests_properties(/root/repo/test/regress/ic3/example3.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/issues/31.mcmt "sally" "--engine" "pdkind" "--show-trace" "/root/repo/test/regress/issues/31.mcmt")
+set_tests_properties(/root/repo/test/regress/issues/31.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/issues/51.mcmt "sally" "--engine" "pdkind" "--show-trace" "/root/repo/test/regress/issues/51.mcmt")
+set_tests_properties(/root/repo/test/regress/issues/51.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid.*" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/issues/52.mcmt "sally" "--engine" "pdkind" "--show-trace" "/root/repo/test/regress/issues/52.mcmt")
+set_tests_properties(/root/repo/test/regress/issues/52.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid.*
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/beem/resistance.1.prop1-func-interl.btor "sally" "--engine" "kind" "--kind-max" "1" "/root/repo/test/regress/kind/beem/resistance.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/kind/beem/resistance.1.prop1-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/beem/resistance.1.prop2-func-interl.btor "sally" "--engine" "kind" "--kind-max" "1" "/root/repo/test/regress/kind/beem/resistance.1.prop2-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/kind/beem/resistance.1.prop2-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/beem/resistance.1.prop3-func-interl.btor "sally" "--engine" "kind" "--kind-max" "1" "/root/repo/test/regress/kind/beem/resistance.1.prop3-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/kind/beem/resistance.1.prop3-func-interl.btor PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example0.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example0.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example0.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example2.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example2.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example2.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example3.a.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example3.a.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example3.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example3.b.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example3.b.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example3.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example4.a.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example4.a.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example4.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example4.b.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example4.b.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example4.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example5.a.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example5.a.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example5.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example5.b.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example5.b.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example5.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example6.a.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example6.a.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example6.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example6.b.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example6.b.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example6.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example7.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example7.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example7.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/example8.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/kind/example8.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/example8.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/invariant.mcmt "sally" "--engine" "kind" "--kind-max" "1" "/root/repo/test/regress/kind/invariant.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/invariant.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/invariant_certificate.mcmt "sally" "--engine" "kind" "--kind-max" "1" "--show-invariant" "/root/repo/test/regress/kind/invariant_certificate.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/invariant_certificate.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+\\(invariant 1 .*\\(>= y 0\\).*\\(>= x 0\\)" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/memory_limit.mcmt "sally" "--engine" "kind" "--kind-max" "1000000" "--query-memory-limit" "1" "/root/repo/test/regress/kind/memory_limit.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/memory_limit.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "query interrupted: memory limit reached.*kind::bound = 0" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/arrowsmith_and_place_fig_1_31_page_14.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/arrowsmith_and_place_fig_1_31_page_14.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/arrowsmith_and_place_fig_1_31_page_14.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/arrowsmith_and_place_fig_3_1_page_72.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/arrowsmith_and_place_fig_3_1_page_72.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/arrowsmith_and_place_fig_3_1_page_72.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/arrowsmith_and_place_fig_3_8_page_82.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/arrowsmith_and_place_fig_3_8_page_82.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/arrowsmith_and_place_fig_3_8_page_82.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/ball_count_1d_plain.hydi.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/ball_count_1d_plain.hydi.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/ball_count_1d_plain.hydi.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/cfa_test0005.mcmt "sally" "--engine" "kind" "--lsal-extensions" "--kind-max" "17" "/root/repo/test/regress/kind/nra/invalid/cfa_test0005.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/cfa_test0005.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/cfa_test0013.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/cfa_test0013.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/cfa_test0013.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/cfa_test0016.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/cfa_test0016.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/cfa_test0016.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/collin_goriely_page_60.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/collin_goriely_page_60.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/collin_goriely_page_60.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/darboux_christoffel_int_goriely_page_58.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/darboux_christoffel_int_goriely_page_58.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/darboux_christoffel_int_goriely_page_58.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_11.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_11.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_11.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_15_i.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_15_i.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_15_i.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_15_ii.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_15_ii.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_15_ii.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_9.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_9.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_10_9.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_5_1_ii.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_5_1_ii.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_5_1_ii.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_5_2_ii.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_5_2_ii.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/dumortier_llibre_artes_ex_5_2_ii.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/example_4.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/example_4.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/example_4.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-rangevMain1.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-rangevMain1.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-rangevMain1.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-rangevMain5.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-rangevMain5.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-rangevMain5.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-test1.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-test1.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-test1.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-test2.mcmt "sally" "--engine" "kind" "--lsal-extensions" "--kind-max" "12" "/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-test2.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-test2.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-test3.mcmt "sally" "--engine" "kind" "--lsal-extensions" "--kind-max" "12" "/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-test3.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/invalid/sas13-floatitp-test3.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/Mode_plus_Longitudinal_modified_g120_nuxmv_kratos.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/Mode_plus_Longitudinal_modified_g120_nuxmv_kratos.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/Mode_plus_Longitudinal_modified_g120_nuxmv_kratos.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/Mode_plus_Longitudinal_modified_g130_nuxmv_kratos.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/Mode_plus_Longitudinal_modified_g130_nuxmv_kratos.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/Mode_plus_Longitudinal_modified_g130_nuxmv_kratos.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/arrowsmith_and_place_fig_1_29_page_14.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/arrowsmith_and_place_fig_1_29_page_14.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/arrowsmith_and_place_fig_1_29_page_14.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/arrowsmith_and_place_fig_1_30_page_14.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/arrowsmith_and_place_fig_1_30_page_14.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/arrowsmith_and_place_fig_1_30_page_14.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/cfa_test0006.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/cfa_test0006.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/cfa_test0006.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/cfa_test0014.mcmt "sally" "--engine" "kind" "--lsal-extensions" "--kind-max" "14" "/root/repo/test/regress/kind/nra/valid/cfa_test0014.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/cfa_test0014.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/cfa_test0015.mcmt "sally" "--engine" "kind" "--lsal-extensions" "--kind-max" "14" "/root/repo/test/regress/kind/nra/valid/cfa_test0015.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/cfa_test0015.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/cfa_test0017.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/cfa_test0017.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/cfa_test0017.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/cfa_test0018.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/cfa_test0018.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/cfa_test0018.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/cfa_test0019.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/cfa_test0019.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/cfa_test0019.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/dai_gan_xhia_zhan_jsc14_ex1.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/dai_gan_xhia_zhan_jsc14_ex1.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/dai_gan_xhia_zhan_jsc14_ex1.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/djaballah_chaputot_kieffer_boussou_2015_ex1.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/djaballah_chaputot_kieffer_boussou_2015_ex1.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/djaballah_chaputot_kieffer_boussou_2015_ex1.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/dumortier_llibre_artes_ex_1_9b.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/dumortier_llibre_artes_ex_1_9b.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/dumortier_llibre_artes_ex_1_9b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/dumortier_llibre_artes_ex_5_13.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/dumortier_llibre_artes_ex_5_13.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/dumortier_llibre_artes_ex_5_13.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/keymaera_nonlinear1.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/keymaera_nonlinear1.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/keymaera_nonlinear1.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/liu_zhan_zhao_emsoft11_ex_25.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/liu_zhan_zhao_emsoft11_ex_25.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/liu_zhan_zhao_emsoft11_ex_25.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/lotka_volterra_fourth_quadrant.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/lotka_volterra_fourth_quadrant.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/lotka_volterra_fourth_quadrant.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/paper_example_1.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/paper_example_1.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/paper_example_1.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/paper_example_2.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/paper_example_2.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/paper_example_2.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/shimizu_morioka_system.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/shimizu_morioka_system.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/shimizu_morioka_system.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/synthetic_example1.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/synthetic_example1.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/synthetic_example1.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kind/nra/valid/wiggins_ex_18_1_2.mcmt "sally" "--engine" "kind" "--lsal-extensions" "/root/repo/test/regress/kind/nra/valid/wiggins_ex_18_1_2.mcmt")
+set_tests_properties(/root/repo/test/regress/kind/nra/valid/wiggins_ex_18_1_2.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kliveness/counter.mcmt "sally" "--engine" "kliveness" "/root/repo/test/regress/kliveness/counter.mcmt")
+set_tests_properties(/root/repo/test/regress/kliveness/counter.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/kliveness/fairness.mcmt "sally" "--engine" "kliveness" "/root/repo/test/regress/kliveness/fairness.mcmt")
+set_tests_properties(/root/repo/test/regress/kliveness/fairness.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/adding.1.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/adding.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/adding.1.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/adding.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/adding.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/adding.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/adding.2.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/adding.2.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/adding.2.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/anderson.1.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/anderson.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/anderson.1.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/anderson.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/anderson.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/anderson.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/anderson.2.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/anderson.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/anderson.2.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/anderson.3.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/anderson.3.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/anderson.3.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/anderson.3.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/anderson.3.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/anderson.3.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/bakery.1.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/bakery.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/bakery.1.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/bakery.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/bakery.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/bakery.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/bakery.2.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/bakery.2.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/bakery.2.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/bakery.2.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/bakery.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/bakery.2.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/bakery.4.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/bakery.4.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/bakery.4.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/collision.2.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/collision.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/collision.2.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/elevator_planning.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/elevator_planning.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/elevator_planning.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/elevator_planning.3.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/elevator_planning.3.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/elevator_planning.3.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/elevator_planning.3.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/elevator_planning.3.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/elevator_planning.3.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/fischer.1.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/fischer.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/fischer.1.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/fischer.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/fischer.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/fischer.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/fischer.2.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/fischer.2.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/fischer.2.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/fischer.2.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/fischer.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/fischer.2.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/krebs.1.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/krebs.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/krebs.1.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/krebs.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/krebs.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/krebs.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/krebs.2.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/krebs.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/krebs.2.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/krebs.3.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/krebs.3.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/krebs.3.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/lann.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/lann.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/lann.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/loyd.1.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/loyd.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/loyd.1.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/loyd.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/loyd.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/loyd.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/peterson.2.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/peterson.2.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/peterson.2.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/peterson.2.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/peterson.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/peterson.2.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/peterson.3.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/peterson.3.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/peterson.3.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/peterson.3.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/peterson.3.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/peterson.3.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/protocols.1.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/protocols.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/protocols.1.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/protocols.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/protocols.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/protocols.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/protocols.2.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/protocols.2.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/protocols.2.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/protocols.2.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/protocols.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/protocols.2.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/protocols.3.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/protocols.3.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/protocols.3.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/protocols.3.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/protocols.3.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/protocols.3.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/protocols.4.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/protocols.4.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/protocols.4.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/protocols.4.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/protocols.4.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/protocols.4.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/protocols.5.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/protocols.5.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/protocols.5.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/protocols.5.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/protocols.5.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/protocols.5.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/resistance.1.prop1-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/resistance.1.prop1-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/resistance.1.prop1-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/resistance.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/resistance.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/resistance.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/resistance.1.prop2-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/resistance.1.prop2-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/resistance.1.prop2-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/resistance.1.prop2-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/resistance.1.prop2-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/resistance.1.prop2-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/resistance.1.prop3-back-serstep.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/resistance.1.prop3-back-serstep.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/resistance.1.prop3-back-serstep.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/resistance.1.prop3-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/resistance.1.prop3-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/resistance.1.prop3-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/resistance.2.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/resistance.2.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/resistance.2.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/resistance.2.prop2-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/resistance.2.prop2-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/resistance.2.prop2-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/resistance.2.prop3-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/resistance.2.prop3-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/resistance.2.prop3-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/schedule_world.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/schedule_world.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/schedule_world.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/btor/beem/train-gate.1.prop1-func-interl.btor "sally" "--parse-only" "/root/repo/test/regress/parser/btor/beem/train-gate.1.prop1-func-interl.btor")
+set_tests_properties(/root/repo/test/regress/parser/btor/beem/train-gate.1.prop1-func-interl.btor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example0.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example0.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example0.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example2.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example2.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example2.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example3.a.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example3.a.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example3.a.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example3.b.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example3.b.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example3.b.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example4.a.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example4.a.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example4.a.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example4.b.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example4.b.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example4.b.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example5.a.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example5.a.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example5.a.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example5.b.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example5.b.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example5.b.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example6.a.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example6.a.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example6.a.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example6.b.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example6.b.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example6.b.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example7.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example7.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example7.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/example8.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/example8.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/example8.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/input_test.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/input_test.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/input_test.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/let_test.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/let_test.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/let_test.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/mcmt_features_test.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/mcmt_features_test.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/mcmt_features_test.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/multi_check.mcmt "sally" "--engine" "kind" "/root/repo/test/regress/parser/mcmt/multi_check.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/multi_check.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+valid
+invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/parser/mcmt/real_int_test.mcmt "sally" "--parse-only" "/root/repo/test/regress/parser/mcmt/real_int_test.mcmt")
+set_tests_properties(/root/repo/test/regress/parser/mcmt/real_int_test.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/example0.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/pdkind/example0.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/example0.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/example1.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/pdkind/example1.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/example1.mcmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/example2.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/pdkind/example2.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/example2.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/example3.a.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/pdkind/example3.a.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/example3.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/example3.b.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/pdkind/example3.b.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/example3.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/example4.a.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/pdkind/example4.a.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/example4.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/example4.b.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/pdkind/example4.b.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/example4.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/example6.a.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/pdkind/example6.a.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/example6.a.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/example6.b.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/pdkind/example6.b.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/example6.b.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/example8.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/pdkind/example8.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/example8.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/example9.mcmt "sally" "--engine" "pdkind" "/root/repo/test/regress/pdkind/example9.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/example9.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/no_solver_reuse.mcmt "sally" "--engine" "pdkind" "--pdkind-induction-solver-garbage" "0" "/root/repo/test/regress/pdkind/no_solver_reuse.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/no_solver_reuse.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/subsumption.mcmt "sally" "--engine" "pdkind" "--pdkind-workers" "4" "--pdkind-deterministic" "--show-stats" "/root/repo/test/regress/pdkind/subsumption.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/subsumption.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+.*sally::pdkind::reachability_queries_saved = [1-9]" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/pdkind/workers.mcmt "sally" "--engine" "pdkind" "--pdkind-workers" "2" "--pdkind-deterministic" "/root/repo/test/regress/pdkind/workers.mcmt")
+set_tests_properties(/root/repo/test/regress/pdkind/workers.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "valid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/sim/counter.mcmt "sally" "--engine" "sim" "--sim-seed" "1" "/root/repo/test/regress/sim/counter.mcmt")
+set_tests_properties(/root/repo/test/regress/sim/counter.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+unknown
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+add_test(/root/repo/test/regress/sim/nondet.mcmt "sally" "--engine" "sim" "--sim-seed" "1" "/root/repo/test/regress/sim/nondet.mcmt")
+set_tests_properties(/root/repo/test/regress/sim/nondet.mcmt PROPERTIES  PASS_REGULAR_EXPRESSION "invalid
+" _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;116;add_test;/root/repo/src/CMakeLists.txt;0;")
+subdirs("utils")
+subdirs("expr")
+subdirs("smt")
+subdirs("system")
+subdirs("command")
+subdirs("parser")
+subdirs("ai")
+subdirs("engine")
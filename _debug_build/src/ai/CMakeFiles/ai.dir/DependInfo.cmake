@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ai/ai.cpp" "src/ai/CMakeFiles/ai.dir/ai.cpp.o" "gcc" "src/ai/CMakeFiles/ai.dir/ai.cpp.o.d"
+  "/root/repo/src/ai/crab/crab.cpp" "src/ai/CMakeFiles/ai.dir/crab/crab.cpp.o" "gcc" "src/ai/CMakeFiles/ai.dir/crab/crab.cpp.o.d"
+  "/root/repo/src/ai/crab/domains.cpp" "src/ai/CMakeFiles/ai.dir/crab/domains.cpp.o" "gcc" "src/ai/CMakeFiles/ai.dir/crab/domains.cpp.o.d"
+  "/root/repo/src/ai/factory.cpp" "src/ai/CMakeFiles/ai.dir/factory.cpp.o" "gcc" "src/ai/CMakeFiles/ai.dir/factory.cpp.o.d"
+  "/root/repo/src/ai/houdini/houdini.cpp" "src/ai/CMakeFiles/ai.dir/houdini/houdini.cpp.o" "gcc" "src/ai/CMakeFiles/ai.dir/houdini/houdini.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ai.dir/ai.cpp.o"
+  "CMakeFiles/ai.dir/ai.cpp.o.d"
+  "CMakeFiles/ai.dir/crab/crab.cpp.o"
+  "CMakeFiles/ai.dir/crab/crab.cpp.o.d"
+  "CMakeFiles/ai.dir/crab/domains.cpp.o"
+  "CMakeFiles/ai.dir/crab/domains.cpp.o.d"
+  "CMakeFiles/ai.dir/factory.cpp.o"
+  "CMakeFiles/ai.dir/factory.cpp.o.d"
+  "CMakeFiles/ai.dir/houdini/houdini.cpp.o"
+  "CMakeFiles/ai.dir/houdini/houdini.cpp.o.d"
+  "libai.a"
+  "libai.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ai.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/command/assume.cpp" "src/command/CMakeFiles/command.dir/assume.cpp.o" "gcc" "src/command/CMakeFiles/command.dir/assume.cpp.o.d"
+  "/root/repo/src/command/command.cpp" "src/command/CMakeFiles/command.dir/command.cpp.o" "gcc" "src/command/CMakeFiles/command.dir/command.cpp.o.d"
+  "/root/repo/src/command/declare_state_type.cpp" "src/command/CMakeFiles/command.dir/declare_state_type.cpp.o" "gcc" "src/command/CMakeFiles/command.dir/declare_state_type.cpp.o.d"
+  "/root/repo/src/command/define_states.cpp" "src/command/CMakeFiles/command.dir/define_states.cpp.o" "gcc" "src/command/CMakeFiles/command.dir/define_states.cpp.o.d"
+  "/root/repo/src/command/define_transition.cpp" "src/command/CMakeFiles/command.dir/define_transition.cpp.o" "gcc" "src/command/CMakeFiles/command.dir/define_transition.cpp.o.d"
+  "/root/repo/src/command/define_transition_system.cpp" "src/command/CMakeFiles/command.dir/define_transition_system.cpp.o" "gcc" "src/command/CMakeFiles/command.dir/define_transition_system.cpp.o.d"
+  "/root/repo/src/command/invariant.cpp" "src/command/CMakeFiles/command.dir/invariant.cpp.o" "gcc" "src/command/CMakeFiles/command.dir/invariant.cpp.o.d"
+  "/root/repo/src/command/liveness_query.cpp" "src/command/CMakeFiles/command.dir/liveness_query.cpp.o" "gcc" "src/command/CMakeFiles/command.dir/liveness_query.cpp.o.d"
+  "/root/repo/src/command/query.cpp" "src/command/CMakeFiles/command.dir/query.cpp.o" "gcc" "src/command/CMakeFiles/command.dir/query.cpp.o.d"
+  "/root/repo/src/command/sequence.cpp" "src/command/CMakeFiles/command.dir/sequence.cpp.o" "gcc" "src/command/CMakeFiles/command.dir/sequence.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/command.dir/assume.cpp.o"
+  "CMakeFiles/command.dir/assume.cpp.o.d"
+  "CMakeFiles/command.dir/command.cpp.o"
+  "CMakeFiles/command.dir/command.cpp.o.d"
+  "CMakeFiles/command.dir/declare_state_type.cpp.o"
+  "CMakeFiles/command.dir/declare_state_type.cpp.o.d"
+  "CMakeFiles/command.dir/define_states.cpp.o"
+  "CMakeFiles/command.dir/define_states.cpp.o.d"
+  "CMakeFiles/command.dir/define_transition.cpp.o"
+  "CMakeFiles/command.dir/define_transition.cpp.o.d"
+  "CMakeFiles/command.dir/define_transition_system.cpp.o"
+  "CMakeFiles/command.dir/define_transition_system.cpp.o.d"
+  "CMakeFiles/command.dir/invariant.cpp.o"
+  "CMakeFiles/command.dir/invariant.cpp.o.d"
+  "CMakeFiles/command.dir/liveness_query.cpp.o"
+  "CMakeFiles/command.dir/liveness_query.cpp.o.d"
+  "CMakeFiles/command.dir/query.cpp.o"
+  "CMakeFiles/command.dir/query.cpp.o.d"
+  "CMakeFiles/command.dir/sequence.cpp.o"
+  "CMakeFiles/command.dir/sequence.cpp.o.d"
+  "libcommand.a"
+  "libcommand.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/command.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/engine/aig/aig.cpp" "src/engine/CMakeFiles/engine.dir/aig/aig.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/aig/aig.cpp.o.d"
+  "/root/repo/src/engine/aig/aig_engine.cpp" "src/engine/CMakeFiles/engine.dir/aig/aig_engine.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/aig/aig_engine.cpp.o.d"
+  "/root/repo/src/engine/aig/sat_solver.cpp" "src/engine/CMakeFiles/engine.dir/aig/sat_solver.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/aig/sat_solver.cpp.o.d"
+  "/root/repo/src/engine/bmc/bmc_engine.cpp" "src/engine/CMakeFiles/engine.dir/bmc/bmc_engine.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/bmc/bmc_engine.cpp.o.d"
+  "/root/repo/src/engine/cache/cache_engine.cpp" "src/engine/CMakeFiles/engine.dir/cache/cache_engine.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/cache/cache_engine.cpp.o.d"
+  "/root/repo/src/engine/engine.cpp" "src/engine/CMakeFiles/engine.dir/engine.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/engine.cpp.o.d"
+  "/root/repo/src/engine/explicit_state/explicit_engine.cpp" "src/engine/CMakeFiles/engine.dir/explicit_state/explicit_engine.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/explicit_state/explicit_engine.cpp.o.d"
+  "/root/repo/src/engine/factory.cpp" "src/engine/CMakeFiles/engine.dir/factory.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/factory.cpp.o.d"
+  "/root/repo/src/engine/ic3/ic3_engine.cpp" "src/engine/CMakeFiles/engine.dir/ic3/ic3_engine.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/ic3/ic3_engine.cpp.o.d"
+  "/root/repo/src/engine/imc/imc_engine.cpp" "src/engine/CMakeFiles/engine.dir/imc/imc_engine.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/imc/imc_engine.cpp.o.d"
+  "/root/repo/src/engine/kind/kind_engine.cpp" "src/engine/CMakeFiles/engine.dir/kind/kind_engine.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/kind/kind_engine.cpp.o.d"
+  "/root/repo/src/engine/kliveness/kliveness_engine.cpp" "src/engine/CMakeFiles/engine.dir/kliveness/kliveness_engine.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/kliveness/kliveness_engine.cpp.o.d"
+  "/root/repo/src/engine/pdkind/cex_manager.cpp" "src/engine/CMakeFiles/engine.dir/pdkind/cex_manager.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/pdkind/cex_manager.cpp.o.d"
+  "/root/repo/src/engine/pdkind/checkpoint.cpp" "src/engine/CMakeFiles/engine.dir/pdkind/checkpoint.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/pdkind/checkpoint.cpp.o.d"
+  "/root/repo/src/engine/pdkind/induction_obligation.cpp" "src/engine/CMakeFiles/engine.dir/pdkind/induction_obligation.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/pdkind/induction_obligation.cpp.o.d"
+  "/root/repo/src/engine/pdkind/pdkind_engine.cpp" "src/engine/CMakeFiles/engine.dir/pdkind/pdkind_engine.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/pdkind/pdkind_engine.cpp.o.d"
+  "/root/repo/src/engine/pdkind/reachability.cpp" "src/engine/CMakeFiles/engine.dir/pdkind/reachability.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/pdkind/reachability.cpp.o.d"
+  "/root/repo/src/engine/pdkind/solvers.cpp" "src/engine/CMakeFiles/engine.dir/pdkind/solvers.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/pdkind/solvers.cpp.o.d"
+  "/root/repo/src/engine/pdkind/subsumption_index.cpp" "src/engine/CMakeFiles/engine.dir/pdkind/subsumption_index.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/pdkind/subsumption_index.cpp.o.d"
+  "/root/repo/src/engine/sim/sim_engine.cpp" "src/engine/CMakeFiles/engine.dir/sim/sim_engine.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/sim/sim_engine.cpp.o.d"
+  "/root/repo/src/engine/translator/translator.cpp" "src/engine/CMakeFiles/engine.dir/translator/translator.cpp.o" "gcc" "src/engine/CMakeFiles/engine.dir/translator/translator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/engine.dir/aig/aig.cpp.o"
+  "CMakeFiles/engine.dir/aig/aig.cpp.o.d"
+  "CMakeFiles/engine.dir/aig/aig_engine.cpp.o"
+  "CMakeFiles/engine.dir/aig/aig_engine.cpp.o.d"
+  "CMakeFiles/engine.dir/aig/sat_solver.cpp.o"
+  "CMakeFiles/engine.dir/aig/sat_solver.cpp.o.d"
+  "CMakeFiles/engine.dir/bmc/bmc_engine.cpp.o"
+  "CMakeFiles/engine.dir/bmc/bmc_engine.cpp.o.d"
+  "CMakeFiles/engine.dir/cache/cache_engine.cpp.o"
+  "CMakeFiles/engine.dir/cache/cache_engine.cpp.o.d"
+  "CMakeFiles/engine.dir/engine.cpp.o"
+  "CMakeFiles/engine.dir/engine.cpp.o.d"
+  "CMakeFiles/engine.dir/explicit_state/explicit_engine.cpp.o"
+  "CMakeFiles/engine.dir/explicit_state/explicit_engine.cpp.o.d"
+  "CMakeFiles/engine.dir/factory.cpp.o"
+  "CMakeFiles/engine.dir/factory.cpp.o.d"
+  "CMakeFiles/engine.dir/ic3/ic3_engine.cpp.o"
+  "CMakeFiles/engine.dir/ic3/ic3_engine.cpp.o.d"
+  "CMakeFiles/engine.dir/imc/imc_engine.cpp.o"
+  "CMakeFiles/engine.dir/imc/imc_engine.cpp.o.d"
+  "CMakeFiles/engine.dir/kind/kind_engine.cpp.o"
+  "CMakeFiles/engine.dir/kind/kind_engine.cpp.o.d"
+  "CMakeFiles/engine.dir/kliveness/kliveness_engine.cpp.o"
+  "CMakeFiles/engine.dir/kliveness/kliveness_engine.cpp.o.d"
+  "CMakeFiles/engine.dir/pdkind/cex_manager.cpp.o"
+  "CMakeFiles/engine.dir/pdkind/cex_manager.cpp.o.d"
+  "CMakeFiles/engine.dir/pdkind/checkpoint.cpp.o"
+  "CMakeFiles/engine.dir/pdkind/checkpoint.cpp.o.d"
+  "CMakeFiles/engine.dir/pdkind/induction_obligation.cpp.o"
+  "CMakeFiles/engine.dir/pdkind/induction_obligation.cpp.o.d"
+  "CMakeFiles/engine.dir/pdkind/pdkind_engine.cpp.o"
+  "CMakeFiles/engine.dir/pdkind/pdkind_engine.cpp.o.d"
+  "CMakeFiles/engine.dir/pdkind/reachability.cpp.o"
+  "CMakeFiles/engine.dir/pdkind/reachability.cpp.o.d"
+  "CMakeFiles/engine.dir/pdkind/solvers.cpp.o"
+  "CMakeFiles/engine.dir/pdkind/solvers.cpp.o.d"
+  "CMakeFiles/engine.dir/pdkind/subsumption_index.cpp.o"
+  "CMakeFiles/engine.dir/pdkind/subsumption_index.cpp.o.d"
+  "CMakeFiles/engine.dir/sim/sim_engine.cpp.o"
+  "CMakeFiles/engine.dir/sim/sim_engine.cpp.o.d"
+  "CMakeFiles/engine.dir/translator/translator.cpp.o"
+  "CMakeFiles/engine.dir/translator/translator.cpp.o.d"
+  "libengine.a"
+  "libengine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/engine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/expr/bitvector.cpp" "src/expr/CMakeFiles/expr.dir/bitvector.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/bitvector.cpp.o.d"
+  "/root/repo/src/expr/gc_participant.cpp" "src/expr/CMakeFiles/expr.dir/gc_participant.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/gc_participant.cpp.o.d"
+  "/root/repo/src/expr/gc_relocator.cpp" "src/expr/CMakeFiles/expr.dir/gc_relocator.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/gc_relocator.cpp.o.d"
+  "/root/repo/src/expr/integer.cpp" "src/expr/CMakeFiles/expr.dir/integer.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/integer.cpp.o.d"
+  "/root/repo/src/expr/model.cpp" "src/expr/CMakeFiles/expr.dir/model.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/model.cpp.o.d"
+  "/root/repo/src/expr/rational.cpp" "src/expr/CMakeFiles/expr.dir/rational.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/rational.cpp.o.d"
+  "/root/repo/src/expr/term.cpp" "src/expr/CMakeFiles/expr.dir/term.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/term.cpp.o.d"
+  "/root/repo/src/expr/term_manager.cpp" "src/expr/CMakeFiles/expr.dir/term_manager.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/term_manager.cpp.o.d"
+  "/root/repo/src/expr/term_manager_internal.cpp" "src/expr/CMakeFiles/expr.dir/term_manager_internal.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/term_manager_internal.cpp.o.d"
+  "/root/repo/src/expr/term_ops.cpp" "src/expr/CMakeFiles/expr.dir/term_ops.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/term_ops.cpp.o.d"
+  "/root/repo/src/expr/term_serializer.cpp" "src/expr/CMakeFiles/expr.dir/term_serializer.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/term_serializer.cpp.o.d"
+  "/root/repo/src/expr/type_computation_visitor.cpp" "src/expr/CMakeFiles/expr.dir/type_computation_visitor.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/type_computation_visitor.cpp.o.d"
+  "/root/repo/src/expr/value.cpp" "src/expr/CMakeFiles/expr.dir/value.cpp.o" "gcc" "src/expr/CMakeFiles/expr.dir/value.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/expr.dir/bitvector.cpp.o"
+  "CMakeFiles/expr.dir/bitvector.cpp.o.d"
+  "CMakeFiles/expr.dir/gc_participant.cpp.o"
+  "CMakeFiles/expr.dir/gc_participant.cpp.o.d"
+  "CMakeFiles/expr.dir/gc_relocator.cpp.o"
+  "CMakeFiles/expr.dir/gc_relocator.cpp.o.d"
+  "CMakeFiles/expr.dir/integer.cpp.o"
+  "CMakeFiles/expr.dir/integer.cpp.o.d"
+  "CMakeFiles/expr.dir/model.cpp.o"
+  "CMakeFiles/expr.dir/model.cpp.o.d"
+  "CMakeFiles/expr.dir/rational.cpp.o"
+  "CMakeFiles/expr.dir/rational.cpp.o.d"
+  "CMakeFiles/expr.dir/term.cpp.o"
+  "CMakeFiles/expr.dir/term.cpp.o.d"
+  "CMakeFiles/expr.dir/term_manager.cpp.o"
+  "CMakeFiles/expr.dir/term_manager.cpp.o.d"
+  "CMakeFiles/expr.dir/term_manager_internal.cpp.o"
+  "CMakeFiles/expr.dir/term_manager_internal.cpp.o.d"
+  "CMakeFiles/expr.dir/term_ops.cpp.o"
+  "CMakeFiles/expr.dir/term_ops.cpp.o.d"
+  "CMakeFiles/expr.dir/term_serializer.cpp.o"
+  "CMakeFiles/expr.dir/term_serializer.cpp.o.d"
+  "CMakeFiles/expr.dir/type_computation_visitor.cpp.o"
+  "CMakeFiles/expr.dir/type_computation_visitor.cpp.o.d"
+  "CMakeFiles/expr.dir/value.cpp.o"
+  "CMakeFiles/expr.dir/value.cpp.o.d"
+  "libexpr.a"
+  "libexpr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/expr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
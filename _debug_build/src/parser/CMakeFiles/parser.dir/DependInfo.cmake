@@ -0,0 +1,60 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/parser/aiger/aiger-1.9.4/aiger.c" "src/parser/CMakeFiles/parser.dir/aiger/aiger-1.9.4/aiger.c.o" "gcc" "src/parser/CMakeFiles/parser.dir/aiger/aiger-1.9.4/aiger.c.o.d"
+  "/root/repo/src/parser/aiger/aiger.cpp" "src/parser/CMakeFiles/parser.dir/aiger/aiger.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/aiger/aiger.cpp.o.d"
+  "/root/repo/src/parser/btor/btor.cpp" "src/parser/CMakeFiles/parser.dir/btor/btor.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/btor/btor.cpp.o.d"
+  "/root/repo/src/parser/btor/btorLexer.c" "src/parser/CMakeFiles/parser.dir/btor/btorLexer.c.o" "gcc" "src/parser/CMakeFiles/parser.dir/btor/btorLexer.c.o.d"
+  "/root/repo/src/parser/btor/btorParser.c" "src/parser/CMakeFiles/parser.dir/btor/btorParser.c.o" "gcc" "src/parser/CMakeFiles/parser.dir/btor/btorParser.c.o.d"
+  "/root/repo/src/parser/btor/btor_state.cpp" "src/parser/CMakeFiles/parser.dir/btor/btor_state.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/btor/btor_state.cpp.o.d"
+  "/root/repo/src/parser/mcmt/mcmt.cpp" "src/parser/CMakeFiles/parser.dir/mcmt/mcmt.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/mcmt/mcmt.cpp.o.d"
+  "/root/repo/src/parser/mcmt/mcmtLexer.c" "src/parser/CMakeFiles/parser.dir/mcmt/mcmtLexer.c.o" "gcc" "src/parser/CMakeFiles/parser.dir/mcmt/mcmtLexer.c.o.d"
+  "/root/repo/src/parser/mcmt/mcmtParser.c" "src/parser/CMakeFiles/parser.dir/mcmt/mcmtParser.c.o" "gcc" "src/parser/CMakeFiles/parser.dir/mcmt/mcmtParser.c.o.d"
+  "/root/repo/src/parser/mcmt/mcmt_state.cpp" "src/parser/CMakeFiles/parser.dir/mcmt/mcmt_state.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/mcmt/mcmt_state.cpp.o.d"
+  "/root/repo/src/parser/parser.cpp" "src/parser/CMakeFiles/parser.dir/parser.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/parser.cpp.o.d"
+  "/root/repo/src/parser/sal/sal.cpp" "src/parser/CMakeFiles/parser.dir/sal/sal.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/sal/sal.cpp.o.d"
+  "/root/repo/src/parser/sal/salLexer.c" "src/parser/CMakeFiles/parser.dir/sal/salLexer.c.o" "gcc" "src/parser/CMakeFiles/parser.dir/sal/salLexer.c.o.d"
+  "/root/repo/src/parser/sal/salParser.c" "src/parser/CMakeFiles/parser.dir/sal/salParser.c.o" "gcc" "src/parser/CMakeFiles/parser.dir/sal/salParser.c.o.d"
+  "/root/repo/src/parser/sal/sal_context.cpp" "src/parser/CMakeFiles/parser.dir/sal/sal_context.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/sal/sal_context.cpp.o.d"
+  "/root/repo/src/parser/sal/sal_module.cpp" "src/parser/CMakeFiles/parser.dir/sal/sal_module.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/sal/sal_module.cpp.o.d"
+  "/root/repo/src/parser/sal/sal_state.cpp" "src/parser/CMakeFiles/parser.dir/sal/sal_state.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/sal/sal_state.cpp.o.d"
+  "/root/repo/src/parser/smt2/smt2.cpp" "src/parser/CMakeFiles/parser.dir/smt2/smt2.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/smt2/smt2.cpp.o.d"
+  "/root/repo/src/parser/smt2/smt2Lexer.c" "src/parser/CMakeFiles/parser.dir/smt2/smt2Lexer.c.o" "gcc" "src/parser/CMakeFiles/parser.dir/smt2/smt2Lexer.c.o.d"
+  "/root/repo/src/parser/smt2/smt2Parser.c" "src/parser/CMakeFiles/parser.dir/smt2/smt2Parser.c.o" "gcc" "src/parser/CMakeFiles/parser.dir/smt2/smt2Parser.c.o.d"
+  "/root/repo/src/parser/smt2/smt2_state.cpp" "src/parser/CMakeFiles/parser.dir/smt2/smt2_state.cpp.o" "gcc" "src/parser/CMakeFiles/parser.dir/smt2/smt2_state.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/src/parser/btor/btor.tokens" "/root/repo/src/parser/btor/btorParser.h"
+  "/root/repo/src/parser/btor/btorLexer.c" "/root/repo/src/parser/btor/btorParser.h"
+  "/root/repo/src/parser/btor/btorLexer.h" "/root/repo/src/parser/btor/btorParser.h"
+  "/root/repo/src/parser/btor/btorParser.c" "/root/repo/src/parser/btor/btorParser.h"
+  "/root/repo/src/parser/mcmt/mcmt.tokens" "/root/repo/src/parser/mcmt/mcmtParser.h"
+  "/root/repo/src/parser/mcmt/mcmtLexer.c" "/root/repo/src/parser/mcmt/mcmtParser.h"
+  "/root/repo/src/parser/mcmt/mcmtLexer.h" "/root/repo/src/parser/mcmt/mcmtParser.h"
+  "/root/repo/src/parser/mcmt/mcmtParser.c" "/root/repo/src/parser/mcmt/mcmtParser.h"
+  "/root/repo/src/parser/sal/sal.tokens" "/root/repo/src/parser/sal/salParser.h"
+  "/root/repo/src/parser/sal/salLexer.c" "/root/repo/src/parser/sal/salParser.h"
+  "/root/repo/src/parser/sal/salLexer.h" "/root/repo/src/parser/sal/salParser.h"
+  "/root/repo/src/parser/sal/salParser.c" "/root/repo/src/parser/sal/salParser.h"
+  "/root/repo/src/parser/smt2/smt2.tokens" "/root/repo/src/parser/smt2/smt2Parser.h"
+  "/root/repo/src/parser/smt2/smt2Lexer.c" "/root/repo/src/parser/smt2/smt2Parser.h"
+  "/root/repo/src/parser/smt2/smt2Lexer.h" "/root/repo/src/parser/smt2/smt2Parser.h"
+  "/root/repo/src/parser/smt2/smt2Parser.c" "/root/repo/src/parser/smt2/smt2Parser.h"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,71 @@
+file(REMOVE_RECURSE
+  "/root/repo/src/parser/btor/btor.tokens"
+  "/root/repo/src/parser/btor/btorLexer.c"
+  "/root/repo/src/parser/btor/btorLexer.h"
+  "/root/repo/src/parser/btor/btorParser.c"
+  "/root/repo/src/parser/btor/btorParser.h"
+  "/root/repo/src/parser/mcmt/mcmt.tokens"
+  "/root/repo/src/parser/mcmt/mcmtLexer.c"
+  "/root/repo/src/parser/mcmt/mcmtLexer.h"
+  "/root/repo/src/parser/mcmt/mcmtParser.c"
+  "/root/repo/src/parser/mcmt/mcmtParser.h"
+  "/root/repo/src/parser/sal/sal.tokens"
+  "/root/repo/src/parser/sal/salLexer.c"
+  "/root/repo/src/parser/sal/salLexer.h"
+  "/root/repo/src/parser/sal/salParser.c"
+  "/root/repo/src/parser/sal/salParser.h"
+  "/root/repo/src/parser/smt2/smt2.tokens"
+  "/root/repo/src/parser/smt2/smt2Lexer.c"
+  "/root/repo/src/parser/smt2/smt2Lexer.h"
+  "/root/repo/src/parser/smt2/smt2Parser.c"
+  "/root/repo/src/parser/smt2/smt2Parser.h"
+  "CMakeFiles/parser.dir/aiger/aiger-1.9.4/aiger.c.o"
+  "CMakeFiles/parser.dir/aiger/aiger-1.9.4/aiger.c.o.d"
+  "CMakeFiles/parser.dir/aiger/aiger.cpp.o"
+  "CMakeFiles/parser.dir/aiger/aiger.cpp.o.d"
+  "CMakeFiles/parser.dir/btor/btor.cpp.o"
+  "CMakeFiles/parser.dir/btor/btor.cpp.o.d"
+  "CMakeFiles/parser.dir/btor/btorLexer.c.o"
+  "CMakeFiles/parser.dir/btor/btorLexer.c.o.d"
+  "CMakeFiles/parser.dir/btor/btorParser.c.o"
+  "CMakeFiles/parser.dir/btor/btorParser.c.o.d"
+  "CMakeFiles/parser.dir/btor/btor_state.cpp.o"
+  "CMakeFiles/parser.dir/btor/btor_state.cpp.o.d"
+  "CMakeFiles/parser.dir/mcmt/mcmt.cpp.o"
+  "CMakeFiles/parser.dir/mcmt/mcmt.cpp.o.d"
+  "CMakeFiles/parser.dir/mcmt/mcmtLexer.c.o"
+  "CMakeFiles/parser.dir/mcmt/mcmtLexer.c.o.d"
+  "CMakeFiles/parser.dir/mcmt/mcmtParser.c.o"
+  "CMakeFiles/parser.dir/mcmt/mcmtParser.c.o.d"
+  "CMakeFiles/parser.dir/mcmt/mcmt_state.cpp.o"
+  "CMakeFiles/parser.dir/mcmt/mcmt_state.cpp.o.d"
+  "CMakeFiles/parser.dir/parser.cpp.o"
+  "CMakeFiles/parser.dir/parser.cpp.o.d"
+  "CMakeFiles/parser.dir/sal/sal.cpp.o"
+  "CMakeFiles/parser.dir/sal/sal.cpp.o.d"
+  "CMakeFiles/parser.dir/sal/salLexer.c.o"
+  "CMakeFiles/parser.dir/sal/salLexer.c.o.d"
+  "CMakeFiles/parser.dir/sal/salParser.c.o"
+  "CMakeFiles/parser.dir/sal/salParser.c.o.d"
+  "CMakeFiles/parser.dir/sal/sal_context.cpp.o"
+  "CMakeFiles/parser.dir/sal/sal_context.cpp.o.d"
+  "CMakeFiles/parser.dir/sal/sal_module.cpp.o"
+  "CMakeFiles/parser.dir/sal/sal_module.cpp.o.d"
+  "CMakeFiles/parser.dir/sal/sal_state.cpp.o"
+  "CMakeFiles/parser.dir/sal/sal_state.cpp.o.d"
+  "CMakeFiles/parser.dir/smt2/smt2.cpp.o"
+  "CMakeFiles/parser.dir/smt2/smt2.cpp.o.d"
+  "CMakeFiles/parser.dir/smt2/smt2Lexer.c.o"
+  "CMakeFiles/parser.dir/smt2/smt2Lexer.c.o.d"
+  "CMakeFiles/parser.dir/smt2/smt2Parser.c.o"
+  "CMakeFiles/parser.dir/smt2/smt2Parser.c.o.d"
+  "CMakeFiles/parser.dir/smt2/smt2_state.cpp.o"
+  "CMakeFiles/parser.dir/smt2/smt2_state.cpp.o.d"
+  "libparser.a"
+  "libparser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
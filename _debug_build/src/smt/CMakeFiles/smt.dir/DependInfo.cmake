@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/smt/async_check.cpp" "src/smt/CMakeFiles/smt.dir/async_check.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/async_check.cpp.o.d"
+  "/root/repo/src/smt/cache_wrapper.cpp" "src/smt/CMakeFiles/smt.dir/cache_wrapper.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/cache_wrapper.cpp.o.d"
+  "/root/repo/src/smt/d4y2/d4y2.cpp" "src/smt/CMakeFiles/smt.dir/d4y2/d4y2.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/d4y2/d4y2.cpp.o.d"
+  "/root/repo/src/smt/delayed_wrapper.cpp" "src/smt/CMakeFiles/smt.dir/delayed_wrapper.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/delayed_wrapper.cpp.o.d"
+  "/root/repo/src/smt/dreal/dreal.cpp" "src/smt/CMakeFiles/smt.dir/dreal/dreal.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/dreal/dreal.cpp.o.d"
+  "/root/repo/src/smt/dreal/dreal_internal.cpp" "src/smt/CMakeFiles/smt.dir/dreal/dreal_internal.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/dreal/dreal_internal.cpp.o.d"
+  "/root/repo/src/smt/dreal/dreal_term.cpp" "src/smt/CMakeFiles/smt.dir/dreal/dreal_term.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/dreal/dreal_term.cpp.o.d"
+  "/root/repo/src/smt/dreal/dreal_term_cache.cpp" "src/smt/CMakeFiles/smt.dir/dreal/dreal_term_cache.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/dreal/dreal_term_cache.cpp.o.d"
+  "/root/repo/src/smt/factory.cpp" "src/smt/CMakeFiles/smt.dir/factory.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/factory.cpp.o.d"
+  "/root/repo/src/smt/generic/generic_solver.cpp" "src/smt/CMakeFiles/smt.dir/generic/generic_solver.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/generic/generic_solver.cpp.o.d"
+  "/root/repo/src/smt/incremental_wrapper.cpp" "src/smt/CMakeFiles/smt.dir/incremental_wrapper.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/incremental_wrapper.cpp.o.d"
+  "/root/repo/src/smt/mathsat5/mathsat5.cpp" "src/smt/CMakeFiles/smt.dir/mathsat5/mathsat5.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/mathsat5/mathsat5.cpp.o.d"
+  "/root/repo/src/smt/mathsat5/mathsat5_term_cache.cpp" "src/smt/CMakeFiles/smt.dir/mathsat5/mathsat5_term_cache.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/mathsat5/mathsat5_term_cache.cpp.o.d"
+  "/root/repo/src/smt/opensmt2/opensmt2.cpp" "src/smt/CMakeFiles/smt.dir/opensmt2/opensmt2.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/opensmt2/opensmt2.cpp.o.d"
+  "/root/repo/src/smt/opensmt2/opensmt2_internal.cpp" "src/smt/CMakeFiles/smt.dir/opensmt2/opensmt2_internal.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/opensmt2/opensmt2_internal.cpp.o.d"
+  "/root/repo/src/smt/opensmt2/opensmt2_term_cache.cpp" "src/smt/CMakeFiles/smt.dir/opensmt2/opensmt2_term_cache.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/opensmt2/opensmt2_term_cache.cpp.o.d"
+  "/root/repo/src/smt/smt2_log.cpp" "src/smt/CMakeFiles/smt.dir/smt2_log.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt2_log.cpp.o.d"
+  "/root/repo/src/smt/smt2_output_wrapper.cpp" "src/smt/CMakeFiles/smt.dir/smt2_output_wrapper.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt2_output_wrapper.cpp.o.d"
+  "/root/repo/src/smt/smt2_replay.cpp" "src/smt/CMakeFiles/smt.dir/smt2_replay.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt2_replay.cpp.o.d"
+  "/root/repo/src/smt/solver.cpp" "src/smt/CMakeFiles/smt.dir/solver.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/solver.cpp.o.d"
+  "/root/repo/src/smt/solver_pool.cpp" "src/smt/CMakeFiles/smt.dir/solver_pool.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/solver_pool.cpp.o.d"
+  "/root/repo/src/smt/y2m5/y2m5.cpp" "src/smt/CMakeFiles/smt.dir/y2m5/y2m5.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/y2m5/y2m5.cpp.o.d"
+  "/root/repo/src/smt/y2o2/y2o2.cpp" "src/smt/CMakeFiles/smt.dir/y2o2/y2o2.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/y2o2/y2o2.cpp.o.d"
+  "/root/repo/src/smt/y2z3/y2z3.cpp" "src/smt/CMakeFiles/smt.dir/y2z3/y2z3.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/y2z3/y2z3.cpp.o.d"
+  "/root/repo/src/smt/yices2/yices2.cpp" "src/smt/CMakeFiles/smt.dir/yices2/yices2.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/yices2/yices2.cpp.o.d"
+  "/root/repo/src/smt/yices2/yices2_internal.cpp" "src/smt/CMakeFiles/smt.dir/yices2/yices2_internal.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/yices2/yices2_internal.cpp.o.d"
+  "/root/repo/src/smt/yices2/yices2_term_cache.cpp" "src/smt/CMakeFiles/smt.dir/yices2/yices2_term_cache.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/yices2/yices2_term_cache.cpp.o.d"
+  "/root/repo/src/smt/z3/z3.cpp" "src/smt/CMakeFiles/smt.dir/z3/z3.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/z3/z3.cpp.o.d"
+  "/root/repo/src/smt/z3/z3_common.cpp" "src/smt/CMakeFiles/smt.dir/z3/z3_common.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/z3/z3_common.cpp.o.d"
+  "/root/repo/src/smt/z3/z3_internal.cpp" "src/smt/CMakeFiles/smt.dir/z3/z3_internal.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/z3/z3_internal.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,69 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smt.dir/async_check.cpp.o"
+  "CMakeFiles/smt.dir/async_check.cpp.o.d"
+  "CMakeFiles/smt.dir/cache_wrapper.cpp.o"
+  "CMakeFiles/smt.dir/cache_wrapper.cpp.o.d"
+  "CMakeFiles/smt.dir/d4y2/d4y2.cpp.o"
+  "CMakeFiles/smt.dir/d4y2/d4y2.cpp.o.d"
+  "CMakeFiles/smt.dir/delayed_wrapper.cpp.o"
+  "CMakeFiles/smt.dir/delayed_wrapper.cpp.o.d"
+  "CMakeFiles/smt.dir/dreal/dreal.cpp.o"
+  "CMakeFiles/smt.dir/dreal/dreal.cpp.o.d"
+  "CMakeFiles/smt.dir/dreal/dreal_internal.cpp.o"
+  "CMakeFiles/smt.dir/dreal/dreal_internal.cpp.o.d"
+  "CMakeFiles/smt.dir/dreal/dreal_term.cpp.o"
+  "CMakeFiles/smt.dir/dreal/dreal_term.cpp.o.d"
+  "CMakeFiles/smt.dir/dreal/dreal_term_cache.cpp.o"
+  "CMakeFiles/smt.dir/dreal/dreal_term_cache.cpp.o.d"
+  "CMakeFiles/smt.dir/factory.cpp.o"
+  "CMakeFiles/smt.dir/factory.cpp.o.d"
+  "CMakeFiles/smt.dir/generic/generic_solver.cpp.o"
+  "CMakeFiles/smt.dir/generic/generic_solver.cpp.o.d"
+  "CMakeFiles/smt.dir/incremental_wrapper.cpp.o"
+  "CMakeFiles/smt.dir/incremental_wrapper.cpp.o.d"
+  "CMakeFiles/smt.dir/mathsat5/mathsat5.cpp.o"
+  "CMakeFiles/smt.dir/mathsat5/mathsat5.cpp.o.d"
+  "CMakeFiles/smt.dir/mathsat5/mathsat5_term_cache.cpp.o"
+  "CMakeFiles/smt.dir/mathsat5/mathsat5_term_cache.cpp.o.d"
+  "CMakeFiles/smt.dir/opensmt2/opensmt2.cpp.o"
+  "CMakeFiles/smt.dir/opensmt2/opensmt2.cpp.o.d"
+  "CMakeFiles/smt.dir/opensmt2/opensmt2_internal.cpp.o"
+  "CMakeFiles/smt.dir/opensmt2/opensmt2_internal.cpp.o.d"
+  "CMakeFiles/smt.dir/opensmt2/opensmt2_term_cache.cpp.o"
+  "CMakeFiles/smt.dir/opensmt2/opensmt2_term_cache.cpp.o.d"
+  "CMakeFiles/smt.dir/smt2_log.cpp.o"
+  "CMakeFiles/smt.dir/smt2_log.cpp.o.d"
+  "CMakeFiles/smt.dir/smt2_output_wrapper.cpp.o"
+  "CMakeFiles/smt.dir/smt2_output_wrapper.cpp.o.d"
+  "CMakeFiles/smt.dir/smt2_replay.cpp.o"
+  "CMakeFiles/smt.dir/smt2_replay.cpp.o.d"
+  "CMakeFiles/smt.dir/solver.cpp.o"
+  "CMakeFiles/smt.dir/solver.cpp.o.d"
+  "CMakeFiles/smt.dir/solver_pool.cpp.o"
+  "CMakeFiles/smt.dir/solver_pool.cpp.o.d"
+  "CMakeFiles/smt.dir/y2m5/y2m5.cpp.o"
+  "CMakeFiles/smt.dir/y2m5/y2m5.cpp.o.d"
+  "CMakeFiles/smt.dir/y2o2/y2o2.cpp.o"
+  "CMakeFiles/smt.dir/y2o2/y2o2.cpp.o.d"
+  "CMakeFiles/smt.dir/y2z3/y2z3.cpp.o"
+  "CMakeFiles/smt.dir/y2z3/y2z3.cpp.o.d"
+  "CMakeFiles/smt.dir/yices2/yices2.cpp.o"
+  "CMakeFiles/smt.dir/yices2/yices2.cpp.o.d"
+  "CMakeFiles/smt.dir/yices2/yices2_internal.cpp.o"
+  "CMakeFiles/smt.dir/yices2/yices2_internal.cpp.o.d"
+  "CMakeFiles/smt.dir/yices2/yices2_term_cache.cpp.o"
+  "CMakeFiles/smt.dir/yices2/yices2_term_cache.cpp.o.d"
+  "CMakeFiles/smt.dir/z3/z3.cpp.o"
+  "CMakeFiles/smt.dir/z3/z3.cpp.o.d"
+  "CMakeFiles/smt.dir/z3/z3_common.cpp.o"
+  "CMakeFiles/smt.dir/z3/z3_common.cpp.o.d"
+  "CMakeFiles/smt.dir/z3/z3_internal.cpp.o"
+  "CMakeFiles/smt.dir/z3/z3_internal.cpp.o.d"
+  "libsmt.a"
+  "libsmt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/system/context.cpp" "src/system/CMakeFiles/system.dir/context.cpp.o" "gcc" "src/system/CMakeFiles/system.dir/context.cpp.o.d"
+  "/root/repo/src/system/state_formula.cpp" "src/system/CMakeFiles/system.dir/state_formula.cpp.o" "gcc" "src/system/CMakeFiles/system.dir/state_formula.cpp.o.d"
+  "/root/repo/src/system/state_type.cpp" "src/system/CMakeFiles/system.dir/state_type.cpp.o" "gcc" "src/system/CMakeFiles/system.dir/state_type.cpp.o.d"
+  "/root/repo/src/system/trace_helper.cpp" "src/system/CMakeFiles/system.dir/trace_helper.cpp.o" "gcc" "src/system/CMakeFiles/system.dir/trace_helper.cpp.o.d"
+  "/root/repo/src/system/transition_formula.cpp" "src/system/CMakeFiles/system.dir/transition_formula.cpp.o" "gcc" "src/system/CMakeFiles/system.dir/transition_formula.cpp.o.d"
+  "/root/repo/src/system/transition_functions.cpp" "src/system/CMakeFiles/system.dir/transition_functions.cpp.o" "gcc" "src/system/CMakeFiles/system.dir/transition_functions.cpp.o.d"
+  "/root/repo/src/system/transition_system.cpp" "src/system/CMakeFiles/system.dir/transition_system.cpp.o" "gcc" "src/system/CMakeFiles/system.dir/transition_system.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
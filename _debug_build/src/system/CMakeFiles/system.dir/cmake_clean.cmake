@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/system.dir/context.cpp.o"
+  "CMakeFiles/system.dir/context.cpp.o.d"
+  "CMakeFiles/system.dir/state_formula.cpp.o"
+  "CMakeFiles/system.dir/state_formula.cpp.o.d"
+  "CMakeFiles/system.dir/state_type.cpp.o"
+  "CMakeFiles/system.dir/state_type.cpp.o.d"
+  "CMakeFiles/system.dir/trace_helper.cpp.o"
+  "CMakeFiles/system.dir/trace_helper.cpp.o.d"
+  "CMakeFiles/system.dir/transition_formula.cpp.o"
+  "CMakeFiles/system.dir/transition_formula.cpp.o.d"
+  "CMakeFiles/system.dir/transition_functions.cpp.o"
+  "CMakeFiles/system.dir/transition_functions.cpp.o.d"
+  "CMakeFiles/system.dir/transition_system.cpp.o"
+  "CMakeFiles/system.dir/transition_system.cpp.o.d"
+  "libsystem.a"
+  "libsystem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/system.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
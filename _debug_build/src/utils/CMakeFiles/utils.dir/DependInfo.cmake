@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utils/budget.cpp" "src/utils/CMakeFiles/utils.dir/budget.cpp.o" "gcc" "src/utils/CMakeFiles/utils.dir/budget.cpp.o.d"
+  "/root/repo/src/utils/exception.cpp" "src/utils/CMakeFiles/utils.dir/exception.cpp.o" "gcc" "src/utils/CMakeFiles/utils.dir/exception.cpp.o.d"
+  "/root/repo/src/utils/options.cpp" "src/utils/CMakeFiles/utils.dir/options.cpp.o" "gcc" "src/utils/CMakeFiles/utils.dir/options.cpp.o.d"
+  "/root/repo/src/utils/output.cpp" "src/utils/CMakeFiles/utils.dir/output.cpp.o" "gcc" "src/utils/CMakeFiles/utils.dir/output.cpp.o.d"
+  "/root/repo/src/utils/statistics.cpp" "src/utils/CMakeFiles/utils.dir/statistics.cpp.o" "gcc" "src/utils/CMakeFiles/utils.dir/statistics.cpp.o.d"
+  "/root/repo/src/utils/string.cpp" "src/utils/CMakeFiles/utils.dir/string.cpp.o" "gcc" "src/utils/CMakeFiles/utils.dir/string.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
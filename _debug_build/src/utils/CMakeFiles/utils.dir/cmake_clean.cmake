@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utils.dir/budget.cpp.o"
+  "CMakeFiles/utils.dir/budget.cpp.o.d"
+  "CMakeFiles/utils.dir/exception.cpp.o"
+  "CMakeFiles/utils.dir/exception.cpp.o.d"
+  "CMakeFiles/utils.dir/options.cpp.o"
+  "CMakeFiles/utils.dir/options.cpp.o.d"
+  "CMakeFiles/utils.dir/output.cpp.o"
+  "CMakeFiles/utils.dir/output.cpp.o.d"
+  "CMakeFiles/utils.dir/statistics.cpp.o"
+  "CMakeFiles/utils.dir/statistics.cpp.o.d"
+  "CMakeFiles/utils.dir/string.cpp.o"
+  "CMakeFiles/utils.dir/string.cpp.o.d"
+  "libutils.a"
+  "libutils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
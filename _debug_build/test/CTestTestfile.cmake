@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_debug_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("unit")
+subdirs("regress")
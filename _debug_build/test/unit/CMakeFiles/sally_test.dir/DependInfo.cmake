@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit/test_runner.cpp" "test/unit/CMakeFiles/sally_test.dir/test_runner.cpp.o" "gcc" "test/unit/CMakeFiles/sally_test.dir/test_runner.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/test/unit/engine/CMakeFiles/engine_test.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/test/unit/smt/CMakeFiles/smt_test.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/test/unit/expr/CMakeFiles/expr_test.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/engine/CMakeFiles/engine.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/system/CMakeFiles/system.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/smt/CMakeFiles/smt.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/expr/CMakeFiles/expr.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/utils/CMakeFiles/utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
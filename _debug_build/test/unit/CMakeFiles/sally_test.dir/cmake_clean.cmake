@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sally_test.dir/test_runner.cpp.o"
+  "CMakeFiles/sally_test.dir/test_runner.cpp.o.d"
+  "sally_test"
+  "sally_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sally_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/unit
+# Build directory: /root/repo/_debug_build/test/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit_tests "sally_test" "-i")
+set_tests_properties(unit_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;56;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+subdirs("expr")
+subdirs("smt")
+subdirs("engine")
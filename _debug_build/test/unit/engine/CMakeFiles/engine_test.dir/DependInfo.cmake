@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit/engine/pdkind_solvers_test.cpp" "test/unit/engine/CMakeFiles/engine_test.dir/pdkind_solvers_test.cpp.o" "gcc" "test/unit/engine/CMakeFiles/engine_test.dir/pdkind_solvers_test.cpp.o.d"
+  "/root/repo/test/unit/engine/subsumption_index_test.cpp" "test/unit/engine/CMakeFiles/engine_test.dir/subsumption_index_test.cpp.o" "gcc" "test/unit/engine/CMakeFiles/engine_test.dir/subsumption_index_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/engine_test.dir/pdkind_solvers_test.cpp.o"
+  "CMakeFiles/engine_test.dir/pdkind_solvers_test.cpp.o.d"
+  "CMakeFiles/engine_test.dir/subsumption_index_test.cpp.o"
+  "CMakeFiles/engine_test.dir/subsumption_index_test.cpp.o.d"
+  "libengine_test.a"
+  "libengine_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/engine_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
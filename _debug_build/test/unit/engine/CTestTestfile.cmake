@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/unit/engine
+# Build directory: /root/repo/_debug_build/test/unit/engine
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/expr_test.dir/term_manager_test.cpp.o"
+  "CMakeFiles/expr_test.dir/term_manager_test.cpp.o.d"
+  "CMakeFiles/expr_test.dir/term_serializer_test.cpp.o"
+  "CMakeFiles/expr_test.dir/term_serializer_test.cpp.o.d"
+  "libexpr_test.a"
+  "libexpr_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/expr_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit/smt/async_test.cpp" "test/unit/smt/CMakeFiles/smt_test.dir/async_test.cpp.o" "gcc" "test/unit/smt/CMakeFiles/smt_test.dir/async_test.cpp.o.d"
+  "/root/repo/test/unit/smt/cache_test.cpp" "test/unit/smt/CMakeFiles/smt_test.dir/cache_test.cpp.o" "gcc" "test/unit/smt/CMakeFiles/smt_test.dir/cache_test.cpp.o.d"
+  "/root/repo/test/unit/smt/dreal_test.cpp" "test/unit/smt/CMakeFiles/smt_test.dir/dreal_test.cpp.o" "gcc" "test/unit/smt/CMakeFiles/smt_test.dir/dreal_test.cpp.o.d"
+  "/root/repo/test/unit/smt/mathsat5_test.cpp" "test/unit/smt/CMakeFiles/smt_test.dir/mathsat5_test.cpp.o" "gcc" "test/unit/smt/CMakeFiles/smt_test.dir/mathsat5_test.cpp.o.d"
+  "/root/repo/test/unit/smt/pool_test.cpp" "test/unit/smt/CMakeFiles/smt_test.dir/pool_test.cpp.o" "gcc" "test/unit/smt/CMakeFiles/smt_test.dir/pool_test.cpp.o.d"
+  "/root/repo/test/unit/smt/smt2_log_test.cpp" "test/unit/smt/CMakeFiles/smt_test.dir/smt2_log_test.cpp.o" "gcc" "test/unit/smt/CMakeFiles/smt_test.dir/smt2_log_test.cpp.o.d"
+  "/root/repo/test/unit/smt/yices2_test.cpp" "test/unit/smt/CMakeFiles/smt_test.dir/yices2_test.cpp.o" "gcc" "test/unit/smt/CMakeFiles/smt_test.dir/yices2_test.cpp.o.d"
+  "/root/repo/test/unit/smt/z3_test.cpp" "test/unit/smt/CMakeFiles/smt_test.dir/z3_test.cpp.o" "gcc" "test/unit/smt/CMakeFiles/smt_test.dir/z3_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
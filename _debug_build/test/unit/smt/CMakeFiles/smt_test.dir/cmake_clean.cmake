@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smt_test.dir/async_test.cpp.o"
+  "CMakeFiles/smt_test.dir/async_test.cpp.o.d"
+  "CMakeFiles/smt_test.dir/cache_test.cpp.o"
+  "CMakeFiles/smt_test.dir/cache_test.cpp.o.d"
+  "CMakeFiles/smt_test.dir/dreal_test.cpp.o"
+  "CMakeFiles/smt_test.dir/dreal_test.cpp.o.d"
+  "CMakeFiles/smt_test.dir/mathsat5_test.cpp.o"
+  "CMakeFiles/smt_test.dir/mathsat5_test.cpp.o.d"
+  "CMakeFiles/smt_test.dir/pool_test.cpp.o"
+  "CMakeFiles/smt_test.dir/pool_test.cpp.o.d"
+  "CMakeFiles/smt_test.dir/smt2_log_test.cpp.o"
+  "CMakeFiles/smt_test.dir/smt2_log_test.cpp.o.d"
+  "CMakeFiles/smt_test.dir/yices2_test.cpp.o"
+  "CMakeFiles/smt_test.dir/yices2_test.cpp.o.d"
+  "CMakeFiles/smt_test.dir/z3_test.cpp.o"
+  "CMakeFiles/smt_test.dir/z3_test.cpp.o.d"
+  "libsmt_test.a"
+  "libsmt_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smt_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
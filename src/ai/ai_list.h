@@ -23,8 +23,10 @@
 //
 
 #include "ai/crab/crab_info.h"
+#include "ai/houdini/houdini_info.h"
 
 sally::ai::interpreter_data::interpreter_data() {
   add_module_info<ai::crab_info>();
+  add_module_info<ai::houdini_info>();
 }
 
@@ -18,19 +18,460 @@
 
 #include "crab.h"
 
+#include "smt/factory.h"
 #include "utils/trace.h"
+#include "utils/exception.h"
+
+#include <iostream>
 
 namespace sally {
 namespace ai {
 
 crab::crab(const system::context& ctx)
 : abstract_interpreter(ctx)
+, d_state_size(0)
 {
-  // Construct crab
+  d_stats.iterations = new utils::stat_int("crab::iterations", 0);
+  d_stats.invariants = new utils::stat_int("crab::invariants", 0);
+  ctx.get_statistics().add(new utils::stat_delimiter());
+  ctx.get_statistics().add(d_stats.iterations);
+  ctx.get_statistics().add(d_stats.invariants);
 }
 
 crab::~crab() {
-  // Destruct crab
+}
+
+domain* crab::mk_top() const {
+  std::string id = ctx().get_options().get_string("crab-domain");
+  if (id == "interval") {
+    return new interval_domain(d_integer);
+  }
+  if (id == "octagon") {
+    return new octagon_domain(d_integer);
+  }
+  throw exception("Unknown crab domain ") << id << ".";
+}
+
+void crab::init_variables(const system::state_type* st) {
+
+  d_var_index.clear();
+  d_vars.clear();
+  d_integer.clear();
+
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::term_ref>& x_next = st->get_variables(system::state_type::STATE_NEXT);
+  const std::vector<expr::term_ref>& input = st->get_variables(system::state_type::STATE_INPUT);
+
+  // Current and next variables
+  std::vector<size_t> numeric;
+  for (size_t i = 0; i < x.size(); ++ i) {
+    expr::term_op type = tm().term_of(tm().base_type_of(x[i])).op();
+    if (type == expr::TYPE_INTEGER || type == expr::TYPE_REAL) {
+      numeric.push_back(i);
+    }
+  }
+  for (size_t k = 0; k < 2; ++ k) {
+    const std::vector<expr::term_ref>& vars = k == 0 ? x : x_next;
+    for (size_t i = 0; i < numeric.size(); ++ i) {
+      expr::term_ref var = vars[numeric[i]];
+      d_var_index[var] = d_vars.size();
+      d_vars.push_back(var);
+      d_integer.push_back(tm().term_of(tm().base_type_of(var)).op() == expr::TYPE_INTEGER);
+    }
+  }
+  d_state_size = numeric.size();
+
+  // Inputs
+  for (size_t i = 0; i < input.size(); ++ i) {
+    expr::term_op type = tm().term_of(tm().base_type_of(input[i])).op();
+    if (type == expr::TYPE_INTEGER || type == expr::TYPE_REAL) {
+      d_var_index[input[i]] = d_vars.size();
+      d_vars.push_back(input[i]);
+      d_integer.push_back(type == expr::TYPE_INTEGER);
+    }
+  }
+}
+
+bool crab::linearize(expr::term_ref f, const expr::rational& scale, linear_constraint& c, expr::term_ref& ite) const {
+
+  const expr::term& t = tm().term_of(f);
+
+  switch (t.op()) {
+  case expr::VARIABLE: {
+    std::map<expr::term_ref, size_t>::const_iterator find = d_var_index.find(f);
+    if (find == d_var_index.end()) {
+      return false;
+    }
+    c.add(find->second, scale);
+    return true;
+  }
+  case expr::CONST_RATIONAL:
+    c.constant += scale * tm().get_rational_constant(t);
+    return true;
+  case expr::TERM_ADD:
+    for (size_t i = 0; i < t.size(); ++ i) {
+      if (!linearize(t[i], scale, c, ite)) {
+        return false;
+      }
+    }
+    return true;
+  case expr::TERM_SUB:
+    if (t.size() == 1) {
+      return linearize(t[0], -scale, c, ite);
+    }
+    for (size_t i = 0; i < t.size(); ++ i) {
+      if (!linearize(t[i], i == 0 ? scale : -scale, c, ite)) {
+        return false;
+      }
+    }
+    return true;
+  case expr::TERM_MUL: {
+    // All constants, except (maybe) one
+    expr::rational product = scale;
+    expr::term_ref other;
+    for (size_t i = 0; i < t.size(); ++ i) {
+      if (tm().term_of(t[i]).op() == expr::CONST_RATIONAL) {
+        product *= tm().get_rational_constant(tm().term_of(t[i]));
+      } else if (other.is_null()) {
+        other = t[i];
+      } else {
+        return false;
+      }
+    }
+    if (other.is_null()) {
+      c.constant += product;
+      return true;
+    }
+    return linearize(other, product, c, ite);
+  }
+  case expr::TERM_DIV: {
+    if (t.size() != 2 || tm().term_of(t[1]).op() != expr::CONST_RATIONAL) {
+      return false;
+    }
+    expr::rational divisor = tm().get_rational_constant(tm().term_of(t[1]));
+    if (divisor.sgn() == 0) {
+      return false;
+    }
+    return linearize(t[0], scale / divisor, c, ite);
+  }
+  case expr::TERM_TO_REAL:
+    return linearize(t[0], scale, c, ite);
+  case expr::TERM_ITE:
+    if (ite.is_null()) {
+      ite = f;
+    }
+    return false;
+  default:
+    return false;
+  }
+}
+
+/** For integer constraints, turn sum a_i x_i + c < 0 into sum a_i x_i + c + 1 <= 0 */
+static
+void normalize(linear_constraint& c, const std::vector<bool>& integer) {
+  if (!c.strict) {
+    return;
+  }
+  linear_constraint::coefficient_map::iterator it = c.coefficients.begin();
+  for (; it != c.coefficients.end(); ++ it) {
+    if (!integer[it->first]) {
+      // Reals, we just drop strictness
+      c.strict = false;
+      return;
+    }
+  }
+  // Make all integer
+  for (it = c.coefficients.begin(); it != c.coefficients.end(); ++ it) {
+    expr::integer d = it->second.get_denominator();
+    linear_constraint::coefficient_map::iterator jt = c.coefficients.begin();
+    for (; jt != c.coefficients.end(); ++ jt) {
+      jt->second *= d;
+    }
+    c.constant *= d;
+  }
+  c.constant = c.constant.floor() + expr::rational(1, 1);
+  c.strict = false;
+}
+
+void crab::assume_atom(expr::term_ref f, bool negated, domain& d) {
+
+  const expr::term& t = tm().term_of(f);
+  expr::term_op op = t.op();
+
+  // Arithmetic atoms only
+  if (t.size() != 2) {
+    return;
+  }
+  expr::term_op type = tm().term_of(tm().base_type_of(t[0])).op();
+  if (type != expr::TYPE_INTEGER && type != expr::TYPE_REAL) {
+    return;
+  }
+
+  // e = t[0] - t[1]
+  linear_constraint e;
+  expr::term_ref ite;
+  if (!linearize(t[0], expr::rational(1, 1), e, ite) || !linearize(t[1], expr::rational(-1, 1), e, ite)) {
+    if (!ite.is_null()) {
+      // Split the atom on the condition of the if-then-else
+      const expr::term& ite_term = tm().term_of(ite);
+      expr::term_manager::substitution_map then_subst, else_subst;
+      then_subst[ite] = ite_term[1];
+      else_subst[ite] = ite_term[2];
+      expr::term_ref f_then = tm().substitute(f, then_subst);
+      expr::term_ref f_else = tm().substitute(f, else_subst);
+      assume(tm().mk_term(expr::TERM_ITE, ite_term[0], f_then, f_else), negated, d);
+    }
+    return;
+  }
+
+  // Negation of an equality is a disjunction
+  if (op == expr::TERM_EQ && negated) {
+    domain* d_gt = d.clone();
+    linear_constraint lt = e;
+    lt.strict = true;
+    normalize(lt, d_integer);
+    d.add(lt);
+    linear_constraint gt = e;
+    gt.negate();
+    gt.strict = true;
+    normalize(gt, d_integer);
+    d_gt->add(gt);
+    d.join(*d_gt);
+    delete d_gt;
+    return;
+  }
+
+  // Normalize the rest to e <= 0 or e < 0
+  switch (op) {
+  case expr::TERM_EQ: {
+    linear_constraint e_neg = e;
+    e_neg.negate();
+    d.add(e);
+    d.add(e_neg);
+    return;
+  }
+  case expr::TERM_LEQ:
+    // !(e <= 0) = -e < 0
+    if (negated) { e.negate(); e.strict = true; }
+    break;
+  case expr::TERM_LT:
+    // !(e < 0) = -e <= 0
+    if (negated) { e.negate(); } else { e.strict = true; }
+    break;
+  case expr::TERM_GEQ:
+    // e >= 0 = -e <= 0, !(e >= 0) = e < 0
+    if (negated) { e.strict = true; } else { e.negate(); }
+    break;
+  case expr::TERM_GT:
+    // e > 0 = -e < 0, !(e > 0) = e <= 0
+    if (!negated) { e.negate(); e.strict = true; }
+    break;
+  default:
+    return;
+  }
+
+  normalize(e, d_integer);
+  d.add(e);
+}
+
+void crab::assume(expr::term_ref f, bool negated, domain& d) {
+
+  if (d.is_bottom()) {
+    return;
+  }
+
+  const expr::term& t = tm().term_of(f);
+  expr::term_op op = t.op();
+
+  switch (op) {
+  case expr::CONST_BOOL:
+    if (tm().get_boolean_constant(t) == negated) {
+      d.set_bottom();
+    }
+    break;
+  case expr::TERM_NOT:
+    assume(t[0], !negated, d);
+    break;
+  case expr::TERM_AND:
+  case expr::TERM_OR:
+    if ((op == expr::TERM_AND) != negated) {
+      // Conjunction, twice to propagate between the conjuncts
+      for (size_t round = 0; round < 2; ++ round) {
+        for (size_t i = 0; i < t.size(); ++ i) {
+          assume(t[i], negated, d);
+        }
+      }
+    } else {
+      // Disjunction, join the cases
+      domain* result = 0;
+      for (size_t i = 0; i < t.size(); ++ i) {
+        domain* d_i = d.clone();
+        assume(t[i], negated, *d_i);
+        if (result == 0) {
+          result = d_i;
+        } else {
+          result->join(*d_i);
+          delete d_i;
+        }
+      }
+      if (result != 0) {
+        d.join(*result);
+        d.set_bottom();
+        d.join(*result);
+        delete result;
+      }
+    }
+    break;
+  case expr::TERM_IMPLIES:
+    // a => b = !a or b
+    assume(tm().mk_or(tm().mk_not(t[0]), t[1]), negated, d);
+    break;
+  case expr::TERM_ITE:
+    // Boolean if-then-else, (c and a) or (!c and b)
+    if (tm().type_of(f) == tm().boolean_type()) {
+      domain* d_else = d.clone();
+      assume(t[0], false, d);
+      assume(t[1], negated, d);
+      assume(t[0], true, *d_else);
+      assume(t[2], negated, *d_else);
+      d.join(*d_else);
+      delete d_else;
+    }
+    break;
+  case expr::TERM_EQ:
+    if (tm().type_of(t[0]) == tm().boolean_type()) {
+      // Boolean equality as a case split
+      assume(tm().mk_term(expr::TERM_ITE, t[0], t[1], tm().mk_not(t[1])), negated, d);
+    } else {
+      assume_atom(f, negated, d);
+    }
+    break;
+  case expr::TERM_LEQ:
+  case expr::TERM_LT:
+  case expr::TERM_GEQ:
+  case expr::TERM_GT:
+    assume_atom(f, negated, d);
+    break;
+  default:
+    // Not something we can use
+    break;
+  }
+}
+
+domain* crab::post(const domain& d, expr::term_ref T, const std::vector<expr::term_ref>& invariants) {
+
+  domain* result = d.clone();
+
+  // Known invariants hold in the current state
+  for (size_t i = 0; i < invariants.size(); ++ i) {
+    assume(invariants[i], false, *result);
+  }
+
+  // Assume the transition
+  assume(T, false, *result);
+
+  // Keep the next variables only, and move them to the current ones
+  std::vector<size_t> to(d_vars.size());
+  for (size_t i = 0; i < d_vars.size(); ++ i) {
+    if (i < d_state_size) {
+      result->forget(i);
+      to[i] = i + d_state_size;
+    } else if (i < 2*d_state_size) {
+      to[i] = i - d_state_size;
+    } else {
+      result->forget(i);
+      to[i] = i;
+    }
+  }
+  result->permute(to);
+
+  return result;
+}
+
+expr::term_ref crab::to_term(const linear_constraint& c) const {
+  // sum a_i x_i + c <= 0 as positive <= negative - c
+  std::vector<expr::term_ref> positive, negative;
+  linear_constraint::coefficient_map::const_iterator it = c.coefficients.begin();
+  for (; it != c.coefficients.end(); ++ it) {
+    expr::term_ref x = d_vars[it->first];
+    if (it->second.sgn() > 0) {
+      if (it->second == expr::rational(1, 1)) {
+        positive.push_back(x);
+      } else {
+        positive.push_back(tm().mk_term(expr::TERM_MUL, tm().mk_rational_constant(it->second), x));
+      }
+    } else {
+      if (it->second == expr::rational(-1, 1)) {
+        negative.push_back(x);
+      } else {
+        negative.push_back(tm().mk_term(expr::TERM_MUL, tm().mk_rational_constant(-it->second), x));
+      }
+    }
+  }
+  if (c.constant.sgn() != 0 || negative.empty()) {
+    negative.push_back(tm().mk_rational_constant(-c.constant));
+  }
+  if (positive.empty()) {
+    positive.push_back(tm().mk_rational_constant(expr::rational()));
+  }
+  expr::term_ref lhs = positive.size() == 1 ? positive[0] : tm().mk_term(expr::TERM_ADD, positive);
+  expr::term_ref rhs = negative.size() == 1 ? negative[0] : tm().mk_term(expr::TERM_ADD, negative);
+  return tm().mk_term(expr::TERM_LEQ, lhs, rhs);
+}
+
+void crab::filter_inductive(const system::transition_system* ts, std::vector<expr::term_ref>& candidates) {
+
+  const system::state_type* st = ts->get_state_type();
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::term_ref>& x_next = st->get_variables(system::state_type::STATE_NEXT);
+  const std::vector<expr::term_ref>& input = st->get_variables(system::state_type::STATE_INPUT);
+
+  std::vector<expr::term_ref> invariants;
+  ts->get_invariants(0, invariants);
+
+  // Initial states
+  smt::solver::ref solver(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
+  solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_A);
+  solver->add(ts->get_initial_states(), smt::solver::CLASS_A);
+  std::vector<expr::term_ref> kept;
+  for (size_t i = 0; i < candidates.size(); ++ i) {
+    solver->push();
+    solver->add(tm().mk_not(candidates[i]), smt::solver::CLASS_A);
+    if (solver->check() == smt::solver::UNSAT) {
+      kept.push_back(candidates[i]);
+    }
+    solver->pop();
+  }
+  candidates.swap(kept);
+
+  // Consecution, drop the ones that are not inductive until all are
+  bool changed = true;
+  while (changed && !candidates.empty()) {
+    changed = false;
+    solver = smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics());
+    solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_A);
+    solver->add_variables(x_next.begin(), x_next.end(), smt::solver::CLASS_B);
+    solver->add_variables(input.begin(), input.end(), smt::solver::CLASS_T);
+    solver->add(ts->get_transition_relation(), smt::solver::CLASS_T);
+    for (size_t i = 0; i < invariants.size(); ++ i) {
+      solver->add(invariants[i], smt::solver::CLASS_A);
+    }
+    solver->add(tm().mk_and(candidates), smt::solver::CLASS_A);
+    kept.clear();
+    for (size_t i = 0; i < candidates.size(); ++ i) {
+      expr::term_ref next = st->change_formula_vars(system::state_type::STATE_CURRENT, system::state_type::STATE_NEXT, candidates[i]);
+      solver->push();
+      solver->add(tm().mk_not(next), smt::solver::CLASS_B);
+      if (solver->check() == smt::solver::UNSAT) {
+        kept.push_back(candidates[i]);
+      } else {
+        TRACE("crab") << "crab: not inductive: " << candidates[i] << std::endl;
+        changed = true;
+      }
+      solver->pop();
+    }
+    candidates.swap(kept);
+  }
 }
 
 void crab::run(const system::transition_system* ts, std::vector<system::state_formula*>& out) {
@@ -45,21 +486,94 @@ void crab::run(const system::transition_system* ts, std::vector<system::state_fo
   TRACE("crab") << "crab: I = " << I << std::endl;
   TRACE("crab") << "crab: T = " << T << std::endl;
 
-  // Invariant as a term
-  expr::term_ref invariant_term = I;
-
   // State type has all the transition system variables
   const system::state_type* state_type = ts->get_state_type();
+  init_variables(state_type);
+  if (d_state_size == 0) {
+    MSG(1) << "Crab: no numerical variables" << std::endl;
+    return;
+  }
+
+  std::vector<expr::term_ref> invariants;
+  ts->get_invariants(0, invariants);
+
+  // Initial abstract state
+  domain* init = mk_top();
+  assume(I, false, *init);
+  for (size_t i = d_state_size; i < d_vars.size(); ++ i) {
+    init->forget(i);
+  }
+  TRACE("crab") << "crab: init = " << *init << std::endl;
+
+  unsigned widening_delay = ctx().get_options().get_unsigned("crab-widening-delay");
+  unsigned narrowing = ctx().get_options().get_unsigned("crab-narrowing");
+
+  // Increasing iterations: X = X widen (X join post(X))
+  domain* X = init->clone();
+  for (size_t iteration = 0; ; ++ iteration) {
+    d_stats.iterations->get_value() ++;
+    domain* Y = post(*X, T, invariants);
+    Y->join(*X);
+    TRACE("crab") << "crab: iteration " << iteration << ": " << *Y << std::endl;
+    if (Y->leq(*X)) {
+      delete Y;
+      break;
+    }
+    if (iteration >= widening_delay) {
+      X->widen(*Y);
+      delete Y;
+    } else {
+      delete X;
+      X = Y;
+    }
+  }
+
+  // Decreasing iterations: X = init join post(X)
+  for (size_t iteration = 0; iteration < narrowing; ++ iteration) {
+    d_stats.iterations->get_value() ++;
+    domain* Y = post(*X, T, invariants);
+    Y->join(*init);
+    if (!Y->leq(*X)) {
+      delete Y;
+      break;
+    }
+    delete X;
+    X = Y;
+  }
+
+  TRACE("crab") << "crab: result = " << *X << std::endl;
+
+  // The constraints over the state variables
+  std::vector<expr::term_ref> candidates;
+  if (X->is_bottom()) {
+    candidates.push_back(tm().mk_boolean_constant(false));
+  } else {
+    std::vector<linear_constraint> constraints;
+    X->get_constraints(constraints);
+    for (size_t i = 0; i < constraints.size(); ++ i) {
+      candidates.push_back(to_term(constraints[i]));
+    }
+  }
+  delete X;
+  delete init;
+
+  // Keep the ones that are inductive
+  filter_inductive(ts, candidates);
 
-  MSG(1) << "Crab: done" << std::endl;
+  MSG(1) << "Crab: done, " << candidates.size() << " invariants" << std::endl;
 
   // Invariant as a state formula
-  system::state_formula* invariant = new system::state_formula(tm(), state_type, invariant_term);
-  out.push_back(invariant);
+  if (!candidates.empty()) {
+    expr::term_ref invariant_term = tm().mk_and(candidates);
+    TRACE("crab") << "crab: invariant = " << invariant_term << std::endl;
+    system::state_formula* invariant = new system::state_formula(tm(), state_type, invariant_term);
+    out.push_back(invariant);
+    d_stats.invariants->get_value() += candidates.size();
+  }
 }
 
 void crab::gc_collect(const expr::gc_relocator& gc_reloc) {
-  // Ignore for now
+  // Nothing is kept between runs
 }
 
 }
@@ -20,15 +20,69 @@
 
 #include "system/context.h"
 #include "ai/ai.h"
+#include "ai/crab/domains.h"
+
+#include <map>
+#include <vector>
 
 namespace sally {
 namespace ai {
 
 /**
- * Crab static analyzer.
+ * Numerical abstract interpreter over the integer and real state variables,
+ * with intervals or octagons (option crab-domain). The post-image of the
+ * abstract states is computed by assuming the transition relation in the
+ * domain over the current, next and input variables, and then projecting
+ * to the next variables. Disjunctions are joined, and arithmetic if-then-else
+ * terms are split into cases. The analysis iterates from the initial states,
+ * widening after a few joins, and then refines the post-fixpoint with a few
+ * decreasing iterations. The constraints of the result are checked with
+ * the SMT solver, and only those that are inductive are reported.
  */
 class crab : public abstract_interpreter {
 
+  /** Index of the numerical variables (current, then next, then input) */
+  std::map<expr::term_ref, size_t> d_var_index;
+
+  /** The numerical variables by index */
+  std::vector<expr::term_ref> d_vars;
+
+  /** Which variables are integer */
+  std::vector<bool> d_integer;
+
+  /** Number of state variables */
+  size_t d_state_size;
+
+  /** Analysis statistics */
+  struct stats {
+    utils::stat_int* iterations;
+    utils::stat_int* invariants;
+  } d_stats;
+
+  /** Make the top element of the chosen domain */
+  domain* mk_top() const;
+
+  /** Get the numerical variables of the state type */
+  void init_variables(const system::state_type* st);
+
+  /** Get f as a linear sum times scale into c, returns false if not linear */
+  bool linearize(expr::term_ref f, const expr::rational& scale, linear_constraint& c, expr::term_ref& ite) const;
+
+  /** Add the arithmetic atom (or its negation) to d */
+  void assume_atom(expr::term_ref f, bool negated, domain& d);
+
+  /** Add the formula (or its negation) to d */
+  void assume(expr::term_ref f, bool negated, domain& d);
+
+  /** Post-image of d over the transition relation */
+  domain* post(const domain& d, expr::term_ref T, const std::vector<expr::term_ref>& invariants);
+
+  /** Get the constraint as a term over the state variables */
+  expr::term_ref to_term(const linear_constraint& c) const;
+
+  /** Keep only the candidates that form an inductive invariant */
+  void filter_inductive(const system::transition_system* ts, std::vector<expr::term_ref>& candidates);
+
 public:
 
   /** Construct the interpreter */
@@ -29,7 +29,9 @@ struct crab_info {
   static void setup_options(boost::program_options::options_description& options) {
     using namespace boost::program_options;
     options.add_options()
-        ("crab-domain", value<std::string>()->default_value("interval"), "The domain do use (intervals, ...)")
+        ("crab-domain", value<std::string>()->default_value("interval"), "The domain to use (interval, octagon).")
+        ("crab-widening-delay", value<unsigned>()->default_value(2), "Number of joins before widening.")
+        ("crab-narrowing", value<unsigned>()->default_value(2), "Number of decreasing iterations after widening.")
         ;
   }
 
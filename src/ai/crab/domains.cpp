@@ -0,0 +1,555 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ai/crab/domains.h"
+
+#include <cassert>
+#include <iostream>
+
+namespace sally {
+namespace ai {
+
+bound bound::operator + (const bound& b) const {
+  if (d_infinite || b.d_infinite) {
+    return bound();
+  }
+  return bound(d_value + b.d_value);
+}
+
+bound bound::operator * (const expr::rational& q) const {
+  assert(q.sgn() > 0);
+  if (d_infinite) {
+    return bound();
+  }
+  return bound(d_value * q);
+}
+
+bool bound::operator < (const bound& b) const {
+  if (d_infinite) {
+    return false;
+  }
+  if (b.d_infinite) {
+    return true;
+  }
+  return d_value < b.d_value;
+}
+
+bool bound::operator <= (const bound& b) const {
+  return !(b < *this);
+}
+
+bool bound::operator == (const bound& b) const {
+  if (d_infinite || b.d_infinite) {
+    return d_infinite == b.d_infinite;
+  }
+  return d_value == b.d_value;
+}
+
+bound bound::floor() const {
+  if (d_infinite) {
+    return *this;
+  }
+  return bound(d_value.floor());
+}
+
+std::ostream& operator << (std::ostream& out, const bound& b) {
+  if (b.is_infinite()) {
+    out << "inf";
+  } else {
+    out << b.get_value();
+  }
+  return out;
+}
+
+void linear_constraint::add(size_t x, const expr::rational& a) {
+  expr::rational& current = coefficients[x];
+  current += a;
+  if (current.sgn() == 0) {
+    coefficients.erase(x);
+  }
+}
+
+void linear_constraint::negate() {
+  coefficient_map::iterator it = coefficients.begin();
+  for (; it != coefficients.end(); ++ it) {
+    it->second = -it->second;
+  }
+  constant = -constant;
+}
+
+void domain::propagate(const linear_constraint& c) {
+
+  if (d_bottom) {
+    return;
+  }
+
+  // We have sum a_j x_j <= -c, and each -a_j x_j <= r_j, so
+  // a_i x_i <= -c + sum_{j != i} r_j
+  std::vector<bound> r;
+  size_t infinite = 0;
+  size_t infinite_index = 0;
+  expr::rational sum = -c.constant;
+  linear_constraint::coefficient_map::const_iterator it = c.coefficients.begin();
+  for (; it != c.coefficients.end(); ++ it) {
+    bound lower, upper;
+    get_bounds(it->first, lower, upper);
+    bound r_j = it->second.sgn() > 0 ? lower * it->second : upper * (-it->second);
+    if (r_j.is_infinite()) {
+      infinite ++;
+      infinite_index = it->first;
+    } else {
+      sum += r_j.get_value();
+    }
+    r.push_back(r_j);
+  }
+
+  if (infinite == 0 && sum.sgn() < 0) {
+    set_bottom();
+    return;
+  }
+
+  size_t k = 0;
+  for (it = c.coefficients.begin(); it != c.coefficients.end(); ++ it, ++ k) {
+    size_t i = it->first;
+    const expr::rational& a = it->second;
+    bound rhs;
+    if (infinite == 0) {
+      rhs = bound(sum - r[k].get_value());
+    } else if (infinite == 1 && infinite_index == i) {
+      rhs = bound(sum);
+    } else {
+      continue;
+    }
+    if (a.sgn() > 0) {
+      add_upper(i, rhs * a.invert());
+    } else {
+      add_lower(i, rhs * (-a).invert());
+    }
+    if (d_bottom) {
+      return;
+    }
+  }
+}
+
+void domain::to_stream(std::ostream& out) const {
+  if (d_bottom) {
+    out << "bottom";
+    return;
+  }
+  std::vector<linear_constraint> constraints;
+  get_constraints(constraints);
+  out << "{";
+  for (size_t i = 0; i < constraints.size(); ++ i) {
+    out << (i ? ", " : " ");
+    linear_constraint::coefficient_map::const_iterator it = constraints[i].coefficients.begin();
+    for (; it != constraints[i].coefficients.end(); ++ it) {
+      out << it->second << "*x" << it->first << " + ";
+    }
+    out << constraints[i].constant << " <= 0";
+  }
+  out << " }";
+}
+
+std::ostream& operator << (std::ostream& out, const domain& d) {
+  d.to_stream(out);
+  return out;
+}
+
+interval_domain::interval_domain(const std::vector<bool>& integer)
+: domain(integer)
+, d_upper(integer.size())
+, d_lower(integer.size())
+{}
+
+domain* interval_domain::clone() const {
+  return new interval_domain(*this);
+}
+
+void interval_domain::add_upper(size_t i, const bound& b) {
+  bound u = d_integer[i] ? b.floor() : b;
+  if (u < d_upper[i]) {
+    d_upper[i] = u;
+    if ((d_upper[i] + d_lower[i]) < bound(expr::rational())) {
+      set_bottom();
+    }
+  }
+}
+
+void interval_domain::add_lower(size_t i, const bound& b) {
+  bound l = d_integer[i] ? b.floor() : b;
+  if (l < d_lower[i]) {
+    d_lower[i] = l;
+    if ((d_upper[i] + d_lower[i]) < bound(expr::rational())) {
+      set_bottom();
+    }
+  }
+}
+
+void interval_domain::get_bounds(size_t i, bound& lower, bound& upper) const {
+  lower = d_lower[i];
+  upper = d_upper[i];
+}
+
+void interval_domain::add(const linear_constraint& c) {
+  propagate(c);
+}
+
+void interval_domain::join(const domain& other) {
+  const interval_domain& o = dynamic_cast<const interval_domain&>(other);
+  if (o.d_bottom) {
+    return;
+  }
+  if (d_bottom) {
+    *this = o;
+    return;
+  }
+  for (size_t i = 0; i < size(); ++ i) {
+    d_upper[i] = bound::max(d_upper[i], o.d_upper[i]);
+    d_lower[i] = bound::max(d_lower[i], o.d_lower[i]);
+  }
+}
+
+void interval_domain::widen(const domain& other) {
+  const interval_domain& o = dynamic_cast<const interval_domain&>(other);
+  if (o.d_bottom) {
+    return;
+  }
+  if (d_bottom) {
+    *this = o;
+    return;
+  }
+  for (size_t i = 0; i < size(); ++ i) {
+    if (d_upper[i] < o.d_upper[i]) { d_upper[i] = bound(); }
+    if (d_lower[i] < o.d_lower[i]) { d_lower[i] = bound(); }
+  }
+}
+
+bool interval_domain::leq(const domain& other) const {
+  const interval_domain& o = dynamic_cast<const interval_domain&>(other);
+  if (d_bottom) {
+    return true;
+  }
+  if (o.d_bottom) {
+    return false;
+  }
+  for (size_t i = 0; i < size(); ++ i) {
+    if (!(d_upper[i] <= o.d_upper[i]) || !(d_lower[i] <= o.d_lower[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void interval_domain::forget(size_t i) {
+  d_upper[i] = bound();
+  d_lower[i] = bound();
+}
+
+void interval_domain::permute(const std::vector<size_t>& to) {
+  std::vector<bound> upper(size()), lower(size());
+  std::vector<bool> integer(size());
+  for (size_t i = 0; i < size(); ++ i) {
+    upper[to[i]] = d_upper[i];
+    lower[to[i]] = d_lower[i];
+    integer[to[i]] = d_integer[i];
+  }
+  d_upper.swap(upper);
+  d_lower.swap(lower);
+  d_integer.swap(integer);
+}
+
+void interval_domain::get_constraints(std::vector<linear_constraint>& out) const {
+  for (size_t i = 0; i < size(); ++ i) {
+    if (!d_upper[i].is_infinite()) {
+      linear_constraint c;
+      c.add(i, expr::rational(1, 1));
+      c.constant = -d_upper[i].get_value();
+      out.push_back(c);
+    }
+    if (!d_lower[i].is_infinite()) {
+      linear_constraint c;
+      c.add(i, expr::rational(-1, 1));
+      c.constant = -d_lower[i].get_value();
+      out.push_back(c);
+    }
+  }
+}
+
+octagon_domain::octagon_domain(const std::vector<bool>& integer)
+: domain(integer)
+, d_m(4*integer.size()*integer.size())
+{
+  for (size_t a = 0; a < 2*size(); ++ a) {
+    m(a, a) = bound(expr::rational());
+  }
+}
+
+domain* octagon_domain::clone() const {
+  return new octagon_domain(*this);
+}
+
+void octagon_domain::add_entry(size_t a, size_t b, const bound& k) {
+  if (k < m(a, b)) {
+    m(a, b) = k;
+    m(b^1, a^1) = k;
+  }
+}
+
+void octagon_domain::add_upper(size_t i, const bound& b) {
+  // V_{2i} - V_{2i+1} = 2x_i <= 2b
+  bound u = d_integer[i] ? b.floor() : b;
+  add_entry(2*i+1, 2*i, u * expr::rational(2, 1));
+  if ((m(2*i+1, 2*i) + m(2*i, 2*i+1)) < bound(expr::rational())) {
+    set_bottom();
+  }
+}
+
+void octagon_domain::add_lower(size_t i, const bound& b) {
+  // V_{2i+1} - V_{2i} = -2x_i <= 2b
+  bound l = d_integer[i] ? b.floor() : b;
+  add_entry(2*i, 2*i+1, l * expr::rational(2, 1));
+  if ((m(2*i+1, 2*i) + m(2*i, 2*i+1)) < bound(expr::rational())) {
+    set_bottom();
+  }
+}
+
+void octagon_domain::close() {
+
+  if (d_bottom) {
+    return;
+  }
+
+  size_t N = 2*size();
+  expr::rational half(1, 2);
+
+  // Shortest paths
+  for (size_t k = 0; k < N; ++ k) {
+    for (size_t a = 0; a < N; ++ a) {
+      if (m(a, k).is_infinite()) continue;
+      for (size_t b = 0; b < N; ++ b) {
+        bound through_k = m(a, k) + m(k, b);
+        if (through_k < m(a, b)) {
+          m(a, b) = through_k;
+        }
+      }
+    }
+  }
+
+  // Strengthening with the unary bounds, V_b - V_a = (V_{a^1} - V_a + V_b - V_{b^1}) / 2
+  for (size_t a = 0; a < N; ++ a) {
+    for (size_t b = 0; b < N; ++ b) {
+      bound strengthened = (m(a, a^1) + m(b^1, b)) * half;
+      if (strengthened < m(a, b)) {
+        m(a, b) = strengthened;
+      }
+    }
+  }
+
+  // Integer bounds
+  for (size_t i = 0; i < size(); ++ i) {
+    if (d_integer[i]) {
+      m(2*i+1, 2*i) = (m(2*i+1, 2*i) * half).floor() * expr::rational(2, 1);
+      m(2*i, 2*i+1) = (m(2*i, 2*i+1) * half).floor() * expr::rational(2, 1);
+    }
+  }
+
+  // Check for emptiness
+  for (size_t a = 0; a < N; ++ a) {
+    if (m(a, a) < bound(expr::rational())) {
+      set_bottom();
+      return;
+    }
+  }
+  for (size_t i = 0; i < size(); ++ i) {
+    if ((m(2*i+1, 2*i) + m(2*i, 2*i+1)) < bound(expr::rational())) {
+      set_bottom();
+      return;
+    }
+  }
+}
+
+void octagon_domain::get_bounds(size_t i, bound& lower, bound& upper) const {
+  expr::rational half(1, 2);
+  upper = m(2*i+1, 2*i) * half;
+  lower = m(2*i, 2*i+1) * half;
+}
+
+void octagon_domain::add(const linear_constraint& c) {
+
+  if (d_bottom) {
+    return;
+  }
+
+  linear_constraint::coefficient_map::const_iterator it = c.coefficients.begin();
+
+  if (c.coefficients.size() == 1) {
+    // a*x_i + c <= 0
+    size_t i = it->first;
+    const expr::rational& a = it->second;
+    if (a.sgn() > 0) {
+      add_upper(i, bound(-c.constant / a));
+    } else {
+      add_lower(i, bound(c.constant / a));
+    }
+  } else if (c.coefficients.size() == 2) {
+    size_t i = it->first;
+    expr::rational a_i = it->second;
+    ++ it;
+    size_t j = it->first;
+    expr::rational a_j = it->second;
+    expr::rational abs_i = a_i.sgn() > 0 ? a_i : -a_i;
+    expr::rational abs_j = a_j.sgn() > 0 ? a_j : -a_j;
+    if (abs_i == abs_j) {
+      // V_p + V_q <= k, i.e. V_p - V_{q^1} <= k
+      size_t p = 2*i + (a_i.sgn() > 0 ? 0 : 1);
+      size_t q = 2*j + (a_j.sgn() > 0 ? 0 : 1);
+      add_entry(q^1, p, bound(-c.constant / abs_i));
+    } else {
+      propagate(c);
+    }
+  } else {
+    propagate(c);
+  }
+
+  close();
+}
+
+void octagon_domain::join(const domain& other) {
+  const octagon_domain& o = dynamic_cast<const octagon_domain&>(other);
+  if (o.d_bottom) {
+    return;
+  }
+  if (d_bottom) {
+    *this = o;
+    return;
+  }
+  for (size_t k = 0; k < d_m.size(); ++ k) {
+    d_m[k] = bound::max(d_m[k], o.d_m[k]);
+  }
+}
+
+void octagon_domain::widen(const domain& other) {
+  const octagon_domain& o = dynamic_cast<const octagon_domain&>(other);
+  if (o.d_bottom) {
+    return;
+  }
+  if (d_bottom) {
+    *this = o;
+    return;
+  }
+  // The result is not closed, closing it could break termination
+  for (size_t k = 0; k < d_m.size(); ++ k) {
+    if (d_m[k] < o.d_m[k]) {
+      d_m[k] = bound();
+    }
+  }
+}
+
+bool octagon_domain::leq(const domain& other) const {
+  const octagon_domain& o = dynamic_cast<const octagon_domain&>(other);
+  if (d_bottom) {
+    return true;
+  }
+  if (o.d_bottom) {
+    return false;
+  }
+  for (size_t k = 0; k < d_m.size(); ++ k) {
+    if (!(d_m[k] <= o.d_m[k])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void octagon_domain::forget(size_t i) {
+  size_t N = 2*size();
+  for (size_t a = 0; a < N; ++ a) {
+    for (size_t s = 0; s < 2; ++ s) {
+      if (a != 2*i+s) {
+        m(a, 2*i+s) = bound();
+        m(2*i+s, a) = bound();
+      }
+    }
+  }
+}
+
+void octagon_domain::permute(const std::vector<size_t>& to) {
+  size_t n = size();
+  std::vector<bound> new_m(d_m.size());
+  std::vector<bool> integer(n);
+  for (size_t i = 0; i < n; ++ i) {
+    integer[to[i]] = d_integer[i];
+    for (size_t j = 0; j < n; ++ j) {
+      for (size_t s = 0; s < 2; ++ s) {
+        for (size_t t = 0; t < 2; ++ t) {
+          new_m[(2*to[i]+s)*2*n + 2*to[j]+t] = m(2*i+s, 2*j+t);
+        }
+      }
+    }
+  }
+  d_m.swap(new_m);
+  d_integer.swap(integer);
+}
+
+void octagon_domain::get_constraints(std::vector<linear_constraint>& out) const {
+
+  expr::rational one(1, 1);
+  expr::rational half(1, 2);
+
+  // Unary bounds
+  std::vector<bound> upper(size()), lower(size());
+  for (size_t i = 0; i < size(); ++ i) {
+    get_bounds(i, lower[i], upper[i]);
+    if (!upper[i].is_infinite()) {
+      linear_constraint c;
+      c.add(i, one);
+      c.constant = -upper[i].get_value();
+      out.push_back(c);
+    }
+    if (!lower[i].is_infinite()) {
+      linear_constraint c;
+      c.add(i, -one);
+      c.constant = -lower[i].get_value();
+      out.push_back(c);
+    }
+  }
+
+  // Relational constraints that don't follow from the bounds
+  for (size_t i = 0; i < size(); ++ i) {
+    for (size_t j = i + 1; j < size(); ++ j) {
+      for (size_t s = 0; s < 2; ++ s) {
+        for (size_t t = 0; t < 2; ++ t) {
+          // V_{2j+t} - V_{2i+s}, i.e. (t ? -x_j : x_j) + (s ? x_i : -x_i)
+          const bound& k = m(2*i+s, 2*j+t);
+          if (k.is_infinite()) continue;
+          const bound& b_j = t ? lower[j] : upper[j];
+          const bound& b_i = s ? upper[i] : lower[i];
+          if (!(k < b_j + b_i)) continue;
+          linear_constraint c;
+          c.add(j, t ? -one : one);
+          c.add(i, s ? one : -one);
+          c.constant = -k.get_value();
+          out.push_back(c);
+        }
+      }
+    }
+  }
+}
+
+}
+}
@@ -0,0 +1,233 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "expr/rational.h"
+
+#include <map>
+#include <vector>
+#include <iosfwd>
+
+namespace sally {
+namespace ai {
+
+/** An upper bound, either a rational or +infinity */
+class bound {
+
+  /** Is the bound infinite */
+  bool d_infinite;
+
+  /** The value if finite */
+  expr::rational d_value;
+
+public:
+
+  /** Construct +infinity */
+  bound(): d_infinite(true) {}
+
+  /** Construct a finite bound */
+  bound(const expr::rational& q): d_infinite(false), d_value(q) {}
+
+  bool is_infinite() const { return d_infinite; }
+  const expr::rational& get_value() const { return d_value; }
+
+  /** Sum, infinite if any is infinite */
+  bound operator + (const bound& b) const;
+
+  /** Scale by a positive rational */
+  bound operator * (const expr::rational& q) const;
+
+  bool operator < (const bound& b) const;
+  bool operator <= (const bound& b) const;
+  bool operator == (const bound& b) const;
+
+  /** Round down (for integer variables) */
+  bound floor() const;
+
+  static const bound& min(const bound& a, const bound& b) { return b < a ? b : a; }
+  static const bound& max(const bound& a, const bound& b) { return a < b ? b : a; }
+};
+
+std::ostream& operator << (std::ostream& out, const bound& b);
+
+/** Linear constraint sum a_i x_i + c <= 0 (< 0 if strict) */
+struct linear_constraint {
+
+  typedef std::map<size_t, expr::rational> coefficient_map;
+
+  /** The coefficients (non-zero) */
+  coefficient_map coefficients;
+
+  /** The constant */
+  expr::rational constant;
+
+  /** Strict inequality */
+  bool strict;
+
+  linear_constraint(): strict(false) {}
+
+  /** Add a*x to the constraint */
+  void add(size_t x, const expr::rational& a);
+
+  /** Negate (to get -e < 0 from e <= 0 and vice versa) */
+  void negate();
+};
+
+/**
+ * Numerical abstract domain over variables 0, ..., n-1. Each variable is
+ * either integer or real, and the bounds on integer variables are rounded.
+ */
+class domain {
+
+protected:
+
+  /** Which variables are integer */
+  std::vector<bool> d_integer;
+
+  /** Bottom (empty) */
+  bool d_bottom;
+
+  /** Set x_i <= b */
+  virtual void add_upper(size_t i, const bound& b) = 0;
+
+  /** Set -x_i <= b */
+  virtual void add_lower(size_t i, const bound& b) = 0;
+
+  /** Add the constraint by bounding each variable with the bounds of the others */
+  void propagate(const linear_constraint& c);
+
+public:
+
+  domain(const std::vector<bool>& integer)
+  : d_integer(integer), d_bottom(false) {}
+
+  virtual ~domain() {}
+
+  /** Number of variables */
+  size_t size() const { return d_integer.size(); }
+
+  /** Make a copy */
+  virtual domain* clone() const = 0;
+
+  /** Is it empty */
+  bool is_bottom() const { return d_bottom; }
+
+  /** Make it empty */
+  virtual void set_bottom() { d_bottom = true; }
+
+  /** Get the bounds x_i <= upper and -x_i <= lower */
+  virtual void get_bounds(size_t i, bound& lower, bound& upper) const = 0;
+
+  /** Add the constraint */
+  virtual void add(const linear_constraint& c) = 0;
+
+  /** Join with the other element (same size and kind) */
+  virtual void join(const domain& other) = 0;
+
+  /** Widen with the other element (the next iterate) */
+  virtual void widen(const domain& other) = 0;
+
+  /** Check if included in the other element */
+  virtual bool leq(const domain& other) const = 0;
+
+  /** Remove all the information about x_i */
+  virtual void forget(size_t i) = 0;
+
+  /** Rename x_i to x_{to[i]}, to must be a permutation */
+  virtual void permute(const std::vector<size_t>& to) = 0;
+
+  /** Get the constraints that describe the element (without redundant ones) */
+  virtual void get_constraints(std::vector<linear_constraint>& out) const = 0;
+
+  /** Print to stream */
+  void to_stream(std::ostream& out) const;
+};
+
+std::ostream& operator << (std::ostream& out, const domain& d);
+
+/** Intervals l_i <= x_i <= u_i */
+class interval_domain : public domain {
+
+  /** Upper bounds x_i <= u_i */
+  std::vector<bound> d_upper;
+
+  /** Lower bounds -x_i <= l_i */
+  std::vector<bound> d_lower;
+
+  void add_upper(size_t i, const bound& b);
+  void add_lower(size_t i, const bound& b);
+
+public:
+
+  /** Construct top */
+  interval_domain(const std::vector<bool>& integer);
+
+  domain* clone() const;
+  void get_bounds(size_t i, bound& lower, bound& upper) const;
+  void add(const linear_constraint& c);
+  void join(const domain& other);
+  void widen(const domain& other);
+  bool leq(const domain& other) const;
+  void forget(size_t i);
+  void permute(const std::vector<size_t>& to);
+  void get_constraints(std::vector<linear_constraint>& out) const;
+};
+
+/**
+ * Octagons, constraints +-x_i +-x_j <= c, as a difference bound matrix
+ * over the variables V_{2i} = x_i and V_{2i+1} = -x_i, where m[a][b] bounds
+ * V_b - V_a (Mine, HOSC 2006). The matrix is kept closed. Constraints that
+ * are not octagonal are added through the bounds of their variables.
+ */
+class octagon_domain : public domain {
+
+  /** The matrix, 2n x 2n */
+  std::vector<bound> d_m;
+
+  /** Entry m[a][b] */
+  bound& m(size_t a, size_t b) { return d_m[a*2*size() + b]; }
+  const bound& m(size_t a, size_t b) const { return d_m[a*2*size() + b]; }
+
+  /** Close the matrix (shortest paths and strengthening) */
+  void close();
+
+  /** Add V_b - V_a <= k and its coherent version, without closing */
+  void add_entry(size_t a, size_t b, const bound& k);
+
+  void add_upper(size_t i, const bound& b);
+  void add_lower(size_t i, const bound& b);
+
+public:
+
+  /** Construct top */
+  octagon_domain(const std::vector<bool>& integer);
+
+  domain* clone() const;
+  void get_bounds(size_t i, bound& lower, bound& upper) const;
+  void add(const linear_constraint& c);
+  void join(const domain& other);
+  void widen(const domain& other);
+  bool leq(const domain& other) const;
+  void forget(size_t i);
+  void permute(const std::vector<size_t>& to);
+  void get_constraints(std::vector<linear_constraint>& out) const;
+};
+
+}
+}
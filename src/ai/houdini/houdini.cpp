@@ -0,0 +1,335 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "houdini.h"
+
+#include "smt/factory.h"
+#include "utils/trace.h"
+
+#include <iostream>
+
+namespace sally {
+namespace ai {
+
+houdini::houdini(const system::context& ctx)
+: abstract_interpreter(ctx)
+{
+  d_stats.time = new utils::stat_timer("houdini::time", false);
+  d_stats.candidates = new utils::stat_int("houdini::candidates", 0);
+  d_stats.simulation_dropped = new utils::stat_int("houdini::simulation_dropped", 0);
+  d_stats.invariants = new utils::stat_int("houdini::invariants", 0);
+  ctx.get_statistics().add(new utils::stat_delimiter());
+  ctx.get_statistics().add(d_stats.time);
+  ctx.get_statistics().add(d_stats.candidates);
+  ctx.get_statistics().add(d_stats.simulation_dropped);
+  ctx.get_statistics().add(d_stats.invariants);
+}
+
+bool houdini::add_candidate(const system::state_type* st, expr::term_ref f) {
+  if (d_candidates.size() >= ctx().get_options().get_unsigned("houdini-max-candidates")) {
+    return false;
+  }
+  d_candidates.push_back(f);
+  d_stats.candidates->get_value() ++;
+  d_candidates_next.push_back(st->change_formula_vars(system::state_type::STATE_CURRENT, system::state_type::STATE_NEXT, f));
+  return true;
+}
+
+void houdini::mk_candidates(const system::state_type* st) {
+
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+
+  // Boolean literals
+  for (size_t i = 0; i < x.size(); ++ i) {
+    if (tm().type_of(x[i]) == tm().boolean_type()) {
+      if (!add_candidate(st, x[i])) return;
+      if (!add_candidate(st, tm().mk_not(x[i]))) return;
+    }
+  }
+
+  // Pairs of variables of the same type
+  for (size_t i = 0; i < x.size(); ++ i) {
+    expr::term_ref type = tm().type_of(x[i]);
+    expr::term_op type_op = tm().term_of(tm().base_type_of(x[i])).op();
+    for (size_t j = i + 1; j < x.size(); ++ j) {
+      if (tm().type_of(x[j]) != type) {
+        continue;
+      }
+      expr::term_ref a = x[i], b = x[j];
+      switch (type_op) {
+      case expr::TYPE_BOOL:
+        // All binary clauses (implications both ways, and the rest)
+        if (!add_candidate(st, tm().mk_or(tm().mk_not(a), b))) return;
+        if (!add_candidate(st, tm().mk_or(a, tm().mk_not(b)))) return;
+        if (!add_candidate(st, tm().mk_or(a, b))) return;
+        if (!add_candidate(st, tm().mk_or(tm().mk_not(a), tm().mk_not(b)))) return;
+        break;
+      case expr::TYPE_INTEGER:
+      case expr::TYPE_REAL:
+        if (!add_candidate(st, tm().mk_term(expr::TERM_EQ, a, b))) return;
+        if (!add_candidate(st, tm().mk_term(expr::TERM_LEQ, a, b))) return;
+        if (!add_candidate(st, tm().mk_term(expr::TERM_LEQ, b, a))) return;
+        break;
+      case expr::TYPE_BITVECTOR:
+        if (!add_candidate(st, tm().mk_term(expr::TERM_EQ, a, b))) return;
+        if (!add_candidate(st, tm().mk_term(expr::TERM_BV_ULEQ, a, b))) return;
+        if (!add_candidate(st, tm().mk_term(expr::TERM_BV_ULEQ, b, a))) return;
+        break;
+      default:
+        break;
+      }
+    }
+  }
+}
+
+void houdini::mk_bound_candidates(const system::state_type* st, const std::vector<expr::value>& min, const std::vector<expr::value>& max) {
+
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+
+  for (size_t i = 0; i < x.size(); ++ i) {
+    if (min[i].is_null()) {
+      continue;
+    }
+    expr::term_ref min_term = min[i].to_term(tm());
+    expr::term_ref max_term = max[i].to_term(tm());
+    if (min[i] == max[i]) {
+      if (!add_candidate(st, tm().mk_term(expr::TERM_EQ, x[i], min_term))) return;
+    } else if (min[i].is_rational()) {
+      if (!add_candidate(st, tm().mk_term(expr::TERM_LEQ, min_term, x[i]))) return;
+      if (!add_candidate(st, tm().mk_term(expr::TERM_LEQ, x[i], max_term))) return;
+    } else {
+      // Lower bound 0 is trivial
+      const expr::bitvector& bv_min = min[i].get_bitvector();
+      if (!(bv_min == expr::bitvector(bv_min.size())) && !add_candidate(st, tm().mk_term(expr::TERM_BV_ULEQ, min_term, x[i]))) return;
+      if (!add_candidate(st, tm().mk_term(expr::TERM_BV_ULEQ, x[i], max_term))) return;
+    }
+  }
+}
+
+size_t houdini::filter(expr::model::ref m, bool next) {
+  expr::term_manager::substitution_map no_renaming;
+  const expr::term_manager::substitution_map& renaming = next ? d_current_to_next : no_renaming;
+  size_t kept = 0;
+  for (size_t i = 0; i < d_candidates.size(); ++ i) {
+    if (m->is_true(d_candidates[i], renaming)) {
+      d_candidates[kept] = d_candidates[i];
+      d_candidates_next[kept] = d_candidates_next[i];
+      kept ++;
+    } else {
+      TRACE("houdini") << "houdini: dropping " << d_candidates[i] << std::endl;
+    }
+  }
+  size_t removed = d_candidates.size() - kept;
+  d_candidates.resize(kept);
+  d_candidates_next.resize(kept);
+  return removed;
+}
+
+void houdini::simulate(const system::transition_system* ts) {
+
+  const system::state_type* st = ts->get_state_type();
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::term_ref>& x_next = st->get_variables(system::state_type::STATE_NEXT);
+  const std::vector<expr::term_ref>& input = st->get_variables(system::state_type::STATE_INPUT);
+
+  smt::solver::ref solver(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
+  solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_A);
+  solver->add_variables(x_next.begin(), x_next.end(), smt::solver::CLASS_B);
+  solver->add_variables(input.begin(), input.end(), smt::solver::CLASS_T);
+  solver->add(ts->get_transition_relation(), smt::solver::CLASS_T);
+
+  // Observed values of the numerical and bit-vector variables
+  std::vector<expr::value> min(x.size()), max(x.size());
+
+  unsigned steps = ctx().get_options().get_unsigned("houdini-simulation-steps");
+  expr::term_ref state = ts->get_initial_states();
+  for (unsigned k = 0; k <= steps; ++ k) {
+
+    // The initial state, or the successor of the last state
+    bool next = k > 0;
+    const std::vector<expr::term_ref>& candidates = next ? d_candidates_next : d_candidates;
+    solver->push();
+    solver->add(state, smt::solver::CLASS_A);
+
+    // Prefer a state that falsifies some candidate
+    smt::solver::result result = smt::solver::UNSAT;
+    if (!candidates.empty()) {
+      solver->push();
+      solver->add(tm().mk_not(tm().mk_and(candidates)), next ? smt::solver::CLASS_B : smt::solver::CLASS_A);
+      result = solver->check();
+      if (result != smt::solver::SAT) {
+        solver->pop();
+      }
+    }
+    if (result != smt::solver::SAT) {
+      solver->push();
+      result = solver->check();
+    }
+    if (result != smt::solver::SAT) {
+      // No more states
+      solver->pop();
+      solver->pop();
+      break;
+    }
+
+    // Remove the candidates that are false in the state
+    expr::model::ref m = solver->get_model();
+    d_stats.simulation_dropped->get_value() += filter(m, next);
+
+    // Record the values and continue from the state
+    const std::vector<expr::term_ref>& vars = next ? x_next : x;
+    std::vector<expr::term_ref> state_values;
+    for (size_t i = 0; i < x.size(); ++ i) {
+      if (!m->has_value(vars[i])) {
+        continue;
+      }
+      expr::value v = m->get_variable_value(vars[i]);
+      state_values.push_back(tm().mk_term(expr::TERM_EQ, x[i], v.to_term(tm())));
+      if (!v.is_rational() && !v.is_bitvector()) {
+        continue;
+      }
+      if (min[i].is_null()) {
+        min[i] = max[i] = v;
+      } else if (v.is_rational()) {
+        if (v.get_rational() < min[i].get_rational()) { min[i] = v; }
+        if (max[i].get_rational() < v.get_rational()) { max[i] = v; }
+      } else {
+        if (v.get_bitvector().ult(min[i].get_bitvector())) { min[i] = v; }
+        if (max[i].get_bitvector().ult(v.get_bitvector())) { max[i] = v; }
+      }
+    }
+    state = tm().mk_and(state_values);
+
+    solver->pop();
+    solver->pop();
+
+    TRACE("houdini") << "houdini: step " << k << ": " << state << std::endl;
+  }
+
+  // Bounds from the observed values, to be checked for inductiveness
+  mk_bound_candidates(st, min, max);
+}
+
+void houdini::check_inductive(const system::transition_system* ts) {
+
+  const system::state_type* st = ts->get_state_type();
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::term_ref>& x_next = st->get_variables(system::state_type::STATE_NEXT);
+  const std::vector<expr::term_ref>& input = st->get_variables(system::state_type::STATE_INPUT);
+
+  smt::solver::ref solver(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
+  solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_A);
+  solver->add_variables(x_next.begin(), x_next.end(), smt::solver::CLASS_B);
+  solver->add_variables(input.begin(), input.end(), smt::solver::CLASS_T);
+
+  // Initiation: I => C
+  solver->push();
+  solver->add(ts->get_initial_states(), smt::solver::CLASS_A);
+  while (!d_candidates.empty()) {
+    solver->push();
+    solver->add(tm().mk_not(tm().mk_and(d_candidates)), smt::solver::CLASS_A);
+    smt::solver::result result = solver->check();
+    if (result == smt::solver::SAT) {
+      filter(solver->get_model(), false);
+    }
+    solver->pop();
+    if (result == smt::solver::UNSAT) {
+      break;
+    }
+    if (result != smt::solver::SAT) {
+      // Can't tell which ones hold, so we keep none
+      MSG(1) << "Houdini: initiation check is inconclusive, dropping all candidates" << std::endl;
+      d_candidates.clear();
+      d_candidates_next.clear();
+    }
+  }
+  solver->pop();
+
+  // Consecution: C and T => C'
+  std::vector<expr::term_ref> invariants;
+  ts->get_invariants(0, invariants);
+  solver->add(ts->get_transition_relation(), smt::solver::CLASS_T);
+  for (size_t i = 0; i < invariants.size(); ++ i) {
+    solver->add(invariants[i], smt::solver::CLASS_A);
+  }
+  while (!d_candidates.empty()) {
+    solver->push();
+    solver->add(tm().mk_and(d_candidates), smt::solver::CLASS_A);
+    solver->add(tm().mk_not(tm().mk_and(d_candidates_next)), smt::solver::CLASS_B);
+    smt::solver::result result = solver->check();
+    if (result == smt::solver::SAT) {
+      filter(solver->get_model(), true);
+    }
+    solver->pop();
+    if (result == smt::solver::UNSAT) {
+      break;
+    }
+    if (result != smt::solver::SAT) {
+      MSG(1) << "Houdini: consecution check is inconclusive, dropping all candidates" << std::endl;
+      d_candidates.clear();
+      d_candidates_next.clear();
+    }
+  }
+}
+
+void houdini::run(const system::transition_system* ts, std::vector<system::state_formula*>& out) {
+
+  MSG(1) << "Houdini: starting" << std::endl;
+  d_stats.time->start();
+
+  const system::state_type* st = ts->get_state_type();
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::term_ref>& x_next = st->get_variables(system::state_type::STATE_NEXT);
+
+  d_candidates.clear();
+  d_candidates_next.clear();
+  d_current_to_next.clear();
+  for (size_t i = 0; i < x.size(); ++ i) {
+    d_current_to_next[x[i]] = x_next[i];
+  }
+
+  // Candidates and the quick filtering
+  size_t generated = d_stats.candidates->get_value();
+  mk_candidates(st);
+  simulate(ts);
+  generated = d_stats.candidates->get_value() - generated;
+  MSG(1) << "Houdini: " << generated << " candidates, " << d_candidates.size() << " after simulation" << std::endl;
+
+  // Keep the inductive ones
+  check_inductive(ts);
+
+  if (!d_candidates.empty()) {
+    expr::term_ref invariant_term = tm().mk_and(d_candidates);
+    TRACE("houdini") << "houdini: invariant = " << invariant_term << std::endl;
+    out.push_back(new system::state_formula(tm(), st, invariant_term));
+    d_stats.invariants->get_value() += d_candidates.size();
+  }
+
+  d_stats.time->stop();
+  MSG(1) << "Houdini: done, " << d_candidates.size() << " invariants" << std::endl;
+
+  d_candidates.clear();
+  d_candidates_next.clear();
+}
+
+void houdini::gc_collect(const expr::gc_relocator& gc_reloc) {
+  // Nothing is kept between runs
+}
+
+}
+}
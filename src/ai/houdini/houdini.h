@@ -0,0 +1,91 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "system/context.h"
+#include "smt/solver.h"
+#include "ai/ai.h"
+
+#include <vector>
+
+namespace sally {
+namespace ai {
+
+/**
+ * Houdini-style invariant miner. Candidates are generated from templates
+ * over the state variables (Boolean literals and implications, equalities
+ * and orderings of variables of the same type, and bounds on numerical and
+ * bit-vector variables). The candidates are first filtered on a simulated
+ * path of reachable states, where each step prefers a successor that
+ * falsifies some candidate. The remaining candidates are then checked with
+ * a single incremental solver, dropping the ones that are not initial or
+ * not preserved by the transition relation until the rest is inductive.
+ */
+class houdini : public abstract_interpreter {
+
+  /** The current and next versions of the candidates */
+  std::vector<expr::term_ref> d_candidates;
+  std::vector<expr::term_ref> d_candidates_next;
+
+  /** Renaming to evaluate current state formulas on the next state */
+  expr::term_manager::substitution_map d_current_to_next;
+
+  /** Statistics */
+  struct stats {
+    utils::stat_timer* time;
+    utils::stat_int* candidates;
+    utils::stat_int* simulation_dropped;
+    utils::stat_int* invariants;
+  } d_stats;
+
+  /** Add a candidate, returns false if at the limit */
+  bool add_candidate(const system::state_type* st, expr::term_ref f);
+
+  /** Generate the candidates that don't depend on the values */
+  void mk_candidates(const system::state_type* st);
+
+  /** Generate the bounds from the observed values (min and max) */
+  void mk_bound_candidates(const system::state_type* st, const std::vector<expr::value>& min, const std::vector<expr::value>& max);
+
+  /**
+   * Keep only the candidates that are true in the model, evaluated on the
+   * current state or on the next state. Returns the number of removed ones.
+   */
+  size_t filter(expr::model::ref m, bool next);
+
+  /** Simulate and remove the candidates that are false in reachable states */
+  void simulate(const system::transition_system* ts);
+
+  /** Remove the candidates until the rest is inductive */
+  void check_inductive(const system::transition_system* ts);
+
+public:
+
+  /** Construct the miner */
+  houdini(const system::context& ctx);
+
+  /** Run the miner on the transition system */
+  void run(const system::transition_system* ts, std::vector<system::state_formula*>& out);
+
+  /** Garbage collection */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+};
+
+}
+}
@@ -0,0 +1,48 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "houdini.h"
+#include <boost/program_options.hpp>
+
+namespace sally {
+namespace ai {
+
+struct houdini_info {
+
+  static void setup_options(boost::program_options::options_description& options) {
+    using namespace boost::program_options;
+    options.add_options()
+        ("houdini-simulation-steps", value<unsigned>()->default_value(20), "Number of simulation steps used to filter the candidates.")
+        ("houdini-max-candidates", value<unsigned>()->default_value(10000), "Maximal number of candidates to generate.")
+        ;
+  }
+
+  static std::string get_id() {
+    return "houdini";
+  }
+
+  static abstract_interpreter* new_instance(const system::context& ctx) {
+    return new houdini(ctx);
+  }
+
+};
+
+}
+}
@@ -38,7 +38,9 @@ switch (d_type) {
   CASE_TO_STRING(DEFINE_TRANSITION)
   CASE_TO_STRING(DEFINE_TRANSITION_SYSTEM)
   CASE_TO_STRING(ASSUME)
+  CASE_TO_STRING(INVARIANT)
   CASE_TO_STRING(QUERY)
+  CASE_TO_STRING(LIVENESS_QUERY)
 default:
   assert(false);
 }
@@ -48,6 +50,24 @@ return "unknown";
 #undef CASE_TO_STRING
 }
 
+void command::start_budget(const system::context* ctx) {
+  const options& opts = ctx->get_options();
+  double time_limit = 0;
+  size_t memory_limit = 0;
+  if (opts.has_option("query-time-limit")) {
+    time_limit = opts.get_double("query-time-limit");
+  }
+  if (opts.has_option("query-memory-limit")) {
+    memory_limit = opts.get_unsigned("query-memory-limit");
+  }
+  utils::budget::start(time_limit, memory_limit);
+}
+
+void command::report_budget_exhausted(const system::context* ctx, const utils::budget_exhausted& e) {
+  std::cerr << "query interrupted: " << e.get_message() << std::endl;
+  ctx->get_statistics().named_values_to_stream(std::cerr);
+}
+
 std::ostream& operator << (std::ostream& out, const command& cmd) {
   cmd.to_stream(out);
   return out;
@@ -22,6 +22,7 @@
 
 #include "system/context.h"
 #include "engine/engine.h"
+#include "utils/budget.h"
 
 namespace sally {
 namespace cmd {
@@ -34,7 +35,9 @@ enum type {
   DEFINE_TRANSITION,
   DEFINE_TRANSITION_SYSTEM,
   ASSUME,
-  QUERY
+  INVARIANT,
+  QUERY,
+  LIVENESS_QUERY
 };
 
 class command {
@@ -58,6 +61,14 @@ public:
   /** Run the command */
   virtual void run(system::context* ctx, engine* e) {};
 
+protected:
+
+  /** Start the budget of a query as set in the options (if any) */
+  static void start_budget(const system::context* ctx);
+
+  /** Report the reason and the progress of a query that ran out of budget */
+  static void report_budget_exhausted(const system::context* ctx, const utils::budget_exhausted& e);
+
 private:
 
   /** Type of command */
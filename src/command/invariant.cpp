@@ -0,0 +1,30 @@
+#include "invariant.h"
+
+#include <iostream>
+
+namespace sally {
+namespace cmd {
+
+invariant::invariant(const system::context& ctx, std::string system_id, system::state_formula* invariant)
+: command(INVARIANT)
+, d_system_id(system_id)
+, d_invariant(invariant)
+{}
+
+void invariant::to_stream(std::ostream& out) const  {
+  out << "[" << get_command_type_string() << " " << d_system_id << " " << *d_invariant << "]";
+}
+
+void invariant::run(system::context* ctx, engine* e) {
+  // Add the invariant
+  ctx->add_invariant_to(d_system_id, d_invariant);
+  // Taken by the context
+  d_invariant = 0;
+}
+
+invariant::~invariant() {
+  delete d_invariant;
+}
+
+}
+}
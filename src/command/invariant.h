@@ -0,0 +1,42 @@
+#pragma once
+
+#include "command.h"
+
+#include "system/context.h"
+#include "system/state_formula.h"
+
+namespace sally {
+namespace cmd {
+
+/** Command to add a (trusted) invariant to the system. */
+class invariant : public command {
+
+  /** Id of the system this invariant is about */
+  std::string d_system_id;
+
+  /** The invariant formula */
+  system::state_formula* d_invariant;
+
+public:
+
+  /** Command takes over the state formula */
+  invariant(const system::context& ctx, std::string system_id, system::state_formula* invariant);
+
+  /** Command owns the invariant, so we delete it */
+  ~invariant();
+
+  /** Get the id of the system */
+  std::string get_system_id() const { return d_system_id; }
+
+  /** Get the invariant */
+  const system::state_formula* get_invariant() const { return d_invariant; }
+
+  /** Run the command on an engine */
+  void run(system::context* ctx, engine* e);
+
+  /** Output the command to stream */
+  void to_stream(std::ostream& out) const;
+};
+
+}
+}
@@ -0,0 +1,61 @@
+#include "liveness_query.h"
+
+#include <iostream>
+
+namespace sally {
+namespace cmd {
+
+liveness_query::liveness_query(const system::context& ctx, std::string system_id, system::state_formula* goal, system::state_formula* fairness)
+: command(LIVENESS_QUERY)
+, d_system_id(system_id)
+, d_goal(goal)
+, d_fairness(fairness)
+{}
+
+void liveness_query::to_stream(std::ostream& out) const  {
+  out << "[" << get_command_type_string() << " " << d_system_id << " " << *d_goal;
+  if (d_fairness) {
+    out << " " << *d_fairness;
+  }
+  out << "]";
+}
+
+void liveness_query::run(system::context* ctx, engine* e) {
+  // If in parse only mode, we're done
+  if (ctx->get_options().has_option("parse-only")) { return; }
+  // We need an engine
+  if (e == 0) { throw exception("Engine needed to do a query."); }
+  // Get the transition system
+  const system::transition_system* T = ctx->get_transition_system(d_system_id);
+  // Check the property
+  engine::result result;
+  start_budget(ctx);
+  try {
+    result = e->query_liveness(T, d_goal, d_fairness);
+  } catch (const utils::budget_exhausted& ex) {
+    report_budget_exhausted(ctx, ex);
+    result = engine::INTERRUPTED;
+  }
+  utils::budget::stop();
+  // Output the result if not silent
+  if (result != engine::SILENT) {
+    std::cout << result << std::endl;
+  }
+  // If invalid, and asked to, show the trace
+  if (result == engine::INVALID && ctx->get_options().has_option("show-trace")) {
+    const system::trace_helper* trace = e->get_trace();
+    std::cout << *trace << std::endl;
+  }
+  // If asked to, show the statistics
+  if (ctx->get_options().has_option("show-stats")) {
+    ctx->get_statistics().named_values_to_stream(std::cout);
+  }
+}
+
+liveness_query::~liveness_query() {
+  delete d_goal;
+  delete d_fairness;
+}
+
+}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "command.h"
+
+#include "system/context.h"
+#include "system/state_formula.h"
+
+namespace sally {
+namespace cmd {
+
+/**
+ * Command to query a liveness property of a system: all fair paths
+ * eventually reach the goal.
+ */
+class liveness_query : public command {
+
+  /** Id of the system this query is about */
+  std::string d_system_id;
+
+  /** The states to reach eventually */
+  system::state_formula* d_goal;
+
+  /** The fair states (null if all states are fair) */
+  system::state_formula* d_fairness;
+
+public:
+
+  /** Query takes over the state formulas, fairness can be null */
+  liveness_query(const system::context& ctx, std::string system_id, system::state_formula* goal, system::state_formula* fairness);
+
+  /** Command owns the formulas, so we delete them */
+  ~liveness_query();
+
+  /** Get the id of the system */
+  std::string get_system_id() const { return d_system_id; }
+
+  /** Run the command on an engine */
+  void run(system::context* ctx, engine* e);
+
+  /** Output the command to stream */
+  void to_stream(std::ostream& out) const;
+};
+
+}
+}
@@ -36,7 +36,15 @@ void query::run(system::context* ctx, engine* e) {
   const system::transition_system* T = ctx->get_transition_system(d_system_id);
   // Check the formula
   for (size_t i = 0; i < d_queries.size(); ++ i) {
-    engine::result result = e->query(T, d_queries[i]);
+    engine::result result;
+    start_budget(ctx);
+    try {
+      result = e->query(T, d_queries[i]);
+    } catch (const utils::budget_exhausted& ex) {
+      report_budget_exhausted(ctx, ex);
+      result = engine::INTERRUPTED;
+    }
+    utils::budget::stop();
     // Output the result if not silent
     if (result != engine::SILENT) {
       std::cout << result << std::endl;
@@ -56,6 +64,10 @@ void query::run(system::context* ctx, engine* e) {
       ctx->tm().pop_namespace();
       ctx->tm().pop_namespace();
     }
+    // If asked to, show the statistics
+    if (ctx->get_options().has_option("show-stats")) {
+      ctx->get_statistics().named_values_to_stream(std::cout);
+    }
   }
 }
 
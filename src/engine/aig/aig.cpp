@@ -0,0 +1,132 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "engine/aig/aig.h"
+
+#include <algorithm>
+
+namespace sally {
+namespace aig {
+
+const graph::lit graph::lit_false;
+const graph::lit graph::lit_true;
+
+graph::graph()
+: d_ands(0)
+{
+  // The constant
+  d_left.push_back(0);
+  d_right.push_back(0);
+  d_is_input.push_back(false);
+}
+
+graph::lit graph::mk_input() {
+  unsigned node = size();
+  d_left.push_back(0);
+  d_right.push_back(0);
+  d_is_input.push_back(true);
+  return mk_lit(node, false);
+}
+
+graph::lit graph::mk_and(lit a, lit b) {
+
+  if (a > b) {
+    std::swap(a, b);
+  }
+
+  // Constants, a & a, a & !a
+  if (a == lit_false) { return lit_false; }
+  if (a == lit_true) { return b; }
+  if (a == b) { return a; }
+  if (a == neg(b)) { return lit_false; }
+
+  // Two-level rules, a = (x & y)
+  for (int i = 0; i < 2; ++ i) {
+    lit p = i == 0 ? a : b;
+    lit q = i == 0 ? b : a;
+    unsigned p_node = node_of(p);
+    if (!is_and(p_node)) {
+      continue;
+    }
+    lit x = d_left[p_node], y = d_right[p_node];
+    if (!is_negated(p)) {
+      // (x & y) & x = x & y
+      if (q == x || q == y) { return p; }
+      // (x & y) & !x = false
+      if (q == neg(x) || q == neg(y)) { return lit_false; }
+      // (x & y) & (u & v) = false, if u = !x, ...
+      if (is_and_lit(q)) {
+        lit u = d_left[node_of(q)], v = d_right[node_of(q)];
+        if (u == neg(x) || u == neg(y) || v == neg(x) || v == neg(y)) {
+          return lit_false;
+        }
+      }
+    } else {
+      // !(x & y) & !x = !x
+      if (q == neg(x) || q == neg(y)) { return q; }
+      // !(x & y) & x = !y & x
+      if (q == x) { return mk_and(q, neg(y)); }
+      if (q == y) { return mk_and(q, neg(x)); }
+    }
+  }
+
+  // Structural hashing
+  uint64_t key = (((uint64_t) a) << 32) | b;
+  boost::unordered_map<uint64_t, unsigned>::const_iterator find = d_strash.find(key);
+  if (find != d_strash.end()) {
+    return mk_lit(find->second, false);
+  }
+
+  unsigned node = size();
+  d_left.push_back(a);
+  d_right.push_back(b);
+  d_is_input.push_back(false);
+  d_strash[key] = node;
+  d_ands ++;
+  return mk_lit(node, false);
+}
+
+graph::lit graph::mk_or(lit a, lit b) {
+  return neg(mk_and(neg(a), neg(b)));
+}
+
+graph::lit graph::mk_xor(lit a, lit b) {
+  return mk_or(mk_and(a, neg(b)), mk_and(neg(a), b));
+}
+
+graph::lit graph::mk_eq(lit a, lit b) {
+  return neg(mk_xor(a, b));
+}
+
+graph::lit graph::mk_ite(lit c, lit a, lit b) {
+  if (a == b) { return a; }
+  return mk_or(mk_and(c, a), mk_and(neg(c), b));
+}
+
+void graph::simulate(std::vector<uint64_t>& values) const {
+  values.resize(size());
+  values[0] = 0;
+  for (unsigned node = 1; node < size(); ++ node) {
+    if (!d_is_input[node]) {
+      values[node] = value_of(values, d_left[node]) & value_of(values, d_right[node]);
+    }
+  }
+}
+
+}
+}
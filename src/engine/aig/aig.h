@@ -0,0 +1,122 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <boost/unordered_map.hpp>
+
+namespace sally {
+namespace aig {
+
+/**
+ * An and-inverter graph. Node 0 is the constant false, the other nodes are
+ * either inputs or two-input and gates. Literals are 2*node + sign, so the
+ * literal 0 is false and 1 is true. The and gates are structurally hashed
+ * and simplified locally (constants, a & a, a & !a, and two-level rules
+ * when the children are and gates themselves). Nodes are only created
+ * after their children, so the node order is topological.
+ */
+class graph {
+
+public:
+
+  typedef unsigned lit;
+
+  static const lit lit_false = 0;
+  static const lit lit_true = 1;
+
+  static lit mk_lit(unsigned node, bool negated) { return 2*node + (negated ? 1 : 0); }
+  static lit neg(lit l) { return l ^ 1; }
+  static lit neg_if(lit l, bool negated) { return negated ? l ^ 1 : l; }
+  static unsigned node_of(lit l) { return l >> 1; }
+  static bool is_negated(lit l) { return l & 1; }
+
+private:
+
+  /** Children of the and gates (both 0 for inputs and the constant) */
+  std::vector<lit> d_left, d_right;
+
+  /** Is the node an input */
+  std::vector<bool> d_is_input;
+
+  /** Structural hashing of the and gates */
+  boost::unordered_map<uint64_t, unsigned> d_strash;
+
+  /** Number of and gates */
+  size_t d_ands;
+
+  /** Is the literal a positive and gate */
+  bool is_and_lit(lit l) const { return !is_negated(l) && is_and(node_of(l)); }
+
+public:
+
+  graph();
+
+  /** Make a new input */
+  lit mk_input();
+
+  /** Make a & b */
+  lit mk_and(lit a, lit b);
+
+  /** Make a | b */
+  lit mk_or(lit a, lit b);
+
+  /** Make a ^ b */
+  lit mk_xor(lit a, lit b);
+
+  /** Make a <=> b */
+  lit mk_eq(lit a, lit b);
+
+  /** Make c ? a : b */
+  lit mk_ite(lit c, lit a, lit b);
+
+  /** Number of nodes (including the constant) */
+  size_t size() const { return d_is_input.size(); }
+
+  /** Number of and gates */
+  size_t num_ands() const { return d_ands; }
+
+  /** Is the node an input */
+  bool is_input(unsigned node) const { return d_is_input[node]; }
+
+  /** Is the node an and gate */
+  bool is_and(unsigned node) const { return node > 0 && !d_is_input[node]; }
+
+  /** Left child of the and gate */
+  lit left(unsigned node) const { return d_left[node]; }
+
+  /** Right child of the and gate */
+  lit right(unsigned node) const { return d_right[node]; }
+
+  /**
+   * Simulate 64 patterns in parallel. The values of the input nodes must be
+   * set, and the values of the and gates are computed.
+   */
+  void simulate(std::vector<uint64_t>& values) const;
+
+  /** Value of the literal in the simulation */
+  static uint64_t value_of(const std::vector<uint64_t>& values, lit l) {
+    uint64_t v = values[node_of(l)];
+    return is_negated(l) ? ~v : v;
+  }
+};
+
+}
+}
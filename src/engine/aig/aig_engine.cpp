@@ -0,0 +1,591 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "engine/aig/aig_engine.h"
+
+#include "expr/gc_relocator.h"
+#include "utils/trace.h"
+#include "utils/budget.h"
+
+#include <map>
+#include <sstream>
+#include <iostream>
+#include <boost/random/mersenne_twister.hpp>
+
+namespace sally {
+namespace aig {
+
+/** Marks the frame literals that are not encoded yet */
+static const sat_solver::lit no_lit = (sat_solver::lit) -1;
+
+aig_engine::unroller::unroller(const circuit& c, sat_solver& solver)
+: d_circuit(c)
+, d_solver(solver)
+{
+  d_true = sat_solver::mk_lit(d_solver.new_var(), false);
+  d_solver.add_clause(d_true);
+}
+
+sat_solver::lit aig_engine::unroller::encode(size_t k, graph::lit l) {
+
+  const graph& g = d_circuit.g;
+  while (d_frames.size() <= k) {
+    d_frames.push_back(std::vector<sat_solver::lit>(g.size(), no_lit));
+  }
+
+  std::vector<sat_solver::lit>& frame = d_frames[k];
+  std::vector<unsigned> to_encode;
+  to_encode.push_back(graph::node_of(l));
+  while (!to_encode.empty()) {
+    unsigned node = to_encode.back();
+    if (frame[node] != no_lit) {
+      to_encode.pop_back();
+      continue;
+    }
+    if (node == 0) {
+      frame[node] = sat_solver::neg(d_true);
+    } else if (g.is_input(node)) {
+      // Latches take the next value from the previous frame
+      int latch = d_circuit.latch_of[node];
+      if (latch >= 0 && k > 0) {
+        frame[node] = encode(k - 1, d_circuit.next[latch]);
+      } else {
+        frame[node] = sat_solver::mk_lit(d_solver.new_var(), false);
+      }
+    } else {
+      unsigned a = graph::node_of(g.left(node));
+      unsigned b = graph::node_of(g.right(node));
+      if (frame[a] == no_lit || frame[b] == no_lit) {
+        if (frame[a] == no_lit) { to_encode.push_back(a); }
+        if (frame[b] == no_lit) { to_encode.push_back(b); }
+        continue;
+      }
+      // v <=> x & y
+      sat_solver::lit x = frame[a] ^ (graph::is_negated(g.left(node)) ? 1 : 0);
+      sat_solver::lit y = frame[b] ^ (graph::is_negated(g.right(node)) ? 1 : 0);
+      sat_solver::lit v = sat_solver::mk_lit(d_solver.new_var(), false);
+      d_solver.add_clause(sat_solver::neg(v), x);
+      d_solver.add_clause(sat_solver::neg(v), y);
+      d_solver.add_clause(v, sat_solver::neg(x), sat_solver::neg(y));
+      frame[node] = v;
+    }
+    to_encode.pop_back();
+  }
+
+  return frame[graph::node_of(l)] ^ (graph::is_negated(l) ? 1 : 0);
+}
+
+aig_engine::aig_engine(const system::context& ctx)
+: engine(ctx)
+, d_trace(0)
+, d_functions(ctx.tm())
+, d_invariant(expr::term_ref(), 0)
+{
+  d_stats.nodes = new utils::stat_int("aig::nodes", 0);
+  d_stats.latches = new utils::stat_int("aig::latches", 0);
+  d_stats.merged = new utils::stat_int("aig::merged", 0);
+  d_stats.bound = new utils::stat_int("aig::bound", 0);
+  ctx.get_statistics().add(new utils::stat_delimiter());
+  ctx.get_statistics().add(d_stats.nodes);
+  ctx.get_statistics().add(d_stats.latches);
+  ctx.get_statistics().add(d_stats.merged);
+  ctx.get_statistics().add(d_stats.bound);
+}
+
+aig_engine::~aig_engine() {}
+
+graph::lit aig_engine::convert(expr::term_ref t, term_to_lit_map& cache, const expr::term_ref_hash_map<expr::term_ref>& next_functions) {
+
+  graph& g = d_circuit.g;
+
+  // Post-order, the bool is true if the children have been pushed
+  std::vector< std::pair<expr::term_ref, bool> > to_convert;
+  to_convert.push_back(std::make_pair(t, false));
+  while (!to_convert.empty()) {
+    expr::term_ref current = to_convert.back().first;
+    if (cache.find(current) != cache.end()) {
+      to_convert.pop_back();
+      continue;
+    }
+
+    const expr::term& term = tm().term_of(current);
+    expr::term_op op = term.op();
+
+    // Children (next-state variables are replaced with their function)
+    std::vector<expr::term_ref> children;
+    if (op == expr::VARIABLE) {
+      expr::term_ref_hash_map<expr::term_ref>::const_iterator find = next_functions.find(current);
+      if (find == next_functions.end()) {
+        std::stringstream ss;
+        ss << "Unexpected variable in the aig engine: " << current;
+        throw exception(ss.str());
+      }
+      children.push_back(find->second);
+    } else if (op != expr::CONST_BOOL) {
+      for (size_t i = 0; i < term.size(); ++ i) {
+        children.push_back(term[i]);
+      }
+    }
+
+    if (!to_convert.back().second) {
+      to_convert.back().second = true;
+      for (size_t i = 0; i < children.size(); ++ i) {
+        if (cache.find(children[i]) == cache.end()) {
+          to_convert.push_back(std::make_pair(children[i], false));
+        }
+      }
+      continue;
+    }
+    to_convert.pop_back();
+
+    std::vector<graph::lit> lits;
+    for (size_t i = 0; i < children.size(); ++ i) {
+      lits.push_back(cache[children[i]]);
+    }
+
+    graph::lit result = graph::lit_false;
+    switch (op) {
+    case expr::CONST_BOOL:
+      result = tm().get_boolean_constant(term) ? graph::lit_true : graph::lit_false;
+      break;
+    case expr::VARIABLE:
+      result = lits[0];
+      break;
+    case expr::TERM_NOT:
+      result = graph::neg(lits[0]);
+      break;
+    case expr::TERM_AND:
+      result = graph::lit_true;
+      for (size_t i = 0; i < lits.size(); ++ i) {
+        result = g.mk_and(result, lits[i]);
+      }
+      break;
+    case expr::TERM_OR:
+      result = graph::lit_false;
+      for (size_t i = 0; i < lits.size(); ++ i) {
+        result = g.mk_or(result, lits[i]);
+      }
+      break;
+    case expr::TERM_XOR:
+      result = graph::lit_false;
+      for (size_t i = 0; i < lits.size(); ++ i) {
+        result = g.mk_xor(result, lits[i]);
+      }
+      break;
+    case expr::TERM_IMPLIES:
+      result = g.mk_or(graph::neg(lits[0]), lits[1]);
+      break;
+    case expr::TERM_EQ:
+      result = g.mk_eq(lits[0], lits[1]);
+      break;
+    case expr::TERM_ITE:
+      result = g.mk_ite(lits[0], lits[1], lits[2]);
+      break;
+    default: {
+      std::stringstream ss;
+      ss << "Unsupported term in the aig engine: " << current;
+      throw exception(ss.str());
+    }
+    }
+    cache[current] = result;
+  }
+
+  return cache[t];
+}
+
+void aig_engine::build(const system::transition_system* ts, const system::state_formula* sf) {
+
+  const system::state_type* st = ts->get_state_type();
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::term_ref>& x_next = st->get_variables(system::state_type::STATE_NEXT);
+  const std::vector<expr::term_ref>& input = st->get_variables(system::state_type::STATE_INPUT);
+
+  // Only Boolean variables
+  for (size_t i = 0; i < x.size() + input.size(); ++ i) {
+    expr::term_ref var = i < x.size() ? x[i] : input[i - x.size()];
+    if (tm().type_of(var) != tm().boolean_type()) {
+      throw exception("The aig engine only supports Boolean state and input variables.");
+    }
+  }
+
+  d_circuit = circuit();
+  graph& g = d_circuit.g;
+  term_to_lit_map cache;
+
+  // State variables, merged ones replaced with the representative
+  std::vector<int> merged(x.size(), -1);
+  for (size_t i = 0; i < d_equivalences.size(); ++ i) {
+    merged[d_equivalences[i].var] = i;
+  }
+  std::vector<size_t> latches;
+  d_circuit.state.resize(x.size());
+  for (size_t i = 0; i < x.size(); ++ i) {
+    if (merged[i] >= 0) {
+      const equivalence& eq = d_equivalences[merged[i]];
+      graph::lit rep = eq.rep < 0 ? graph::lit_false : d_circuit.state[eq.rep];
+      d_circuit.state[i] = graph::neg_if(rep, eq.negated);
+    } else {
+      d_circuit.state[i] = g.mk_input();
+      latches.push_back(i);
+    }
+    cache[x[i]] = d_circuit.state[i];
+  }
+
+  // Inputs
+  d_circuit.input.resize(input.size());
+  for (size_t i = 0; i < input.size(); ++ i) {
+    d_circuit.input[i] = g.mk_input();
+    cache[input[i]] = d_circuit.input[i];
+  }
+
+  // Next-state variables, either functions or free
+  bool functional = d_functions.extract(ts);
+  expr::term_ref_hash_map<expr::term_ref> next_functions;
+  for (size_t i = 0; i < x_next.size(); ++ i) {
+    if (functional && !d_functions.is_unconstrained(i)) {
+      next_functions[x_next[i]] = d_functions.get_function(i);
+    } else {
+      cache[x_next[i]] = g.mk_input();
+    }
+  }
+  d_circuit.next.resize(x_next.size());
+  for (size_t i = 0; i < x_next.size(); ++ i) {
+    d_circuit.next[i] = convert(x_next[i], cache, next_functions);
+  }
+
+  // The step constraints
+  if (functional) {
+    d_circuit.step = graph::lit_true;
+    const std::vector<expr::term_ref>& constraints = d_functions.get_constraints();
+    for (size_t i = 0; i < constraints.size(); ++ i) {
+      d_circuit.step = g.mk_and(d_circuit.step, convert(constraints[i], cache, next_functions));
+    }
+  } else {
+    d_circuit.step = convert(ts->get_transition_relation(), cache, next_functions);
+  }
+
+  // Initial states and the property
+  d_circuit.init = convert(ts->get_initial_states(), cache, next_functions);
+  d_circuit.property = convert(sf->get_formula(), cache, next_functions);
+
+  // Known invariants constrain all states (skip the ones we can't convert)
+  d_circuit.constraint = graph::lit_true;
+  std::vector<expr::term_ref> invariants;
+  ts->get_invariants(0, invariants);
+  for (size_t i = 0; i < invariants.size(); ++ i) {
+    try {
+      d_circuit.constraint = g.mk_and(d_circuit.constraint, convert(invariants[i], cache, next_functions));
+      d_circuit.invariants.push_back(invariants[i]);
+    } catch (const exception& e) {
+      MSG(1) << "AIG: skipping invariant " << invariants[i] << std::endl;
+    }
+  }
+
+  // Mark the latches
+  d_circuit.latch_of.assign(g.size(), -1);
+  for (size_t i = 0; i < latches.size(); ++ i) {
+    d_circuit.latch_of[graph::node_of(d_circuit.state[latches[i]])] = latches[i];
+  }
+
+  d_stats.nodes->get_value() = g.num_ands();
+  d_stats.latches->get_value() = latches.size();
+}
+
+/** Split the classes by the values of the members in the model, keep classes of size >= 2 */
+static
+void refine(std::vector< std::vector<graph::lit> >& classes, const sat_solver& solver, const std::vector<sat_solver::lit>& encoded) {
+  std::vector< std::vector<graph::lit> > refined;
+  size_t index = 0;
+  for (size_t i = 0; i < classes.size(); ++ i) {
+    const std::vector<graph::lit>& c = classes[i];
+    std::vector<graph::lit> same, different;
+    bool rep_value = solver.get_value(encoded[index]);
+    for (size_t j = 0; j < c.size(); ++ j, ++ index) {
+      if (solver.get_value(encoded[index]) == rep_value) {
+        same.push_back(c[j]);
+      } else {
+        different.push_back(c[j]);
+      }
+    }
+    if (same.size() > 1) { refined.push_back(same); }
+    if (different.size() > 1) { refined.push_back(different); }
+  }
+  classes.swap(refined);
+}
+
+void aig_engine::sweep() {
+
+  const circuit& c = d_circuit;
+  const graph& g = c.g;
+  size_t n = c.state.size();
+
+  sat_solver solver;
+  unroller u(c, solver);
+
+  // Frame 0 to frame 1, initial states with an activation literal
+  sat_solver::lit init = sat_solver::mk_lit(solver.new_var(), false);
+  solver.add_clause(sat_solver::neg(init), u.encode(0, c.init));
+  solver.add_clause(u.encode(0, c.constraint));
+  solver.add_clause(u.encode(0, c.step));
+  solver.add_clause(u.encode(1, c.constraint));
+  for (size_t i = 0; i < n; ++ i) {
+    u.encode(0, c.state[i]);
+  }
+
+  // Get an initial state to start the simulation from
+  std::vector<sat_solver::lit> assumptions(1, init);
+  if (solver.solve(assumptions) == sat_solver::UNSAT) {
+    MSG(1) << "AIG: no initial states" << std::endl;
+    return;
+  }
+
+  // Simulate 64 random traces, and collect the signatures of the latches
+  boost::random::mt19937 rng;
+  std::vector<uint64_t> values(g.size(), 0), state_values(n);
+  std::vector< std::vector<uint64_t> > signatures(n);
+  for (size_t i = 0; i < n; ++ i) {
+    state_values[i] = solver.get_value(u.encode(0, c.state[i])) ? ~(uint64_t) 0 : 0;
+  }
+  unsigned steps = ctx().get_options().get_unsigned("aig-sim-steps");
+  for (size_t step = 0; step < steps; ++ step) {
+    for (unsigned node = 1; node < g.size(); ++ node) {
+      if (g.is_input(node)) {
+        values[node] = (((uint64_t) rng()) << 32) | rng();
+      }
+    }
+    for (size_t i = 0; i < n; ++ i) {
+      values[graph::node_of(c.state[i])] = state_values[i];
+      signatures[i].push_back(state_values[i]);
+    }
+    g.simulate(values);
+    for (size_t i = 0; i < n; ++ i) {
+      state_values[i] = graph::value_of(values, c.next[i]);
+    }
+  }
+
+  // Candidate classes by signature (up to negation), with the constant class first
+  std::vector< std::vector<graph::lit> > classes;
+  std::map< std::vector<uint64_t>, size_t > class_of;
+  class_of[std::vector<uint64_t>(steps, 0)] = 0;
+  classes.push_back(std::vector<graph::lit>(1, graph::lit_false));
+  for (size_t i = 0; i < n; ++ i) {
+    std::vector<uint64_t>& s = signatures[i];
+    bool negated = !s.empty() && (s[0] & 1);
+    if (negated) {
+      for (size_t j = 0; j < s.size(); ++ j) { s[j] = ~s[j]; }
+    }
+    std::map< std::vector<uint64_t>, size_t >::const_iterator find = class_of.find(s);
+    if (find == class_of.end()) {
+      class_of[s] = classes.size();
+      classes.push_back(std::vector<graph::lit>());
+    }
+    classes[class_of[s]].push_back(graph::neg_if(c.state[i], negated));
+  }
+  std::vector< std::vector<graph::lit> > candidates;
+  for (size_t i = 0; i < classes.size(); ++ i) {
+    if (classes[i].size() > 1) {
+      candidates.push_back(classes[i]);
+    }
+  }
+  classes.swap(candidates);
+
+  // Refine until the equivalences hold initially (frame 0), and are inductive (frame 0 to 1)
+  for (size_t frame = 0; frame < 2 && !classes.empty(); ) {
+
+    utils::budget::check();
+
+    // Activate with act, and assume the equivalences at frame 0 in the inductive check
+    sat_solver::lit act = sat_solver::mk_lit(solver.new_var(), false);
+    std::vector<sat_solver::lit> encoded, some_different(1, sat_solver::neg(act));
+    for (size_t i = 0; i < classes.size(); ++ i) {
+      sat_solver::lit rep = u.encode(frame, classes[i][0]);
+      sat_solver::lit rep_0 = u.encode(0, classes[i][0]);
+      for (size_t j = 0; j < classes[i].size(); ++ j) {
+        sat_solver::lit member = u.encode(frame, classes[i][j]);
+        encoded.push_back(member);
+        if (j == 0) { continue; }
+        if (frame > 0) {
+          sat_solver::lit member_0 = u.encode(0, classes[i][j]);
+          solver.add_clause(sat_solver::neg(act), sat_solver::neg(rep_0), member_0);
+          solver.add_clause(sat_solver::neg(act), rep_0, sat_solver::neg(member_0));
+        }
+        sat_solver::lit d = sat_solver::mk_lit(solver.new_var(), false);
+        solver.add_clause(sat_solver::neg(d), rep, member);
+        solver.add_clause(sat_solver::neg(d), sat_solver::neg(rep), sat_solver::neg(member));
+        some_different.push_back(d);
+      }
+    }
+    solver.add_clause(some_different);
+
+    assumptions.clear();
+    if (frame == 0) {
+      assumptions.push_back(init);
+    }
+    assumptions.push_back(act);
+    sat_solver::result r = solver.solve(assumptions);
+    solver.add_clause(sat_solver::neg(act));
+
+    if (r == sat_solver::SAT) {
+      refine(classes, solver, encoded);
+    } else {
+      frame ++;
+    }
+  }
+
+  // The equivalences, the representative is the first one in the class
+  for (size_t i = 0; i < classes.size(); ++ i) {
+    graph::lit rep = classes[i][0];
+    for (size_t j = 1; j < classes[i].size(); ++ j) {
+      graph::lit member = classes[i][j];
+      int var = c.latch_of[graph::node_of(member)];
+      bool negated = graph::is_negated(rep) != graph::is_negated(member);
+      int rep_var = rep == graph::lit_false ? -1 : c.latch_of[graph::node_of(rep)];
+      d_equivalences.push_back(equivalence(var, rep_var, rep_var < 0 ? graph::is_negated(member) : negated));
+    }
+  }
+}
+
+void aig_engine::set_trace_model(unroller& u, const sat_solver& solver, size_t k) {
+  const circuit& c = d_circuit;
+  expr::model::ref m = new expr::model(tm(), false);
+  for (size_t i = 0; i <= k; ++ i) {
+    const std::vector<expr::term_ref>& x = d_trace->get_state_variables(i);
+    for (size_t j = 0; j < x.size(); ++ j) {
+      m->set_variable_value(x[j], expr::value(solver.get_value(u.encode(i, c.state[j]))));
+    }
+    if (i < k) {
+      const std::vector<expr::term_ref>& input = d_trace->get_input_variables(i);
+      for (size_t j = 0; j < input.size(); ++ j) {
+        m->set_variable_value(input[j], expr::value(solver.get_value(u.encode(i, c.input[j]))));
+      }
+    }
+  }
+  d_trace->set_model(m, 0, k);
+}
+
+expr::term_ref aig_engine::get_equivalences(const system::transition_system* ts) const {
+  const std::vector<expr::term_ref>& x = ts->get_state_type()->get_variables(system::state_type::STATE_CURRENT);
+  std::vector<expr::term_ref> conjuncts;
+  for (size_t i = 0; i < d_equivalences.size(); ++ i) {
+    const equivalence& eq = d_equivalences[i];
+    expr::term_ref var = x[eq.var];
+    if (eq.rep < 0) {
+      conjuncts.push_back(eq.negated ? var : tm().mk_term(expr::TERM_NOT, var));
+    } else {
+      expr::term_ref rep = x[eq.rep];
+      if (eq.negated) {
+        rep = tm().mk_term(expr::TERM_NOT, rep);
+      }
+      conjuncts.push_back(tm().mk_term(expr::TERM_EQ, var, rep));
+    }
+  }
+  return tm().mk_and(conjuncts);
+}
+
+engine::result aig_engine::query(const system::transition_system* ts, const system::state_formula* sf) {
+
+  // The trace we are building
+  d_trace = ts->get_trace_helper();
+  d_trace->clear_model();
+
+  // Build the circuit, and merge the equivalent latches
+  d_equivalences.clear();
+  build(ts, sf);
+  if (!ctx().get_options().get_bool("aig-no-sweep")) {
+    sweep();
+    if (!d_equivalences.empty()) {
+      build(ts, sf);
+    }
+  }
+  d_stats.merged->get_value() = d_equivalences.size();
+  MSG(1) << "AIG: " << d_circuit.g.num_ands() << " and gates, " << d_stats.latches->get_value() << " latches, " << d_equivalences.size() << " merged" << std::endl;
+
+  const circuit& c = d_circuit;
+  unsigned aig_max = ctx().get_options().get_unsigned("aig-max");
+
+  // BMC in solver1, induction in solver2, as in k-induction
+  sat_solver solver1, solver2;
+  unroller u1(c, solver1), u2(c, solver2);
+  solver1.add_clause(u1.encode(0, c.init));
+
+  for (size_t k = 0; ; ++ k) {
+
+    // Did we go overboard
+    if (k >= aig_max) {
+      return UNKNOWN;
+    }
+
+    // Stop if out of budget
+    utils::budget::check();
+    d_stats.bound->get_value() = k;
+
+    // Frame k of BMC, encode the variables for the trace
+    solver1.add_clause(u1.encode(k, c.constraint));
+    for (size_t i = 0; i < c.state.size(); ++ i) {
+      u1.encode(k, c.state[i]);
+    }
+    for (size_t i = 0; k > 0 && i < c.input.size(); ++ i) {
+      u1.encode(k - 1, c.input[i]);
+    }
+
+    MSG(1) << "AIG: checking initialization " << k << std::endl;
+    std::vector<sat_solver::lit> assumptions(1, sat_solver::neg(u1.encode(k, c.property)));
+    if (solver1.solve(assumptions) == sat_solver::SAT) {
+      set_trace_model(u1, solver1, k);
+      return INVALID;
+    }
+    solver1.add_clause(u1.encode(k, c.property));
+    solver1.add_clause(u1.encode(k, c.step));
+
+    // Induction, P at 0..k implies P at k + 1
+    MSG(1) << "AIG: checking consecution " << k << std::endl;
+    solver2.add_clause(u2.encode(k, c.constraint));
+    solver2.add_clause(u2.encode(k, c.property));
+    solver2.add_clause(u2.encode(k, c.step));
+    solver2.add_clause(u2.encode(k + 1, c.constraint));
+    assumptions[0] = sat_solver::neg(u2.encode(k + 1, c.property));
+    if (solver2.solve(assumptions) == sat_solver::UNSAT) {
+      // The constraint was assumed in every frame, so the known invariants
+      // it came from are part of the k-inductive invariant
+      std::vector<expr::term_ref> conjuncts(c.invariants);
+      conjuncts.push_back(sf->get_formula());
+      if (!d_equivalences.empty()) {
+        conjuncts.push_back(get_equivalences(ts));
+      }
+      d_invariant = invariant(tm().mk_and(conjuncts), k + 1);
+      return VALID;
+    }
+  }
+
+  return UNKNOWN;
+}
+
+const system::trace_helper* aig_engine::get_trace() {
+  return d_trace;
+}
+
+engine::invariant aig_engine::get_invariant() {
+  return d_invariant;
+}
+
+void aig_engine::gc_collect(const expr::gc_relocator& gc_reloc) {
+  d_functions.gc_collect(gc_reloc);
+}
+
+}
+}
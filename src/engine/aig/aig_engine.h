@@ -0,0 +1,151 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "system/context.h"
+#include "system/trace_helper.h"
+#include "system/transition_functions.h"
+#include "engine/engine.h"
+#include "engine/aig/aig.h"
+#include "engine/aig/sat_solver.h"
+#include "expr/term_map.h"
+
+#include <vector>
+
+namespace sally {
+namespace aig {
+
+/**
+ * Bit-level engine for Boolean systems, such as the ones coming from
+ * AIGER inputs. The transition system is converted once to an
+ * and-inverter graph, where the state variables are latches with their
+ * next-state functions (or free inputs if the transition relation is not
+ * functional). Equivalent latches (up to negation and constants) are found
+ * by simulation and proved by SAT induction, and then merged. The property
+ * is checked with BMC and k-induction on the graph, using a built-in SAT
+ * solver, without going through the SMT layer.
+ */
+class aig_engine : public engine {
+
+  /** The system as an and-inverter graph */
+  struct circuit {
+    /** The graph */
+    graph g;
+    /** Literal of each state variable (the representative for merged ones) */
+    std::vector<graph::lit> state;
+    /** Literal of the next value of each state variable */
+    std::vector<graph::lit> next;
+    /** Literal of each input variable */
+    std::vector<graph::lit> input;
+    /** The state variable of each latch node (-1 if not a latch) */
+    std::vector<int> latch_of;
+    /** Initial states */
+    graph::lit init;
+    /** The property */
+    graph::lit property;
+    /** Constraints on the step (over the current, input and next literals) */
+    graph::lit step;
+    /** Constraints on all states (assumptions and known invariants) */
+    graph::lit constraint;
+    /** The known invariants in constraint */
+    std::vector<expr::term_ref> invariants;
+  };
+
+  /** Variable var is equal to the variable rep (or false if rep < 0), negated if needed */
+  struct equivalence {
+    size_t var;
+    int rep;
+    bool negated;
+    equivalence(size_t var, int rep, bool negated)
+    : var(var), rep(rep), negated(negated) {}
+  };
+
+  /** Unrolls the circuit into the SAT solver, one copy of the graph per frame */
+  class unroller {
+    const circuit& d_circuit;
+    sat_solver& d_solver;
+    sat_solver::lit d_true;
+    std::vector< std::vector<sat_solver::lit> > d_frames;
+  public:
+    unroller(const circuit& c, sat_solver& solver);
+    /** Get the SAT literal of the graph literal in frame k */
+    sat_solver::lit encode(size_t k, graph::lit l);
+  };
+
+  /** Cache of converted terms */
+  typedef expr::term_ref_hash_map<graph::lit> term_to_lit_map;
+
+  /** The trace we're building */
+  system::trace_helper* d_trace;
+
+  /** The next-state functions */
+  system::transition_functions d_functions;
+
+  /** The current circuit */
+  circuit d_circuit;
+
+  /** The proved equivalences of the latches */
+  std::vector<equivalence> d_equivalences;
+
+  /** The invariant, if proved */
+  invariant d_invariant;
+
+  /** Statistics */
+  struct stats {
+    utils::stat_int* nodes;
+    utils::stat_int* latches;
+    utils::stat_int* merged;
+    utils::stat_int* bound;
+  } d_stats;
+
+  /** Convert the term to the graph, with the variables already in the cache */
+  graph::lit convert(expr::term_ref t, term_to_lit_map& cache, const expr::term_ref_hash_map<expr::term_ref>& next_functions);
+
+  /** Build the circuit of the system, merging the latches in d_equivalences */
+  void build(const system::transition_system* ts, const system::state_formula* sf);
+
+  /** Find the equivalent latches in the circuit, and put them into d_equivalences */
+  void sweep();
+
+  /** Set the model of the trace helper from the BMC unrolling of depth k */
+  void set_trace_model(unroller& u, const sat_solver& solver, size_t k);
+
+  /** The equivalences as a state formula */
+  expr::term_ref get_equivalences(const system::transition_system* ts) const;
+
+public:
+
+  aig_engine(const system::context& ctx);
+  ~aig_engine();
+
+  /** Query */
+  result query(const system::transition_system* ts, const system::state_formula* sf);
+
+  /** Trace */
+  const system::trace_helper* get_trace();
+
+  /** Invariant */
+  invariant get_invariant();
+
+  /** Collect the terms */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+};
+
+}
+}
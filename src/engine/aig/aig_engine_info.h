@@ -0,0 +1,50 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "engine/aig/aig_engine.h"
+
+#include <boost/program_options/options_description.hpp>
+
+namespace sally {
+namespace aig {
+
+struct aig_engine_info {
+
+  static void setup_options(boost::program_options::options_description& options) {
+    using namespace boost::program_options;
+    options.add_options()
+        ("aig-max", value<unsigned>()->default_value(10), "Maximal k for BMC and k-induction on the and-inverter graph.")
+        ("aig-no-sweep", "Don't merge the equivalent latches.")
+        ("aig-sim-steps", value<unsigned>()->default_value(32), "Number of simulation steps to find the candidate equivalent latches.")
+        ;
+  }
+
+  static std::string get_id() {
+    return "aig";
+  }
+
+  static engine* new_instance(const system::context& ctx) {
+    return new aig_engine(ctx);
+  }
+
+};
+
+}
+}
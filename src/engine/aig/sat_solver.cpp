@@ -0,0 +1,431 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "engine/aig/sat_solver.h"
+
+#include "utils/budget.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace sally {
+namespace aig {
+
+const size_t sat_solver::no_reason;
+
+sat_solver::sat_solver()
+: d_activity_inc(1)
+, d_propagate_head(0)
+, d_ok(true)
+, d_conflicts(0)
+{}
+
+unsigned sat_solver::new_var() {
+  unsigned var = d_value.size();
+  d_value.push_back(L_UNDEF);
+  d_level.push_back(0);
+  d_reason.push_back(no_reason);
+  d_phase.push_back(false);
+  d_activity.push_back(0);
+  d_heap_index.push_back(-1);
+  d_seen.push_back(false);
+  d_watches.resize(2*d_value.size());
+  heap_insert(var);
+  return var;
+}
+
+sat_solver::lbool sat_solver::value(lit l) const {
+  unsigned char v = d_value[var_of(l)];
+  if (v == L_UNDEF) {
+    return L_UNDEF;
+  }
+  return (lbool) (v ^ (is_negated(l) ? 1 : 0));
+}
+
+void sat_solver::assign(lit l, size_t reason) {
+  unsigned var = var_of(l);
+  d_value[var] = is_negated(l) ? L_FALSE : L_TRUE;
+  d_level[var] = decision_level();
+  d_reason[var] = reason;
+  d_trail.push_back(l);
+}
+
+void sat_solver::add_clause(lit l1) {
+  std::vector<lit> clause(1, l1);
+  add_clause(clause);
+}
+
+void sat_solver::add_clause(lit l1, lit l2) {
+  std::vector<lit> clause;
+  clause.push_back(l1);
+  clause.push_back(l2);
+  add_clause(clause);
+}
+
+void sat_solver::add_clause(lit l1, lit l2, lit l3) {
+  std::vector<lit> clause;
+  clause.push_back(l1);
+  clause.push_back(l2);
+  clause.push_back(l3);
+  add_clause(clause);
+}
+
+void sat_solver::add_clause(const std::vector<lit>& clause_in) {
+
+  if (!d_ok) {
+    return;
+  }
+
+  // Remove duplicates, and false literals, check if satisfied (at level 0)
+  std::vector<lit> clause(clause_in);
+  std::sort(clause.begin(), clause.end());
+  size_t j = 0;
+  for (size_t i = 0; i < clause.size(); ++ i) {
+    lit l = clause[i];
+    if (value(l) == L_TRUE || (j > 0 && clause[j-1] == neg(l))) {
+      return;
+    }
+    if (value(l) == L_FALSE || (j > 0 && clause[j-1] == l)) {
+      continue;
+    }
+    clause[j++] = l;
+  }
+  clause.resize(j);
+
+  if (clause.empty()) {
+    d_ok = false;
+    return;
+  }
+
+  if (clause.size() == 1) {
+    assign(clause[0], no_reason);
+    if (propagate() != no_reason) {
+      d_ok = false;
+    }
+    return;
+  }
+
+  size_t index = d_clauses.size();
+  d_clauses.push_back(clause);
+  d_watches[clause[0]].push_back(index);
+  d_watches[clause[1]].push_back(index);
+}
+
+size_t sat_solver::propagate() {
+  while (d_propagate_head < d_trail.size()) {
+    lit false_lit = neg(d_trail[d_propagate_head ++]);
+    std::vector<size_t>& watches = d_watches[false_lit];
+    size_t i = 0, j = 0, n = watches.size();
+    while (i < n) {
+      size_t c_index = watches[i ++];
+      std::vector<lit>& c = d_clauses[c_index];
+      // Make sure the false literal is the second one
+      if (c[0] == false_lit) {
+        std::swap(c[0], c[1]);
+      }
+      // Satisfied by the first one
+      if (value(c[0]) == L_TRUE) {
+        watches[j ++] = c_index;
+        continue;
+      }
+      // Look for a new literal to watch
+      bool found = false;
+      for (size_t k = 2; k < c.size(); ++ k) {
+        if (value(c[k]) != L_FALSE) {
+          std::swap(c[1], c[k]);
+          d_watches[c[1]].push_back(c_index);
+          found = true;
+          break;
+        }
+      }
+      if (found) {
+        continue;
+      }
+      // Unit or conflict
+      watches[j ++] = c_index;
+      if (value(c[0]) == L_FALSE) {
+        while (i < n) {
+          watches[j ++] = watches[i ++];
+        }
+        watches.resize(j);
+        d_propagate_head = d_trail.size();
+        return c_index;
+      }
+      assign(c[0], c_index);
+    }
+    watches.resize(j);
+  }
+  return no_reason;
+}
+
+void sat_solver::analyze(size_t conflict, std::vector<lit>& learnt, unsigned& backtrack_level) {
+
+  learnt.clear();
+  learnt.push_back(0);
+
+  int path = 0;
+  lit p = 0;
+  bool first = true;
+  size_t index = d_trail.size();
+  size_t c_index = conflict;
+
+  do {
+    const std::vector<lit>& c = d_clauses[c_index];
+    // The first literal of the reasons is the implied one
+    for (size_t k = first ? 0 : 1; k < c.size(); ++ k) {
+      unsigned var = var_of(c[k]);
+      if (!d_seen[var] && d_level[var] > 0) {
+        d_seen[var] = true;
+        bump(var);
+        if (d_level[var] >= decision_level()) {
+          path ++;
+        } else {
+          learnt.push_back(c[k]);
+        }
+      }
+    }
+    first = false;
+    // Next marked literal on the trail
+    do {
+      index --;
+    } while (!d_seen[var_of(d_trail[index])]);
+    p = d_trail[index];
+    c_index = d_reason[var_of(p)];
+    d_seen[var_of(p)] = false;
+    path --;
+  } while (path > 0);
+
+  learnt[0] = neg(p);
+
+  // Backtrack to the second highest level
+  backtrack_level = 0;
+  if (learnt.size() > 1) {
+    size_t max_i = 1;
+    for (size_t i = 2; i < learnt.size(); ++ i) {
+      if (d_level[var_of(learnt[i])] > d_level[var_of(learnt[max_i])]) {
+        max_i = i;
+      }
+    }
+    std::swap(learnt[1], learnt[max_i]);
+    backtrack_level = d_level[var_of(learnt[1])];
+  }
+
+  for (size_t i = 1; i < learnt.size(); ++ i) {
+    d_seen[var_of(learnt[i])] = false;
+  }
+}
+
+void sat_solver::backtrack(unsigned level) {
+  if (decision_level() <= level) {
+    return;
+  }
+  for (size_t i = d_trail.size(); i > d_trail_lim[level]; -- i) {
+    unsigned var = var_of(d_trail[i-1]);
+    d_phase[var] = d_value[var] == L_TRUE;
+    d_value[var] = L_UNDEF;
+    d_reason[var] = no_reason;
+    heap_insert(var);
+  }
+  d_trail.resize(d_trail_lim[level]);
+  d_trail_lim.resize(level);
+  d_propagate_head = d_trail.size();
+}
+
+void sat_solver::bump(unsigned var) {
+  d_activity[var] += d_activity_inc;
+  if (d_activity[var] > 1e100) {
+    for (size_t i = 0; i < d_activity.size(); ++ i) {
+      d_activity[i] *= 1e-100;
+    }
+    d_activity_inc *= 1e-100;
+  }
+  if (d_heap_index[var] >= 0) {
+    heap_up(d_heap_index[var]);
+  }
+}
+
+sat_solver::lit sat_solver::pick_branch() {
+  while (!d_heap.empty()) {
+    unsigned var = heap_pop();
+    if (d_value[var] == L_UNDEF) {
+      return mk_lit(var, !d_phase[var]);
+    }
+  }
+  return (lit) -1;
+}
+
+void sat_solver::heap_insert(unsigned var) {
+  if (d_heap_index[var] >= 0) {
+    return;
+  }
+  d_heap_index[var] = d_heap.size();
+  d_heap.push_back(var);
+  heap_up(d_heap.size() - 1);
+}
+
+void sat_solver::heap_up(size_t i) {
+  unsigned var = d_heap[i];
+  while (i > 0) {
+    size_t parent = (i - 1) / 2;
+    if (!heap_less(var, d_heap[parent])) {
+      break;
+    }
+    d_heap[i] = d_heap[parent];
+    d_heap_index[d_heap[i]] = i;
+    i = parent;
+  }
+  d_heap[i] = var;
+  d_heap_index[var] = i;
+}
+
+void sat_solver::heap_down(size_t i) {
+  unsigned var = d_heap[i];
+  for (;;) {
+    size_t child = 2*i + 1;
+    if (child >= d_heap.size()) {
+      break;
+    }
+    if (child + 1 < d_heap.size() && heap_less(d_heap[child + 1], d_heap[child])) {
+      child ++;
+    }
+    if (!heap_less(d_heap[child], var)) {
+      break;
+    }
+    d_heap[i] = d_heap[child];
+    d_heap_index[d_heap[i]] = i;
+    i = child;
+  }
+  d_heap[i] = var;
+  d_heap_index[var] = i;
+}
+
+unsigned sat_solver::heap_pop() {
+  unsigned var = d_heap[0];
+  d_heap_index[var] = -1;
+  d_heap[0] = d_heap.back();
+  d_heap.pop_back();
+  if (!d_heap.empty()) {
+    d_heap_index[d_heap[0]] = 0;
+    heap_down(0);
+  }
+  return var;
+}
+
+/** The Luby sequence (1, 1, 2, 1, 1, 2, 4, ...) */
+static
+double luby(size_t x) {
+  size_t size = 1, seq = 0;
+  while (size < x + 1) {
+    seq ++;
+    size = 2*size + 1;
+  }
+  while (size - 1 != x) {
+    size = (size - 1) >> 1;
+    seq --;
+    x = x % size;
+  }
+  return std::pow(2.0, (double) seq);
+}
+
+sat_solver::result sat_solver::solve(const std::vector<lit>& assumptions) {
+
+  if (!d_ok) {
+    return UNSAT;
+  }
+
+  std::vector<lit> learnt;
+  size_t restarts = 0;
+  size_t restart_conflicts = 0;
+  size_t restart_limit = 100 * luby(restarts);
+
+  try {
+    for (;;) {
+      size_t conflict = propagate();
+      if (conflict != no_reason) {
+        d_conflicts ++;
+        restart_conflicts ++;
+        if (decision_level() == 0) {
+          d_ok = false;
+          return UNSAT;
+        }
+        unsigned backtrack_level;
+        analyze(conflict, learnt, backtrack_level);
+        backtrack(backtrack_level);
+        if (learnt.size() == 1) {
+          assign(learnt[0], no_reason);
+        } else {
+          size_t index = d_clauses.size();
+          d_clauses.push_back(learnt);
+          d_watches[learnt[0]].push_back(index);
+          d_watches[learnt[1]].push_back(index);
+          assign(learnt[0], index);
+        }
+        d_activity_inc /= 0.95;
+        if (d_conflicts % 1000 == 0) {
+          utils::budget::check();
+        }
+        continue;
+      }
+
+      // Restart
+      if (restart_conflicts >= restart_limit) {
+        backtrack(0);
+        restart_conflicts = 0;
+        restart_limit = 100 * luby(++ restarts);
+        continue;
+      }
+
+      // Assumptions first, each at its own level
+      lit next = (lit) -1;
+      while (decision_level() < assumptions.size()) {
+        lit a = assumptions[decision_level()];
+        lbool a_value = value(a);
+        if (a_value == L_TRUE) {
+          d_trail_lim.push_back(d_trail.size());
+        } else if (a_value == L_FALSE) {
+          backtrack(0);
+          return UNSAT;
+        } else {
+          next = a;
+          break;
+        }
+      }
+
+      // Decide
+      if (next == (lit) -1) {
+        next = pick_branch();
+        if (next == (lit) -1) {
+          d_model.resize(d_value.size());
+          for (size_t i = 0; i < d_value.size(); ++ i) {
+            d_model[i] = d_value[i] == L_TRUE;
+          }
+          backtrack(0);
+          return SAT;
+        }
+      }
+      d_trail_lim.push_back(d_trail.size());
+      assign(next, no_reason);
+    }
+  } catch (...) {
+    backtrack(0);
+    throw;
+  }
+}
+
+}
+}
@@ -0,0 +1,161 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace sally {
+namespace aig {
+
+/**
+ * A small CDCL SAT solver for the bit-level engine: two watched literals,
+ * first-UIP learning, activity-based decisions with phase saving, Luby
+ * restarts, and solving under assumptions. Clauses can be added between
+ * calls to solve(). Literals are 2*var + sign.
+ */
+class sat_solver {
+
+public:
+
+  typedef unsigned lit;
+
+  enum result {
+    SAT,
+    UNSAT
+  };
+
+  static lit mk_lit(unsigned var, bool negated) { return 2*var + (negated ? 1 : 0); }
+  static lit neg(lit l) { return l ^ 1; }
+  static unsigned var_of(lit l) { return l >> 1; }
+  static bool is_negated(lit l) { return l & 1; }
+
+private:
+
+  /** Assignment values */
+  enum lbool {
+    L_FALSE = 0,
+    L_TRUE = 1,
+    L_UNDEF = 2
+  };
+
+  /** No reason (decisions and level 0 units) */
+  static const size_t no_reason = (size_t) -1;
+
+  /** All clauses, the first two literals are watched */
+  std::vector< std::vector<lit> > d_clauses;
+
+  /** For each literal, the clauses where it's watched */
+  std::vector< std::vector<size_t> > d_watches;
+
+  /** Current assignment of the variables */
+  std::vector<unsigned char> d_value;
+
+  /** Decision level of the assignment */
+  std::vector<unsigned> d_level;
+
+  /** Clause that implied the assignment */
+  std::vector<size_t> d_reason;
+
+  /** Saved phase */
+  std::vector<bool> d_phase;
+
+  /** Activity for the decisions */
+  std::vector<double> d_activity;
+
+  /** Activity increment */
+  double d_activity_inc;
+
+  /** Heap of variables by activity */
+  std::vector<unsigned> d_heap;
+
+  /** Position of variables in the heap (-1 if not in) */
+  std::vector<int> d_heap_index;
+
+  /** Assigned literals, in order */
+  std::vector<lit> d_trail;
+
+  /** Start of each decision level in the trail */
+  std::vector<size_t> d_trail_lim;
+
+  /** Next literal in the trail to propagate */
+  size_t d_propagate_head;
+
+  /** Marks for conflict analysis */
+  std::vector<bool> d_seen;
+
+  /** The model after SAT */
+  std::vector<bool> d_model;
+
+  /** False if the clauses are unsatisfiable */
+  bool d_ok;
+
+  /** Number of conflicts so far */
+  size_t d_conflicts;
+
+  lbool value(lit l) const;
+  void assign(lit l, size_t reason);
+  size_t propagate();
+  void analyze(size_t conflict, std::vector<lit>& learnt, unsigned& backtrack_level);
+  void backtrack(unsigned level);
+  void bump(unsigned var);
+  lit pick_branch();
+
+  void heap_insert(unsigned var);
+  void heap_up(size_t i);
+  void heap_down(size_t i);
+  unsigned heap_pop();
+  bool heap_less(unsigned a, unsigned b) const { return d_activity[a] > d_activity[b]; }
+
+  unsigned decision_level() const { return d_trail_lim.size(); }
+
+public:
+
+  sat_solver();
+
+  /** Make a new variable */
+  unsigned new_var();
+
+  /** Number of variables */
+  size_t num_vars() const { return d_value.size(); }
+
+  /** Number of conflicts so far */
+  size_t num_conflicts() const { return d_conflicts; }
+
+  /** Add a clause */
+  void add_clause(const std::vector<lit>& clause);
+
+  /** Add a unit clause */
+  void add_clause(lit l1);
+
+  /** Add a binary clause */
+  void add_clause(lit l1, lit l2);
+
+  /** Add a ternary clause */
+  void add_clause(lit l1, lit l2, lit l3);
+
+  /** Solve under the assumptions */
+  result solve(const std::vector<lit>& assumptions);
+
+  /** Value of the literal in the model (after SAT) */
+  bool get_value(lit l) const { return d_model[var_of(l)] != is_negated(l); }
+};
+
+}
+}
@@ -19,7 +19,9 @@
 #include "engine/bmc/bmc_engine.h"
 
 #include "smt/factory.h"
+#include "expr/gc_relocator.h"
 #include "utils/trace.h"
+#include "utils/budget.h"
 
 #include <sstream>
 #include <iostream>
@@ -31,24 +33,27 @@ bmc_engine::bmc_engine(const system::context& ctx)
 : engine(ctx)
 , d_trace(0)
 {
+  d_stats.bound = new utils::stat_int("bmc::bound", 0);
+  ctx.get_statistics().add(new utils::stat_delimiter());
+  ctx.get_statistics().add(d_stats.bound);
 }
 
 bmc_engine::~bmc_engine() {}
 
 engine::result bmc_engine::query(const system::transition_system* ts, const system::state_formula* sf) {
 
-  // Make the solver
-  smt::solver::ref d_solver(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
-
   // The trace we are using
   d_trace = ts->get_trace_helper();
   d_trace->clear_model();
 
-  // Initial states
+  // Initial states are the base of the solver
+  smt::pooled_solver::base base;
   expr::term_ref initial_states = ts->get_initial_states();
-  const std::vector<expr::term_ref>& state_vars = d_trace->get_state_variables(0);
-  d_solver->add_variables(state_vars.begin(), state_vars.end(), smt::solver::CLASS_A);
-  d_solver->add(d_trace->get_state_formula(initial_states, 0), smt::solver::CLASS_A);
+  base.add_variables(d_trace->get_state_variables(0), smt::solver::CLASS_A);
+  base.add(d_trace->get_state_formula(initial_states, 0), smt::solver::CLASS_A);
+
+  // Make the solver
+  smt::solver_lease d_solver(base, tm(), ctx().get_options(), ctx().get_statistics());
 
   // Transition formula
   expr::term_ref transition_formula = ts->get_transition_relation();
@@ -59,13 +64,29 @@ engine::result bmc_engine::query(const system::transition_system* ts, const syst
   // The loop
   size_t bmc_min = ctx().get_options().get_unsigned("bmc-min");
   size_t bmc_max = ctx().get_options().get_unsigned("bmc-max");
+  bool use_invariants = !ctx().get_options().get_bool("bmc-ignore-invariants");
+
+  // No invariants seen yet
+  d_system_invariants.clear();
 
   // Did we get an unknown result
   bool unknown = false;
 
   // BMC loop
   for (size_t k = 0; k <= bmc_max; ++ k) {
-  
+
+    // Stop if out of budget
+    utils::budget::check();
+    d_stats.bound->get_value() = k;
+
+    // Strengthen with any new system invariants
+    if (use_invariants) {
+      size_t added = add_new_invariants(ts, *d_solver, k);
+      if (added > 0) {
+        MSG(1) << "BMC: added " << added << " invariants" << std::endl;
+      }
+    }
+
     // Check the current unrolling
     if (k >= bmc_min) {
 
@@ -123,11 +144,26 @@ engine::result bmc_engine::query(const system::transition_system* ts, const syst
     d_solver->add_variables(input_vars.begin(), input_vars.end(), smt::solver::CLASS_A);
     // Unroll once more
     d_solver->add(d_trace->get_transition_formula(transition_formula, k), smt::solver::CLASS_A);
+    // Known invariants hold in the new frame
+    for (size_t i = 0; i < d_system_invariants.size(); ++ i) {
+      d_solver->add(d_trace->get_state_formula(d_system_invariants[i], k+1), smt::solver::CLASS_A);
+    }
   }
 
   return UNKNOWN;
 }
 
+size_t bmc_engine::add_new_invariants(const system::transition_system* ts, smt::solver& solver, size_t k) {
+  size_t begin = d_system_invariants.size();
+  ts->get_invariants(begin, d_system_invariants);
+  for (size_t i = begin; i < d_system_invariants.size(); ++ i) {
+    for (size_t j = 0; j <= k; ++ j) {
+      solver.add(d_trace->get_state_formula(d_system_invariants[i], j), smt::solver::CLASS_A);
+    }
+  }
+  return d_system_invariants.size() - begin;
+}
+
 const system::trace_helper* bmc_engine::get_trace() {
   return d_trace;
 }
@@ -136,5 +172,9 @@ engine::invariant bmc_engine::get_invariant() {
   throw exception("Not supported.");
 }
 
+void bmc_engine::gc_collect(const expr::gc_relocator& gc_reloc) {
+  gc_reloc.reloc(d_system_invariants);
+}
+
 }
 }
@@ -31,12 +31,29 @@ namespace bmc {
 
 /**
  * Bounded model checking engine.
+ *
+ * Invariants of the system are added to every frame of the unrolling,
+ * including the ones that arrive during the query.
  */
 class bmc_engine : public engine {
 
   /** The trace we're building */
   system::trace_helper* d_trace;
 
+  /** BMC statistics */
+  struct stats {
+    utils::stat_int* bound;
+  } d_stats;
+
+  /** The invariants of the system we've added to the solver */
+  std::vector<expr::term_ref> d_system_invariants;
+
+  /**
+   * Get any new invariants of the system and add them to frames 0..k of
+   * the solver. Returns the number of new invariants.
+   */
+  size_t add_new_invariants(const system::transition_system* ts, smt::solver& solver, size_t k);
+
 public:
 
   bmc_engine(const system::context& ctx);
@@ -51,8 +68,8 @@ public:
   /** Invariant (not supported) */
   invariant get_invariant();
 
-  /** Nothing to collect */
-  void gc_collect(const expr::gc_relocator& gc_reloc) {}
+  /** Collect the invariants */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
 };
 
 }
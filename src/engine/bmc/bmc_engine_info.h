@@ -33,6 +33,7 @@ struct bmc_engine_info {
         ("bmc-max", value<unsigned>()->default_value(10), "Maximal unrolling length to check.")
         ("bmc-min", value<unsigned>()->default_value(0), "Minimal unrolling length to check.")
         ("bmc-check-deadlock", "Check for deadlocks throughout the algorithm.")
+        ("bmc-ignore-invariants", "Don't add the invariants of the system to the unrolling.")
         ;
   }
 
@@ -0,0 +1,456 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "engine/cache/cache_engine.h"
+
+#include "smt/factory.h"
+#include "expr/gc_relocator.h"
+#include "utils/hash.h"
+#include "utils/trace.h"
+#include "system/trace_helper.h"
+
+#include <cstdio>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <dirent.h>
+
+namespace sally {
+namespace cache {
+
+/** Header of the cache entries */
+static const char* cache_header = "sally-cache";
+
+/** Version of the cache entry format */
+static const size_t cache_version = 1;
+
+cache_engine::cache_engine(const system::context& ctx, engine* e, std::string directory)
+: engine(ctx)
+, d_engine(e)
+, d_directory(directory)
+, d_hit(false)
+, d_trace(0)
+, d_invariant(expr::term_ref(), 0)
+{
+  d_stats.hits = new utils::stat_int("cache::hits", 0);
+  d_stats.misses = new utils::stat_int("cache::misses", 0);
+  d_stats.rejected = new utils::stat_int("cache::rejected", 0);
+  d_stats.seeded = new utils::stat_int("cache::seeded", 0);
+  ctx.get_statistics().add(new utils::stat_delimiter());
+  ctx.get_statistics().add(d_stats.hits);
+  ctx.get_statistics().add(d_stats.misses);
+  ctx.get_statistics().add(d_stats.rejected);
+  ctx.get_statistics().add(d_stats.seeded);
+}
+
+cache_engine::~cache_engine() {
+  delete d_engine;
+}
+
+/** Hash of the string as a fixed-width hex string */
+static
+std::string hash_to_string(const std::string& s) {
+  std::stringstream out;
+  out << std::hex << std::setw(16) << std::setfill('0') << utils::hash<std::string>()(s);
+  return out.str();
+}
+
+std::string cache_engine::get_system_key(const system::transition_system* ts) const {
+  std::stringstream out;
+  out << expr::set_tm(tm());
+
+  // The state type, variables by name and type
+  const system::state_type* st = ts->get_state_type();
+  system::state_type::var_class classes[2] = { system::state_type::STATE_CURRENT, system::state_type::STATE_INPUT };
+  for (size_t c = 0; c < 2; ++ c) {
+    const std::vector<expr::term_ref>& vars = st->get_variables(classes[c]);
+    out << vars.size() << std::endl;
+    for (size_t i = 0; i < vars.size(); ++ i) {
+      out << tm().get_variable_name(vars[i]) << " " << tm().type_of(vars[i]) << std::endl;
+    }
+  }
+
+  // The initial states and the transition relation (with assumptions)
+  expr::term_writer writer(tm(), out);
+  out << writer.write(ts->get_initial_states()) << std::endl;
+  out << writer.write(ts->get_transition_relation()) << std::endl;
+
+  return hash_to_string(out.str());
+}
+
+std::string cache_engine::get_property_key(const system::state_formula* sf) const {
+  std::stringstream out;
+  expr::term_writer writer(tm(), out);
+  writer.write(sf->get_formula());
+  return hash_to_string(out.str());
+}
+
+void cache_engine::get_variables(const system::state_type* st, expr::term_reader::variable_map& variables) const {
+  system::state_type::var_class classes[2] = { system::state_type::STATE_CURRENT, system::state_type::STATE_INPUT };
+  for (size_t c = 0; c < 2; ++ c) {
+    const std::vector<expr::term_ref>& vars = st->get_variables(classes[c]);
+    for (size_t i = 0; i < vars.size(); ++ i) {
+      variables[tm().get_variable_name(vars[i])] = vars[i];
+    }
+  }
+}
+
+bool cache_engine::check_invariant(const system::transition_system* ts, expr::term_ref F, size_t depth, expr::term_ref P) {
+
+  if (depth == 0) {
+    return false;
+  }
+
+  system::trace_helper* trace = ts->get_trace_helper();
+  expr::term_ref I = ts->get_initial_states();
+  expr::term_ref T = ts->get_transition_relation();
+
+  // Invariants of the system are trusted
+  std::vector<expr::term_ref> invariants;
+  ts->get_invariants(0, invariants);
+
+  smt::solver::ref solver(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
+  for (size_t k = 0; k <= depth; ++ k) {
+    solver->add_variables(trace->get_state_variables(k), smt::solver::CLASS_A);
+    if (k < depth) {
+      solver->add_variables(trace->get_input_variables(k), smt::solver::CLASS_A);
+    }
+    for (size_t i = 0; i < invariants.size(); ++ i) {
+      solver->add(trace->get_state_formula(invariants[i], k), smt::solver::CLASS_A);
+    }
+  }
+
+  // F implies P
+  if (!P.is_null()) {
+    solver->push();
+    solver->add(trace->get_state_formula(F, 0), smt::solver::CLASS_A);
+    solver->add(trace->get_state_formula(tm().mk_not(P), 0), smt::solver::CLASS_A);
+    smt::solver::result result = solver->check();
+    solver->pop();
+    if (result != smt::solver::UNSAT) {
+      return false;
+    }
+  }
+
+  // Base case: F holds in the first depth states
+  solver->push();
+  solver->add(trace->get_state_formula(I, 0), smt::solver::CLASS_A);
+  std::vector<expr::term_ref> F_not;
+  for (size_t k = 0; k < depth; ++ k) {
+    if (k > 0) {
+      solver->add(trace->get_transition_formula(T, k-1), smt::solver::CLASS_A);
+    }
+    F_not.push_back(trace->get_state_formula(tm().mk_not(F), k));
+  }
+  solver->add(tm().mk_or(F_not), smt::solver::CLASS_A);
+  smt::solver::result result = solver->check();
+  solver->pop();
+  if (result != smt::solver::UNSAT) {
+    return false;
+  }
+
+  // Induction: depth states in F are followed by a state in F
+  for (size_t k = 0; k < depth; ++ k) {
+    solver->add(trace->get_state_formula(F, k), smt::solver::CLASS_A);
+    solver->add(trace->get_transition_formula(T, k), smt::solver::CLASS_A);
+  }
+  solver->add(trace->get_state_formula(tm().mk_not(F), depth), smt::solver::CLASS_A);
+  result = solver->check();
+
+  return result == smt::solver::UNSAT;
+}
+
+bool cache_engine::check_trace(const system::transition_system* ts, expr::model::ref m, size_t length, expr::term_ref P) {
+
+  system::trace_helper* trace = ts->get_trace_helper();
+  expr::term_ref I = ts->get_initial_states();
+  expr::term_ref T = ts->get_transition_relation();
+
+  // Replay the trace: start in I, follow T, end in !P
+  if (!m->is_true(trace->get_state_formula(I, 0))) {
+    return false;
+  }
+  for (size_t k = 0; k < length; ++ k) {
+    if (!m->is_true(trace->get_transition_formula(T, k))) {
+      return false;
+    }
+  }
+  return m->is_true(trace->get_state_formula(tm().mk_not(P), length));
+}
+
+/** Read the keyword from input, and throw an exception if it's not there */
+static
+void expect(std::istream& in, const char* keyword) {
+  std::string s;
+  in >> s;
+  if (!in || s != keyword) {
+    throw exception("Corrupt cache entry: expected '") << keyword << "', got '" << s << "'.";
+  }
+}
+
+/** Read a number from input, and throw an exception if it's not there */
+template <typename T>
+static
+T read_number(std::istream& in) {
+  T x;
+  in >> x;
+  if (!in) {
+    throw exception("Corrupt cache entry: expected a number.");
+  }
+  return x;
+}
+
+engine::result cache_engine::read_entry(const system::transition_system* ts, const system::state_formula* sf, std::string filename, bool seed_only) {
+
+  std::ifstream in(filename.c_str());
+  if (!in) {
+    return engine::UNKNOWN;
+  }
+
+  const system::state_type* st = ts->get_state_type();
+  expr::term_reader::variable_map variables;
+  get_variables(st, variables);
+
+  expect(in, cache_header);
+  size_t version = read_number<size_t>(in);
+  if (version != cache_version) {
+    throw exception("Cache entry version ") << version << " not supported.";
+  }
+
+  expect(in, "terms");
+  size_t n = read_number<size_t>(in);
+  expr::term_reader reader(tm(), in, variables);
+  for (size_t i = 0; i < n; ++ i) {
+    reader.read();
+  }
+
+  std::string kind;
+  in >> kind;
+
+  if (kind == "invariant") {
+    expr::term_ref F = reader.get_term(read_number<size_t>(in));
+    size_t depth = read_number<size_t>(in);
+    expect(in, "end");
+    if (seed_only) {
+      // Invariant of another property, add it to the system
+      if (d_seeded.count(F) == 0 && check_invariant(ts, F, depth, expr::term_ref())) {
+        MSG(1) << "cache: seeding with invariant from " << filename << std::endl;
+        d_seeded.insert(F);
+        // Invariants are trusted additions, safe to add while querying
+        const_cast<system::transition_system*>(ts)->add_invariant(new system::state_formula(tm(), st, F));
+        d_stats.seeded->get_value() ++;
+      }
+      return engine::UNKNOWN;
+    }
+    if (!check_invariant(ts, F, depth, sf->get_formula())) {
+      return engine::UNKNOWN;
+    }
+    d_invariant = invariant(F, depth);
+    return engine::VALID;
+  }
+
+  if (kind == "trace") {
+    if (seed_only) {
+      return engine::UNKNOWN;
+    }
+    size_t length = read_number<size_t>(in);
+    d_trace = ts->get_trace_helper();
+    d_trace->clear_model();
+    expr::model::ref m = new expr::model(tm(), true);
+    for (size_t k = 0; k <= length; ++ k) {
+      // Values of the state variables, and the inputs (except the last frame)
+      const std::vector<expr::term_ref>& x = d_trace->get_state_variables(k);
+      for (size_t i = 0; i < x.size(); ++ i) {
+        expr::term_ref v = reader.get_term(read_number<size_t>(in));
+        m->set_variable_value(x[i], expr::value(tm(), v));
+      }
+      if (k < length) {
+        const std::vector<expr::term_ref>& input = d_trace->get_input_variables(k);
+        for (size_t i = 0; i < input.size(); ++ i) {
+          expr::term_ref v = reader.get_term(read_number<size_t>(in));
+          m->set_variable_value(input[i], expr::value(tm(), v));
+        }
+      }
+    }
+    expect(in, "end");
+    if (!check_trace(ts, m, length, sf->get_formula())) {
+      return engine::UNKNOWN;
+    }
+    d_trace->set_model(m, 0, length);
+    return engine::INVALID;
+  }
+
+  throw exception("Corrupt cache entry: unknown result '") << kind << "'.";
+}
+
+void cache_engine::write_entry(const system::transition_system* ts, const system::state_formula* sf, result r, std::string filename) {
+
+  std::stringstream terms_out;
+  std::stringstream out;
+  expr::term_writer writer(tm(), terms_out);
+
+  if (r == engine::VALID) {
+    invariant inv = d_engine->get_invariant();
+    if (inv.F.is_null()) {
+      return;
+    }
+    size_t id = writer.write(inv.F);
+    out << "invariant " << id << " " << inv.depth << std::endl;
+  } else {
+    const system::trace_helper* trace = d_engine->get_trace();
+    expr::model::ref m = trace->get_model();
+    size_t size = trace->get_model_size();
+    if (size == 0) {
+      return;
+    }
+    system::trace_helper* ts_trace = ts->get_trace_helper();
+    out << "trace " << size - 1 << std::endl;
+    for (size_t k = 0; k < size; ++ k) {
+      const std::vector<expr::term_ref>& x = ts_trace->get_state_variables(k);
+      for (size_t i = 0; i < x.size(); ++ i) {
+        out << (i ? " " : "") << writer.write(m->get_variable_value(x[i]).to_term(tm()));
+      }
+      if (k + 1 < size) {
+        const std::vector<expr::term_ref>& input = ts_trace->get_input_variables(k);
+        for (size_t i = 0; i < input.size(); ++ i) {
+          out << " " << writer.write(m->get_variable_value(input[i]).to_term(tm()));
+        }
+      }
+      out << std::endl;
+    }
+  }
+
+  // Write to a temporary file, and move it over when done, so that a
+  // concurrent reader never sees a partial entry
+  std::string tmp_filename = filename + ".tmp";
+  std::ofstream file(tmp_filename.c_str());
+  if (!file) {
+    throw exception("Can't write cache entry to ") << tmp_filename << ".";
+  }
+  file << cache_header << " " << cache_version << std::endl;
+  file << "terms " << writer.size() << std::endl;
+  file << terms_out.str();
+  file << out.str();
+  file << "end" << std::endl;
+  file.close();
+  if (!file || std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+    throw exception("Can't write cache entry to ") << filename << ".";
+  }
+}
+
+void cache_engine::seed(const system::transition_system* ts, std::string system_key, std::string property_key) {
+
+  DIR* dir = opendir(d_directory.c_str());
+  if (dir == 0) {
+    return;
+  }
+
+  std::string prefix = system_key + "-";
+  std::string own = prefix + property_key + ".cert";
+  std::vector<std::string> files;
+  for (struct dirent* entry = readdir(dir); entry != 0; entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    if (name.compare(0, prefix.size(), prefix) == 0 && name != own && name.size() > 5 && name.compare(name.size() - 5, 5, ".cert") == 0) {
+      files.push_back(name);
+    }
+  }
+  closedir(dir);
+
+  for (size_t i = 0; i < files.size(); ++ i) {
+    try {
+      read_entry(ts, 0, d_directory + "/" + files[i], true);
+    } catch (const exception& e) {
+      MSG(1) << "cache: ignoring " << files[i] << ": " << e << std::endl;
+    }
+  }
+}
+
+engine::result cache_engine::query(const system::transition_system* ts, const system::state_formula* sf) {
+
+  d_hit = false;
+  d_trace = 0;
+  d_invariant = invariant(expr::term_ref(), 0);
+
+  std::string system_key = get_system_key(ts);
+  std::string property_key = get_property_key(sf);
+  std::string filename = d_directory + "/" + system_key + "-" + property_key + ".cert";
+
+  MSG(1) << "cache: looking up " << filename << std::endl;
+
+  // Try the cache
+  result r = engine::UNKNOWN;
+  try {
+    r = read_entry(ts, sf, filename, false);
+  } catch (const exception& e) {
+    MSG(1) << "cache: ignoring " << filename << ": " << e << std::endl;
+  }
+  if (r != engine::UNKNOWN) {
+    MSG(1) << "cache: hit, " << r << std::endl;
+    d_stats.hits->get_value() ++;
+    d_hit = true;
+    return r;
+  }
+
+  // The entry is there, but it doesn't check out
+  std::ifstream exists(filename.c_str());
+  if (exists) {
+    d_stats.rejected->get_value() ++;
+  }
+  d_stats.misses->get_value() ++;
+
+  // Help the engine with what we know about the system, and solve
+  seed(ts, system_key, property_key);
+  r = d_engine->query(ts, sf);
+
+  // Remember the result
+  if (r == engine::VALID || r == engine::INVALID) {
+    write_entry(ts, sf, r, filename);
+  }
+
+  return r;
+}
+
+engine::result cache_engine::query_liveness(const system::transition_system* ts, const system::state_formula* goal, const system::state_formula* fairness) {
+  d_hit = false;
+  return d_engine->query_liveness(ts, goal, fairness);
+}
+
+const system::trace_helper* cache_engine::get_trace() {
+  return d_hit ? d_trace : d_engine->get_trace();
+}
+
+engine::invariant cache_engine::get_invariant() {
+  return d_hit ? d_invariant : d_engine->get_invariant();
+}
+
+void cache_engine::gc_collect(const expr::gc_relocator& gc_reloc) {
+  gc_reloc.reloc(d_invariant.F);
+  std::set<expr::term_ref> seeded;
+  std::set<expr::term_ref>::const_iterator it = d_seeded.begin();
+  for (; it != d_seeded.end(); ++ it) {
+    expr::term_ref F = *it;
+    if (gc_reloc.reloc(F)) {
+      seeded.insert(F);
+    }
+  }
+  d_seeded.swap(seeded);
+}
+
+}
+}
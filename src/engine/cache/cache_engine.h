@@ -0,0 +1,123 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "system/context.h"
+#include "engine/engine.h"
+#include "expr/term.h"
+#include "expr/term_serializer.h"
+
+#include <set>
+#include <string>
+
+namespace sally {
+namespace cache {
+
+/**
+ * Engine that keeps the results of another engine in a directory, so that
+ * unchanged problems don't have to be solved again. Results are keyed by a
+ * hash of the system (state type, initial states and transition relation)
+ * and a hash of the property, and each result comes with its certificate:
+ * the invariant for valid properties, and the counterexample trace for
+ * invalid ones. The certificate is checked on a hit, so a stale or corrupt
+ * entry is never trusted: the invariant must be inductive and imply the
+ * property, and the trace must evaluate to true on the system and reach
+ * the negation of the property.
+ *
+ * On a miss, the invariants stored for other properties of the same system
+ * are checked and added to the system, so that the engine can use them
+ * (e.g. pdkind starts with them in its frames).
+ */
+class cache_engine : public engine {
+
+  /** The engine that solves the misses */
+  engine* d_engine;
+
+  /** Directory of the cache */
+  std::string d_directory;
+
+  /** True if the last result came from the cache */
+  bool d_hit;
+
+  /** The trace (for cached counterexamples) */
+  system::trace_helper* d_trace;
+
+  /** The invariant (for cached proofs) */
+  invariant d_invariant;
+
+  /** Invariants we've already seeded the systems with */
+  std::set<expr::term_ref> d_seeded;
+
+  /** Cache statistics */
+  struct stats {
+    utils::stat_int* hits;
+    utils::stat_int* misses;
+    utils::stat_int* rejected;
+    utils::stat_int* seeded;
+  } d_stats;
+
+  /** Get the hash of the system as a string */
+  std::string get_system_key(const system::transition_system* ts) const;
+
+  /** Get the hash of the property as a string */
+  std::string get_property_key(const system::state_formula* sf) const;
+
+  /** Get the variables of the state type by name */
+  void get_variables(const system::state_type* st, expr::term_reader::variable_map& variables) const;
+
+  /** Check that F is a k-inductive invariant of the system (and that it implies P, if given) */
+  bool check_invariant(const system::transition_system* ts, expr::term_ref F, size_t depth, expr::term_ref P);
+
+  /** Check that the model of the trace is a counterexample to P */
+  bool check_trace(const system::transition_system* ts, expr::model::ref m, size_t length, expr::term_ref P);
+
+  /** Read and check the entry from the file, returns VALID/INVALID if ok, UNKNOWN otherwise */
+  result read_entry(const system::transition_system* ts, const system::state_formula* sf, std::string filename, bool seed_only);
+
+  /** Write the result of the engine to the file */
+  void write_entry(const system::transition_system* ts, const system::state_formula* sf, result r, std::string filename);
+
+  /** Add the invariants stored for other properties of the system */
+  void seed(const system::transition_system* ts, std::string system_key, std::string property_key);
+
+public:
+
+  /** Construct the cache around the engine (takes over the pointer) */
+  cache_engine(const system::context& ctx, engine* e, std::string directory);
+  ~cache_engine();
+
+  /** Query */
+  result query(const system::transition_system* ts, const system::state_formula* sf);
+
+  /** Liveness queries are not cached */
+  result query_liveness(const system::transition_system* ts, const system::state_formula* goal, const system::state_formula* fairness);
+
+  /** Trace */
+  const system::trace_helper* get_trace();
+
+  /** Invariant if valid */
+  invariant get_invariant();
+
+  /** Collect terms */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+
+};
+
+}
+}
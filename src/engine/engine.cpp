@@ -36,6 +36,10 @@ expr::term_manager& engine::tm() const {
   return ctx().tm();
 }
 
+engine::result engine::query_liveness(const system::transition_system* ts, const system::state_formula* goal, const system::state_formula* fairness) {
+  return UNSUPPORTED;
+}
+
 std::ostream& operator << (std::ostream& out, engine::result result) {
 
   output::language lang = output::get_output_language(out);
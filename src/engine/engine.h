@@ -70,6 +70,15 @@ public:
   virtual
   result query(const system::transition_system* ts, const system::state_formula* sf) = 0;
 
+  /**
+   * Query a liveness property: every path of the system that goes through
+   * the fair states infinitely often eventually reaches the goal. If
+   * fairness is null, all paths are fair. Engines that can't check
+   * liveness return UNSUPPORTED.
+   */
+  virtual
+  result query_liveness(const system::transition_system* ts, const system::state_formula* goal, const system::state_formula* fairness);
+
   /** Get the counter-example trace, if previous query allows it */
   virtual
   const system::trace_helper* get_trace() = 0;
@@ -25,6 +25,12 @@
 #include "engine/bmc/bmc_engine_info.h"
 #include "engine/kind/kind_engine_info.h"
 #include "engine/pdkind/pdkind_engine_info.h"
+#include "engine/ic3/ic3_engine_info.h"
+#include "engine/imc/imc_engine_info.h"
+#include "engine/kliveness/kliveness_engine_info.h"
+#include "engine/sim/sim_engine_info.h"
+#include "engine/explicit_state/explicit_engine_info.h"
+#include "engine/aig/aig_engine_info.h"
 
 #include "engine/translator/translator_info.h"
 
@@ -32,6 +38,12 @@ sally::engine_data::engine_data() {
   add_module_info<bmc::bmc_engine_info>();
   add_module_info<kind::kind_engine_info>();
   add_module_info<pdkind::pdkind_engine_info>();
+  add_module_info<ic3::ic3_engine_info>();
+  add_module_info<imc::imc_engine_info>();
+  add_module_info<kliveness::kliveness_engine_info>();
+  add_module_info<sim::sim_engine_info>();
+  add_module_info<explicit_state::explicit_engine_info>();
+  add_module_info<aig::aig_engine_info>();
   add_module_info<output::translator_info>();
 }
 
@@ -0,0 +1,518 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "engine/explicit_state/explicit_engine.h"
+
+#include "smt/factory.h"
+#include "utils/trace.h"
+#include "utils/budget.h"
+
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+namespace sally {
+namespace explicit_state {
+
+/** Number of frontier states in a chunk */
+static const size_t chunk_size = 64;
+
+explicit_engine::explicit_engine(const system::context& ctx)
+: engine(ctx)
+, d_trace(0)
+, d_functions(ctx.tm())
+, d_next_chunk(0)
+{
+  d_stats.states = new utils::stat_int("explicit::states", 0);
+  d_stats.depth = new utils::stat_int("explicit::depth", 0);
+  ctx.get_statistics().add(new utils::stat_delimiter());
+  ctx.get_statistics().add(d_stats.states);
+  ctx.get_statistics().add(d_stats.depth);
+}
+
+explicit_engine::~explicit_engine() {}
+
+bool explicit_engine::mk_layout(const std::vector<expr::term_ref>& vars, layout& l) const {
+  l = layout();
+  for (size_t i = 0; i < vars.size(); ++ i) {
+    expr::term_ref type = tm().type_of(vars[i]);
+    size_t width;
+    switch (tm().term_of(type).op()) {
+    case expr::TYPE_BOOL:
+      width = 1;
+      break;
+    case expr::TYPE_BITVECTOR:
+      width = tm().get_bitvector_type_size(type);
+      break;
+    default:
+      return false;
+    }
+    l.vars.push_back(vars[i]);
+    l.offset.push_back(l.bits);
+    l.width.push_back(width);
+    l.is_bool.push_back(width == 1 && tm().term_of(type).op() == expr::TYPE_BOOL);
+    l.bits += width;
+  }
+  // At least one word, so that there are no empty states
+  l.words = l.bits / 64 + 1;
+  return true;
+}
+
+/** Write the value of a variable at offset to the packed words */
+static
+void set_value(uint64_t* words, size_t offset, size_t width, bool is_bool, const expr::value& v) {
+  for (size_t b = 0; b < width; ++ b) {
+    bool bit = is_bool ? v.get_bool() : v.get_bitvector().get_bit(b);
+    size_t k = offset + b;
+    if (bit) {
+      words[k / 64] |= ((uint64_t) 1) << (k % 64);
+    } else {
+      words[k / 64] &= ~(((uint64_t) 1) << (k % 64));
+    }
+  }
+}
+
+/** Get the value of a variable at offset from the packed words */
+static
+expr::value get_value(const uint64_t* words, size_t offset, size_t width, bool is_bool) {
+  if (is_bool) {
+    return expr::value(((words[offset / 64] >> (offset % 64)) & 1) == 1);
+  }
+  expr::bitvector bv(width);
+  for (size_t b = 0; b < width; ++ b) {
+    size_t k = offset + b;
+    bv.set_bit(b, ((words[k / 64] >> (k % 64)) & 1) == 1);
+  }
+  return expr::value(bv);
+}
+
+size_t explicit_engine::size() const {
+  return d_parents.size();
+}
+
+size_t explicit_engine::hash(const uint64_t* state) const {
+  uint64_t h = 0x9e3779b97f4a7c15ull;
+  for (size_t i = 0; i < d_state_layout.words; ++ i) {
+    uint64_t z = state[i] + h;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    h = z ^ (z >> 31);
+  }
+  return (size_t) h;
+}
+
+bool explicit_engine::add_state(const uint64_t* state, const uint64_t* input, size_t parent) {
+
+  size_t words = d_state_layout.words;
+
+  // Grow the table to keep it at most half full
+  if (2*(size() + 1) > d_table.size()) {
+    std::vector<size_t> old_table;
+    old_table.swap(d_table);
+    d_table.resize(old_table.size() < 1024 ? 1024 : 2*old_table.size(), 0);
+    for (size_t i = 0; i < size(); ++ i) {
+      size_t slot = hash(&d_states[i*words]) & (d_table.size() - 1);
+      while (d_table[slot]) {
+        slot = (slot + 1) & (d_table.size() - 1);
+      }
+      d_table[slot] = i + 1;
+    }
+  }
+
+  // Find the slot
+  size_t slot = hash(state) & (d_table.size() - 1);
+  while (d_table[slot]) {
+    if (std::equal(state, state + words, &d_states[(d_table[slot]-1)*words])) {
+      return false;
+    }
+    slot = (slot + 1) & (d_table.size() - 1);
+  }
+
+  // New state
+  d_table[slot] = size() + 1;
+  d_states.insert(d_states.end(), state, state + words);
+  d_inputs.insert(d_inputs.end(), input, input + d_input_layout.words);
+  d_parents.push_back(parent == size_t(-1) ? size() : parent);
+  return true;
+}
+
+bool explicit_engine::is_bad(const uint64_t* state) const {
+  const layout& l = d_state_layout;
+  expr::model m(tm(), false);
+  for (size_t i = 0; i < l.vars.size(); ++ i) {
+    m.set_variable_value(l.vars[i], get_value(state, l.offset[i], l.width[i], l.is_bool[i]));
+  }
+  return !m.is_true(d_property);
+}
+
+bool explicit_engine::initial_states(const system::transition_system* ts, size_t max_states) {
+
+  const layout& l = d_state_layout;
+
+  smt::solver::ref solver(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
+  solver->add_variables(l.vars.begin(), l.vars.end(), smt::solver::CLASS_A);
+  solver->add(ts->get_initial_states(), smt::solver::CLASS_A);
+
+  std::vector<uint64_t> zero(l.words, 0);
+  std::vector<uint64_t> state(l.words, 0);
+  std::vector<uint64_t> input(d_input_layout.words, 0);
+  while (solver->check() == smt::solver::SAT) {
+    utils::budget::check();
+    expr::model::ref m = solver->get_model();
+    std::vector<expr::term_ref> block;
+    for (size_t i = 0; i < l.vars.size(); ++ i) {
+      // Unconstrained variables are 0
+      expr::value v = m->has_value(l.vars[i]) ? m->get_variable_value(l.vars[i]) : get_value(&zero[0], 0, l.width[i], l.is_bool[i]);
+      set_value(&state[0], l.offset[i], l.width[i], l.is_bool[i], v);
+      block.push_back(tm().mk_term(expr::TERM_EQ, l.vars[i], v.to_term(tm())));
+    }
+    add_state(&state[0], &input[0], size_t(-1));
+    if (size() > max_states) {
+      return false;
+    }
+    solver->add(tm().mk_not(tm().mk_and(block)), smt::solver::CLASS_A);
+  }
+
+  return true;
+}
+
+void explicit_engine::expand_evaluation(expr::model& m, size_t begin, size_t end, successors& out) {
+
+  const layout& sl = d_state_layout;
+  const layout& il = d_input_layout;
+  const layout& el = d_enum_layout;
+  const std::vector<expr::term_ref>& x_next = d_next_vars;
+
+  std::vector<uint64_t> next(sl.words, 0);
+  std::vector<uint64_t> input(il.words, 0);
+  uint64_t n_enum = ((uint64_t) 1) << el.bits;
+
+  for (size_t s = begin; s < end; ++ s) {
+
+    // Set the current state
+    const uint64_t* state = &d_states[s*sl.words];
+    for (size_t i = 0; i < sl.vars.size(); ++ i) {
+      m.set_variable_value(sl.vars[i], get_value(state, sl.offset[i], sl.width[i], sl.is_bool[i]));
+    }
+
+    // Go through all the inputs
+    for (uint64_t c = 0; c < n_enum; ++ c) {
+      for (size_t i = 0; i < el.vars.size(); ++ i) {
+        m.set_variable_value(el.vars[i], get_value(&c, el.offset[i], el.width[i], el.is_bool[i]));
+      }
+      if (!d_functions.evaluate(m, x_next)) {
+        continue;
+      }
+      for (size_t i = 0; i < sl.vars.size(); ++ i) {
+        set_value(&next[0], sl.offset[i], sl.width[i], sl.is_bool[i], m.get_variable_value(x_next[i]));
+      }
+      for (size_t i = 0; i < il.vars.size(); ++ i) {
+        set_value(&input[0], il.offset[i], il.width[i], il.is_bool[i], m.get_variable_value(il.vars[i]));
+      }
+      out.states.insert(out.states.end(), next.begin(), next.end());
+      out.inputs.insert(out.inputs.end(), input.begin(), input.end());
+      out.parents.push_back(s);
+      out.bad.push_back(!m.is_true(d_property, d_current_to_next));
+    }
+  }
+}
+
+void explicit_engine::expand_solver(smt::solver& solver, size_t begin, size_t end, successors& out) {
+
+  const layout& sl = d_state_layout;
+  const layout& il = d_input_layout;
+  const std::vector<expr::term_ref>& x_next = d_next_vars;
+
+  std::vector<uint64_t> zero(sl.words + il.words, 0);
+  std::vector<uint64_t> next(sl.words, 0);
+  std::vector<uint64_t> input(il.words, 0);
+
+  for (size_t s = begin; s < end; ++ s) {
+
+    utils::budget::check();
+
+    // Fix the current state
+    const uint64_t* state = &d_states[s*sl.words];
+    solver.push();
+    for (size_t i = 0; i < sl.vars.size(); ++ i) {
+      expr::value v = get_value(state, sl.offset[i], sl.width[i], sl.is_bool[i]);
+      solver.add(tm().mk_term(expr::TERM_EQ, sl.vars[i], v.to_term(tm())), smt::solver::CLASS_A);
+    }
+
+    // Enumerate the successors
+    while (solver.check() == smt::solver::SAT) {
+      expr::model::ref m = solver.get_model();
+      std::vector<expr::term_ref> block;
+      for (size_t i = 0; i < sl.vars.size(); ++ i) {
+        expr::value v = m->has_value(x_next[i]) ? m->get_variable_value(x_next[i]) : get_value(&zero[0], 0, sl.width[i], sl.is_bool[i]);
+        set_value(&next[0], sl.offset[i], sl.width[i], sl.is_bool[i], v);
+        block.push_back(tm().mk_term(expr::TERM_EQ, x_next[i], v.to_term(tm())));
+      }
+      for (size_t i = 0; i < il.vars.size(); ++ i) {
+        expr::value v = m->has_value(il.vars[i]) ? m->get_variable_value(il.vars[i]) : get_value(&zero[0], 0, il.width[i], il.is_bool[i]);
+        set_value(&input[0], il.offset[i], il.width[i], il.is_bool[i], v);
+      }
+      out.states.insert(out.states.end(), next.begin(), next.end());
+      out.inputs.insert(out.inputs.end(), input.begin(), input.end());
+      out.parents.push_back(s);
+      out.bad.push_back(is_bad(&next[0]));
+      solver.add(tm().mk_not(tm().mk_and(block)), smt::solver::CLASS_B);
+    }
+
+    solver.pop();
+  }
+}
+
+void explicit_engine::expansion_thread(size_t begin, size_t end, size_t chunk_size, std::vector<successors>* out) {
+
+  const std::vector<expr::term_ref>& x_next = d_next_vars;
+  const layout& sl = d_state_layout;
+  const layout& el = d_enum_layout;
+  std::vector<uint64_t> zero(sl.words + el.words, 0);
+
+  // The model, with all the variables set upfront. The model keeps references
+  // to new variables, so we do it under the lock, and the expansion only
+  // reads the terms.
+  expr::model* m = 0;
+  {
+    boost::mutex::scoped_lock lock(d_mutex);
+    m = new expr::model(tm(), false);
+    for (size_t i = 0; i < sl.vars.size(); ++ i) {
+      m->set_variable_value(sl.vars[i], get_value(&zero[0], 0, sl.width[i], sl.is_bool[i]));
+      m->set_variable_value(x_next[i], get_value(&zero[0], 0, sl.width[i], sl.is_bool[i]));
+    }
+    for (size_t i = 0; i < el.vars.size(); ++ i) {
+      m->set_variable_value(el.vars[i], get_value(&zero[0], 0, el.width[i], el.is_bool[i]));
+    }
+  }
+
+  try {
+    for (;;) {
+      size_t chunk;
+      {
+        boost::mutex::scoped_lock lock(d_mutex);
+        chunk = d_next_chunk ++;
+      }
+      if (chunk >= out->size()) {
+        break;
+      }
+      size_t chunk_begin = begin + chunk*chunk_size;
+      size_t chunk_end = std::min(end, chunk_begin + chunk_size);
+      expand_evaluation(*m, chunk_begin, chunk_end, (*out)[chunk]);
+    }
+  } catch (const exception& e) {
+    std::stringstream ss;
+    ss << e;
+    boost::mutex::scoped_lock lock(d_mutex);
+    d_error = ss.str();
+    d_next_chunk = out->size();
+  }
+
+  boost::mutex::scoped_lock lock(d_mutex);
+  delete m;
+}
+
+void explicit_engine::set_trace_model(size_t state) {
+
+  const layout& sl = d_state_layout;
+  const layout& il = d_input_layout;
+
+  // Path from the initial state
+  std::vector<size_t> path;
+  path.push_back(state);
+  while (d_parents[path.back()] != path.back()) {
+    path.push_back(d_parents[path.back()]);
+  }
+  std::reverse(path.begin(), path.end());
+
+  expr::model::ref m = new expr::model(tm(), false);
+  for (size_t k = 0; k < path.size(); ++ k) {
+    const std::vector<expr::term_ref>& vars = d_trace->get_state_variables(k);
+    const uint64_t* s = &d_states[path[k]*sl.words];
+    for (size_t i = 0; i < vars.size(); ++ i) {
+      m->set_variable_value(vars[i], get_value(s, sl.offset[i], sl.width[i], sl.is_bool[i]));
+    }
+    if (k + 1 < path.size()) {
+      const std::vector<expr::term_ref>& inputs = d_trace->get_input_variables(k);
+      const uint64_t* in = &d_inputs[path[k+1]*il.words];
+      for (size_t i = 0; i < inputs.size(); ++ i) {
+        m->set_variable_value(inputs[i], get_value(in, il.offset[i], il.width[i], il.is_bool[i]));
+      }
+    }
+  }
+  d_trace->set_model(m, 0, path.size() - 1);
+}
+
+engine::result explicit_engine::query(const system::transition_system* ts, const system::state_formula* sf) {
+
+  const system::state_type* st = ts->get_state_type();
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::term_ref>& x_next = st->get_variables(system::state_type::STATE_NEXT);
+  const std::vector<expr::term_ref>& input = st->get_variables(system::state_type::STATE_INPUT);
+
+  // The trace we are using
+  d_trace = ts->get_trace_helper();
+  d_trace->clear_model();
+  d_property = sf->get_formula();
+
+  // Only finite states
+  if (!mk_layout(x, d_state_layout) || !mk_layout(input, d_input_layout)) {
+    throw exception("The explicit-state engine only supports Boolean and bit-vector variables.");
+  }
+  d_next_vars = x_next;
+  d_current_to_next.clear();
+  for (size_t i = 0; i < x.size(); ++ i) {
+    d_current_to_next[x[i]] = x_next[i];
+  }
+
+  // Evaluate if functional and not too many inputs to enumerate
+  bool evaluate = d_functions.extract(ts);
+  if (evaluate) {
+    std::vector<expr::term_ref> enum_vars(input);
+    for (size_t i = 0; i < x_next.size(); ++ i) {
+      if (d_functions.is_unconstrained(i)) {
+        enum_vars.push_back(x_next[i]);
+      }
+    }
+    mk_layout(enum_vars, d_enum_layout);
+    evaluate = d_enum_layout.bits <= ctx().get_options().get_unsigned("explicit-max-input-bits") && d_enum_layout.bits < 64;
+  }
+
+  size_t max_states = ctx().get_options().get_unsigned("explicit-max-states");
+  size_t n_threads = ctx().get_options().get_unsigned("explicit-threads");
+  if (n_threads == 0) { n_threads = 1; }
+
+  d_states.clear();
+  d_inputs.clear();
+  d_parents.clear();
+  d_table.clear();
+
+  // Initial states
+  MSG(1) << "Explicit: enumerating initial states" << std::endl;
+  bool complete = initial_states(ts, max_states);
+  d_stats.states->get_value() = size();
+  for (size_t i = 0; i < size(); ++ i) {
+    if (is_bad(&d_states[i*d_state_layout.words])) {
+      MSG(1) << "Explicit: property violated in an initial state" << std::endl;
+      set_trace_model(i);
+      return INVALID;
+    }
+  }
+  if (!complete) {
+    MSG(1) << "Explicit: too many initial states" << std::endl;
+    return UNKNOWN;
+  }
+
+  // Solver for the enumeration of successors
+  smt::solver::ref solver;
+  if (!evaluate) {
+    solver = smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics());
+    solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_A);
+    solver->add_variables(x_next.begin(), x_next.end(), smt::solver::CLASS_B);
+    solver->add_variables(input.begin(), input.end(), smt::solver::CLASS_T);
+    solver->add(ts->get_transition_relation(), smt::solver::CLASS_T);
+  }
+
+  // Breadth-first search, the frontier is [begin, end)
+  size_t begin = 0, end = size();
+  for (size_t depth = 0; begin < end; ++ depth) {
+
+    utils::budget::check();
+    d_stats.depth->get_value() = depth;
+    MSG(1) << "Explicit: depth " << depth << ", " << size() << " states, frontier " << end - begin << std::endl;
+
+    // Expand the frontier in chunks
+    std::vector<successors> results((end - begin + chunk_size - 1) / chunk_size);
+    if (evaluate) {
+      d_next_chunk = 0;
+      d_error.clear();
+      size_t threads_to_use = std::min(n_threads, results.size());
+      std::vector<boost::thread*> threads;
+      for (size_t i = 0; i < threads_to_use; ++ i) {
+        threads.push_back(new boost::thread(boost::bind(&explicit_engine::expansion_thread, this, begin, end, chunk_size, &results)));
+      }
+      bool out_of_budget = false;
+      for (size_t i = 0; i < threads.size(); ++ i) {
+        while (!threads[i]->timed_join(boost::posix_time::milliseconds(100))) {
+          if (!out_of_budget && utils::budget::get_status() != utils::budget::BUDGET_OK) {
+            out_of_budget = true;
+            boost::mutex::scoped_lock lock(d_mutex);
+            d_next_chunk = results.size();
+          }
+        }
+        delete threads[i];
+      }
+      if (out_of_budget) {
+        utils::budget::check();
+      }
+      if (!d_error.empty()) {
+        throw exception(d_error);
+      }
+    } else {
+      for (size_t c = 0; c < results.size(); ++ c) {
+        size_t chunk_begin = begin + c*chunk_size;
+        expand_solver(*solver, chunk_begin, std::min(end, chunk_begin + chunk_size), results[c]);
+      }
+    }
+
+    // Add the new states, in order
+    for (size_t c = 0; c < results.size(); ++ c) {
+      const successors& r = results[c];
+      for (size_t i = 0; i < r.parents.size(); ++ i) {
+        if (add_state(&r.states[i*d_state_layout.words], &r.inputs[i*d_input_layout.words], r.parents[i])) {
+          if (r.bad[i]) {
+            d_stats.states->get_value() = size();
+            d_stats.depth->get_value() = depth + 1;
+            MSG(1) << "Explicit: property violated at depth " << depth + 1 << std::endl;
+            set_trace_model(size() - 1);
+            return INVALID;
+          }
+          if (size() > max_states) {
+            d_stats.states->get_value() = size();
+            MSG(1) << "Explicit: reached the maximal number of states" << std::endl;
+            return UNKNOWN;
+          }
+        }
+      }
+    }
+    d_stats.states->get_value() = size();
+
+    begin = end;
+    end = size();
+  }
+
+  MSG(1) << "Explicit: explored all " << size() << " reachable states" << std::endl;
+  return VALID;
+}
+
+const system::trace_helper* explicit_engine::get_trace() {
+  return d_trace;
+}
+
+engine::invariant explicit_engine::get_invariant() {
+  throw exception("Not supported.");
+}
+
+void explicit_engine::gc_collect(const expr::gc_relocator& gc_reloc) {
+  d_functions.gc_collect(gc_reloc);
+}
+
+}
+}
@@ -0,0 +1,165 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "smt/solver.h"
+#include "system/context.h"
+#include "system/trace_helper.h"
+#include "system/transition_functions.h"
+#include "engine/engine.h"
+#include "expr/model.h"
+
+#include <vector>
+#include <stdint.h>
+#include <boost/thread/mutex.hpp>
+
+namespace sally {
+namespace explicit_state {
+
+/**
+ * Explicit-state reachability for systems where all the state and input
+ * variables are Boolean or bit-vectors. States are packed into bit vectors
+ * of fixed size and kept in an open-addressing hash table. Reachability is
+ * breadth-first, so the counterexamples are the shortest ones, and if all
+ * reachable states are explored the property is proved.
+ *
+ * If the transition relation is functional, the successors are computed by
+ * evaluating the next-state functions on all the inputs, and the frontier
+ * is split into chunks that the threads take from a shared counter. Otherwise,
+ * the successors of each state are enumerated with the solver.
+ */
+class explicit_engine : public engine {
+
+  /** Bit layout of a list of variables */
+  struct layout {
+    std::vector<expr::term_ref> vars;
+    std::vector<size_t> offset;
+    std::vector<size_t> width;
+    std::vector<bool> is_bool;
+    size_t bits;
+    size_t words;
+    layout(): bits(0), words(0) {}
+  };
+
+  /** Successors of a chunk of the frontier */
+  struct successors {
+    std::vector<uint64_t> states;
+    std::vector<uint64_t> inputs;
+    std::vector<size_t> parents;
+    std::vector<bool> bad;
+  };
+
+  /** The trace we're building */
+  system::trace_helper* d_trace;
+
+  /** The property being checked */
+  expr::term_ref d_property;
+
+  /** The next-state variables */
+  std::vector<expr::term_ref> d_next_vars;
+
+  /** Renaming to evaluate the property on the next state */
+  expr::term_manager::substitution_map d_current_to_next;
+
+  /** The next-state functions, if the transition relation is functional */
+  system::transition_functions d_functions;
+
+  /** Layout of the states and of the inputs */
+  layout d_state_layout, d_input_layout;
+
+  /** Layout of the enumerated variables (inputs and unconstrained next-state variables) */
+  layout d_enum_layout;
+
+  /** The packed states, by index */
+  std::vector<uint64_t> d_states;
+
+  /** The packed inputs leading to each state (from the parent) */
+  std::vector<uint64_t> d_inputs;
+
+  /** Parent of each state (the index itself for initial states) */
+  std::vector<size_t> d_parents;
+
+  /** Hash table of states (index + 1, 0 if empty) */
+  std::vector<size_t> d_table;
+
+  /** Next chunk of the frontier to expand */
+  size_t d_next_chunk;
+
+  /** Error message from a thread, if any */
+  std::string d_error;
+
+  /** Lock for the shared data */
+  boost::mutex d_mutex;
+
+  /** Statistics */
+  struct stats {
+    utils::stat_int* states;
+    utils::stat_int* depth;
+  } d_stats;
+
+  /** Make the layout, returns false if the variables are not finite */
+  bool mk_layout(const std::vector<expr::term_ref>& vars, layout& l) const;
+
+  /** Number of states */
+  size_t size() const;
+
+  /** Hash the packed state */
+  size_t hash(const uint64_t* state) const;
+
+  /** Add the state if new, returns true if added */
+  bool add_state(const uint64_t* state, const uint64_t* input, size_t parent);
+
+  /** Check the property on the packed state */
+  bool is_bad(const uint64_t* state) const;
+
+  /** Enumerate the initial states, returns false if over the limit */
+  bool initial_states(const system::transition_system* ts, size_t max_states);
+
+  /** Expand the states in the chunk by evaluation */
+  void expand_evaluation(expr::model& m, size_t begin, size_t end, successors& out);
+
+  /** Expand the states in the chunk with the solver */
+  void expand_solver(smt::solver& solver, size_t begin, size_t end, successors& out);
+
+  /** Expand the chunks of the frontier [begin, end) (thread entry) */
+  void expansion_thread(size_t begin, size_t end, size_t chunk_size, std::vector<successors>* out);
+
+  /** Set the model of the trace helper, for the path to the given state */
+  void set_trace_model(size_t state);
+
+public:
+
+  explicit_engine(const system::context& ctx);
+  ~explicit_engine();
+
+  /** Query */
+  result query(const system::transition_system* ts, const system::state_formula* sf);
+
+  /** Trace */
+  const system::trace_helper* get_trace();
+
+  /** Invariant (not supported) */
+  invariant get_invariant();
+
+  /** Collect the terms */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+};
+
+}
+}
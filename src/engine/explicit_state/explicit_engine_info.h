@@ -0,0 +1,50 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "engine/explicit_state/explicit_engine.h"
+
+#include <boost/program_options/options_description.hpp>
+
+namespace sally {
+namespace explicit_state {
+
+struct explicit_engine_info {
+
+  static void setup_options(boost::program_options::options_description& options) {
+    using namespace boost::program_options;
+    options.add_options()
+        ("explicit-max-states", value<unsigned>()->default_value(10000000), "Maximal number of states to explore.")
+        ("explicit-max-input-bits", value<unsigned>()->default_value(16), "Maximal number of input bits to enumerate by evaluation (the solver enumerates the successors otherwise).")
+        ("explicit-threads", value<unsigned>()->default_value(4), "Number of threads to expand the frontier (when expanding by evaluation).")
+        ;
+  }
+
+  static std::string get_id() {
+    return "explicit";
+  }
+
+  static engine* new_instance(const system::context& ctx) {
+    return new explicit_engine(ctx);
+  }
+
+};
+
+}
+}
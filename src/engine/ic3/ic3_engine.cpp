@@ -0,0 +1,503 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "engine/ic3/ic3_engine.h"
+
+#include "smt/factory.h"
+#include "expr/gc_relocator.h"
+#include "utils/trace.h"
+#include "utils/budget.h"
+#include "system/trace_helper.h"
+
+#include <queue>
+#include <cassert>
+#include <iostream>
+
+namespace sally {
+namespace ic3 {
+
+/** Null parent of obligations */
+static const size_t null_parent = -1;
+
+ic3_engine::ic3_engine(const system::context& ctx)
+: engine(ctx)
+, d_transition_system(0)
+, d_property(0)
+, d_trace(0)
+, d_invariant(expr::term_ref(), 0)
+, d_initial_solver(0)
+{
+  d_stats.frame_index = new utils::stat_int("ic3::frame_index", 0);
+  d_stats.lemmas = new utils::stat_int("ic3::lemmas", 0);
+  d_stats.obligations = new utils::stat_int("ic3::obligations", 0);
+  d_stats.propagated = new utils::stat_int("ic3::propagated", 0);
+  ctx.get_statistics().add(new utils::stat_delimiter());
+  ctx.get_statistics().add(d_stats.frame_index);
+  ctx.get_statistics().add(d_stats.lemmas);
+  ctx.get_statistics().add(d_stats.obligations);
+  ctx.get_statistics().add(d_stats.propagated);
+}
+
+ic3_engine::~ic3_engine() {
+  clear();
+}
+
+void ic3_engine::clear() {
+  rebuild_solvers();
+  d_lemmas.clear();
+  d_obligations.clear();
+  d_cex.clear();
+}
+
+void ic3_engine::rebuild_solvers() {
+  // The solvers are rebuilt from the lemmas on demand
+  for (size_t k = 0; k < d_frame_solvers.size(); ++ k) {
+    delete d_frame_solvers[k];
+  }
+  d_frame_solvers.clear();
+  delete d_initial_solver;
+  d_initial_solver = 0;
+}
+
+smt::solver* ic3_engine::get_frame_solver(size_t k) {
+
+  if (d_lemmas.size() <= k) {
+    d_lemmas.resize(k + 1);
+  }
+
+  while (d_frame_solvers.size() <= k) {
+    size_t i = d_frame_solvers.size();
+    smt::solver* solver = smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics());
+    d_frame_solvers.push_back(solver);
+    // Variables: x_0 -> x_1 with inputs
+    solver->add_variables(d_trace->get_state_variables(0), smt::solver::CLASS_A);
+    solver->add_variables(d_trace->get_state_variables(1), smt::solver::CLASS_B);
+    solver->add_variables(d_trace->get_input_variables(0), smt::solver::CLASS_T);
+    // The transition relation
+    expr::term_ref T = d_transition_system->get_transition_relation();
+    solver->add(d_trace->get_transition_formula(T, 0), smt::solver::CLASS_T);
+    // The frame content
+    if (i == 0) {
+      expr::term_ref I = d_transition_system->get_initial_states();
+      solver->add(d_trace->get_state_formula(I, 0), smt::solver::CLASS_A);
+    } else {
+      for (size_t level = i; level < d_lemmas.size(); ++ level) {
+        cube_set::const_iterator it = d_lemmas[level].begin();
+        for (; it != d_lemmas[level].end(); ++ it) {
+          expr::term_ref lemma = tm().mk_not(*it);
+          solver->add(d_trace->get_state_formula(lemma, 0), smt::solver::CLASS_A);
+        }
+      }
+    }
+  }
+
+  return d_frame_solvers[k];
+}
+
+void ic3_engine::add_lemma(expr::term_ref cube, size_t level) {
+
+  TRACE("ic3") << "ic3: blocking at " << level << ": " << cube << std::endl;
+
+  assert(level > 0);
+  get_frame_solver(level);
+
+  // Remove from the lower levels, if there
+  for (size_t k = 1; k < level; ++ k) {
+    d_lemmas[k].erase(cube);
+  }
+  d_lemmas[level].insert(cube);
+  d_stats.lemmas->get_value() ++;
+
+  // Add to the frames 1..level
+  expr::term_ref lemma = d_trace->get_state_formula(tm().mk_not(cube), 0);
+  for (size_t k = 1; k <= level; ++ k) {
+    get_frame_solver(k)->add(lemma, smt::solver::CLASS_A);
+  }
+}
+
+bool ic3_engine::intersects_initial(expr::term_ref cube) {
+  if (d_initial_solver == 0) {
+    d_initial_solver = smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics());
+    d_initial_solver->add_variables(d_trace->get_state_variables(0), smt::solver::CLASS_A);
+    expr::term_ref I = d_transition_system->get_initial_states();
+    d_initial_solver->add(d_trace->get_state_formula(I, 0), smt::solver::CLASS_A);
+  }
+  smt::solver_scope scope(d_initial_solver);
+  scope.push();
+  d_initial_solver->add(d_trace->get_state_formula(cube, 0), smt::solver::CLASS_A);
+  smt::solver::result result = d_initial_solver->check();
+  if (result == smt::solver::UNKNOWN) {
+    throw exception("SMT unknown result.");
+  }
+  return result == smt::solver::SAT;
+}
+
+bool ic3_engine::is_blocked(expr::term_ref cube, size_t k) {
+  smt::solver* solver = get_frame_solver(k);
+  smt::solver_scope scope(solver);
+  scope.push();
+  solver->add(d_trace->get_state_formula(cube, 0), smt::solver::CLASS_A);
+  smt::solver::result result = solver->check();
+  if (result == smt::solver::UNKNOWN) {
+    throw exception("SMT unknown result.");
+  }
+  return result == smt::solver::UNSAT;
+}
+
+expr::term_ref ic3_engine::get_predecessor(smt::solver* solver) {
+  // Generalize if we can, otherwise take the values of the state variables
+  if (solver->supports(smt::solver::GENERALIZATION)) {
+    expr::term_ref G = solver->generalize(smt::solver::GENERALIZE_BACKWARD);
+    return d_trace->get_state_formula(0, G);
+  }
+  expr::model::ref m = solver->get_model();
+  const std::vector<expr::term_ref>& x0 = d_trace->get_state_variables(0);
+  const std::vector<expr::term_ref>& x = d_transition_system->get_state_type()->get_variables(system::state_type::STATE_CURRENT);
+  std::vector<expr::term_ref> literals;
+  for (size_t i = 0; i < x0.size(); ++ i) {
+    expr::term_ref value = m->get_variable_value(x0[i]).to_term(tm());
+    literals.push_back(tm().mk_term(expr::TERM_EQ, x[i], value));
+  }
+  return tm().mk_and(literals);
+}
+
+smt::solver::result ic3_engine::check_relative(size_t k, expr::term_ref cube, std::vector<expr::term_ref>* core, expr::term_ref* predecessor) {
+
+  assert(k > 0);
+
+  smt::solver* solver = get_frame_solver(k - 1);
+  smt::solver_scope scope(solver);
+  scope.push();
+
+  // !cube in the current state
+  solver->add(d_trace->get_state_formula(tm().mk_not(cube), 0), smt::solver::CLASS_A);
+
+  // cube in the next state, literal by literal so that we can get the core
+  std::vector<expr::term_ref> literals;
+  tm().get_conjuncts(cube, literals);
+  expr::term_manager::substitution_map literals_next;
+  for (size_t i = 0; i < literals.size(); ++ i) {
+    expr::term_ref literal_next = d_trace->get_state_formula(literals[i], 1);
+    literals_next[literal_next] = literals[i];
+    solver->add(literal_next, smt::solver::CLASS_B);
+  }
+
+  smt::solver::result result = solver->check();
+  switch (result) {
+  case smt::solver::SAT:
+    if (predecessor) {
+      *predecessor = get_predecessor(solver);
+    }
+    break;
+  case smt::solver::UNSAT:
+    if (core && solver->supports(smt::solver::UNSAT_CORE) && !ctx().get_options().get_bool("ic3-no-unsat-core")) {
+      std::vector<expr::term_ref> assertions;
+      solver->get_unsat_core(assertions);
+      for (size_t i = 0; i < assertions.size(); ++ i) {
+        expr::term_manager::substitution_map::const_iterator find = literals_next.find(assertions[i]);
+        if (find != literals_next.end()) {
+          core->push_back(find->second);
+        }
+      }
+    } else if (core) {
+      *core = literals;
+    }
+    break;
+  default:
+    throw exception("SMT unknown result.");
+  }
+
+  return result;
+}
+
+expr::term_ref ic3_engine::generalize_blocked(size_t k, expr::term_ref cube, const std::vector<expr::term_ref>& core) {
+
+  // Start from the core, unless it includes initial states
+  std::vector<expr::term_ref> literals = core;
+  if (literals.empty() || intersects_initial(tm().mk_and(literals))) {
+    literals.clear();
+    tm().get_conjuncts(cube, literals);
+  }
+
+  // Try to drop the literals one by one
+  if (!ctx().get_options().get_bool("ic3-no-drop-literals")) {
+    for (size_t i = 0; i < literals.size() && literals.size() > 1; ) {
+      std::vector<expr::term_ref> candidate;
+      for (size_t j = 0; j < literals.size(); ++ j) {
+        if (j != i) { candidate.push_back(literals[j]); }
+      }
+      expr::term_ref candidate_cube = tm().mk_and(candidate);
+      if (!intersects_initial(candidate_cube) && check_relative(k, candidate_cube, 0, 0) == smt::solver::UNSAT) {
+        literals.swap(candidate);
+      } else {
+        ++ i;
+      }
+    }
+  }
+
+  return tm().mk_and(literals);
+}
+
+namespace {
+
+/** Compare obligations in the queue, lowest level first, then the latest first */
+class obligation_cmp {
+  const std::vector<size_t>& d_levels;
+public:
+  obligation_cmp(const std::vector<size_t>& levels)
+  : d_levels(levels) {}
+  bool operator () (size_t i, size_t j) const {
+    // Priority queue is a max-heap, so we reverse
+    if (d_levels[i] != d_levels[j]) {
+      return d_levels[i] > d_levels[j];
+    }
+    return i < j;
+  }
+};
+
+}
+
+bool ic3_engine::block(expr::term_ref cube, size_t N) {
+
+  d_obligations.clear();
+  d_obligations.push_back(obligation(cube, N, null_parent));
+
+  std::vector<size_t> levels(1, N);
+  obligation_cmp cmp(levels);
+  std::priority_queue<size_t, std::vector<size_t>, obligation_cmp> queue(cmp);
+  queue.push(0);
+
+  while (!queue.empty()) {
+
+    size_t index = queue.top();
+    obligation o = d_obligations[index];
+    d_stats.obligations->get_value() ++;
+
+    TRACE("ic3") << "ic3: obligation at " << o.level << ": " << o.cube << std::endl;
+
+    // Maybe blocked already by a lemma learned in the meantime
+    if (is_blocked(o.cube, o.level)) {
+      queue.pop();
+      continue;
+    }
+
+    expr::term_ref predecessor;
+    std::vector<expr::term_ref> core;
+    smt::solver::result result = check_relative(o.level, o.cube, &core, &predecessor);
+
+    if (result == smt::solver::SAT) {
+      // Predecessor in F_{k-1}, if initial we have a counterexample
+      if (o.level == 1 || intersects_initial(predecessor)) {
+        d_cex.clear();
+        d_cex.push_back(predecessor);
+        for (size_t i = index; i != null_parent; i = d_obligations[i].parent) {
+          d_cex.push_back(d_obligations[i].cube);
+        }
+        return false;
+      }
+      // Block the predecessor first
+      d_obligations.push_back(obligation(predecessor, o.level - 1, index));
+      levels.push_back(o.level - 1);
+      queue.push(d_obligations.size() - 1);
+    } else {
+      queue.pop();
+      // Learn the lemma, and push it as far as we can
+      expr::term_ref blocked = generalize_blocked(o.level, o.cube, core);
+      size_t level = o.level;
+      while (level < N && check_relative(level + 1, blocked, 0, 0) == smt::solver::UNSAT) {
+        level ++;
+      }
+      add_lemma(blocked, level);
+      // Try to block the cube further up
+      if (level < N) {
+        d_obligations.push_back(obligation(o.cube, level + 1, o.parent));
+        levels.push_back(level + 1);
+        queue.push(d_obligations.size() - 1);
+      }
+    }
+  }
+
+  return true;
+}
+
+bool ic3_engine::propagate(size_t N) {
+
+  for (size_t k = 1; k < N; ++ k) {
+    // Try to push the lemmas at k to k + 1
+    cube_set to_push = d_lemmas[k];
+    cube_set::const_iterator it = to_push.begin();
+    for (; it != to_push.end(); ++ it) {
+      if (check_relative(k + 1, *it, 0, 0) == smt::solver::UNSAT) {
+        add_lemma(*it, k + 1);
+        d_stats.propagated->get_value() ++;
+      }
+    }
+    // If nothing left at k, then F_k = F_{k+1}
+    if (d_lemmas[k].empty()) {
+      std::vector<expr::term_ref> invariant;
+      invariant.push_back(d_property->get_formula());
+      for (size_t level = k + 1; level < d_lemmas.size(); ++ level) {
+        for (it = d_lemmas[level].begin(); it != d_lemmas[level].end(); ++ it) {
+          invariant.push_back(tm().mk_not(*it));
+        }
+      }
+      d_invariant = engine::invariant(tm().mk_and(invariant), 1);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+engine::result ic3_engine::query(const system::transition_system* ts, const system::state_formula* sf) {
+
+  // The frames only depend on the system, so we keep them when queried
+  // again on the same system, otherwise start fresh
+  if (ts != d_transition_system) {
+    clear();
+  }
+  d_obligations.clear();
+  d_cex.clear();
+  d_transition_system = ts;
+  d_property = sf;
+  d_invariant = engine::invariant(expr::term_ref(), 0);
+
+  // Make the trace
+  d_trace = ts->get_trace_helper();
+  d_trace->clear_model();
+
+  // The bad states
+  expr::term_ref P = sf->get_formula();
+  expr::term_ref P_not = tm().mk_not(P);
+  expr::term_ref P_not_next = d_trace->get_state_formula(P_not, 1);
+
+  // Property doesn't hold initially
+  if (intersects_initial(P_not)) {
+    return engine::INVALID;
+  }
+
+  unsigned ic3_max = ctx().get_options().get_unsigned("ic3-max");
+
+  for (size_t N = 0; ; ++ N) {
+
+    MSG(1) << "ic3: working on frame " << N << std::endl;
+    d_stats.frame_index->get_value() = N;
+
+    // Stop if out of budget, and rebuild the solvers if low on memory
+    utils::budget::check();
+    if (utils::budget::memory_pressure()) {
+      MSG(1) << "ic3: low on memory, rebuilding the solvers" << std::endl;
+      rebuild_solvers();
+    }
+
+    // Block all states in F_N that reach !P in one step
+    for (;;) {
+      smt::solver* solver = get_frame_solver(N);
+      smt::solver_scope scope(solver);
+      scope.push();
+      solver->add(P_not_next, smt::solver::CLASS_B);
+      smt::solver::result result = solver->check();
+      if (result == smt::solver::UNSAT) {
+        break;
+      }
+      if (result != smt::solver::SAT) {
+        throw exception("SMT unknown result.");
+      }
+      expr::term_ref G = get_predecessor(solver);
+      scope.pop();
+      // Bad state in F_N
+      if (N == 0 || intersects_initial(G)) {
+        d_cex.clear();
+        d_cex.push_back(G);
+        return engine::INVALID;
+      }
+      if (!block(G, N)) {
+        return engine::INVALID;
+      }
+    }
+
+    // F_N and T => P', so next frame, and propagate
+    get_frame_solver(N + 1);
+    if (propagate(N + 1)) {
+      MSG(1) << "ic3: invariant found at frame " << N + 1 << std::endl;
+      return engine::VALID;
+    }
+
+    // Garbage collection of the solvers
+    for (size_t k = 0; k < d_frame_solvers.size(); ++ k) {
+      d_frame_solvers[k]->gc();
+    }
+
+    if (ic3_max > 0 && N + 1 >= ic3_max) {
+      return engine::UNKNOWN;
+    }
+  }
+
+  return engine::UNKNOWN;
+}
+
+const system::trace_helper* ic3_engine::get_trace() {
+
+  MSG(1) << "ic3: constructing counter-example" << std::endl;
+
+  // Cubes are at 0 .. n-1, and !P at n
+  size_t cex_length = d_cex.size();
+
+  smt::solver* solver = smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics());
+
+  for (size_t k = 0; k <= cex_length; ++ k) {
+    solver->add_variables(d_trace->get_state_variables(k), smt::solver::CLASS_A);
+    if (k < cex_length) {
+      solver->add_variables(d_trace->get_input_variables(k), smt::solver::CLASS_A);
+    }
+  }
+
+  expr::term_ref I = d_transition_system->get_initial_states();
+  expr::term_ref T = d_transition_system->get_transition_relation();
+  expr::term_ref P_not = tm().mk_not(d_property->get_formula());
+
+  solver->add(d_trace->get_state_formula(I, 0), smt::solver::CLASS_A);
+  for (size_t k = 0; k < cex_length; ++ k) {
+    solver->add(d_trace->get_state_formula(d_cex[k], k), smt::solver::CLASS_A);
+    solver->add(d_trace->get_transition_formula(T, k), smt::solver::CLASS_A);
+  }
+  solver->add(d_trace->get_state_formula(P_not, cex_length), smt::solver::CLASS_A);
+
+  smt::solver::result result = solver->check();
+  (void)result;
+  assert(result == smt::solver::SAT);
+  d_trace->set_model(solver->get_model(), 0, cex_length);
+
+  delete solver;
+
+  return d_trace;
+}
+
+engine::invariant ic3_engine::get_invariant() {
+  return d_invariant;
+}
+
+void ic3_engine::gc_collect(const expr::gc_relocator& gc_reloc) {
+  for (size_t k = 0; k < d_lemmas.size(); ++ k) {
+    gc_reloc.reloc(d_lemmas[k]);
+  }
+  gc_reloc.reloc(d_cex);
+}
+
+}
+}
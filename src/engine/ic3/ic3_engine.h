@@ -0,0 +1,162 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "smt/solver.h"
+#include "system/context.h"
+#include "engine/engine.h"
+#include "expr/term.h"
+
+#include <set>
+#include <vector>
+
+namespace sally {
+namespace ic3 {
+
+/**
+ * Classic IC3/PDR engine.
+ *
+ * Frames F_0, F_1, ..., F_N over-approximate the states reachable in at most
+ * k steps, with F_0 = I. Each frame is a set of lemmas (negated cubes), and a
+ * lemma at level k holds in all frames 1..k. Each frame has a solver with the
+ * frame content and the transition relation, over the trace variables x_0
+ * (class A), x_1 (class B) and the inputs (class T).
+ *
+ * At level N we block all the states of F_N that can reach !P in one step.
+ * A cube s is blocked at level k by showing it's inductive relative to F_{k-1},
+ * i.e. F_{k-1} and !s and T and s' is unsat. If sat, the generalization of the
+ * model is a predecessor that needs to be blocked at k-1 first (if the solver
+ * can't generalize, the predecessor is the model itself). Learned cubes
+ * are shrunk with the unsat core (if the solver supports it) and by dropping
+ * literals, and then pushed to as high a level as possible. When all bad
+ * states are blocked, we move to N + 1 and propagate the lemmas forward. If
+ * two consecutive frames become equal, the frame (and P) is an inductive
+ * invariant.
+ *
+ * The lemmas don't depend on the property, so the frames are kept between
+ * queries on the same system.
+ */
+class ic3_engine : public engine {
+
+  /** Set of cubes */
+  typedef std::set<expr::term_ref> cube_set;
+
+  /** The transition system */
+  const system::transition_system* d_transition_system;
+
+  /** The property we're proving */
+  const system::state_formula* d_property;
+
+  /** The trace we're building for counterexamples */
+  system::trace_helper* d_trace;
+
+  /** The invariant, if we prove it */
+  invariant d_invariant;
+
+  /** Solver for frame k (F_k and T) */
+  std::vector<smt::solver*> d_frame_solvers;
+
+  /** Solver with the initial states only */
+  smt::solver* d_initial_solver;
+
+  /** Blocked cubes by the level they're blocked at */
+  std::vector<cube_set> d_lemmas;
+
+  /** An obligation to block the cube at level, parent is the obligation it leads to */
+  struct obligation {
+    expr::term_ref cube;
+    size_t level;
+    size_t parent;
+    obligation(expr::term_ref cube, size_t level, size_t parent)
+    : cube(cube), level(level), parent(parent) {}
+  };
+
+  /** Obligations of the current blocking phase */
+  std::vector<obligation> d_obligations;
+
+  /** The counterexample, sequence of cubes starting at an initial state and reaching !P */
+  std::vector<expr::term_ref> d_cex;
+
+  /** IC3 statistics */
+  struct stats {
+    utils::stat_int* frame_index;
+    utils::stat_int* lemmas;
+    utils::stat_int* obligations;
+    utils::stat_int* propagated;
+  } d_stats;
+
+  /** Get the solver of frame k, making it if needed */
+  smt::solver* get_frame_solver(size_t k);
+
+  /** Add the lemma !cube to frames 1..level */
+  void add_lemma(expr::term_ref cube, size_t level);
+
+  /** Check if the cube intersects the initial states */
+  bool intersects_initial(expr::term_ref cube);
+
+  /** Check if the cube is already excluded from frame k */
+  bool is_blocked(expr::term_ref cube, size_t k);
+
+  /** Get the predecessor cube (in state variables) from the last sat check of the solver */
+  expr::term_ref get_predecessor(smt::solver* solver);
+
+  /**
+   * Check if the cube is inductive relative to frame k - 1, i.e. if
+   * F_{k-1} and !cube and T and cube' is unsat. If unsat and core is given,
+   * the literals of the cube in the unsat core are returned. If sat and
+   * predecessor is given, the generalization of the model is returned.
+   */
+  smt::solver::result check_relative(size_t k, expr::term_ref cube, std::vector<expr::term_ref>* core, expr::term_ref* predecessor);
+
+  /** Shrink the cube that's blocked at level k */
+  expr::term_ref generalize_blocked(size_t k, expr::term_ref cube, const std::vector<expr::term_ref>& core);
+
+  /** Block the cube at level N, returns false if a counterexample is found */
+  bool block(expr::term_ref cube, size_t N);
+
+  /** Propagate the lemmas up to level N, returns true if two frames are equal */
+  bool propagate(size_t N);
+
+  /** Remove the solvers, they are rebuilt from the lemmas when needed */
+  void rebuild_solvers();
+
+  /** Remove all the data */
+  void clear();
+
+public:
+
+  ic3_engine(const system::context& ctx);
+  ~ic3_engine();
+
+  /** Query */
+  result query(const system::transition_system* ts, const system::state_formula* sf);
+
+  /** Trace */
+  const system::trace_helper* get_trace();
+
+  /** Invariant if valid */
+  invariant get_invariant();
+
+  /** Collect terms */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+
+};
+
+}
+}
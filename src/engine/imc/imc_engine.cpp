@@ -0,0 +1,200 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "engine/imc/imc_engine.h"
+
+#include "smt/factory.h"
+#include "expr/gc_relocator.h"
+#include "utils/trace.h"
+#include "utils/budget.h"
+#include "system/trace_helper.h"
+
+#include <vector>
+#include <iostream>
+
+namespace sally {
+namespace imc {
+
+imc_engine::imc_engine(const system::context& ctx)
+: engine(ctx)
+, d_trace(0)
+, d_invariant(expr::term_ref(), 0)
+{
+  d_stats.bound = new utils::stat_int("imc::bound", 0);
+  d_stats.images = new utils::stat_int("imc::images", 0);
+  d_stats.spurious = new utils::stat_int("imc::spurious", 0);
+  ctx.get_statistics().add(new utils::stat_delimiter());
+  ctx.get_statistics().add(d_stats.bound);
+  ctx.get_statistics().add(d_stats.images);
+  ctx.get_statistics().add(d_stats.spurious);
+}
+
+imc_engine::~imc_engine() {
+}
+
+engine::result imc_engine::check(const system::transition_system* ts, expr::term_ref P, size_t k) {
+
+  expr::term_ref I = ts->get_initial_states();
+  expr::term_ref T = ts->get_transition_relation();
+  expr::term_ref P_not = tm().mk_not(P);
+
+  // Solver for the images: R(x_0) and T(x_0, x_1) is the A part, the rest of
+  // the unrolling reaching !P is the B part, so interpolants are over x_1
+  smt::solver::ref solver(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
+  solver->add_variables(d_trace->get_state_variables(0), smt::solver::CLASS_A);
+  solver->add_variables(d_trace->get_input_variables(0), smt::solver::CLASS_T);
+  solver->add(d_trace->get_transition_formula(T, 0), smt::solver::CLASS_T);
+  std::vector<expr::term_ref> bad;
+  for (size_t i = 1; i <= k; ++ i) {
+    solver->add_variables(d_trace->get_state_variables(i), smt::solver::CLASS_B);
+    if (i < k) {
+      solver->add_variables(d_trace->get_input_variables(i), smt::solver::CLASS_B);
+      solver->add(d_trace->get_transition_formula(T, i), smt::solver::CLASS_B);
+    }
+    bad.push_back(d_trace->get_state_formula(P_not, i));
+  }
+  solver->add(tm().mk_or(bad), smt::solver::CLASS_B);
+
+  // Solver to check for the fixpoint, has !R(x_0)
+  smt::solver::ref fixpoint_solver(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
+  fixpoint_solver->add_variables(d_trace->get_state_variables(0), smt::solver::CLASS_A);
+  fixpoint_solver->add(d_trace->get_state_formula(tm().mk_not(I), 0), smt::solver::CLASS_A);
+
+  // Reachable states, disjunction of I and the images
+  std::vector<expr::term_ref> R;
+  R.push_back(I);
+  expr::term_ref R_last = I;
+
+  for (size_t iteration = 0; ; ++ iteration) {
+
+    MSG(1) << "imc: computing image " << iteration << " with bound " << k << std::endl;
+
+    // Stop if out of budget
+    utils::budget::check();
+
+    solver->push();
+    solver->add(d_trace->get_state_formula(R_last, 0), smt::solver::CLASS_A);
+    smt::solver::result result = solver->check();
+
+    if (result == smt::solver::SAT) {
+      if (iteration == 0) {
+        // Real counterexample, find where !P holds
+        expr::model::ref m = solver->get_model();
+        size_t length = k;
+        for (size_t i = 1; i <= k; ++ i) {
+          if (m->is_true(bad[i-1])) {
+            length = i;
+            break;
+          }
+        }
+        d_trace->set_model(m, 0, length);
+        return engine::INVALID;
+      }
+      // Over-approximation reaches !P, need to go deeper
+      d_stats.spurious->get_value() ++;
+      return engine::UNKNOWN;
+    }
+    if (result != smt::solver::UNSAT) {
+      throw exception("SMT unknown result.");
+    }
+
+    // Image of R, moved back to the state variables
+    expr::term_ref image = solver->interpolate();
+    image = d_trace->get_state_formula(1, image);
+    solver->pop();
+    d_stats.images->get_value() ++;
+
+    TRACE("imc") << "imc: image: " << image << std::endl;
+
+    // If the image is in R, then R is inductive
+    fixpoint_solver->push();
+    fixpoint_solver->add(d_trace->get_state_formula(image, 0), smt::solver::CLASS_A);
+    result = fixpoint_solver->check();
+    fixpoint_solver->pop();
+    if (result == smt::solver::UNSAT) {
+      d_invariant = engine::invariant(tm().mk_or(R), 1);
+      return engine::VALID;
+    }
+    if (result != smt::solver::SAT) {
+      throw exception("SMT unknown result.");
+    }
+
+    // Add the image to R, and compute the image of the new states next
+    fixpoint_solver->add(d_trace->get_state_formula(tm().mk_not(image), 0), smt::solver::CLASS_A);
+    R.push_back(image);
+    R_last = image;
+  }
+
+  return engine::UNKNOWN;
+}
+
+engine::result imc_engine::query(const system::transition_system* ts, const system::state_formula* sf) {
+
+  d_invariant = engine::invariant(expr::term_ref(), 0);
+
+  // The trace we are using
+  d_trace = ts->get_trace_helper();
+  d_trace->clear_model();
+
+  expr::term_ref P = sf->get_formula();
+
+  // Check the initial states first
+  smt::solver::ref solver(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
+  if (!solver->supports(smt::solver::INTERPOLATION)) {
+    throw exception("The imc engine needs a solver that supports interpolation.");
+  }
+  solver->add_variables(d_trace->get_state_variables(0), smt::solver::CLASS_A);
+  solver->add(d_trace->get_state_formula(ts->get_initial_states(), 0), smt::solver::CLASS_A);
+  solver->add(d_trace->get_state_formula(tm().mk_not(P), 0), smt::solver::CLASS_A);
+  smt::solver::result result = solver->check();
+  if (result == smt::solver::SAT) {
+    d_trace->set_model(solver->get_model(), 0, 0);
+    return engine::INVALID;
+  }
+  if (result != smt::solver::UNSAT) {
+    throw exception("SMT unknown result.");
+  }
+
+  unsigned imc_max = ctx().get_options().get_unsigned("imc-max");
+
+  for (size_t k = 1; imc_max == 0 || k <= imc_max; ++ k) {
+    MSG(1) << "imc: checking with bound " << k << std::endl;
+    d_stats.bound->get_value() = k;
+    engine::result r = check(ts, P, k);
+    if (r != engine::UNKNOWN) {
+      return r;
+    }
+  }
+
+  return engine::UNKNOWN;
+}
+
+const system::trace_helper* imc_engine::get_trace() {
+  return d_trace;
+}
+
+engine::invariant imc_engine::get_invariant() {
+  return d_invariant;
+}
+
+void imc_engine::gc_collect(const expr::gc_relocator& gc_reloc) {
+  gc_reloc.reloc(d_invariant.F);
+}
+
+}
+}
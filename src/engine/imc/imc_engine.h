@@ -0,0 +1,79 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "smt/solver.h"
+#include "system/context.h"
+#include "engine/engine.h"
+#include "expr/term.h"
+
+namespace sally {
+namespace imc {
+
+/**
+ * Interpolation-based model checking (McMillan, CAV 2003).
+ *
+ * For a bound k, we check R(x_0) and T(x_0, x_1) against the rest of the
+ * unrolling T(x_1, x_2) ... T(x_{k-1}, x_k) that reaches !P in one of
+ * x_1, ..., x_k. Starting with R = I, if the check is unsat, the interpolant
+ * is an over-approximation of the image of R that can't reach !P in k - 1
+ * steps, and we add it to R. If the interpolant is already included in R, we
+ * have reached a fixpoint and R is an inductive invariant. If the check is
+ * sat with R = I, the counterexample is real. Otherwise the over-approximation
+ * was too coarse and we restart with k + 1.
+ */
+class imc_engine : public engine {
+
+  /** The trace we're building */
+  system::trace_helper* d_trace;
+
+  /** The invariant, if we prove it */
+  invariant d_invariant;
+
+  /** IMC statistics */
+  struct stats {
+    utils::stat_int* bound;
+    utils::stat_int* images;
+    utils::stat_int* spurious;
+  } d_stats;
+
+  /** Check the property for bound k */
+  result check(const system::transition_system* ts, expr::term_ref P, size_t k);
+
+public:
+
+  imc_engine(const system::context& ctx);
+  ~imc_engine();
+
+  /** Query */
+  result query(const system::transition_system* ts, const system::state_formula* sf);
+
+  /** Trace */
+  const system::trace_helper* get_trace();
+
+  /** Invariant if valid */
+  invariant get_invariant();
+
+  /** Collect terms */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+
+};
+
+}
+}
@@ -0,0 +1,50 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "engine/imc/imc_engine.h"
+
+#include <boost/program_options.hpp>
+
+#include <string>
+
+namespace sally {
+namespace imc {
+
+struct imc_engine_info {
+
+  static void setup_options(boost::program_options::options_description& options) {
+    using namespace boost::program_options;
+    options.add_options()
+        ("imc-max", value<unsigned>()->default_value(0), "Maximal unrolling length to consider (0 for no limit).")
+        ;
+  }
+
+  static std::string get_id() {
+    return "imc";
+  }
+
+  static engine* new_instance(const system::context& ctx) {
+    return new imc_engine(ctx);
+  }
+
+};
+
+}
+}
@@ -19,7 +19,9 @@
 #include "engine/kind/kind_engine.h"
 
 #include "smt/factory.h"
+#include "expr/gc_relocator.h"
 #include "utils/trace.h"
+#include "utils/budget.h"
 
 #include <sstream>
 #include <iostream>
@@ -34,6 +36,9 @@ kind_engine::kind_engine(const system::context& ctx)
 , d_trace(0)
 , d_invariant(expr::term_ref(), 0)
 {
+  d_stats.bound = new utils::stat_int("kind::bound", 0);
+  ctx.get_statistics().add(new utils::stat_delimiter());
+  ctx.get_statistics().add(d_stats.bound);
 }
 
 kind_engine::~kind_engine() {
@@ -58,25 +63,26 @@ engine::result kind_engine::query(const system::transition_system* ts, const sys
 
   */
 
-  /** SMT solver for proving (1) */
-  smt::solver::ref solver1(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
-  /** SMT solver for proving (2) */
-  smt::solver::ref solver2(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
-
   // The trace we are building
   d_trace = ts->get_trace_helper();
   d_trace->clear_model();
 
   typedef std::vector<expr::term_ref> var_vec;
 
-  // Add initial state variables
+  // Initial state variables are in the base of both solvers
   const var_vec& x0 = d_trace->get_state_variables(0);
-  solver1->add_variables(x0, smt::solver::CLASS_A);
-  solver2->add_variables(x0, smt::solver::CLASS_A);
+  smt::pooled_solver::base base1, base2;
+  base1.add_variables(x0, smt::solver::CLASS_A);
+  base2.add_variables(x0, smt::solver::CLASS_A);
 
   // Initial states go to solver 1
   expr::term_ref initial_states = ts->get_initial_states();
-  solver1->add(d_trace->get_state_formula(initial_states, 0), smt::solver::CLASS_A);
+  base1.add(d_trace->get_state_formula(initial_states, 0), smt::solver::CLASS_A);
+
+  /** SMT solver for proving (1) */
+  smt::solver_lease solver1(base1, tm(), ctx().get_options(), ctx().get_statistics());
+  /** SMT solver for proving (2) */
+  smt::solver_lease solver2(base2, tm(), ctx().get_options(), ctx().get_statistics());
 
   // Transition formula
   expr::term_ref transition_formula = ts->get_transition_relation();
@@ -92,6 +98,10 @@ engine::result kind_engine::query(const system::transition_system* ts, const sys
   // The options
   unsigned kind_min = ctx().get_options().get_unsigned("kind-min");
   unsigned kind_max = ctx().get_options().get_unsigned("kind-max");
+  bool use_invariants = !ctx().get_options().get_bool("kind-ignore-invariants");
+
+  // No invariants seen yet
+  d_system_invariants.clear();
 
   // Induction loop
   unsigned k = 0;
@@ -102,6 +112,18 @@ engine::result kind_engine::query(const system::transition_system* ts, const sys
       return UNKNOWN;
     }
 
+    // Stop if out of budget
+    utils::budget::check();
+    d_stats.bound->get_value() = k;
+
+    // Strengthen with any new system invariants
+    if (use_invariants) {
+      size_t added = add_new_invariants(ts, *solver1, *solver2, k);
+      if (added > 0) {
+        MSG(1) << "K-Induction: added " << added << " invariants" << std::endl;
+      }
+    }
+
     MSG(1) << "K-Induction: checking initialization " << k << std::endl;
 
     // Check the current unrolling (1)
@@ -158,6 +180,10 @@ engine::result kind_engine::query(const system::transition_system* ts, const sys
     property_k = d_trace->get_state_formula(property, k);
     property_not_k = tm().mk_term(expr::TERM_NOT, property_k);
 
+    // Known invariants hold in the new frame
+    add_invariants_at(*solver1, k);
+    add_invariants_at(*solver2, k);
+
     // Check the current unrolling (2)
     if (check_consecution) {
       solver2->push();
@@ -173,8 +199,9 @@ engine::result kind_engine::query(const system::transition_system* ts, const sys
         // Couldn't prove it, continue
         break;
       case smt::solver::UNSAT:
-        // Proved it, done
-        d_invariant = invariant(property, k);
+        // Proved it, done. The invariants were assumed in every frame, so
+        // they are part of the k-inductive invariant.
+        d_invariant = invariant(mk_invariant(property), k);
         return VALID;
         break;
       default:
@@ -192,6 +219,31 @@ engine::result kind_engine::query(const system::transition_system* ts, const sys
   return UNKNOWN;
 }
 
+size_t kind_engine::add_new_invariants(const system::transition_system* ts, smt::solver& solver1, smt::solver& solver2, size_t k) {
+  size_t begin = d_system_invariants.size();
+  ts->get_invariants(begin, d_system_invariants);
+  for (size_t i = begin; i < d_system_invariants.size(); ++ i) {
+    for (size_t j = 0; j <= k; ++ j) {
+      expr::term_ref inv_j = d_trace->get_state_formula(d_system_invariants[i], j);
+      solver1.add(inv_j, smt::solver::CLASS_A);
+      solver2.add(inv_j, smt::solver::CLASS_A);
+    }
+  }
+  return d_system_invariants.size() - begin;
+}
+
+expr::term_ref kind_engine::mk_invariant(expr::term_ref property) const {
+  std::vector<expr::term_ref> conjuncts(d_system_invariants);
+  conjuncts.push_back(property);
+  return tm().mk_and(conjuncts);
+}
+
+void kind_engine::add_invariants_at(smt::solver& solver, size_t k) {
+  for (size_t i = 0; i < d_system_invariants.size(); ++ i) {
+    solver.add(d_trace->get_state_formula(d_system_invariants[i], k), smt::solver::CLASS_A);
+  }
+}
+
 const system::trace_helper* kind_engine::get_trace() {
   return d_trace;
 }
@@ -200,5 +252,9 @@ engine::invariant kind_engine::get_invariant() {
   return d_invariant;
 }
 
+void kind_engine::gc_collect(const expr::gc_relocator& gc_reloc) {
+  gc_reloc.reloc(d_system_invariants);
+}
+
 }
 }
@@ -39,6 +39,11 @@ namespace kind {
  *     and_{0 <= i < k} (P_i and T_i) => P_k
  *
  * Options kind-min and kind-max set the range of k to try.
+ *
+ * Invariants of the system (e.g. from the invariant command, or from an
+ * invariant generator running alongside) are added to every frame of both
+ * solvers. Invariants that arrive during the query are picked up at the
+ * next step and added to all the existing frames.
  */
 class kind_engine : public engine {
 
@@ -48,6 +53,26 @@ class kind_engine : public engine {
   /** The invariant if proven */
   invariant d_invariant;
 
+  /** K-induction statistics */
+  struct stats {
+    utils::stat_int* bound;
+  } d_stats;
+
+  /** The invariants of the system we've added to the solvers */
+  std::vector<expr::term_ref> d_system_invariants;
+
+  /**
+   * Get any new invariants of the system and add them to frames 0..k of
+   * the solvers. Returns the number of new invariants.
+   */
+  size_t add_new_invariants(const system::transition_system* ts, smt::solver& solver1, smt::solver& solver2, size_t k);
+
+  /** Add all known system invariants at frame k of the solver */
+  void add_invariants_at(smt::solver& solver, size_t k);
+
+  /** The property conjoined with the system invariants used to prove it */
+  expr::term_ref mk_invariant(expr::term_ref property) const;
+
 public:
 
   kind_engine(const system::context& ctx);
@@ -62,8 +87,8 @@ public:
   /** Invariant (not supported) */
   invariant get_invariant();
 
-  /** Nothing to collect */
-  void gc_collect(const expr::gc_relocator& gc_reloc) {}
+  /** Collect the invariants */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
 
 };
 
@@ -0,0 +1,246 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "engine/kliveness/kliveness_engine.h"
+
+#include "engine/factory.h"
+#include "expr/gc_relocator.h"
+#include "utils/trace.h"
+#include "utils/budget.h"
+#include "system/trace_helper.h"
+
+#include <sstream>
+#include <iostream>
+
+namespace sally {
+namespace kliveness {
+
+kliveness_engine::kliveness_engine(const system::context& ctx)
+: engine(ctx)
+, d_engine(0)
+, d_trace(0)
+{
+  std::string engine_id = ctx.get_options().get_string("kliveness-engine");
+  if (engine_id == "kliveness") {
+    throw exception("The kliveness engine needs a safety engine.");
+  }
+  d_engine = engine_factory::mk_engine(engine_id, ctx);
+
+  d_stats.bound = new utils::stat_int("kliveness::bound", 0);
+  d_stats.lasso_checks = new utils::stat_int("kliveness::lasso_checks", 0);
+  ctx.get_statistics().add(new utils::stat_delimiter());
+  ctx.get_statistics().add(d_stats.bound);
+  ctx.get_statistics().add(d_stats.lasso_checks);
+}
+
+kliveness_engine::~kliveness_engine() {
+  delete d_engine;
+  for (size_t i = 0; i < d_transition_systems.size(); ++ i) {
+    delete d_transition_systems[i];
+  }
+  for (size_t i = 0; i < d_state_types.size(); ++ i) {
+    delete d_state_types[i];
+  }
+}
+
+system::transition_system* kliveness_engine::mk_extended_system(const system::transition_system* ts, expr::term_ref goal, expr::term_ref fairness, expr::term_manager::substitution_map& subst) {
+
+  const system::state_type* st = ts->get_state_type();
+
+  // Same variables, and the seen flag and the counter
+  std::vector<std::string> state_names, input_names;
+  std::vector<expr::term_ref> state_types, input_types;
+  const expr::term& state_struct = tm().term_of(st->get_state_type_var());
+  for (size_t i = 0; i < tm().get_struct_type_size(state_struct); ++ i) {
+    state_names.push_back(tm().get_struct_type_field_id(state_struct, i));
+    state_types.push_back(tm().get_struct_type_field_type(state_struct, i));
+  }
+  state_names.push_back("kliveness_seen");
+  state_types.push_back(tm().boolean_type());
+  state_names.push_back("kliveness_count");
+  state_types.push_back(tm().real_type());
+  const expr::term& input_struct = tm().term_of(st->get_input_type_var());
+  for (size_t i = 0; i < tm().get_struct_type_size(input_struct); ++ i) {
+    input_names.push_back(tm().get_struct_type_field_id(input_struct, i));
+    input_types.push_back(tm().get_struct_type_field_type(input_struct, i));
+  }
+
+  std::stringstream id;
+  id << "kliveness_" << d_state_types.size();
+  system::state_type* kst = new system::state_type(id.str(), tm(), tm().mk_struct_type(state_names, state_types), tm().mk_struct_type(input_names, input_types));
+  d_state_types.push_back(kst);
+
+  // Map the variables of ts to the new ones
+  system::state_type::var_class classes[3] = { system::state_type::STATE_CURRENT, system::state_type::STATE_INPUT, system::state_type::STATE_NEXT };
+  for (size_t c = 0; c < 3; ++ c) {
+    const std::vector<expr::term_ref>& from = st->get_variables(classes[c]);
+    const std::vector<expr::term_ref>& to = kst->get_variables(classes[c]);
+    for (size_t i = 0; i < from.size(); ++ i) {
+      subst[from[i]] = to[i];
+    }
+  }
+
+  const std::vector<expr::term_ref>& x = kst->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::term_ref>& x_next = kst->get_variables(system::state_type::STATE_NEXT);
+  expr::term_ref seen = x[x.size() - 2];
+  expr::term_ref count = x[x.size() - 1];
+  expr::term_ref seen_next = x_next[x_next.size() - 2];
+  expr::term_ref count_next = x_next[x_next.size() - 1];
+
+  expr::term_ref zero = tm().mk_rational_constant(expr::rational(0, 1));
+  expr::term_ref one = tm().mk_rational_constant(expr::rational(1, 1));
+  expr::term_ref G = tm().substitute(goal, subst);
+  expr::term_ref G_next = kst->change_formula_vars(system::state_type::STATE_CURRENT, system::state_type::STATE_NEXT, G);
+  expr::term_ref F = tm().substitute(fairness, subst);
+
+  // Initial states: seen if goal, and counter at 0
+  std::vector<expr::term_ref> I;
+  I.push_back(tm().substitute(ts->get_initial_states(), subst));
+  I.push_back(tm().mk_term(expr::TERM_EQ, seen, G));
+  I.push_back(tm().mk_term(expr::TERM_EQ, count, zero));
+
+  // Transition: remember the goal, and count the fair states before it
+  std::vector<expr::term_ref> T;
+  T.push_back(tm().substitute(ts->get_transition_relation(), subst));
+  T.push_back(tm().mk_term(expr::TERM_EQ, seen_next, tm().mk_or(seen, G_next)));
+  expr::term_ref count_fair = tm().mk_and(tm().mk_not(seen), F);
+  expr::term_ref count_plus_one = tm().mk_term(expr::TERM_ADD, count, one);
+  T.push_back(tm().mk_term(expr::TERM_EQ, count_next, tm().mk_term(expr::TERM_ITE, count_fair, count_plus_one, count)));
+
+  system::state_formula* I_sf = new system::state_formula(tm(), kst, tm().mk_and(I));
+  system::transition_formula* T_tf = new system::transition_formula(tm(), kst, tm().mk_and(T));
+  system::transition_system* kts = new system::transition_system(kst, I_sf, T_tf);
+  d_transition_systems.push_back(kts);
+
+  return kts;
+}
+
+bool kliveness_engine::has_lasso(system::trace_helper* trace, const system::state_type* st, expr::term_ref fairness) {
+
+  d_stats.lasso_checks->get_value() ++;
+
+  expr::model::ref m = trace->get_model();
+  size_t size = trace->get_model_size();
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  expr::term_ref seen = x[x.size() - 2];
+
+  // Values of the original variables, and fairness, in each frame
+  std::vector< std::vector<expr::value> > values(size);
+  std::vector<bool> fair(size);
+  for (size_t k = 0; k < size; ++ k) {
+    const std::vector<expr::term_ref>& x_k = trace->get_state_variables(k);
+    for (size_t i = 0; i + 2 < x_k.size(); ++ i) {
+      values[k].push_back(m->get_variable_value(x_k[i]));
+    }
+    fair[k] = trace->is_true_in_frame(k, fairness, m);
+  }
+
+  // Look for i < j with the same state, goal not seen, and fair in between
+  for (size_t j = 0; j < size; ++ j) {
+    if (trace->is_true_in_frame(j, seen, m)) {
+      break;
+    }
+    bool fair_in_between = false;
+    for (size_t i = j; i > 0; -- i) {
+      fair_in_between = fair_in_between || fair[i - 1];
+      if (fair_in_between && values[i - 1] == values[j]) {
+        MSG(1) << "kliveness: found a lasso from " << i - 1 << " to " << j << std::endl;
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+engine::result kliveness_engine::query(const system::transition_system* ts, const system::state_formula* sf) {
+  d_trace = 0;
+  return d_engine->query(ts, sf);
+}
+
+engine::result kliveness_engine::query_liveness(const system::transition_system* ts, const system::state_formula* goal, const system::state_formula* fairness) {
+
+  d_trace = 0;
+
+  expr::term_manager::substitution_map subst;
+  expr::term_ref F = fairness ? fairness->get_formula() : tm().mk_boolean_constant(true);
+  system::transition_system* kts = mk_extended_system(ts, goal->get_formula(), F, subst);
+  const system::state_type* kst = kts->get_state_type();
+  const std::vector<expr::term_ref>& x = kst->get_variables(system::state_type::STATE_CURRENT);
+  expr::term_ref count = x[x.size() - 1];
+  expr::term_ref F_k = tm().substitute(F, subst);
+
+  // Invariants of the system are invariants of the extended system
+  std::vector<expr::term_ref> invariants;
+
+  unsigned kliveness_max = ctx().get_options().get_unsigned("kliveness-max");
+
+  for (size_t k = 0; kliveness_max == 0 || k <= kliveness_max; ++ k) {
+
+    MSG(1) << "kliveness: checking with bound " << k << std::endl;
+    d_stats.bound->get_value() = k;
+
+    // Stop if out of budget
+    utils::budget::check();
+
+    size_t begin = invariants.size();
+    ts->get_invariants(begin, invariants);
+    for (size_t i = begin; i < invariants.size(); ++ i) {
+      expr::term_ref inv = tm().substitute(invariants[i], subst);
+      kts->add_invariant(new system::state_formula(tm(), kst, inv));
+    }
+
+    // The counter stays bounded by k
+    expr::term_ref bound = tm().mk_rational_constant(expr::rational(k, 1));
+    system::state_formula P(tm(), kst, tm().mk_term(expr::TERM_LEQ, count, bound));
+    engine::result result = d_engine->query(kts, &P);
+
+    switch (result) {
+    case engine::VALID:
+      return engine::VALID;
+    case engine::INVALID:
+      d_engine->get_trace();
+      if (has_lasso(kts->get_trace_helper(), kst, F_k)) {
+        d_trace = kts->get_trace_helper();
+        return engine::INVALID;
+      }
+      break;
+    default:
+      return result;
+    }
+  }
+
+  return engine::UNKNOWN;
+}
+
+const system::trace_helper* kliveness_engine::get_trace() {
+  if (d_trace) {
+    return d_trace;
+  }
+  return d_engine->get_trace();
+}
+
+engine::invariant kliveness_engine::get_invariant() {
+  return d_engine->get_invariant();
+}
+
+void kliveness_engine::gc_collect(const expr::gc_relocator& gc_reloc) {
+}
+
+}
+}
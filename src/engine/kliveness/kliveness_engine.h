@@ -0,0 +1,100 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "system/context.h"
+#include "engine/engine.h"
+#include "expr/term.h"
+
+#include <vector>
+
+namespace sally {
+namespace kliveness {
+
+/**
+ * K-liveness engine (Claessen and Sorensson, FMCAD 2012).
+ *
+ * To show that all fair paths eventually reach the goal, we extend the
+ * system with a flag that records whether the goal has been seen, and a
+ * counter of the fair states visited before that. If the counter is bounded
+ * by k in all reachable states, the property holds. The bound is checked
+ * with a safety engine, for k = 0, 1, ... on the same extended system, so
+ * that an incremental engine can keep what it learned between the checks.
+ *
+ * When the check for k fails, we look for a lasso in the counterexample:
+ * two equal states without the goal, with a fair state in between. If
+ * there is one, the property is invalid. For finite systems, there is
+ * always a lasso once k is larger than the number of states.
+ *
+ * Safety queries are passed to the safety engine directly.
+ */
+class kliveness_engine : public engine {
+
+  /** The safety engine */
+  engine* d_engine;
+
+  /** Extended state types we made (owned) */
+  std::vector<system::state_type*> d_state_types;
+
+  /** Extended systems we made (owned) */
+  std::vector<system::transition_system*> d_transition_systems;
+
+  /** The trace of the last liveness query (0 if not a liveness query) */
+  const system::trace_helper* d_trace;
+
+  /** K-liveness statistics */
+  struct stats {
+    utils::stat_int* bound;
+    utils::stat_int* lasso_checks;
+  } d_stats;
+
+  /**
+   * Make the extended system of ts for the goal and fairness, and return
+   * it. The last two variables of the state are the seen flag and the
+   * counter, and subst maps the variables of ts to the extended ones.
+   */
+  system::transition_system* mk_extended_system(const system::transition_system* ts, expr::term_ref goal, expr::term_ref fairness, expr::term_manager::substitution_map& subst);
+
+  /** Check if there is a lasso without the goal in the trace */
+  bool has_lasso(system::trace_helper* trace, const system::state_type* st, expr::term_ref fairness);
+
+public:
+
+  kliveness_engine(const system::context& ctx);
+  ~kliveness_engine();
+
+  /** Query (safety, passed to the safety engine) */
+  result query(const system::transition_system* ts, const system::state_formula* sf);
+
+  /** Query a liveness property */
+  result query_liveness(const system::transition_system* ts, const system::state_formula* goal, const system::state_formula* fairness);
+
+  /** Trace */
+  const system::trace_helper* get_trace();
+
+  /** Invariant if valid (of the extended system for liveness queries) */
+  invariant get_invariant();
+
+  /** Collect terms */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+
+};
+
+}
+}
@@ -209,6 +209,25 @@ expr::term_ref cex_manager::get_full_cex(size_t property_id, edge_vector& edges)
   return current;
 }
 
+void cex_manager::get_edges(std::vector<expr::term_ref>& sources, edge_vector& edges) const {
+  cex_graph::const_iterator v_it = d_cex_graph.begin();
+  for (; v_it != d_cex_graph.end(); ++ v_it) {
+    const edge_list& A_edges = v_it->second;
+    edge_list::const_iterator e_it = A_edges.begin();
+    for (; e_it != A_edges.end(); ++ e_it) {
+      sources.push_back(v_it->first);
+      edges.push_back(*e_it);
+    }
+  }
+}
+
+void cex_manager::get_roots(std::vector<expr::term_ref>& roots, std::vector<size_t>& property_ids) const {
+  for (size_t i = 0; i < d_roots.size(); ++ i) {
+    roots.push_back(d_roots[i].A);
+    property_ids.push_back(d_roots[i].property_id);
+  }
+}
+
 void cex_manager::to_stream(std::ostream& out) const {
 
   cex_graph::const_iterator v_it; 
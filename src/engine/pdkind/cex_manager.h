@@ -105,6 +105,15 @@ public:
    */
   expr::term_ref get_full_cex(size_t property_id, edge_vector& edges) const;
 
+  /**
+   * Get all the edges of the graph. The edges are returned as A -> edges[i],
+   * with A the source of the edge in sources[i].
+   */
+  void get_edges(std::vector<expr::term_ref>& sources, edge_vector& edges) const;
+
+  /** Get all the roots, with their property ids */
+  void get_roots(std::vector<expr::term_ref>& roots, std::vector<size_t>& property_ids) const;
+
   /** Print to stream */
   void to_stream(std::ostream& out) const;
 
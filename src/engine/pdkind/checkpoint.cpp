@@ -0,0 +1,227 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "checkpoint.h"
+
+#include "utils/exception.h"
+
+#include <cstdio>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace sally {
+namespace pdkind {
+
+/** Header of the checkpoint files */
+static const char* checkpoint_header = "pdkind-checkpoint";
+
+/** Version of the checkpoint format */
+static const size_t checkpoint_version = 1;
+
+void checkpoint::write(const expr::term_manager& tm, std::ostream& out) const {
+
+  // Write all the terms first, so we know how many there are
+  std::stringstream terms_out;
+  expr::term_writer writer(tm, terms_out);
+
+  writer.write(property);
+  formula_set::const_iterator it = properties.begin();
+  for (; it != properties.end(); ++ it) {
+    writer.write(*it);
+  }
+  for (size_t i = 0; i < frame.size(); ++ i) {
+    writer.write(frame[i].F_fwd);
+    writer.write(frame[i].F_cex);
+  }
+  for (size_t k = 0; k < reachability_frames.size(); ++ k) {
+    for (it = reachability_frames[k].begin(); it != reachability_frames[k].end(); ++ it) {
+      writer.write(*it);
+    }
+  }
+  for (size_t i = 0; i < cex_edges.size(); ++ i) {
+    writer.write(cex_sources[i]);
+    writer.write(cex_edges[i].B);
+  }
+  for (size_t i = 0; i < cex_roots.size(); ++ i) {
+    writer.write(cex_roots[i]);
+  }
+
+  out << checkpoint_header << " " << checkpoint_version << std::endl;
+  out << "terms " << writer.size() << std::endl;
+  out << terms_out.str();
+
+  out << "property " << writer.get_id(property) << std::endl;
+  out << "properties " << properties.size();
+  for (it = properties.begin(); it != properties.end(); ++ it) {
+    out << " " << writer.get_id(*it);
+  }
+  out << std::endl;
+
+  out << "frame " << frame_index << " " << frame_depth << std::endl;
+  out << "obligations " << frame.size() << std::endl;
+  out << std::setprecision(17);
+  for (size_t i = 0; i < frame.size(); ++ i) {
+    const induction_obligation& ind = frame[i];
+    out << writer.get_id(ind.F_fwd) << " " << writer.get_id(ind.F_cex) << " " << ind.d << " " << ind.score << " " << ind.refined << std::endl;
+  }
+
+  out << "reachability " << reachability_frames.size() << std::endl;
+  for (size_t k = 0; k < reachability_frames.size(); ++ k) {
+    out << reachability_frames[k].size();
+    for (it = reachability_frames[k].begin(); it != reachability_frames[k].end(); ++ it) {
+      out << " " << writer.get_id(*it);
+    }
+    out << std::endl;
+  }
+
+  out << "cex_edges " << cex_edges.size() << std::endl;
+  for (size_t i = 0; i < cex_edges.size(); ++ i) {
+    const cex_manager::cex_edge& e = cex_edges[i];
+    out << writer.get_id(cex_sources[i]) << " " << writer.get_id(e.B) << " " << e.edge_length << " " << e.property_id << std::endl;
+  }
+
+  out << "cex_roots " << cex_roots.size() << std::endl;
+  for (size_t i = 0; i < cex_roots.size(); ++ i) {
+    out << writer.get_id(cex_roots[i]) << " " << cex_root_properties[i] << std::endl;
+  }
+
+  out << "end" << std::endl;
+}
+
+void checkpoint::write(const expr::term_manager& tm, std::string filename) const {
+  // Write to a temporary file, and move it over when done, so that we never
+  // leave a partial checkpoint behind
+  std::string tmp_filename = filename + ".tmp";
+  std::ofstream out(tmp_filename.c_str());
+  if (!out) {
+    throw exception("Can't write checkpoint to ") << tmp_filename << ".";
+  }
+  write(tm, out);
+  out.close();
+  if (!out || std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+    throw exception("Can't write checkpoint to ") << filename << ".";
+  }
+}
+
+/** Read the keyword from input, and throw an exception if it's not there */
+static
+void expect(std::istream& in, const char* keyword) {
+  std::string s;
+  in >> s;
+  if (!in || s != keyword) {
+    throw exception("Corrupt checkpoint: expected '") << keyword << "', got '" << s << "'.";
+  }
+}
+
+/** Read a number from input, and throw an exception if it's not there */
+template <typename T>
+static
+T read_number(std::istream& in) {
+  T x;
+  in >> x;
+  if (!in) {
+    throw exception("Corrupt checkpoint: expected a number.");
+  }
+  return x;
+}
+
+void checkpoint::read(expr::term_manager& tm, const expr::term_reader::variable_map& variables, std::istream& in) {
+
+  expect(in, checkpoint_header);
+  size_t version = read_number<size_t>(in);
+  if (version != checkpoint_version) {
+    throw exception("Checkpoint version ") << version << " not supported.";
+  }
+
+  expect(in, "terms");
+  size_t n = read_number<size_t>(in);
+  expr::term_reader reader(tm, in, variables);
+  for (size_t i = 0; i < n; ++ i) {
+    reader.read();
+  }
+
+  expect(in, "property");
+  property = reader.get_term(read_number<size_t>(in));
+  expect(in, "properties");
+  properties.clear();
+  n = read_number<size_t>(in);
+  for (size_t i = 0; i < n; ++ i) {
+    properties.insert(reader.get_term(read_number<size_t>(in)));
+  }
+
+  expect(in, "frame");
+  frame_index = read_number<size_t>(in);
+  frame_depth = read_number<size_t>(in);
+  expect(in, "obligations");
+  frame.clear();
+  n = read_number<size_t>(in);
+  for (size_t i = 0; i < n; ++ i) {
+    expr::term_ref F_fwd = reader.get_term(read_number<size_t>(in));
+    expr::term_ref F_cex = reader.get_term(read_number<size_t>(in));
+    size_t d = read_number<size_t>(in);
+    double score = read_number<double>(in);
+    size_t refined = read_number<size_t>(in);
+    frame.push_back(induction_obligation(tm, F_fwd, F_cex, d, score, refined));
+  }
+
+  expect(in, "reachability");
+  reachability_frames.clear();
+  reachability_frames.resize(read_number<size_t>(in));
+  for (size_t k = 0; k < reachability_frames.size(); ++ k) {
+    n = read_number<size_t>(in);
+    for (size_t i = 0; i < n; ++ i) {
+      reachability_frames[k].insert(reader.get_term(read_number<size_t>(in)));
+    }
+  }
+
+  expect(in, "cex_edges");
+  cex_sources.clear();
+  cex_edges.clear();
+  n = read_number<size_t>(in);
+  for (size_t i = 0; i < n; ++ i) {
+    cex_sources.push_back(reader.get_term(read_number<size_t>(in)));
+    expr::term_ref B = reader.get_term(read_number<size_t>(in));
+    size_t edge_length = read_number<size_t>(in);
+    size_t property_id = read_number<size_t>(in);
+    cex_edges.push_back(cex_manager::cex_edge(B, edge_length, property_id));
+  }
+
+  expect(in, "cex_roots");
+  cex_roots.clear();
+  cex_root_properties.clear();
+  n = read_number<size_t>(in);
+  for (size_t i = 0; i < n; ++ i) {
+    cex_roots.push_back(reader.get_term(read_number<size_t>(in)));
+    cex_root_properties.push_back(read_number<size_t>(in));
+  }
+
+  expect(in, "end");
+}
+
+void checkpoint::read(expr::term_manager& tm, const expr::term_reader::variable_map& variables, std::string filename) {
+  std::ifstream in(filename.c_str());
+  if (!in) {
+    throw exception("Can't open checkpoint ") << filename << ".";
+  }
+  read(tm, variables, in);
+}
+
+}
+}
@@ -0,0 +1,89 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "induction_obligation.h"
+#include "cex_manager.h"
+
+#include "expr/term.h"
+#include "expr/term_serializer.h"
+
+#include <set>
+#include <vector>
+#include <string>
+#include <iosfwd>
+
+namespace sally {
+namespace pdkind {
+
+/**
+ * State of the pdkind search at the start of an induction frame. This is
+ * all that is needed to continue the search: the solvers can be rebuilt
+ * from the frames, and the rest of the engine state is recomputed while
+ * pushing the frame.
+ */
+struct checkpoint {
+
+  typedef std::set<expr::term_ref> formula_set;
+
+  /** The property being checked */
+  expr::term_ref property;
+
+  /** The property components */
+  formula_set properties;
+
+  /** Index of the induction frame */
+  size_t frame_index;
+
+  /** Induction depth of the frame */
+  size_t frame_depth;
+
+  /** The induction frame (all of it is in the queue) with scores */
+  std::vector<induction_obligation> frame;
+
+  /** Content of the reachability frames */
+  std::vector<formula_set> reachability_frames;
+
+  /** Counter-example graph edges, cex_sources[i] -> cex_edges[i] */
+  std::vector<expr::term_ref> cex_sources;
+  cex_manager::edge_vector cex_edges;
+
+  /** Counter-example graph roots */
+  std::vector<expr::term_ref> cex_roots;
+  std::vector<size_t> cex_root_properties;
+
+  checkpoint()
+  : frame_index(0), frame_depth(0) {}
+
+  /** Write the checkpoint to the output */
+  void write(const expr::term_manager& tm, std::ostream& out) const;
+
+  /** Write the checkpoint to a file (atomically, through a temporary file) */
+  void write(const expr::term_manager& tm, std::string filename) const;
+
+  /** Read the checkpoint from the input, variables are matched by name */
+  void read(expr::term_manager& tm, const expr::term_reader::variable_map& variables, std::istream& in);
+
+  /** Read the checkpoint from a file */
+  void read(expr::term_manager& tm, const expr::term_reader::variable_map& variables, std::string filename);
+
+};
+
+}
+}
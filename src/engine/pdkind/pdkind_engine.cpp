@@ -18,11 +18,14 @@
 
 #include "engine/pdkind/pdkind_engine.h"
 #include "engine/pdkind/solvers.h"
+#include "engine/pdkind/checkpoint.h"
 #include "engine/factory.h"
 
 #include "smt/factory.h"
 #include "utils/trace.h"
+#include "utils/budget.h"
 #include "expr/gc_relocator.h"
+#include "utils/exception.h"
 
 #include <stack>
 #include <cassert>
@@ -51,6 +54,7 @@ pdkind_engine::pdkind_engine(const system::context& ctx)
 , d_induction_frame_depth_count(0)
 , d_induction_frame_next_index(0)
 , d_property_invalid(false)
+, d_deterministic(false)
 , d_learning_type(LEARN_UNDEFINED)
 {
   d_stats.frame_index = new utils::stat_int("pdkind::frame_index", 0);
@@ -59,6 +63,9 @@ pdkind_engine::pdkind_engine(const system::context& ctx)
   d_stats.frame_pushed = new utils::stat_int("pdkind::frame_pushed", 0);
   d_stats.queue_size = new utils::stat_int("pdkind::queue_size", 0);
   d_stats.max_cex_depth = new utils::stat_int("pdkind::max_cex_depth", 0);
+  d_stats.induction_solver_builds = new utils::stat_int("pdkind::induction_solver_builds", 0);
+  d_stats.induction_solver_reuses = new utils::stat_int("pdkind::induction_solver_reuses", 0);
+  d_stats.induction_solver_time = new utils::stat_timer("pdkind::induction_solver_time", false);
   ctx.get_statistics().add(new utils::stat_delimiter());
   ctx.get_statistics().add(d_stats.frame_index);
   ctx.get_statistics().add(d_stats.induction_depth);
@@ -66,6 +73,9 @@ pdkind_engine::pdkind_engine(const system::context& ctx)
   ctx.get_statistics().add(d_stats.frame_pushed);
   ctx.get_statistics().add(d_stats.queue_size);
   ctx.get_statistics().add(d_stats.max_cex_depth);
+  ctx.get_statistics().add(d_stats.induction_solver_builds);
+  ctx.get_statistics().add(d_stats.induction_solver_reuses);
+  ctx.get_statistics().add(d_stats.induction_solver_time);
 }
 
 pdkind_engine::~pdkind_engine() {
@@ -249,11 +259,85 @@ pdkind_engine::induction_result pdkind_engine::push_obligation(induction_obligat
   return INDUCTION_RETRY;
 }
 
+void pdkind_engine::reset_induction_solver(size_t depth) {
+  d_stats.induction_solver_time->start();
+  bool reused = d_smt->reset_induction_solver(depth);
+  d_stats.induction_solver_time->stop();
+  if (reused) {
+    d_stats.induction_solver_reuses->get_value() ++;
+  } else {
+    d_stats.induction_solver_builds->get_value() ++;
+  }
+}
+
+void pdkind_engine::push_obligations_batch(size_t n) {
+
+  // Pop the obligations in the queue order
+  std::vector<induction_obligation> batch;
+  std::vector<expr::term_ref> batch_F;
+  while (batch.size() < n && !d_induction_obligations.empty()) {
+    batch.push_back(pop_induction_obligation());
+    batch_F.push_back(batch.back().F_fwd);
+  }
+
+  TRACE("pdkind") << "pdkind: checking " << batch.size() << " obligations in parallel" << std::endl;
+
+  // Check them all against the current frame
+  std::vector<smt::solver::result> batch_results;
+  std::vector<size_t> batch_finished;
+  d_smt->check_inductive_batch(batch_F, batch_results, batch_finished);
+
+  // The merge order
+  std::vector<size_t> merge_order;
+  if (d_deterministic) {
+    for (size_t i = 0; i < batch.size(); ++ i) {
+      merge_order.push_back(i);
+    }
+  } else {
+    merge_order = batch_finished;
+  }
+
+  // Merge the results into the frame. Facts learned while merging only make
+  // the frame stronger, so obligations found inductive stay inductive.
+  for (size_t i = 0; i < merge_order.size(); ++ i) {
+    induction_obligation& ind = batch[merge_order[i]];
+    if (d_property_invalid) {
+      // Put back the rest, same as if we never popped them
+      enqueue_induction_obligation(ind);
+      continue;
+    }
+    if (batch_results[merge_order[i]] == smt::solver::UNSAT) {
+      TRACE("pdkind") << "pdkind: pushed " << ind.F_fwd << std::endl;
+      assert(d_induction_frame.find(ind) != d_induction_frame.end());
+      d_induction_obligations_next.push_back(ind);
+      d_stats.frame_pushed->get_value() = d_induction_obligations_next.size();
+    } else {
+      // Not inductive (or unknown), do the full processing
+      induction_result ind_result = push_obligation(ind);
+      if (ind_result == INDUCTION_RETRY) {
+        enqueue_induction_obligation(ind);
+      }
+    }
+  }
+}
+
 void pdkind_engine::push_current_frame() {
 
+  // Number of induction workers
+  size_t workers = d_smt->induction_workers();
+
   // Search while we have something to do
   while (!d_induction_obligations.empty() && !d_property_invalid) {
 
+    // Stop if out of budget
+    utils::budget::check();
+
+    // Process in parallel if we have enough work
+    if (workers > 1 && d_induction_obligations.size() > 1) {
+      push_obligations_batch(workers);
+      continue;
+    }
+
     // Pick a formula to try and prove inductive, i.e. that F_k & P & T => P'
     induction_obligation ind = pop_induction_obligation();
 
@@ -279,6 +363,9 @@ void pdkind_engine::push_current_frame() {
 
 engine::result pdkind_engine::search() {
 
+  // Number of frames done, for checkpointing
+  size_t frames_done = 0;
+
   // Push frame by frame */
   for(;;) {
 
@@ -328,7 +415,7 @@ engine::result pdkind_engine::search() {
     if (ctx().get_options().get_unsigned("pdkind-induction-max") != 0 && d_induction_frame_depth > ctx().get_options().get_unsigned("pdkind-induction-max")) {
       d_induction_frame_depth = ctx().get_options().get_unsigned("pdkind-induction-max");
     }
-    d_smt->reset_induction_solver(d_induction_frame_depth);
+    reset_induction_solver(d_induction_frame_depth);
 
     if (ctx().get_options().get_bool("pdkind-minimize-frames")) {
       d_smt->minimize_frame(d_induction_obligations_next);
@@ -359,6 +446,15 @@ engine::result pdkind_engine::search() {
 
     // Do garbage collection
     d_smt->gc();
+
+    // Save the state if asked
+    frames_done ++;
+    if (ctx().get_options().has_option("pdkind-checkpoint")) {
+      unsigned interval = ctx().get_options().get_unsigned("pdkind-checkpoint-interval");
+      if (interval > 0 && frames_done % interval == 0) {
+        write_checkpoint(ctx().get_options().get_string("pdkind-checkpoint"));
+      }
+    }
   }
 
   // Didn't prove or disprove, so unknown
@@ -376,6 +472,7 @@ engine::result pdkind_engine::query(const system::transition_system* ts, const s
   // Remember the input
   d_transition_system = ts;
   d_property = sf;
+  d_deterministic = ctx().get_options().get_bool("pdkind-deterministic");
 
   // Make the trace
   d_trace = ts->get_trace_helper();
@@ -388,19 +485,24 @@ engine::result pdkind_engine::query(const system::transition_system* ts, const s
   // Initialize the reachability solver
   d_reachability.init(d_transition_system, d_smt);
 
-  // Initialize the induction solver
-  d_induction_frame_index = 0;
-  d_induction_frame_depth = 1;
-  d_smt->reset_induction_solver(1);
-
-  // Add the property we're trying to prove (if not already invalid at frame 0)
-  bool ok = add_property(d_property->get_formula());
-  if (!ok) {
+  if (ctx().get_options().has_option("pdkind-resume")) {
+    // Continue from where we left off
+    resume(ctx().get_options().get_string("pdkind-resume"));
+  } else {
+    // Initialize the induction solver
+    d_induction_frame_index = 0;
+    d_induction_frame_depth = 1;
+    reset_induction_solver(1);
+
+    // Add the property we're trying to prove (if not already invalid at frame 0)
+    bool ok = add_property(d_property->get_formula());
+    if (!ok) {
 #ifndef NDEBUG
-    // Check trace generation if not asked for explicityly
-    if (!ctx().get_options().has_option("show-trace")) { get_trace(); }  
+      // Check trace generation if not asked for explicityly
+      if (!ctx().get_options().has_option("show-trace")) { get_trace(); }
 #endif
-    return engine::INVALID;
+      return engine::INVALID;
+    }
   }
 
   while (r == UNKNOWN) {
@@ -428,6 +530,76 @@ engine::result pdkind_engine::query(const system::transition_system* ts, const s
   return r;
 }
 
+void pdkind_engine::write_checkpoint(std::string filename) const {
+
+  MSG(1) << "pdkind: writing checkpoint at frame " << d_induction_frame_index << " to " << filename << std::endl;
+
+  checkpoint cp;
+  cp.property = d_property->get_formula();
+  cp.properties = d_properties;
+  cp.frame_index = d_induction_frame_index;
+  cp.frame_depth = d_induction_frame_depth;
+  cp.frame.insert(cp.frame.end(), d_induction_frame.begin(), d_induction_frame.end());
+  cp.reachability_frames = d_reachability.get_frame_content();
+  d_cex_manager.get_edges(cp.cex_sources, cp.cex_edges);
+  d_cex_manager.get_roots(cp.cex_roots, cp.cex_root_properties);
+
+  cp.write(tm(), filename);
+}
+
+void pdkind_engine::resume(std::string filename) {
+
+  MSG(1) << "pdkind: resuming from " << filename << std::endl;
+
+  // Variables are matched by name
+  expr::term_reader::variable_map variables;
+  const system::state_type* st = d_transition_system->get_state_type();
+  system::state_type::var_class classes[3] = { system::state_type::STATE_CURRENT, system::state_type::STATE_INPUT, system::state_type::STATE_NEXT };
+  for (size_t c = 0; c < 3; ++ c) {
+    const std::vector<expr::term_ref>& vars = st->get_variables(classes[c]);
+    for (size_t i = 0; i < vars.size(); ++ i) {
+      variables[tm().get_variable_name(vars[i])] = vars[i];
+    }
+  }
+
+  checkpoint cp;
+  cp.read(tm(), variables, filename);
+  if (cp.property != d_property->get_formula()) {
+    throw exception("Checkpoint ") << filename << " was not written for this property.";
+  }
+
+  // The counter-example graph
+  for (size_t i = 0; i < cp.cex_edges.size(); ++ i) {
+    const cex_manager::cex_edge& e = cp.cex_edges[i];
+    d_cex_manager.add_edge(cp.cex_sources[i], e.B, e.edge_length, e.property_id);
+  }
+  for (size_t i = 0; i < cp.cex_roots.size(); ++ i) {
+    d_cex_manager.mark_root(cp.cex_roots[i], cp.cex_root_properties[i]);
+  }
+  d_properties = cp.properties;
+
+  // The reachability frames
+  d_reachability.restore(cp.reachability_frames);
+
+  // The induction frame, same as setting up a new frame in search
+  d_induction_frame_index = cp.frame_index;
+  d_induction_frame_depth = cp.frame_depth;
+  reset_induction_solver(d_induction_frame_depth);
+  for (size_t i = 0; i < cp.frame.size(); ++ i) {
+    const induction_obligation& ind = cp.frame[i];
+    assert(d_induction_frame.find(ind) == d_induction_frame.end());
+    d_smt->add_to_induction_solver(ind.F_fwd, solvers::INDUCTION_FIRST);
+    d_smt->add_to_induction_solver(ind.F_fwd, solvers::INDUCTION_INTERMEDIATE);
+    d_induction_frame.insert(ind);
+    enqueue_induction_obligation(ind);
+  }
+
+  // Update stats
+  d_stats.frame_size->get_value() = d_induction_frame.size();
+  d_stats.frame_index->get_value() = d_induction_frame_index;
+  d_stats.induction_depth->get_value() = d_induction_frame_depth;
+}
+
 bool pdkind_engine::add_property(expr::term_ref P) {
   // Add to cex manager
   expr::term_ref P_cex = tm().mk_not(P);
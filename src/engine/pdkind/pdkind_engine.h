@@ -109,6 +109,9 @@ class pdkind_engine : public engine {
     utils::stat_int* frame_pushed;
     utils::stat_int* queue_size;
     utils::stat_int* max_cex_depth;
+    utils::stat_int* induction_solver_builds;
+    utils::stat_int* induction_solver_reuses;
+    utils::stat_timer* induction_solver_time;
   } d_stats;
 
 
@@ -168,6 +171,9 @@ class pdkind_engine : public engine {
   /** Bump the score of the obligation */
   void bump_induction_obligation(const induction_obligation& ind, double amount);
 
+  /** Reset the induction solver to the given depth (keeping stats) */
+  void reset_induction_solver(size_t depth);
+
   /** Returns the frame variable */
   expr::term_ref get_frame_variable(size_t i);
 
@@ -196,9 +202,28 @@ class pdkind_engine : public engine {
   /** Push the current frame */
   void push_current_frame();
 
+  /**
+   * Pop up to n obligations and check them for inductiveness in parallel,
+   * each on its own induction solver replica. The results are then merged
+   * into the frame one by one: obligations that are inductive are pushed,
+   * the rest are processed as usual with push_obligation. The merge is done
+   * in the queue order if deterministic, otherwise in the order the checks
+   * finished.
+   */
+  void push_obligations_batch(size_t n);
+
+  /** Merge parallel results in queue order */
+  bool d_deterministic;
+
   /** Search */
   result search();
 
+  /** Write the state at the start of the current frame to the file */
+  void write_checkpoint(std::string filename) const;
+
+  /** Restore the state from the checkpoint file, and setup the solvers */
+  void resume(std::string filename);
+
   /** Reset the engine */
   void reset();
 
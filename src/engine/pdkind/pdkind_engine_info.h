@@ -40,6 +40,12 @@ struct pdkind_engine_info {
         ("pdkind-minimize-generalizations", "Try to minimize generalizations")
         ("pdkind-minimize-frames", "Try to minimize frames")
         ("pdkind-output-cex-graph", value<std::string>(), "Print the CEX graph into this file when done.")
+        ("pdkind-workers", value<unsigned>()->default_value(1), "Number of workers checking induction obligations in parallel (each with its own induction solver).")
+        ("pdkind-deterministic", "Merge the results of the parallel workers in a deterministic order.")
+        ("pdkind-induction-solver-garbage", value<unsigned>()->default_value(1000), "Reuse the induction solver across frames, unrolling it as the depth grows, until this many retired assertions accumulate (0 to always rebuild).")
+        ("pdkind-checkpoint", value<std::string>(), "Save the search state into this file as frames are completed.")
+        ("pdkind-checkpoint-interval", value<unsigned>()->default_value(1), "Save the search state every this many frames.")
+        ("pdkind-resume", value<std::string>(), "Resume the search from the state saved in this file.")
         ;
   }
 
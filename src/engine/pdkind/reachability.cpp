@@ -16,14 +16,18 @@ reachability::reachability(const system::context& ctx, cex_manager& cm)
 , d_transition_system(0)
 , d_smt(0)
 , d_cex_manager(cm)
+, d_unreachable_index(ctx.tm())
+, d_reachable_index(ctx.tm())
 {
   d_stats.reachable = new utils::stat_int("sally::pdkind::reachable", 0);
   d_stats.unreachable = new utils::stat_int("sally::pdkind::unreachable", 0);
   d_stats.queries = new utils::stat_int("sally::pdkind::reachability_queries", 0);
+  d_stats.queries_saved = new utils::stat_int("sally::pdkind::reachability_queries_saved", 0);
   ctx.get_statistics().add(new utils::stat_delimiter());
   ctx.get_statistics().add(d_stats.reachable);
   ctx.get_statistics().add(d_stats.unreachable);
   ctx.get_statistics().add(d_stats.queries);
+  ctx.get_statistics().add(d_stats.queries_saved);
 }
 
 solvers::query_result reachability::check_one_step_reachable(size_t k, expr::term_ref F) {
@@ -89,15 +93,34 @@ reachability::result reachability::check_reachable(size_t k, expr::term_ref f, s
 
   ensure_frame(k);
 
+  // If a weaker cube is unreachable at k, so is f
+  if (d_unreachable_index.contains_weaker(k, f)) {
+    TRACE("pdkind") << "pdkind: checking reachability at " << k << ": unreachable (subsumed)" << std::endl;
+    d_stats.queries_saved->get_value() ++;
+    d_stats.unreachable->get_value() ++;
+    return UNREACHABLE;
+  }
+
+  // If a stronger cube is reachable at k, so is f (we can't use this if we
+  // need to record the counter-example)
+  if (property_id == d_cex_manager.null_property_id && d_reachable_index.contains_stronger(k, f)) {
+    TRACE("pdkind") << "pdkind: checking reachability at " << k << ": reachable (subsumed)" << std::endl;
+    d_stats.queries_saved->get_value() ++;
+    d_stats.reachable->get_value() ++;
+    return REACHABLE;
+  }
+
   // Special case for k = 0
   if (k == 0) {
     smt::solver::result result = d_smt->query_at_init(f);
     switch (result) {
     case smt::solver::UNSAT:
       TRACE("pdkind") << "pdkind: checking reachability at " << k << ": unreachable" << std::endl;
+      d_unreachable_index.add(k, f);
       return UNREACHABLE;
     case smt::solver::SAT:
       TRACE("pdkind") << "pdkind: checking reachability at " << k << ": reachable" << std::endl;
+      d_reachable_index.add(k, f);
       if (property_id != d_cex_manager.null_property_id) {
         d_cex_manager.mark_root(f, property_id);
       }
@@ -123,6 +146,10 @@ reachability::result reachability::check_reachable(size_t k, expr::term_ref f, s
     if (reach.frame() == 0) {
       // We're reachable since we got here by going back to I, mark it
       reachable = true;
+      // All the obligations on the path are reachable
+      for (size_t i = 0; i < reachability_obligations.size(); ++ i) {
+        d_reachable_index.add(reachability_obligations[i].frame(), reachability_obligations[i].formula());
+      }
       // Remember the counterexample
       if (property_id != d_cex_manager.null_property_id) {
         d_cex_manager.mark_root(reach.formula(), property_id);
@@ -137,11 +164,22 @@ reachability::result reachability::check_reachable(size_t k, expr::term_ref f, s
       break;
     }
 
+    // If a stronger cube is reachable at this frame, we're reachable too
+    if (property_id == d_cex_manager.null_property_id && d_reachable_index.contains_stronger(reach.frame(), reach.formula())) {
+      d_stats.queries_saved->get_value() ++;
+      reachable = true;
+      for (size_t i = 0; i + 1 < reachability_obligations.size(); ++ i) {
+        d_reachable_index.add(reachability_obligations[i].frame(), reachability_obligations[i].formula());
+      }
+      break;
+    }
+
     // Check if the obligation is reachable
     solvers::query_result result = check_one_step_reachable(reach.frame(), reach.formula());
     if (result.result == smt::solver::UNSAT) {
       // Proven, remove from obligations
       reachability_obligations.pop_back();
+      d_unreachable_index.add(reach.frame(), reach.formula());
       // Learn something at k that refutes the formula
       expr::term_ref learnt = d_smt->learn_forward(reach.frame(), reach.formula());
       // Add any unreachability learnts
@@ -215,20 +253,39 @@ void reachability::add_to_frame(size_t k, expr::term_ref f) {
   d_frame_content[k].insert(f);
 }
 
+void reachability::restore(const std::vector<formula_set>& frame_content) {
+  for (size_t k = 0; k < frame_content.size(); ++ k) {
+    ensure_frame(k);
+    formula_set::const_iterator it = frame_content[k].begin();
+    for (; it != frame_content[k].end(); ++ it) {
+      if (!frame_contains(k, *it)) {
+        add_to_frame(k, *it);
+      }
+    }
+  }
+}
+
 void reachability::init(const system::transition_system* transition_system, solvers* smt_solvers) {
   d_transition_system = transition_system;
   d_smt = smt_solvers;
   d_frame_content.clear();
+  d_unreachable_index.clear();
+  d_reachable_index.clear();
 }
 
 void reachability::clear() {
   d_transition_system = 0;
   d_smt = 0;
   d_frame_content.clear();
+  d_unreachable_index.clear();
+  d_reachable_index.clear();
 }
 
 void reachability::gc_collect(const expr::gc_relocator& gc_reloc) {
   // TODO
+  // The indices are only a cache, drop them
+  d_unreachable_index.clear();
+  d_reachable_index.clear();
 }
 
 }
@@ -13,6 +13,7 @@
 #include "system/transition_system.h"
 #include "solvers.h"
 #include "cex_manager.h"
+#include "subsumption_index.h"
 
 #include <deque>
 
@@ -36,6 +37,8 @@ public:
     size_t k;
   };
 
+  typedef std::set<expr::term_ref> formula_set;
+
 
 private:
 
@@ -61,10 +64,16 @@ private:
     utils::stat_int* reachable;
     /** Number of unreachable reasults */
     utils::stat_int* unreachable;
+    /** Number of SMT queries saved by subsumption */
+    utils::stat_int* queries_saved;
 
   } d_stats;
 
-  typedef std::set<expr::term_ref> formula_set;
+  /** Cubes shown unreachable, per frame */
+  subsumption_index d_unreachable_index;
+
+  /** Cubes shown reachable, per frame */
+  subsumption_index d_reachable_index;
 
   /** Set of facts valid per frame */
   std::vector<formula_set> d_frame_content;
@@ -101,6 +110,12 @@ public:
    */
   void add_to_frame(size_t k, expr::term_ref F);
 
+  /** Get the content of all the frames */
+  const std::vector<formula_set>& get_frame_content() const { return d_frame_content; }
+
+  /** Restore the frames (from a checkpoint), adding the content to the solvers */
+  void restore(const std::vector<formula_set>& frame_content);
+
   /**
    * Add to frames 1..k.
    */
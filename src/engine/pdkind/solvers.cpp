@@ -20,9 +20,12 @@
 
 #include "smt/factory.h"
 #include "utils/trace.h"
+#include "utils/budget.h"
 
+#include <sstream>
 #include <iostream>
 #include <fstream>
+#include <boost/thread.hpp>
 
 #define unused_var(x) { (void)x; }
 
@@ -41,18 +44,24 @@ solvers::solvers(const system::context& ctx, const system::transition_system* tr
 , d_induction_generalizer(0)
 , d_minimization_solver(0)
 , d_induction_solver_depth(0)
+, d_induction_guard_count(0)
+, d_induction_guarded(0)
+, d_induction_garbage(0)
 , d_generate_models_for_queries(false)
 {
 }
 
 solvers::~solvers() {
-  delete d_reachability_solver;
-  delete d_initial_solver;
+  smt::factory::release_solver(d_reachability_solver);
+  smt::factory::release_solver(d_initial_solver);
   delete d_induction_solver;
   delete d_induction_generalizer;
-  delete d_minimization_solver;
+  smt::factory::release_solver(d_minimization_solver);
   for (size_t k = 0; k < d_reachability_solvers.size(); ++ k) {
-    delete d_reachability_solvers[k];
+    smt::factory::release_solver(d_reachability_solvers[k]);
+  }
+  for (size_t i = 0; i < d_induction_replicas.size(); ++ i) {
+    delete d_induction_replicas[i];
   }
 }
 
@@ -62,21 +71,21 @@ void solvers::reset(const std::vector<solvers::formula_set>& frames) {
 
   if (d_ctx.get_options().get_bool("pdkind-single-solver")) {
     // Restart the reachability solver
-    delete d_reachability_solver;
+    smt::factory::release_solver(d_reachability_solver);
     d_reachability_solver = 0;
   } else {
     // Restart the solver
     assert(d_size == d_reachability_solvers.size());
     assert(d_size == frames.size());
     for (size_t k = 0; k < d_size; ++ k) {
-      delete d_reachability_solvers[k];
+      smt::factory::release_solver(d_reachability_solvers[k]);
       d_reachability_solvers[k] = 0;
     }
     d_reachability_solvers.clear();
   }
 
   // Clear the initial solver
-  delete d_initial_solver;
+  smt::factory::release_solver(d_initial_solver);
   d_initial_solver = 0;
 
   // Clear the induction solver
@@ -84,9 +93,14 @@ void solvers::reset(const std::vector<solvers::formula_set>& frames) {
   d_induction_solver = 0;
   delete d_induction_generalizer;
   d_induction_generalizer = 0;
+  for (size_t i = 0; i < d_induction_replicas.size(); ++ i) {
+    delete d_induction_replicas[i];
+  }
+  d_induction_replicas.clear();
+  d_induction_guard = expr::term_ref_strong();
 
   // Reset the minimization solver
-  delete d_minimization_solver;
+  smt::factory::release_solver(d_minimization_solver);
   d_minimization_solver = 0;
 
   assert(d_size == frames.size());
@@ -115,28 +129,49 @@ void solvers::init_reachability_solver(size_t k) {
 
     // A solver per frame
     while (d_reachability_solvers.size() <= k) {
-      smt::solver* solver = smt::factory::mk_default_solver(d_tm, d_ctx.get_options(), d_ctx.get_statistics());
-      d_reachability_solvers.push_back(solver);
-      solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_A);
-      solver->add_variables(x_next.begin(), x_next.end(), smt::solver::CLASS_B);
-      solver->add_variables(input.begin(), input.end(), smt::solver::CLASS_T);
+      smt::pooled_solver::base base;
+      base.add_variables(x, smt::solver::CLASS_A);
+      base.add_variables(x_next, smt::solver::CLASS_B);
+      base.add_variables(input, smt::solver::CLASS_T);
       // Add transition relation
-      solver->add(d_transition_system->get_transition_relation(), smt::solver::CLASS_T);
-      if (d_reachability_solvers.size() == 1) {
-        solver->add(d_transition_system->get_initial_states(), smt::solver::CLASS_A);
+      base.add(get_transition_relation(), smt::solver::CLASS_T);
+      if (d_reachability_solvers.size() == 0) {
+        base.add(d_transition_system->get_initial_states(), smt::solver::CLASS_A);
       }
+      smt::solver* solver = smt::factory::acquire_solver(base, d_tm, d_ctx.get_options(), d_ctx.get_statistics());
+      d_reachability_solvers.push_back(solver);
     }
   }
 }
 
+expr::term_ref solvers::get_transition_relation() const {
+  expr::term_ref T = d_transition_system->get_transition_relation();
+  // The invariants of the system hold in all reachable states, so we can
+  // strengthen the transition relation with them
+  std::vector<expr::term_ref> invariants;
+  d_transition_system->get_invariants(0, invariants);
+  if (invariants.empty()) {
+    return T;
+  }
+  const system::state_type* st = d_transition_system->get_state_type();
+  std::vector<expr::term_ref> conjuncts;
+  conjuncts.push_back(T);
+  for (size_t i = 0; i < invariants.size(); ++ i) {
+    conjuncts.push_back(invariants[i]);
+    conjuncts.push_back(st->change_formula_vars(system::state_type::STATE_CURRENT, system::state_type::STATE_NEXT, invariants[i]));
+  }
+  return d_tm.mk_and(conjuncts);
+}
+
 smt::solver* solvers::get_initial_solver() {
   if (d_initial_solver == 0) {
     // The variables from the state types
     const std::vector<expr::term_ref>& x = d_transition_system->get_state_type()->get_variables(system::state_type::STATE_CURRENT);
     // Make the solver
-    d_initial_solver = smt::factory::mk_default_solver(d_tm, d_ctx.get_options(), d_ctx.get_statistics());
-    d_initial_solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_A);
-    d_initial_solver->add(d_transition_system->get_initial_states(), smt::solver::CLASS_A);
+    smt::pooled_solver::base base;
+    base.add_variables(x, smt::solver::CLASS_A);
+    base.add(d_transition_system->get_initial_states(), smt::solver::CLASS_A);
+    d_initial_solver = smt::factory::acquire_solver(base, d_tm, d_ctx.get_options(), d_ctx.get_statistics());
   }
   return d_initial_solver;
 }
@@ -150,11 +185,12 @@ smt::solver* solvers::get_reachability_solver() {
     const std::vector<expr::term_ref>& x_next = d_transition_system->get_state_type()->get_variables(system::state_type::STATE_NEXT);
     const std::vector<expr::term_ref>& input = d_transition_system->get_state_type()->get_variables(system::state_type::STATE_INPUT);
     // Make the solver
-    d_reachability_solver = smt::factory::mk_default_solver(d_tm, d_ctx.get_options(), d_ctx.get_statistics());
-    d_reachability_solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_A);
-    d_reachability_solver->add_variables(x_next.begin(), x_next.end(), smt::solver::CLASS_B);
-    d_reachability_solver->add_variables(input.begin(), input.end(), smt::solver::CLASS_T);
-    d_reachability_solver->add(d_transition_system->get_transition_relation(), smt::solver::CLASS_T);
+    smt::pooled_solver::base base;
+    base.add_variables(x, smt::solver::CLASS_A);
+    base.add_variables(x_next, smt::solver::CLASS_B);
+    base.add_variables(input, smt::solver::CLASS_T);
+    base.add(get_transition_relation(), smt::solver::CLASS_T);
+    d_reachability_solver = smt::factory::acquire_solver(base, d_tm, d_ctx.get_options(), d_ctx.get_statistics());
   }
   return d_reachability_solver;
 }
@@ -169,8 +205,9 @@ smt::solver* solvers::get_minimization_solver() {
   if (d_minimization_solver == 0) {
     // Make the solver
     const std::vector<expr::term_ref>& x = d_transition_system->get_state_type()->get_variables(system::state_type::STATE_CURRENT);
-    d_minimization_solver = smt::factory::mk_default_solver(d_tm, d_ctx.get_options(), d_ctx.get_statistics());
-    d_minimization_solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_A);
+    smt::pooled_solver::base base;
+    base.add_variables(x, smt::solver::CLASS_A);
+    d_minimization_solver = smt::factory::acquire_solver(base, d_tm, d_ctx.get_options(), d_ctx.get_statistics());
   }
   return d_minimization_solver;
 }
@@ -190,6 +227,9 @@ void solvers::gc() {
   if (d_induction_generalizer) {
     d_induction_generalizer->gc();
   }
+  for (size_t i = 0; i < d_induction_replicas.size(); ++ i) {
+    d_induction_replicas[i]->gc();
+  }
   if (d_reachability_solver) {
     d_reachability_solver->gc();
   }
@@ -307,7 +347,12 @@ expr::term_ref solvers::generalize_sat(smt::solver* solver) {
     }
     std::vector<expr::term_ref> conjuncts_vec(conjuncts.begin(), conjuncts.end()), minimized_vec;
     // Minimize
-    quickxplain_generalization(minimization_solver, conjuncts_vec, 0, conjuncts_vec.size(), minimized_vec);
+    if (minimization_solver->supports(smt::solver::ASSUMPTIONS)) {
+      std::vector<expr::term_ref> assumptions;
+      quickxplain_generalization(minimization_solver, conjuncts_vec, 0, conjuncts_vec.size(), assumptions, minimized_vec);
+    } else {
+      quickxplain_generalization(minimization_solver, conjuncts_vec, 0, conjuncts_vec.size(), minimized_vec);
+    }
     TRACE("pdkind::mingen") << "min: old_size = " << conjuncts_vec.size() << ", new_size = " << minimized_vec.size() << std::endl;
     generalization_facts.swap(minimized_vec);
   }
@@ -334,7 +379,12 @@ expr::term_ref solvers::generalize_sat(smt::solver* solver, expr::model::ref m)
     }
     // Minimize
     std::vector<expr::term_ref> conjuncts_vec(conjuncts.begin(), conjuncts.end()), minimized_vec;
-    quickxplain_generalization(minimization_solver, conjuncts_vec, 0, conjuncts_vec.size(), minimized_vec);
+    if (minimization_solver->supports(smt::solver::ASSUMPTIONS)) {
+      std::vector<expr::term_ref> assumptions;
+      quickxplain_generalization(minimization_solver, conjuncts_vec, 0, conjuncts_vec.size(), assumptions, minimized_vec);
+    } else {
+      quickxplain_generalization(minimization_solver, conjuncts_vec, 0, conjuncts_vec.size(), minimized_vec);
+    }
     TRACE("pdkind::mingen") << "min: old_size = " << conjuncts_vec.size() << ", new_size = " << minimized_vec.size() << std::endl;
     generalization_facts.swap(minimized_vec);
   }
@@ -417,6 +467,78 @@ void solvers::quickxplain_interpolant(bool negate, smt::solver* I_solver, smt::s
   if (T_solver) T_solver_scope.pop();
 }
 
+void solvers::quickxplain_interpolant(bool negate, smt::solver* I_solver, smt::solver* T_solver, const std::vector<expr::term_ref>& formulas, size_t begin, size_t end, std::vector<expr::term_ref>& I_assumptions, std::vector<expr::term_ref>& T_assumptions, std::vector<expr::term_ref>& out) {
+
+  // Same as above, but the asserted formulas are assumptions, so no push/pop
+  smt::solver::result I_solver_result = smt::solver::UNSAT;
+  smt::solver::result T_solver_result = smt::solver::UNSAT;
+
+  if (I_solver) { I_solver_result = I_solver->check(I_assumptions); }
+  if (T_solver) { T_solver_result = T_solver->check(T_assumptions); }
+
+  if (I_solver_result == smt::solver::UNSAT && T_solver_result == smt::solver::UNSAT) {
+    // Solver state already unsat, done
+    return;
+  }
+
+  // If only one solver is unsat, we don't use it anymore
+  if (I_solver_result == smt::solver::UNSAT) { I_solver = 0; }
+  if (T_solver_result == smt::solver::UNSAT) { T_solver = 0; }
+
+  assert(begin < end);
+
+  if (begin + 1 == end) {
+    // Only one left, we keep it, since we're SAT in one of the solvers
+    out.push_back(formulas[begin]);
+    return;
+  }
+
+  // Split: how many in first half?
+  size_t n = (end - begin) / 2;
+  size_t I_assumptions_size = I_assumptions.size();
+  size_t T_assumptions_size = T_assumptions.size();
+
+  // Assume first half and minimize the second
+  for (size_t i = begin; i < begin + n; ++ i) {
+    assume_interpolant_formula(negate, formulas[i], I_solver, T_solver, I_assumptions, T_assumptions);
+  }
+  size_t old_out_size = out.size();
+  quickxplain_interpolant(negate, I_solver, T_solver, formulas, begin + n, end, I_assumptions, T_assumptions, out);
+  I_assumptions.resize(I_assumptions_size);
+  T_assumptions.resize(T_assumptions_size);
+
+  // Now, assume the minimized second half, and minimize the first half
+  for (size_t i = old_out_size; i < out.size(); ++ i) {
+    assume_interpolant_formula(negate, out[i], I_solver, T_solver, I_assumptions, T_assumptions);
+  }
+  quickxplain_interpolant(negate, I_solver, T_solver, formulas, begin, begin + n, I_assumptions, T_assumptions, out);
+  I_assumptions.resize(I_assumptions_size);
+  T_assumptions.resize(T_assumptions_size);
+}
+
+void solvers::assume_interpolant_formula(bool negate, expr::term_ref f, smt::solver* I_solver, smt::solver* T_solver, std::vector<expr::term_ref>& I_assumptions, std::vector<expr::term_ref>& T_assumptions) {
+  expr::term_ref to_assume = negate ? d_tm.mk_term(expr::TERM_NOT, f) : f;
+  // Assume in initial solver
+  if (I_solver) {
+    I_assumptions.push_back(to_assume);
+  }
+  // Assume in transition solver
+  if (T_solver) {
+    to_assume = d_transition_system->get_state_type()->change_formula_vars(system::state_type::STATE_CURRENT, system::state_type::STATE_NEXT, to_assume);
+    T_assumptions.push_back(to_assume);
+  }
+}
+
+void solvers::minimize_interpolant(bool negate, smt::solver* I_solver, smt::solver* T_solver, const std::vector<expr::term_ref>& formulas, std::vector<expr::term_ref>& out) {
+  bool assumptions = I_solver->supports(smt::solver::ASSUMPTIONS) && (T_solver == 0 || T_solver->supports(smt::solver::ASSUMPTIONS));
+  if (assumptions) {
+    std::vector<expr::term_ref> I_assumptions, T_assumptions;
+    quickxplain_interpolant(negate, I_solver, T_solver, formulas, 0, formulas.size(), I_assumptions, T_assumptions, out);
+  } else {
+    quickxplain_interpolant(negate, I_solver, T_solver, formulas, 0, formulas.size(), out);
+  }
+}
+
 void solvers::quickxplain_generalization(smt::solver* solver, const std::vector<expr::term_ref>& conjuncts, size_t begin, size_t end, std::vector<expr::term_ref>& out) {
 
   // TRACE("pdkind::min") << "min: begin = " << begin << ", end = " << end << std::endl;
@@ -458,6 +580,40 @@ void solvers::quickxplain_generalization(smt::solver* solver, const std::vector<
   solver_scope.pop();
 }
 
+void solvers::quickxplain_generalization(smt::solver* solver, const std::vector<expr::term_ref>& conjuncts, size_t begin, size_t end, std::vector<expr::term_ref>& assumptions, std::vector<expr::term_ref>& out) {
+
+  // Same as above, but the asserted conjuncts are assumptions, so no push/pop
+  smt::solver::result solver_result = solver->check(assumptions);
+
+  if (solver_result == smt::solver::UNSAT) {
+    // Solver state already unsat, done
+    return;
+  }
+
+  assert(begin < end);
+
+  if (begin + 1 == end) {
+    // Only one left, we keep it, since we're SAT in one of the solvers
+    out.push_back(conjuncts[begin]);
+    return;
+  }
+
+  // Split: how many in first half?
+  size_t n = (end - begin) / 2;
+  size_t assumptions_size = assumptions.size();
+
+  // Assume first half and minimize the second
+  assumptions.insert(assumptions.end(), conjuncts.begin() + begin, conjuncts.begin() + begin + n);
+  size_t old_out_size = out.size();
+  quickxplain_generalization(solver, conjuncts, begin + n, end, assumptions, out);
+  assumptions.resize(assumptions_size);
+
+  // Now, assume the minimized second half, and minimize the first half
+  assumptions.insert(assumptions.end(), out.begin() + old_out_size, out.end());
+  quickxplain_generalization(solver, conjuncts, begin, begin + n, assumptions, out);
+  assumptions.resize(assumptions_size);
+}
+
 struct interpolant_cmp {
   expr::term_manager& tm;
   interpolant_cmp(expr::term_manager& tm): tm(tm) {}
@@ -487,7 +643,7 @@ expr::term_ref solvers::learn_forward(size_t k, expr::term_ref G) {
     d_tm.get_conjuncts(G, G_conjuncts);
     interpolant_cmp cmp(d_tm);
     std::sort(G_conjuncts.begin(), G_conjuncts.end(), cmp);
-    quickxplain_interpolant(false, I_solver, T_solver, G_conjuncts, 0, G_conjuncts.size(), G_conjuncts_min);
+    minimize_interpolant(false, I_solver, T_solver, G_conjuncts, G_conjuncts_min);
     G = d_tm.mk_and(G_conjuncts_min);
   }
 
@@ -526,7 +682,7 @@ expr::term_ref solvers::learn_forward(size_t k, expr::term_ref G) {
     std::vector<expr::term_ref> disjuncts_vec(disjuncts.begin(), disjuncts.end()), minimized_vec;
     interpolant_cmp cmp(d_tm);
     std::sort(disjuncts_vec.begin(), disjuncts_vec.end(), cmp);
-    quickxplain_interpolant(true, I_solver, T_solver, disjuncts_vec, 0, disjuncts_vec.size(), minimized_vec);
+    minimize_interpolant(true, I_solver, T_solver, disjuncts_vec, minimized_vec);
     TRACE("pdkind::min") << "min: old_size = " << disjuncts_vec.size() << ", new_size = " << minimized_vec.size() << std::endl;
     learnt = d_tm.mk_or(minimized_vec);
   } else {
@@ -545,6 +701,7 @@ expr::term_ref solvers::learn_forward(size_t k, expr::term_ref G) {
 
 
 void solvers::gc_collect(const expr::gc_relocator& gc_reloc) {
+  gc_reloc.reloc(d_induction_guard);
 }
 
 void solvers::add_to_reachability_solver(size_t k, expr::term_ref f)  {
@@ -564,21 +721,14 @@ void solvers::add_to_reachability_solver(size_t k, expr::term_ref f)  {
   }
 }
 
-void solvers::reset_induction_solver(size_t depth) {
-  // Reset the induction solver
-  delete d_induction_solver;
-  delete d_induction_generalizer;
-
-  // Transition relation
-  d_transition_relation = d_transition_system->get_transition_relation();
+void solvers::init_induction_solver(smt::solver* solver, size_t first) {
 
-  // The solver
-  d_induction_solver = smt::factory::mk_default_solver(d_tm, d_ctx.get_options(), d_ctx.get_statistics());
-  d_induction_generalizer = smt::factory::mk_default_solver(d_tm, d_ctx.get_options(), d_ctx.get_statistics());
-  d_induction_solver_depth = depth;
+  size_t depth = d_induction_solver_depth;
 
-  // Add variables and transition relation
-  for (size_t k = 0; k <= depth; ++ k) {
+  // Add variables and transition relation. When unrolling an existing solver
+  // further, its old last frame stays in class B, which is fine as both B
+  // and T are eliminated in generalization.
+  for (size_t k = first; k <= depth; ++ k) {
 
     // The variables
     const std::vector<expr::term_ref>& x = d_trace->get_state_variables(k);
@@ -587,45 +737,163 @@ void solvers::reset_induction_solver(size_t depth) {
     if (k == 0) {
       // First frame is A
       const std::vector<expr::term_ref>& x_state = d_transition_system->get_state_type()->get_variables(system::state_type::STATE_CURRENT);
-      d_induction_solver->add_variables(x_state.begin(), x_state.end(), smt::solver::CLASS_A);
-      d_induction_generalizer->add_variables(x_state.begin(), x_state.end(), smt::solver::CLASS_A);
+      solver->add_variables(x_state.begin(), x_state.end(), smt::solver::CLASS_A);
     } else if (k < depth) {
       // Intermediate frames are T
-      d_induction_solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_T);
-      d_induction_generalizer->add_variables(x.begin(), x.end(), smt::solver::CLASS_T);
+      solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_T);
     } else {
       // Last frame is B
-      d_induction_solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_B);
-      d_induction_generalizer->add_variables(x.begin(), x.end(), smt::solver::CLASS_B);
+      solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_B);
     }
 
     // Add input variables
     if (k > 0) {
       const std::vector<expr::term_ref>& input = d_trace->get_input_variables(k-1);
-      d_induction_solver->add_variables(input.begin(), input.end(), smt::solver::CLASS_T);
-      d_induction_generalizer->add_variables(input.begin(), input.end(), smt::solver::CLASS_T);
+      solver->add_variables(input.begin(), input.end(), smt::solver::CLASS_T);
       // Formula T(x_{k-1}, x_k)
       expr::term_ref T = d_trace->get_transition_formula(d_transition_relation, k-1);
       // If transitioning from initial state, move to state vars
       if (k == 1) {
         T = d_trace->get_state_formula(0, T);
       }
-      d_induction_solver->add(T, smt::solver::CLASS_T);
-      d_induction_generalizer->add(T, smt::solver::CLASS_T);
+      solver->add(T, smt::solver::CLASS_T);
+    }
+  }
+}
+
+void solvers::new_induction_guard() {
+  std::stringstream ss;
+  ss << "pdkind_induction_guard_" << d_induction_guard_count ++;
+  expr::term_ref guard = d_tm.mk_variable(ss.str(), d_tm.boolean_type());
+  d_induction_guard = expr::term_ref_strong(d_tm, guard);
+  d_induction_guarded = 0;
+  // Add to the solvers
+  std::vector<expr::term_ref> guard_vars(1, guard);
+  d_induction_solver->add_variables(guard_vars.begin(), guard_vars.end(), smt::solver::CLASS_A);
+  for (size_t i = 0; i < d_induction_replicas.size(); ++ i) {
+    d_induction_replicas[i]->add_variables(guard_vars.begin(), guard_vars.end(), smt::solver::CLASS_A);
+  }
+}
+
+expr::term_ref solvers::induction_guarded(expr::term_ref f) const {
+  if (d_induction_guard.is_null()) {
+    return f;
+  } else {
+    return d_tm.mk_or(d_tm.mk_not(d_induction_guard), f);
+  }
+}
+
+void solvers::assume_induction_guard(smt::solver* solver, std::vector<expr::term_ref>& assumptions) const {
+  if (!d_induction_guard.is_null()) {
+    if (solver->supports(smt::solver::ASSUMPTIONS)) {
+      assumptions.push_back(d_induction_guard);
+    } else {
+      // Emulated assumptions lose the model, assert in the current scope instead
+      solver->add(d_induction_guard, smt::solver::CLASS_A);
+    }
+  }
+}
+
+smt::solver::result solvers::check_induction(smt::solver* solver, const std::vector<expr::term_ref>& assumptions) {
+  if (assumptions.empty()) {
+    return solver->check();
+  } else {
+    return solver->check(assumptions);
+  }
+}
+
+bool solvers::reset_induction_solver(size_t depth) {
+
+  size_t garbage_max = d_ctx.get_options().get_unsigned("pdkind-induction-solver-garbage");
+
+  // Reuse the solver if possible, but start fresh if low on memory. The depth
+  // grows with every frame, so a deeper solver is unrolled further.
+  if (d_induction_solver != 0 && !d_induction_guard.is_null() && d_induction_solver_depth <= depth && !utils::budget::memory_pressure()) {
+    if (d_induction_garbage + d_induction_guarded <= garbage_max) {
+      TRACE("pdkind") << "pdkind: reusing induction solver of depth " << d_induction_solver_depth << " at depth " << depth << std::endl;
+      // Retire the old guard
+      expr::term_ref retire = d_tm.mk_not(d_induction_guard);
+      d_induction_solver->add(retire, smt::solver::CLASS_A);
+      for (size_t i = 0; i < d_induction_replicas.size(); ++ i) {
+        d_induction_replicas[i]->add(retire, smt::solver::CLASS_A);
+      }
+      d_induction_garbage += d_induction_guarded;
+      // Unroll the new frames
+      if (d_induction_solver_depth < depth) {
+        size_t first = d_induction_solver_depth + 1;
+        d_induction_solver_depth = depth;
+        init_induction_solver(d_induction_solver, first);
+        init_induction_solver(d_induction_generalizer, first);
+        for (size_t i = 0; i < d_induction_replicas.size(); ++ i) {
+          init_induction_solver(d_induction_replicas[i], first);
+        }
+      }
+      // New guard for the new frame
+      new_induction_guard();
+      return true;
     }
   }
+
+  // Reset the induction solver
+  delete d_induction_solver;
+  delete d_induction_generalizer;
+  for (size_t i = 0; i < d_induction_replicas.size(); ++ i) {
+    delete d_induction_replicas[i];
+  }
+  d_induction_replicas.clear();
+
+  // Transition relation
+  d_transition_relation = get_transition_relation();
+
+  // The solver
+  d_induction_solver = smt::factory::mk_default_solver(d_tm, d_ctx.get_options(), d_ctx.get_statistics());
+  d_induction_generalizer = smt::factory::mk_default_solver(d_tm, d_ctx.get_options(), d_ctx.get_statistics());
+  d_induction_solver_depth = depth;
+
+  // Add variables and transition relation
+  init_induction_solver(d_induction_solver);
+  init_induction_solver(d_induction_generalizer);
+
+  // Replicas for the workers
+  size_t workers = d_ctx.get_options().get_unsigned("pdkind-workers");
+  while (d_induction_replicas.size() + 1 < workers) {
+    smt::solver* replica = smt::factory::mk_default_solver(d_tm, d_ctx.get_options(), d_ctx.get_statistics());
+    init_induction_solver(replica);
+    d_induction_replicas.push_back(replica);
+  }
+
+  // Guard the frame content if we plan to reuse the solver
+  d_induction_garbage = 0;
+  d_induction_guarded = 0;
+  d_induction_guard = expr::term_ref_strong();
+  if (garbage_max > 0) {
+    new_induction_guard();
+  }
+
+  return false;
 }
 
 void solvers::add_to_induction_solver(expr::term_ref f, induction_assertion_type type) {
   assert(d_induction_solver != 0);
   assert(d_induction_generalizer != 0);
   switch (type) {
-  case INDUCTION_FIRST:
-    d_induction_solver->add(f, smt::solver::CLASS_A);
+  case INDUCTION_FIRST: {
+    expr::term_ref f_guarded = induction_guarded(f);
+    d_induction_solver->add(f_guarded, smt::solver::CLASS_A);
+    for (size_t i = 0; i < d_induction_replicas.size(); ++ i) {
+      d_induction_replicas[i]->add(f_guarded, smt::solver::CLASS_A);
+    }
+    d_induction_guarded ++;
     break;
+  }
   case INDUCTION_INTERMEDIATE:
     for (size_t k = 1; k < d_induction_solver_depth; ++ k) {
-      d_induction_solver->add(d_trace->get_state_formula(f, k), smt::solver::CLASS_T);
+      expr::term_ref f_k = induction_guarded(d_trace->get_state_formula(f, k));
+      d_induction_solver->add(f_k, smt::solver::CLASS_T);
+      for (size_t i = 0; i < d_induction_replicas.size(); ++ i) {
+        d_induction_replicas[i]->add(f_k, smt::solver::CLASS_T);
+      }
+      d_induction_guarded ++;
     }
     break;
   default:
@@ -633,7 +901,11 @@ void solvers::add_to_induction_solver(expr::term_ref f, induction_assertion_type
   }
 
   if (d_ctx.get_options().get_bool("pdkind-check-deadlock")) {
-    smt::solver::result result = d_induction_solver->check();
+    smt::solver_scope scope(d_induction_solver);
+    scope.push();
+    std::vector<expr::term_ref> assumptions;
+    assume_induction_guard(d_induction_solver, assumptions);
+    smt::solver::result result = check_induction(d_induction_solver, assumptions);
     if (result != smt::solver::SAT) {
       std::stringstream ss;
       ss << "pdkind: deadlock detected when checking induction of depth " << d_induction_solver_depth << ".";
@@ -652,6 +924,8 @@ solvers::query_result solvers::check_inductive(expr::term_ref f) {
   // Push the scope
   smt::solver_scope scope(d_induction_solver);
   scope.push();
+  std::vector<expr::term_ref> assumptions;
+  assume_induction_guard(d_induction_solver, assumptions);
 
   // Add the formula (moving current -> next)
   expr::term_ref F_not = d_tm.mk_term(expr::TERM_NOT, f);
@@ -659,7 +933,7 @@ solvers::query_result solvers::check_inductive(expr::term_ref f) {
   d_induction_solver->add(F_not_next, smt::solver::CLASS_B);
 
   // Figure out the result
-  result.result = d_induction_solver->check();
+  result.result = check_induction(d_induction_solver, assumptions);
   switch (result.result) {
   case smt::solver::SAT: {
     // Generalize in the simplified induction
@@ -679,6 +953,108 @@ solvers::query_result solvers::check_inductive(expr::term_ref f) {
   return result;
 }
 
+size_t solvers::induction_workers() const {
+  return d_induction_replicas.size() + 1;
+}
+
+namespace {
+
+/** Runs the check of one induction solver replica */
+class induction_check_worker {
+
+  /** The solver to check */
+  smt::solver* d_solver;
+
+  /** Assumptions for the check */
+  const std::vector<expr::term_ref>* d_assumptions;
+
+  /** Index of the check */
+  size_t d_index;
+
+  /** Where to put the result */
+  smt::solver::result* d_result;
+
+  /** Indices of the finished checks (shared) */
+  std::vector<size_t>* d_finished;
+
+  /** Mutex for the finished checks */
+  boost::mutex* d_finished_mutex;
+
+public:
+
+  induction_check_worker(smt::solver* solver, const std::vector<expr::term_ref>* assumptions, size_t index, smt::solver::result* result, std::vector<size_t>* finished, boost::mutex* finished_mutex)
+  : d_solver(solver)
+  , d_assumptions(assumptions)
+  , d_index(index)
+  , d_result(result)
+  , d_finished(finished)
+  , d_finished_mutex(finished_mutex)
+  {}
+
+  void operator () () {
+    smt::solver::result r = smt::solver::UNKNOWN;
+    try {
+      r = solvers::check_induction(d_solver, *d_assumptions);
+    } catch (const exception&) {
+      // Report as unknown, the caller will redo the check
+      r = smt::solver::UNKNOWN;
+    }
+    boost::mutex::scoped_lock lock(*d_finished_mutex);
+    *d_result = r;
+    d_finished->push_back(d_index);
+  }
+};
+
+}
+
+void solvers::check_inductive_batch(const std::vector<expr::term_ref>& f, std::vector<smt::solver::result>& out, std::vector<size_t>& finished) {
+
+  assert(d_induction_solver != 0);
+  assert(f.size() <= induction_workers());
+
+  // The solvers to use, and whether they can run concurrently
+  std::vector<smt::solver*> replicas;
+  bool concurrent = f.size() > 1;
+  for (size_t i = 0; i < f.size(); ++ i) {
+    smt::solver* solver = i == 0 ? d_induction_solver : d_induction_replicas[i-1];
+    concurrent = concurrent && solver->supports(smt::solver::CONCURRENT_CHECK);
+    replicas.push_back(solver);
+  }
+
+  // Add the formulas (all term construction happens here, on this thread)
+  std::vector< std::vector<expr::term_ref> > assumptions(f.size());
+  for (size_t i = 0; i < f.size(); ++ i) {
+    expr::term_ref F_not = d_tm.mk_term(expr::TERM_NOT, f[i]);
+    expr::term_ref F_not_next = d_trace->get_state_formula(F_not, d_induction_solver_depth);
+    replicas[i]->push();
+    assume_induction_guard(replicas[i], assumptions[i]);
+    replicas[i]->add(F_not_next, smt::solver::CLASS_B);
+  }
+
+  // Run the checks
+  out.clear();
+  out.resize(f.size(), smt::solver::UNKNOWN);
+  finished.clear();
+  boost::mutex finished_mutex;
+  if (concurrent) {
+    boost::thread_group workers;
+    for (size_t i = 0; i < f.size(); ++ i) {
+      workers.create_thread(induction_check_worker(replicas[i], &assumptions[i], i, &out[i], &finished, &finished_mutex));
+    }
+    workers.join_all();
+  } else {
+    for (size_t i = 0; i < f.size(); ++ i) {
+      induction_check_worker worker(replicas[i], &assumptions[i], i, &out[i], &finished, &finished_mutex);
+      worker();
+    }
+  }
+
+  // Back to the common content
+  for (size_t i = 0; i < f.size(); ++ i) {
+    replicas[i]->pop();
+  }
+}
+
 solvers::query_result solvers::check_inductive_model(expr::model::ref m, expr::term_ref f) {
   assert(d_induction_solver != 0);
   assert(d_induction_generalizer != 0);
@@ -826,11 +1202,56 @@ void solvers::quickxplain_frame(smt::solver* solver, const std::vector<induction
 
 }
 
+void solvers::quickxplain_frame(smt::solver* solver, const std::vector<induction_obligation>& frame, size_t begin, size_t end, std::vector<expr::term_ref>& assumptions, std::vector<induction_obligation>& out) {
+
+  // Same as above, but the asserted frame formulas are assumptions, so no push/pop
+  assert(begin < end);
+
+  if (begin + 1 == end) {
+    // Keep the properties
+    if (frame[begin].d == 0) {
+      out.push_back(frame[begin]);
+      return;
+    }
+    // Only one left, we keep it, check if we need it
+    assumptions.push_back(d_tm.mk_not(frame[begin].F_fwd));
+    if (solver->check(assumptions) != smt::solver::UNSAT) {
+      out.push_back(frame[begin]);
+    }
+    assumptions.pop_back();
+    return;
+  }
+
+  // Split: how many in first half?
+  size_t n = (end - begin) / 2;
+  size_t assumptions_size = assumptions.size();
+
+  // Assume first half and minimize the second
+  for (size_t i = begin; i < begin + n; ++ i) {
+    assumptions.push_back(frame[i].F_fwd);
+  }
+  size_t old_out_size = out.size();
+  quickxplain_frame(solver, frame, begin + n, end, assumptions, out);
+  assumptions.resize(assumptions_size);
+
+  // Now, assume the minimized second half, and minimize the first half
+  for (size_t i = old_out_size; i < out.size(); ++ i) {
+    assumptions.push_back(out[i].F_fwd);
+  }
+  quickxplain_frame(solver, frame, begin, begin + n, assumptions, out);
+  assumptions.resize(assumptions_size);
+}
+
 void solvers::minimize_frame(std::vector<induction_obligation>& frame) {
   std::vector<induction_obligation> out;
   smt::solver* solver = get_minimization_solver();
   std::sort(frame.begin(), frame.end(), induction_obligation_cmp_better());
-  quickxplain_frame(solver, frame, 0, frame.size(), out);
+  if (solver->supports(smt::solver::ASSUMPTIONS)) {
+    std::vector<expr::term_ref> assumptions;
+    quickxplain_frame(solver, frame, 0, frame.size(), assumptions, out);
+  } else {
+    quickxplain_frame(solver, frame, 0, frame.size(), out);
+  }
   frame.swap(out);
 }
 
@@ -79,18 +79,63 @@ class solvers {
   /** Solver for induction generalization */
   smt::solver* d_induction_generalizer;
 
+  /**
+   * Replicas of the induction solver, one per extra worker. All facts added
+   * to the induction solver are also added to the replicas.
+   */
+  std::vector<smt::solver*> d_induction_replicas;
+
   /** Solver for minimization */
   smt::solver* d_minimization_solver;
 
   /** Depth of the induction solver */
   size_t d_induction_solver_depth;
 
+  /**
+   * The frame content in the induction solver (and replicas) is guarded by
+   * this activation literal, that is assumed in all checks. When moving to
+   * a new frame of the same depth, the guard is retired (asserted false) and
+   * a new one is made, so the solver can be reused. Null if not reusing.
+   */
+  expr::term_ref_strong d_induction_guard;
+
+  /** Number of guards made so far */
+  size_t d_induction_guard_count;
+
+  /** Number of assertions guarded by the current guard */
+  size_t d_induction_guarded;
+
+  /** Number of assertions guarded by retired guards */
+  size_t d_induction_garbage;
+
+  /** Make a new guard and add it to the induction solver and replicas */
+  void new_induction_guard();
+
+  /** Returns the formula guarded by the current guard */
+  expr::term_ref induction_guarded(expr::term_ref f) const;
+
+  /**
+   * Add the current guard to the assumptions of the next check of the
+   * solver. Solvers without native assumptions get the guard asserted in
+   * the current scope instead, so that the model stays available.
+   */
+  void assume_induction_guard(smt::solver* solver, std::vector<expr::term_ref>& assumptions) const;
+
   /** Relation used in the induction solver */
   expr::term_ref d_transition_relation;
 
   /** Returns the induction solver */
   smt::solver* get_initial_solver();
 
+  /** Get the transition relation, strengthened with the system invariants */
+  expr::term_ref get_transition_relation() const;
+
+  /**
+   * Add the variables and the unrolled transition relation of frames
+   * first, ..., d_induction_solver_depth to an induction solver.
+   */
+  void init_induction_solver(smt::solver* solver, size_t first = 0);
+
   /** Initialize the reachability solver for frame k */
   void init_reachability_solver(size_t k);
 
@@ -115,12 +160,27 @@ class solvers {
   /** Use quickxplain to minimize the interpolant */
   void quickxplain_interpolant(bool negate, smt::solver* I_solver, smt::solver* T_solver, const std::vector<expr::term_ref>& formulas, size_t begin, size_t end, std::vector<expr::term_ref>& out);
 
+  /** Use quickxplain to minimize the interpolant, with the asserted formulas as assumptions */
+  void quickxplain_interpolant(bool negate, smt::solver* I_solver, smt::solver* T_solver, const std::vector<expr::term_ref>& formulas, size_t begin, size_t end, std::vector<expr::term_ref>& I_assumptions, std::vector<expr::term_ref>& T_assumptions, std::vector<expr::term_ref>& out);
+
+  /** Add the (negated) formula to the assumptions of the solvers that are still in use */
+  void assume_interpolant_formula(bool negate, expr::term_ref f, smt::solver* I_solver, smt::solver* T_solver, std::vector<expr::term_ref>& I_assumptions, std::vector<expr::term_ref>& T_assumptions);
+
+  /** Minimize the interpolant formulas, with assumptions if both solvers support them */
+  void minimize_interpolant(bool negate, smt::solver* I_solver, smt::solver* T_solver, const std::vector<expr::term_ref>& formulas, std::vector<expr::term_ref>& out);
+
   /** Use quickxplain to minimize the generalization */
   void quickxplain_generalization(smt::solver* solver, const std::vector<expr::term_ref>& disjuncts, size_t begin, size_t end, std::vector<expr::term_ref>& out);
 
+  /** Use quickxplain to minimize the generalization, with the asserted conjuncts as assumptions */
+  void quickxplain_generalization(smt::solver* solver, const std::vector<expr::term_ref>& disjuncts, size_t begin, size_t end, std::vector<expr::term_ref>& assumptions, std::vector<expr::term_ref>& out);
+
   /** Use quickxplain to minimize the frame */
   void quickxplain_frame(smt::solver* solver, const std::vector<induction_obligation>& frame, size_t begin, size_t end, std::vector<induction_obligation>& out);
 
+  /** Use quickxplain to minimize the frame, with the asserted frame formulas as assumptions */
+  void quickxplain_frame(smt::solver* solver, const std::vector<induction_obligation>& frame, size_t begin, size_t end, std::vector<expr::term_ref>& assumptions, std::vector<induction_obligation>& out);
+
 public:
 
   /** Create solvers for the given transition system */
@@ -163,8 +223,12 @@ public:
    * transitions. So, if you'd like to try k-induction, you need to do depth k + 1.
    * The solver will have depth frames and all formulas will be added to frames
    * < depth.
+   *
+   * If the solver has at most the given depth, and the retired frame content
+   * is below the garbage threshold, the solver is reused, unrolling it further
+   * if needed. Returns true if reused.
    */
-  void reset_induction_solver(size_t depth);
+  bool reset_induction_solver(size_t depth);
 
   enum induction_assertion_type {
     // First frame
@@ -187,6 +251,22 @@ public:
    */
   query_result check_inductive(expr::term_ref f);
 
+  /** Number of induction workers, i.e. the induction solver and its replicas */
+  size_t induction_workers() const;
+
+  /**
+   * Check if the formulas f[i] are inductive, each on its own replica of the
+   * induction solver (the result is out[i]). All the replicas have the same
+   * content, so the results don't depend on the order. If the solvers allow
+   * it, the checks run concurrently. The indices of the checks in the order
+   * they finished are returned in finished.
+   */
+  void check_inductive_batch(const std::vector<expr::term_ref>& f, std::vector<smt::solver::result>& out, std::vector<size_t>& finished);
+
+  /** Check an induction solver under the assumptions from assume_induction_guard() */
+  static
+  smt::solver::result check_induction(smt::solver* solver, const std::vector<expr::term_ref>& assumptions);
+
   /**
    * Check if the given model from induction check satisfies f at frame depth.
    * If yes, returns generalization.
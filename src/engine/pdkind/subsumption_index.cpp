@@ -0,0 +1,93 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "subsumption_index.h"
+
+#include <set>
+#include <algorithm>
+
+namespace sally {
+namespace pdkind {
+
+subsumption_index::subsumption_index(expr::term_manager& tm)
+: d_tm(tm)
+{}
+
+void subsumption_index::mk_entry(expr::term_ref cube, entry& e) const {
+  // Sorted literals
+  std::set<expr::term_ref> literals;
+  d_tm.get_conjuncts(cube, literals);
+  e.literals.assign(literals.begin(), literals.end());
+  // The signature
+  e.signature = 0;
+  for (size_t i = 0; i < e.literals.size(); ++ i) {
+    e.signature |= ((size_t) 1) << (e.literals[i].index() % (sizeof(size_t)*8));
+  }
+}
+
+void subsumption_index::add(size_t k, expr::term_ref cube) {
+  if (d_frames.size() <= k) {
+    d_frames.resize(k + 1);
+  }
+  entry e;
+  mk_entry(cube, e);
+  d_frames[k].push_back(e);
+}
+
+bool subsumption_index::contains_weaker(size_t k, expr::term_ref cube) const {
+  if (k >= d_frames.size() || d_frames[k].empty()) {
+    return false;
+  }
+  entry e;
+  mk_entry(cube, e);
+  const entry_vector& frame = d_frames[k];
+  for (size_t i = 0; i < frame.size(); ++ i) {
+    // Literals of frame[i] must be in e
+    if ((frame[i].signature & ~e.signature) != 0) continue;
+    if (frame[i].literals.size() > e.literals.size()) continue;
+    if (std::includes(e.literals.begin(), e.literals.end(), frame[i].literals.begin(), frame[i].literals.end())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool subsumption_index::contains_stronger(size_t k, expr::term_ref cube) const {
+  if (k >= d_frames.size() || d_frames[k].empty()) {
+    return false;
+  }
+  entry e;
+  mk_entry(cube, e);
+  const entry_vector& frame = d_frames[k];
+  for (size_t i = 0; i < frame.size(); ++ i) {
+    // Literals of e must be in frame[i]
+    if ((e.signature & ~frame[i].signature) != 0) continue;
+    if (e.literals.size() > frame[i].literals.size()) continue;
+    if (std::includes(frame[i].literals.begin(), frame[i].literals.end(), e.literals.begin(), e.literals.end())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void subsumption_index::clear() {
+  d_frames.clear();
+}
+
+}
+}
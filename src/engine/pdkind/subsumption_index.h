@@ -0,0 +1,83 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "expr/term.h"
+#include "expr/term_manager.h"
+
+#include <vector>
+
+namespace sally {
+namespace pdkind {
+
+/**
+ * Per-frame index of cubes (conjunctions of literals) used to answer
+ * subsumption queries without going to the solver. Each cube is kept as a
+ * sorted vector of its literals, together with a signature bitmask of the
+ * literal ids, so that most non-subsumed entries are rejected with a single
+ * mask test.
+ */
+class subsumption_index {
+
+  /** A cube in the index */
+  struct entry {
+    /** Bitmask of the literal ids */
+    size_t signature;
+    /** The sorted literals */
+    std::vector<expr::term_ref> literals;
+  };
+
+  typedef std::vector<entry> entry_vector;
+
+  /** The term manager */
+  expr::term_manager& d_tm;
+
+  /** The entries per frame */
+  std::vector<entry_vector> d_frames;
+
+  /** Make the entry for the cube */
+  void mk_entry(expr::term_ref cube, entry& e) const;
+
+public:
+
+  /** Construct the index */
+  subsumption_index(expr::term_manager& tm);
+
+  /** Add the cube at frame k */
+  void add(size_t k, expr::term_ref cube);
+
+  /**
+   * Returns true if there is a cube at frame k whose literals are a subset
+   * of the literals of the given cube, i.e. a weaker cube.
+   */
+  bool contains_weaker(size_t k, expr::term_ref cube) const;
+
+  /**
+   * Returns true if there is a cube at frame k whose literals are a superset
+   * of the literals of the given cube, i.e. a stronger cube.
+   */
+  bool contains_stronger(size_t k, expr::term_ref cube) const;
+
+  /** Clear the index */
+  void clear();
+
+};
+
+}
+}
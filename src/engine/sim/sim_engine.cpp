@@ -0,0 +1,449 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "engine/sim/sim_engine.h"
+
+#include "smt/factory.h"
+#include "expr/gc_relocator.h"
+#include "utils/trace.h"
+#include "utils/budget.h"
+
+#include <sstream>
+#include <iostream>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+namespace sally {
+namespace sim {
+
+sim_engine::sim_engine(const system::context& ctx)
+: engine(ctx)
+, d_trace(0)
+, d_functions(ctx.tm())
+, d_max_steps(0)
+, d_range(0)
+, d_violation(0)
+, d_interrupted(false)
+{
+  d_stats.traces = new utils::stat_int("sim::traces", 0);
+  d_stats.steps = new utils::stat_int("sim::steps", 0);
+  ctx.get_statistics().add(new utils::stat_delimiter());
+  ctx.get_statistics().add(d_stats.traces);
+  ctx.get_statistics().add(d_stats.steps);
+}
+
+sim_engine::~sim_engine() {}
+
+expr::value sim_engine::random_value(random& rng, expr::term_ref type) const {
+  const expr::term& type_term = tm().term_of(type);
+  switch (type_term.op()) {
+  case expr::TYPE_BOOL:
+    return expr::value((rng() & 1) == 1);
+  case expr::TYPE_INTEGER:
+    return expr::value(expr::rational((long) (rng() % (2*d_range + 1)) - d_range, 1));
+  case expr::TYPE_REAL:
+    // Allow halves too
+    return expr::value(expr::rational((long) (rng() % (4*d_range + 1)) - 2*d_range, 2));
+  case expr::TYPE_BITVECTOR: {
+    size_t size = tm().get_bitvector_type_size(type);
+    expr::integer z;
+    for (size_t i = 0; i < size; i += 16) {
+      size_t n = size - i < 16 ? size - i : 16;
+      z = z * expr::integer(1L << n) + expr::integer((long) (rng() & ((1u << n) - 1)));
+    }
+    return expr::value(expr::bitvector(size, z));
+  }
+  default: {
+    std::stringstream ss;
+    ss << "Simulation: unsupported type " << type << ".";
+    throw exception(ss.str());
+  }
+  }
+}
+
+void sim_engine::add_hints(random& rng, const std::vector<expr::term_ref>& vars, smt::solver& solver, smt::solver::formula_class c) const {
+  for (size_t i = 0; i < vars.size(); ++ i) {
+    if (rng() & 1) {
+      expr::value v = random_value(rng, tm().type_of(vars[i]));
+      solver.add(tm().mk_term(expr::TERM_EQ, vars[i], v.to_term(tm())), c);
+    }
+  }
+}
+
+expr::value sim_engine::get_value(random& rng, expr::model::ref m, expr::term_ref var) const {
+  if (m->has_value(var)) {
+    return m->get_variable_value(var);
+  } else {
+    return random_value(rng, tm().type_of(var));
+  }
+}
+
+bool sim_engine::initial_state(random& rng, const system::transition_system* ts, smt::solver& solver, sim_trace& trace) {
+
+  const std::vector<expr::term_ref>& x = ts->get_state_type()->get_variables(system::state_type::STATE_CURRENT);
+
+  // Try with hints first, and then without
+  solver.push();
+  add_hints(rng, x, solver, smt::solver::CLASS_A);
+  smt::solver::result r = solver.check();
+  if (r != smt::solver::SAT) {
+    solver.pop();
+    solver.push();
+    r = solver.check();
+  }
+  if (r != smt::solver::SAT) {
+    solver.pop();
+    return false;
+  }
+
+  expr::model::ref m = solver.get_model();
+  std::vector<expr::value> state;
+  for (size_t i = 0; i < x.size(); ++ i) {
+    state.push_back(get_value(rng, m, x[i]));
+  }
+  trace.states.push_back(state);
+  solver.pop();
+
+  return true;
+}
+
+bool sim_engine::check_property(const system::state_type* st, const sim_trace& trace) const {
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::value>& state = trace.states.back();
+  expr::model m(tm(), false);
+  for (size_t i = 0; i < x.size(); ++ i) {
+    m.set_variable_value(x[i], state[i]);
+  }
+  return m.is_true(d_property);
+}
+
+bool sim_engine::simulate_evaluation(random& rng, const system::state_type* st, size_t index, sim_trace& trace, size_t& steps) {
+
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::term_ref>& x_next = st->get_variables(system::state_type::STATE_NEXT);
+  const std::vector<expr::term_ref>& input = st->get_variables(system::state_type::STATE_INPUT);
+
+  // The model, with all the variables set upfront. The model keeps references
+  // to new variables, so we do it under the lock, and all the other
+  // operations only read the terms.
+  expr::model* m = 0;
+  {
+    boost::mutex::scoped_lock lock(d_mutex);
+    m = new expr::model(tm(), false);
+    for (size_t i = 0; i < x.size(); ++ i) {
+      m->set_variable_value(x[i], trace.states[0][i]);
+      m->set_variable_value(x_next[i], trace.states[0][i]);
+    }
+    for (size_t i = 0; i < input.size(); ++ i) {
+      m->set_variable_value(input[i], random_value(rng, tm().type_of(input[i])));
+    }
+  }
+
+  bool violated = false;
+  for (size_t k = 0; !d_interrupted; ++ k) {
+
+    // Check the property
+    if (!m->is_true(d_property)) {
+      violated = true;
+      break;
+    }
+
+    // Done, or an earlier trace already has a violation
+    if (k == d_max_steps) {
+      break;
+    }
+    {
+      boost::mutex::scoped_lock lock(d_mutex);
+      if (d_violation < index) {
+        break;
+      }
+    }
+
+    // Try a few inputs until the constraints are satisfied
+    std::vector<expr::value> inputs(input.size());
+    bool ok = false;
+    for (size_t attempt = 0; !ok && attempt < 10; ++ attempt) {
+      for (size_t i = 0; i < input.size(); ++ i) {
+        inputs[i] = random_value(rng, tm().type_of(input[i]));
+        m->set_variable_value(input[i], inputs[i]);
+      }
+      for (size_t i = 0; i < x_next.size(); ++ i) {
+        if (d_functions.is_unconstrained(i)) {
+          m->set_variable_value(x_next[i], random_value(rng, tm().type_of(x_next[i])));
+        }
+      }
+      ok = d_functions.evaluate(*m, x_next);
+    }
+    if (!ok) {
+      // Stuck
+      break;
+    }
+
+    // Move to the next state
+    std::vector<expr::value> state(x.size());
+    for (size_t i = 0; i < x.size(); ++ i) {
+      state[i] = m->get_variable_value(x_next[i]);
+      m->set_variable_value(x[i], state[i]);
+    }
+    trace.inputs.push_back(inputs);
+    trace.states.push_back(state);
+    steps ++;
+  }
+
+  {
+    boost::mutex::scoped_lock lock(d_mutex);
+    delete m;
+  }
+
+  return violated;
+}
+
+bool sim_engine::simulate_solver(random& rng, const system::transition_system* ts, smt::solver& solver, sim_trace& trace, size_t& steps) {
+
+  const system::state_type* st = ts->get_state_type();
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::term_ref>& x_next = st->get_variables(system::state_type::STATE_NEXT);
+  const std::vector<expr::term_ref>& input = st->get_variables(system::state_type::STATE_INPUT);
+
+  for (size_t k = 0; ; ++ k) {
+
+    // Check the property
+    if (!check_property(st, trace)) {
+      return true;
+    }
+
+    if (k == d_max_steps) {
+      return false;
+    }
+
+    // Stop if out of budget
+    utils::budget::check();
+
+    // Fix the current state
+    const std::vector<expr::value>& current = trace.states.back();
+    solver.push();
+    for (size_t i = 0; i < x.size(); ++ i) {
+      solver.add(tm().mk_term(expr::TERM_EQ, x[i], current[i].to_term(tm())), smt::solver::CLASS_A);
+    }
+
+    // Get a successor, with hints first and then without
+    solver.push();
+    add_hints(rng, input, solver, smt::solver::CLASS_T);
+    add_hints(rng, x_next, solver, smt::solver::CLASS_B);
+    smt::solver::result r = solver.check();
+    if (r != smt::solver::SAT) {
+      solver.pop();
+      solver.push();
+      r = solver.check();
+    }
+    if (r != smt::solver::SAT) {
+      // Stuck
+      solver.pop();
+      solver.pop();
+      return false;
+    }
+
+    expr::model::ref m = solver.get_model();
+    std::vector<expr::value> inputs(input.size());
+    for (size_t i = 0; i < input.size(); ++ i) {
+      inputs[i] = get_value(rng, m, input[i]);
+    }
+    std::vector<expr::value> state(x.size());
+    for (size_t i = 0; i < x.size(); ++ i) {
+      state[i] = get_value(rng, m, x_next[i]);
+    }
+    trace.inputs.push_back(inputs);
+    trace.states.push_back(state);
+    steps ++;
+
+    solver.pop();
+    solver.pop();
+  }
+}
+
+void sim_engine::simulation_thread(const system::state_type* st, size_t index, size_t n, std::vector<random>* rngs, size_t* steps) {
+  try {
+    for (size_t i = index; i < d_traces.size() && !d_interrupted; i += n) {
+      {
+        boost::mutex::scoped_lock lock(d_mutex);
+        if (d_violation < i) {
+          break;
+        }
+      }
+      bool violated = simulate_evaluation((*rngs)[i], st, i, d_traces[i], *steps);
+      boost::mutex::scoped_lock lock(d_mutex);
+      if (violated) {
+        if (i < d_violation) {
+          d_violation = i;
+        }
+      } else {
+        d_traces[i] = sim_trace();
+      }
+    }
+  } catch (const exception& e) {
+    std::stringstream ss;
+    ss << e;
+    boost::mutex::scoped_lock lock(d_mutex);
+    d_error = ss.str();
+    d_interrupted = true;
+  }
+}
+
+void sim_engine::set_trace_model(const system::state_type* st, const sim_trace& trace) {
+  expr::model::ref m = new expr::model(tm(), false);
+  size_t k = trace.states.size() - 1;
+  for (size_t i = 0; i <= k; ++ i) {
+    const std::vector<expr::term_ref>& vars = d_trace->get_state_variables(i);
+    for (size_t j = 0; j < vars.size(); ++ j) {
+      m->set_variable_value(vars[j], trace.states[i][j]);
+    }
+    if (i < k) {
+      const std::vector<expr::term_ref>& inputs = d_trace->get_input_variables(i);
+      for (size_t j = 0; j < inputs.size(); ++ j) {
+        m->set_variable_value(inputs[j], trace.inputs[i][j]);
+      }
+    }
+  }
+  d_trace->set_model(m, 0, k);
+}
+
+engine::result sim_engine::query(const system::transition_system* ts, const system::state_formula* sf) {
+
+  const system::state_type* st = ts->get_state_type();
+  const std::vector<expr::term_ref>& x = st->get_variables(system::state_type::STATE_CURRENT);
+  const std::vector<expr::term_ref>& x_next = st->get_variables(system::state_type::STATE_NEXT);
+  const std::vector<expr::term_ref>& input = st->get_variables(system::state_type::STATE_INPUT);
+
+  // The trace we are using
+  d_trace = ts->get_trace_helper();
+  d_trace->clear_model();
+
+  d_property = sf->get_formula();
+  d_max_steps = ctx().get_options().get_unsigned("sim-steps");
+  d_range = ctx().get_options().get_unsigned("sim-range");
+  size_t n_traces = ctx().get_options().get_unsigned("sim-traces");
+  unsigned seed = ctx().get_options().get_unsigned("sim-seed");
+
+  // Random generator for each trace
+  std::vector<random> rngs;
+  for (size_t i = 0; i < n_traces; ++ i) {
+    rngs.push_back(random(seed * 2654435761u + i));
+  }
+
+  // Initial states
+  smt::solver::ref solver(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
+  solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_A);
+  solver->add(ts->get_initial_states(), smt::solver::CLASS_A);
+  d_traces.clear();
+  d_traces.resize(n_traces);
+  for (size_t i = 0; i < n_traces; ++ i) {
+    if (!initial_state(rngs[i], ts, *solver, d_traces[i])) {
+      MSG(1) << "Sim: no initial states" << std::endl;
+      return VALID;
+    }
+  }
+
+  d_violation = n_traces;
+  d_interrupted = false;
+  d_error.clear();
+  size_t steps = 0;
+
+  if (d_functions.extract(ts)) {
+
+    // Simulate by evaluation in threads
+    size_t n_threads = ctx().get_options().get_unsigned("sim-threads");
+    if (n_threads == 0) { n_threads = 1; }
+    if (n_threads > n_traces) { n_threads = n_traces; }
+    MSG(1) << "Sim: simulating " << n_traces << " traces by evaluation (" << n_threads << " threads)" << std::endl;
+
+    std::vector<size_t> thread_steps(n_threads, 0);
+    std::vector<boost::thread*> threads;
+    for (size_t i = 0; i < n_threads; ++ i) {
+      threads.push_back(new boost::thread(boost::bind(&sim_engine::simulation_thread, this, st, i, n_threads, &rngs, &thread_steps[i])));
+    }
+
+    // Wait for the threads, stop them if out of budget
+    bool out_of_budget = false;
+    for (size_t i = 0; i < threads.size(); ++ i) {
+      while (!threads[i]->timed_join(boost::posix_time::milliseconds(100))) {
+        if (utils::budget::get_status() != utils::budget::BUDGET_OK) {
+          d_interrupted = true;
+          out_of_budget = true;
+        }
+      }
+      delete threads[i];
+      steps += thread_steps[i];
+    }
+    d_stats.steps->get_value() += steps;
+    if (out_of_budget) {
+      utils::budget::check();
+    }
+    if (!d_error.empty()) {
+      throw exception(d_error);
+    }
+
+  } else {
+
+    // Simulate with the solver
+    MSG(1) << "Sim: simulating " << n_traces << " traces with the solver" << std::endl;
+
+    smt::solver::ref step_solver(smt::factory::mk_default_solver(tm(), ctx().get_options(), ctx().get_statistics()));
+    step_solver->add_variables(x.begin(), x.end(), smt::solver::CLASS_A);
+    step_solver->add_variables(x_next.begin(), x_next.end(), smt::solver::CLASS_B);
+    step_solver->add_variables(input.begin(), input.end(), smt::solver::CLASS_T);
+    step_solver->add(ts->get_transition_relation(), smt::solver::CLASS_T);
+    for (size_t i = 0; i < n_traces; ++ i) {
+      bool violated = simulate_solver(rngs[i], ts, *step_solver, d_traces[i], steps);
+      if (violated) {
+        d_violation = i;
+        break;
+      }
+      d_traces[i] = sim_trace();
+    }
+    d_stats.steps->get_value() += steps;
+  }
+
+  d_stats.traces->get_value() += d_violation < n_traces ? d_violation + 1 : n_traces;
+
+  if (d_violation < n_traces) {
+    const sim_trace& trace = d_traces[d_violation];
+    MSG(1) << "Sim: property violated in trace " << d_violation << " at step " << trace.states.size() - 1 << std::endl;
+    set_trace_model(st, trace);
+    d_traces.clear();
+    return INVALID;
+  }
+
+  MSG(1) << "Sim: no violation found" << std::endl;
+  d_traces.clear();
+  return UNKNOWN;
+}
+
+const system::trace_helper* sim_engine::get_trace() {
+  return d_trace;
+}
+
+engine::invariant sim_engine::get_invariant() {
+  throw exception("Not supported.");
+}
+
+void sim_engine::gc_collect(const expr::gc_relocator& gc_reloc) {
+  d_functions.gc_collect(gc_reloc);
+}
+
+}
+}
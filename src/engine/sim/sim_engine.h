@@ -0,0 +1,145 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "smt/solver.h"
+#include "system/context.h"
+#include "engine/engine.h"
+#include "expr/model.h"
+#include "system/trace_helper.h"
+#include "system/transition_functions.h"
+
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include <boost/random/mersenne_twister.hpp>
+
+namespace sally {
+namespace sim {
+
+/**
+ * Random simulation engine, a cheap falsification pass. Each trace starts
+ * from an initial state obtained from the solver (with random hints on the
+ * state variables), and then takes random steps for a bounded number of
+ * steps. If the next-state functions can be extracted from the transition
+ * relation (conjuncts x' = f(x, input)), the steps are computed by the
+ * term evaluator on random inputs, and the traces are simulated in
+ * parallel threads. Otherwise, the successors are obtained from the solver
+ * with random hints on the inputs and next-state variables. Each trace has
+ * its own random generator, seeded from the sim-seed option and the trace
+ * index, and the reported violation is the one in the trace with the
+ * smallest index, so the results don't depend on the number of threads.
+ */
+class sim_engine : public engine {
+
+public:
+
+  /** Random generator */
+  typedef boost::random::mt19937 random;
+
+  /** A simulated trace, values of the state and input variables per step */
+  struct sim_trace {
+    std::vector< std::vector<expr::value> > states;
+    std::vector< std::vector<expr::value> > inputs;
+  };
+
+private:
+
+  /** The trace we're building */
+  system::trace_helper* d_trace;
+
+  /** The property being checked */
+  expr::term_ref d_property;
+
+  /** The next-state functions, if the transition relation is functional */
+  system::transition_functions d_functions;
+
+  /** Number of steps in each trace */
+  size_t d_max_steps;
+
+  /** Range of the random integer and real values */
+  long d_range;
+
+  /** The simulated traces */
+  std::vector<sim_trace> d_traces;
+
+  /** Index of the first trace with a violation (number of traces if none) */
+  size_t d_violation;
+
+  /** Set to stop the simulation threads */
+  volatile bool d_interrupted;
+
+  /** Error message from a simulation thread, if any */
+  std::string d_error;
+
+  /** Lock for the shared simulation data */
+  boost::mutex d_mutex;
+
+  /** Simulation statistics */
+  struct stats {
+    utils::stat_int* traces;
+    utils::stat_int* steps;
+  } d_stats;
+
+  /** Get a random value of the given type */
+  expr::value random_value(random& rng, expr::term_ref type) const;
+
+  /** Add random hints x = v for some of the variables, to vary the solver models */
+  void add_hints(random& rng, const std::vector<expr::term_ref>& vars, smt::solver& solver, smt::solver::formula_class c) const;
+
+  /** Get the value of var in the model, or a random value if undefined */
+  expr::value get_value(random& rng, expr::model::ref m, expr::term_ref var) const;
+
+  /** Get the initial state of the trace, returns false if no initial states */
+  bool initial_state(random& rng, const system::transition_system* ts, smt::solver& solver, sim_trace& trace);
+
+  /** Check the property in the last state of the trace */
+  bool check_property(const system::state_type* st, const sim_trace& trace) const;
+
+  /** Simulate the trace by evaluation, returns true if property is violated */
+  bool simulate_evaluation(random& rng, const system::state_type* st, size_t index, sim_trace& trace, size_t& steps);
+
+  /** Simulate the trace with the solver, returns true if property is violated */
+  bool simulate_solver(random& rng, const system::transition_system* ts, smt::solver& solver, sim_trace& trace, size_t& steps);
+
+  /** Simulate the traces index, index + n, ... (thread entry) */
+  void simulation_thread(const system::state_type* st, size_t index, size_t n, std::vector<random>* rngs, size_t* steps);
+
+  /** Set the model of the trace helper from the simulated trace */
+  void set_trace_model(const system::state_type* st, const sim_trace& trace);
+
+public:
+
+  sim_engine(const system::context& ctx);
+  ~sim_engine();
+
+  /** Query */
+  result query(const system::transition_system* ts, const system::state_formula* sf);
+
+  /** Trace */
+  const system::trace_helper* get_trace();
+
+  /** Invariant (not supported) */
+  invariant get_invariant();
+
+  /** Collect the terms */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+};
+
+}
+}
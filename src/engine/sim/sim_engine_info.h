@@ -0,0 +1,52 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "engine/sim/sim_engine.h"
+
+#include <boost/program_options/options_description.hpp>
+
+namespace sally {
+namespace sim {
+
+struct sim_engine_info {
+
+  static void setup_options(boost::program_options::options_description& options) {
+    using namespace boost::program_options;
+    options.add_options()
+        ("sim-traces", value<unsigned>()->default_value(64), "Number of traces to simulate.")
+        ("sim-steps", value<unsigned>()->default_value(100), "Number of steps in each trace.")
+        ("sim-threads", value<unsigned>()->default_value(4), "Number of simulation threads (when simulating by evaluation).")
+        ("sim-seed", value<unsigned>()->default_value(0), "Seed for the random generators.")
+        ("sim-range", value<unsigned>()->default_value(16), "Random integer and real values are taken from [-range, range].")
+        ;
+  }
+
+  static std::string get_id() {
+    return "sim";
+  }
+
+  static engine* new_instance(const system::context& ctx) {
+    return new sim_engine(ctx);
+  }
+
+};
+
+}
+}
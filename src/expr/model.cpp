@@ -31,6 +31,7 @@ namespace expr {
 model::model(expr::term_manager& tm, bool undef_to_default)
 : d_tm(tm)
 , d_undef_to_default(undef_to_default)
+, d_source_exact(false)
 , d_true(true)
 , d_false(false)
 {
@@ -41,6 +42,9 @@ model::model(const model& other)
 , d_undef_to_default(other.d_undef_to_default)
 , d_variables(other.d_variables)
 , d_variable_to_value_map(other.d_variable_to_value_map)
+, d_source(other.d_source)
+, d_pending(other.d_pending)
+, d_source_exact(other.d_source_exact)
 , d_true(true)
 , d_false(false)
 {
@@ -52,6 +56,9 @@ model& model::operator = (const model& other) {
     d_undef_to_default = other.d_undef_to_default;
     d_variables = other.d_variables;
     d_variable_to_value_map = other.d_variable_to_value_map;
+    d_source = other.d_source;
+    d_pending = other.d_pending;
+    d_source_exact = other.d_source_exact;
   }
   return *this;
 }
@@ -59,10 +66,19 @@ model& model::operator = (const model& other) {
 void model::clear() {
   d_variable_to_value_map.clear();
   d_variables.clear();
+  d_source = model_source::ref();
+  d_pending.clear();
+  d_source_exact = false;
 }
 
 void model::set_variable_value(expr::term_ref var, value v) {
   assert(d_tm.term_of(var).op() == expr::VARIABLE);
+  // The source doesn't know about this value
+  d_source_exact = false;
+  if (d_pending.erase(var) > 0) {
+    d_variable_to_value_map[var] = v;
+    return;
+  }
   iterator find = d_variable_to_value_map.find(var);
   if (find != d_variable_to_value_map.end()) {
     find->second = v;
@@ -72,6 +88,32 @@ void model::set_variable_value(expr::term_ref var, value v) {
   }
 }
 
+void model::set_source(model_source::ref source, const std::vector<term_ref>& variables) {
+  assert(!d_source);
+  d_source = source;
+  d_source_exact = d_variable_to_value_map.empty();
+  for (size_t i = 0; i < variables.size(); ++ i) {
+    term_ref var = variables[i];
+    assert(d_tm.term_of(var).op() == expr::VARIABLE);
+    if (d_variable_to_value_map.find(var) == d_variable_to_value_map.end() && d_pending.insert(var).second) {
+      d_variables.push_back(expr::term_ref_strong(d_tm, var));
+    }
+  }
+}
+
+value model::get_pending_value(term_ref var) const {
+  value v = d_source->get_value(var);
+  d_variable_to_value_map[var] = v;
+  d_pending.erase(var);
+  return v;
+}
+
+void model::get_pending_values() const {
+  while (!d_pending.empty()) {
+    get_pending_value(*d_pending.begin());
+  }
+}
+
 value model::get_variable_value(expr::term_ref var) const {
   expr::term_manager::substitution_map renaming;
   return get_variable_value(var, renaming);
@@ -92,7 +134,11 @@ value model::get_variable_value(expr::term_ref var, const expr::term_manager::su
 
   const_iterator find = d_variable_to_value_map.find(var_to_evaluate);
   if (find == d_variable_to_value_map.end()) {
-    if (d_undef_to_default) {
+    if (d_pending.count(var_to_evaluate) > 0) {
+      value v = get_pending_value(var_to_evaluate);
+      TRACE("expr::model") << "get_variable_value(" << var_to_evaluate << ") => [source] " << v << std::endl;
+      return v;
+    } else if (d_undef_to_default) {
       expr::term_ref type = d_tm.type_of(var_to_evaluate);
       value v;
       switch (d_tm.term_of(type).op()) {
@@ -546,6 +592,10 @@ value model::get_term_value_internal(expr::term_ref t, const expr::term_manager:
 }
 
 bool model::is_true(expr::term_ref f) const {
+  bool result;
+  if (d_source_exact && d_source->is_true(f, result)) {
+    return result;
+  }
   expr::term_manager::substitution_map renaming;
   return is_true(f, renaming);
 }
@@ -555,6 +605,10 @@ bool model::is_true(expr::term_ref f, const expr::term_manager::substitution_map
 }
 
 bool model::is_false(expr::term_ref f) const {
+  bool result;
+  if (d_source_exact && d_source->is_true(f, result)) {
+    return !result;
+  }
   expr::term_manager::substitution_map renaming;
   return is_false(f, renaming);
 }
@@ -565,14 +619,16 @@ bool model::is_false(expr::term_ref f, const expr::term_manager::substitution_ma
 
 bool model::has_value(expr::term_ref var) const {
   assert(d_tm.term_of(var).op() == expr::VARIABLE);
-  return d_variable_to_value_map.find(var) != d_variable_to_value_map.end();
+  return d_variable_to_value_map.find(var) != d_variable_to_value_map.end() || d_pending.count(var) > 0;
 }
 
 model::const_iterator model::values_begin() const {
+  get_pending_values();
   return d_variable_to_value_map.begin();
 }
 
 model::const_iterator model::values_end() const {
+  get_pending_values();
   return d_variable_to_value_map.end();
 }
 
@@ -591,6 +647,11 @@ void model::restrict_vars_to(const expr::term_manager::substitution_map& subst)
   }
   d_variable_to_value_map.swap(variable_to_value_map_new);
 
+  // Everything we need was obtained from the source
+  d_source = model_source::ref();
+  d_pending.clear();
+  d_source_exact = false;
+
   // Rename the variables in the model
   std::vector<term_ref_strong> variables_new;
   for (size_t i = 0; i < d_variables.size(); ++ i) {
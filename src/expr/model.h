@@ -24,12 +24,31 @@
 #include "utils/smart_ptr.h"
 
 #include <map>
+#include <set>
 #include <vector>
 #include <iosfwd>
 
 namespace sally {
 namespace expr {
 
+/**
+ * Source of the variable values of a model that is filled in on demand, e.g.
+ * from a model kept alive in the backend solver.
+ */
+class model_source {
+public:
+
+  typedef utils::smart_ptr<model_source> ref;
+
+  virtual ~model_source() {}
+
+  /** Get the value of a variable of the model */
+  virtual value get_value(term_ref var) = 0;
+
+  /** Evaluate the formula in the source, returns false if not possible */
+  virtual bool is_true(term_ref f, bool& result) = 0;
+};
+
 class model {
 
 public:
@@ -57,6 +76,13 @@ public:
   /** Set the value of a variable */
   void set_variable_value(term_ref var, value v);
 
+  /**
+   * Add the variables with values from the source. The values are obtained
+   * when first needed and then remembered. While no other values are set,
+   * formulas are evaluated by the source if it can.
+   */
+  void set_source(model_source::ref source, const std::vector<term_ref>& variables);
+
   /** Get the value of a term in the model (not just variables) */
   value get_variable_value(term_ref var) const;
 
@@ -107,8 +133,23 @@ private:
   /** All the variables */
   std::vector<term_ref_strong> d_variables;
 
-  /** The map from variables to their values */
-  term_to_value_map d_variable_to_value_map;
+  /** The map from variables to their values (filled in from the source) */
+  mutable term_to_value_map d_variable_to_value_map;
+
+  /** Source of the values not yet obtained */
+  mutable model_source::ref d_source;
+
+  /** Variables with values still in the source */
+  mutable std::set<term_ref> d_pending;
+
+  /** True if all the values come from the source */
+  bool d_source_exact;
+
+  /** Get the pending value of var from the source */
+  value get_pending_value(term_ref var) const;
+
+  /** Get all the pending values from the source */
+  void get_pending_values() const;
 
   /** True value */
   value d_true;
@@ -515,7 +515,7 @@ void term::to_stream_smt_without_let(std::ostream& out, term_manager& tm, const
       out << "(" << get_smt_keyword(d_op) << " ";
     }
     const term_ref* it = begin();
-    out << *it;
+    SMT_REF_OUT(*it);
     for (++ it; it != end(); ++ it) {
       out << " ";
       SMT_REF_OUT(*it);
@@ -0,0 +1,231 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "expr/term_serializer.h"
+#include "utils/exception.h"
+
+#include <sstream>
+#include <iostream>
+#include <cassert>
+
+namespace sally {
+namespace expr {
+
+term_writer::term_writer(const term_manager& tm, std::ostream& out)
+: d_tm(tm)
+, d_out(out)
+{}
+
+size_t term_writer::write(term_ref t) {
+
+  // Post-order traversal, writing the children first
+  std::vector<term_ref> stack;
+  stack.push_back(t);
+  while (!stack.empty()) {
+    term_ref current = stack.back();
+    if (d_ids.find(current) != d_ids.end()) {
+      stack.pop_back();
+      continue;
+    }
+    // Variables are written by name, the children are not needed
+    const term& current_term = d_tm.term_of(current);
+    bool children_done = true;
+    if (current_term.op() != VARIABLE) {
+      for (size_t i = 0; i < current_term.size(); ++ i) {
+        if (d_ids.find(current_term[i]) == d_ids.end()) {
+          stack.push_back(current_term[i]);
+          children_done = false;
+        }
+      }
+    }
+    if (children_done) {
+      stack.pop_back();
+      write_node(current);
+    }
+  }
+
+  return get_id(t);
+}
+
+size_t term_writer::get_id(term_ref t) const {
+  term_ref_hash_map<size_t>::const_iterator find = d_ids.find(t);
+  assert(find != d_ids.end());
+  return find->second;
+}
+
+void term_writer::write_node(term_ref t) {
+
+  const term& t_term = d_tm.term_of(t);
+  term_op op = t_term.op();
+
+  d_out << op;
+
+  // Payload
+  switch (op) {
+  case VARIABLE: {
+    std::string name = d_tm.get_variable_name(t);
+    d_out << " " << name.size() << " " << name;
+    break;
+  }
+  case CONST_BOOL:
+    d_out << " " << (d_tm.get_boolean_constant(t_term) ? 1 : 0);
+    break;
+  case CONST_RATIONAL:
+    d_out << " " << d_tm.get_rational_constant(t_term).mpq().get_str();
+    break;
+  case CONST_BITVECTOR: {
+    bitvector bv = d_tm.get_bitvector_constant(t_term);
+    d_out << " " << bv.size() << " " << bv.mpz().get_str();
+    break;
+  }
+  case TERM_BV_EXTRACT: {
+    bitvector_extract extract = d_tm.get_bitvector_extract(t_term);
+    d_out << " " << extract.high << " " << extract.low;
+    break;
+  }
+  case TERM_BV_SGN_EXTEND:
+    d_out << " " << d_tm.get_bitvector_sgn_extend(t_term).size;
+    break;
+  case TERM_TUPLE_READ:
+  case TERM_TUPLE_WRITE:
+  case CONST_ENUM:
+  case CONST_STRING:
+    throw exception("Can't serialize term with operator ") << op << ".";
+  default:
+    if (op < VARIABLE) {
+      throw exception("Can't serialize types.");
+    }
+  }
+
+  // Children (the variable child is its type, not written)
+  size_t n = op == VARIABLE ? 0 : t_term.size();
+  d_out << " " << n;
+  for (size_t i = 0; i < n; ++ i) {
+    d_out << " " << get_id(t_term[i]);
+  }
+  d_out << std::endl;
+
+  size_t id = d_ids.size();
+  d_ids[t] = id;
+}
+
+term_reader::term_reader(term_manager& tm, std::istream& in, const variable_map& variables)
+: d_tm(tm)
+, d_in(in)
+, d_variables(variables)
+{
+  for (int op = VARIABLE; op < OP_LAST; ++ op) {
+    std::stringstream ss;
+    ss << (term_op) op;
+    d_ops[ss.str()] = (term_op) op;
+  }
+}
+
+term_ref term_reader::get_term(size_t id) const {
+  if (id >= d_terms.size()) {
+    throw exception("Term with id ") << id << " not defined.";
+  }
+  return d_terms[id];
+}
+
+term_ref term_reader::read() {
+
+  std::string op_name;
+  d_in >> op_name;
+  std::map<std::string, term_op>::const_iterator op_find = d_ops.find(op_name);
+  if (!d_in || op_find == d_ops.end()) {
+    throw exception("Can't read term (operator '") << op_name << "').";
+  }
+  term_op op = op_find->second;
+
+  term_ref result;
+
+  // Read the payload
+  std::string name, value;
+  size_t size = 0, high = 0, low = 0;
+  switch (op) {
+  case VARIABLE: {
+    d_in >> size;
+    d_in.get(); // The separator
+    name.resize(size);
+    if (size > 0) { d_in.read(&name[0], size); }
+    variable_map::const_iterator find = d_variables.find(name);
+    if (!d_in || find == d_variables.end()) {
+      throw exception("Unknown variable '") << name << "'.";
+    }
+    result = find->second;
+    break;
+  }
+  case CONST_BOOL:
+    d_in >> size;
+    result = d_tm.mk_boolean_constant(size != 0);
+    break;
+  case CONST_RATIONAL:
+    d_in >> value;
+    result = d_tm.mk_rational_constant(rational(value));
+    break;
+  case CONST_BITVECTOR:
+    d_in >> size >> value;
+    result = d_tm.mk_bitvector_constant(bitvector(size, integer(value, 10)));
+    break;
+  case TERM_BV_EXTRACT:
+    d_in >> high >> low;
+    break;
+  case TERM_BV_SGN_EXTEND:
+    d_in >> size;
+    break;
+  default:
+    break;
+  }
+
+  // Read the children
+  size_t n = 0;
+  d_in >> n;
+  std::vector<term_ref> children;
+  for (size_t i = 0; i < n; ++ i) {
+    size_t id = 0;
+    d_in >> id;
+    children.push_back(get_term(id));
+  }
+
+  if (!d_in) {
+    throw exception("Can't read term (operator ") << op << ").";
+  }
+
+  // Construct the term
+  if (result.is_null()) {
+    switch (op) {
+    case TERM_BV_EXTRACT:
+      if (n != 1) { throw exception("Bit-vector extract takes one child."); }
+      result = d_tm.mk_bitvector_extract(children[0], bitvector_extract(high, low));
+      break;
+    case TERM_BV_SGN_EXTEND:
+      if (n != 1) { throw exception("Bit-vector sign extend takes one child."); }
+      result = d_tm.mk_bitvector_sgn_extend(children[0], bitvector_sgn_extend(size));
+      break;
+    default:
+      result = d_tm.mk_term(op, children);
+    }
+  }
+
+  d_terms.push_back(result);
+  return result;
+}
+
+}
+}
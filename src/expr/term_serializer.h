@@ -0,0 +1,119 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "expr/term.h"
+#include "expr/term_map.h"
+#include "expr/term_manager.h"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <iosfwd>
+
+namespace sally {
+namespace expr {
+
+/**
+ * Writes terms as a DAG, one node per line, each node getting the next
+ * integer id. A node is written as
+ *
+ *   <op> <payload> <number of children> <child ids>
+ *
+ * and children are always written before their parents, so each term is
+ * written only once, no matter how many times it's shared. Variables are
+ * written by name only, so that the reader can map them back to the
+ * variables it already has.
+ */
+class term_writer {
+
+  /** The term manager */
+  const term_manager& d_tm;
+
+  /** Where we write */
+  std::ostream& d_out;
+
+  /** Ids of the terms written so far */
+  term_ref_hash_map<size_t> d_ids;
+
+  /** Write the node of t, assuming all the children are written */
+  void write_node(term_ref t);
+
+public:
+
+  /** Construct the writer */
+  term_writer(const term_manager& tm, std::ostream& out);
+
+  /** Write t and any of its sub-terms that are not written yet, returns the id of t */
+  size_t write(term_ref t);
+
+  /** Get the id of an already written term */
+  size_t get_id(term_ref t) const;
+
+  /** Number of terms written */
+  size_t size() const { return d_ids.size(); }
+
+};
+
+/**
+ * Reads the terms written by the term_writer. Variables are looked up by
+ * name in the given map, and it's an error if the variable is not there.
+ */
+class term_reader {
+
+public:
+
+  /** Map from names to variables */
+  typedef std::map<std::string, term_ref> variable_map;
+
+private:
+
+  /** The term manager */
+  term_manager& d_tm;
+
+  /** Where we read from */
+  std::istream& d_in;
+
+  /** The variables */
+  const variable_map& d_variables;
+
+  /** Terms by their id */
+  std::vector<term_ref> d_terms;
+
+  /** Map from operator names to operators */
+  std::map<std::string, term_op> d_ops;
+
+public:
+
+  /** Construct the reader */
+  term_reader(term_manager& tm, std::istream& in, const variable_map& variables);
+
+  /** Read one term node from the input, returns the term */
+  term_ref read();
+
+  /** Get the term with the given id */
+  term_ref get_term(size_t id) const;
+
+  /** Number of terms read */
+  size_t size() const { return d_terms.size(); }
+
+};
+
+}
+}
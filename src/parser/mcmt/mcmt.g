@@ -26,11 +26,13 @@ options {
   #include <string>
   #include "command/command.h"
   #include "command/assume.h"
+  #include "command/invariant.h"
   #include "command/declare_state_type.h"
   #include "command/define_states.h"
   #include "command/define_transition.h"
   #include "command/define_transition_system.h"
   #include "command/query.h"
+  #include "command/liveness_query.h"
   #include "command/sequence.h"
   #include "parser/mcmt/mcmt_state.h"
   using namespace sally;
@@ -64,7 +66,9 @@ system_command returns [cmd::command* cmd = 0]
   | c = define_transition        { $cmd = c; }
   | c = define_transition_system { $cmd = c; }
   | c = assume                   { $cmd = c; }
+  | c = invariant                { $cmd = c; }
   | c = query                    { $cmd = c; }
+  | c = liveness_query           { $cmd = c; }
   | EOF { $cmd = 0; }
   ;
 
@@ -163,6 +167,22 @@ assume returns [cmd::command* cmd = 0]
     ')'
   ;
 
+/** Invariants (trusted, used to strengthen the engines) */
+invariant returns [cmd::command* cmd = 0]
+@declarations {
+  std::string id;
+  const system::state_type* state_type;
+}
+  : '(' 'invariant'
+    symbol[id, parser::MCMT_TRANSITION_SYSTEM, true] {
+        state_type = STATE->ctx().get_transition_system(id)->get_state_type();
+    }
+    f = state_formula[state_type] {
+    	$cmd = new cmd::invariant(STATE->ctx(), id, f);
+    }
+    ')'
+  ;
+
 /** Query  */
 query returns [cmd::command* cmd = 0]
 @declarations {
@@ -181,6 +201,25 @@ query returns [cmd::command* cmd = 0]
     ')'
   ;
 
+/** Liveness query, the goal and optionally the fair states */
+liveness_query returns [cmd::command* cmd = 0]
+@declarations {
+  std::string id;
+  system::state_formula* fairness = 0;
+  const system::state_type* state_type;
+}
+  : '(' 'query-liveness'
+    symbol[id, parser::MCMT_TRANSITION_SYSTEM, true] {
+        state_type = STATE->ctx().get_transition_system(id)->get_state_type();
+    }
+    goal = state_formula[state_type]
+    ( f = state_formula[state_type] { fairness = f; } )?
+    {
+      	$cmd = new cmd::liveness_query(STATE->ctx(), id, goal, fairness);
+    }
+    ')'
+  ;
+
 /** Parse a constant definition */
 define_constant
 @declarations {
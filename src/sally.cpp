@@ -18,6 +18,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <set>
 #include <boost/program_options.hpp>
 #include <boost/thread.hpp>
 
@@ -26,7 +27,11 @@
 #include "system/context.h"
 #include "parser/parser.h"
 #include "engine/factory.h"
+#include "engine/cache/cache_engine.h"
 #include "ai/factory.h"
+#include "command/sequence.h"
+#include "command/query.h"
+#include "command/liveness_query.h"
 #include "smt/factory.h"
 #include "utils/trace.h"
 #include "utils/statistics.h"
@@ -42,6 +47,9 @@ void parse_options(int argc, char* argv[], variables_map& variables);
 /** Prints statistics to the given output and given time slice */
 void live_stats(const utils::statistics* stats, std::string file, unsigned time);
 
+/** Runs the command, running the interpreter on each queried system first */
+void run_command(cmd::command* cmd, system::context& ctx, engine* e, ai::abstract_interpreter* ai, std::set<std::string>& analyzed);
+
 int main(int argc, char* argv[]) {
 
   try {
@@ -96,12 +104,34 @@ int main(int argc, char* argv[]) {
       smt::factory::enable_smt2_output(opts.get_string("smt2-output"));
     }
 
+    // Enable the solver query cache if enabled
+    if (opts.has_option("solver-cache")) {
+      smt::factory::enable_query_cache(opts.has_option("solver-cache-models"));
+    }
+
+    // Enable the solver pool if enabled
+    if (opts.has_option("solver-pool")) {
+      smt::factory::enable_solver_pool();
+    }
+
     // Create the engine
     engine* engine_to_use = 0;
     if (opts.has_option("engine")) {
       engine_to_use = engine_factory::mk_engine(boost_opts.at("engine").as<string>(), ctx);
     }
 
+    // Keep the results in the cache if asked
+    if (engine_to_use != 0 && opts.has_option("result-cache")) {
+      engine_to_use = new cache::cache_engine(ctx, engine_to_use, opts.get_string("result-cache"));
+    }
+
+    // Create the abstract interpreter
+    ai::abstract_interpreter* ai_to_use = 0;
+    if (opts.has_option("ai")) {
+      ai_to_use = ai::factory::mk_interpreter(opts.get_string("ai"), ctx);
+    }
+    std::set<std::string> analyzed;
+
     // Setup live stats if asked
     boost::thread *stats_worker = 0;
     if (opts.has_option("live-stats")) {
@@ -124,15 +154,23 @@ int main(int argc, char* argv[]) {
 
         MSG(2) << "Got command " << *cmd << endl;
         // Run the command
-        cmd->run(&ctx, engine_to_use);
+        run_command(cmd, ctx, engine_to_use, ai_to_use, analyzed);
       }
     }
 
+    // Delete the interpreter
+    if (ai_to_use != 0) {
+      delete ai_to_use;
+    }
+
     // Delete the engine
     if (engine_to_use != 0) {
       delete engine_to_use;
     }
 
+    // Delete the pooled solvers
+    smt::factory::clear_solver_pool(tm);
+
     // Stop the live stats thread
     if (stats_worker) {
       stats_worker->interrupt();
@@ -150,6 +188,39 @@ int main(int argc, char* argv[]) {
   }
 }
 
+void run_command(cmd::command* cmd, system::context& ctx, engine* e, ai::abstract_interpreter* ai, std::set<std::string>& analyzed) {
+
+  // Run the sequences one by one, systems might be defined in them
+  if (cmd->get_type() == cmd::SEQUENCE) {
+    cmd::sequence* seq = static_cast<cmd::sequence*>(cmd);
+    for (size_t i = 0; i < seq->size(); ++ i) {
+      run_command((*seq)[i], ctx, e, ai, analyzed);
+    }
+    return;
+  }
+
+  // Get the invariants of the system before the first query
+  if (ai != 0) {
+    std::string id;
+    if (cmd->get_type() == cmd::QUERY) {
+      id = static_cast<cmd::query*>(cmd)->get_system_id();
+    } else if (cmd->get_type() == cmd::LIVENESS_QUERY) {
+      id = static_cast<cmd::liveness_query*>(cmd)->get_system_id();
+    }
+    if (!id.empty() && analyzed.count(id) == 0) {
+      analyzed.insert(id);
+      std::vector<system::state_formula*> invariants;
+      ai->run(ctx.get_transition_system(id), invariants);
+      for (size_t i = 0; i < invariants.size(); ++ i) {
+        MSG(1) << "Invariant from " << ctx.get_options().get_string("ai") << ": " << *invariants[i] << endl;
+        ctx.add_invariant_to(id, invariants[i]);
+      }
+    }
+  }
+
+  cmd->run(&ctx, e);
+}
+
 std::string get_engines_list() {
   std::vector<string> engines;
   engine_factory::get_engines(engines);
@@ -209,6 +280,7 @@ void parse_options(int argc, char* argv[], variables_map& variables)
 #endif
       ("show-trace", "Show the counterexample trace if found.")
       ("show-invariant", "Show the invariant if property is proved.")
+      ("show-stats", "Show the statistics after each query.")
       ("parse-only", "Just parse, don't solve.")
       ("engine", value<string>(), get_engines_list().c_str())
       ("ai", value<string>(), get_ai_list().c_str())
@@ -217,9 +289,17 @@ void parse_options(int argc, char* argv[], variables_map& variables)
       ("output-language", value<string>()->default_value("mcmt"), get_output_languages_list().c_str())
       ("lsal-extensions", "Use lsal extensions to the MCMT language")
       ("no-input-namespace", "Don't use input namespace in the the MCMT language")
+      ("result-cache", value<string>(), "Directory to keep the query results in, unchanged problems are not solved again.")
+      ("query-time-limit", value<double>(), "Wall-clock time limit for each query (in seconds).")
+      ("query-memory-limit", value<unsigned>(), "Memory limit for each query (in MB).")
       ("live-stats", value<string>(), "Output live statistic to the given file (- for stdout).")
       ("live-stats-time", value<unsigned>()->default_value(100), "Time period for statistics output (in miliseconds)")
       ("smt2-output", value<string>(), "Generate smt2 logs of solver queries with given prefix.")
+      ("smt2-output-compact", "Define each subterm once in the smt2 logs, instead of printing the assertions in full.")
+      ("smt2-output-compression", value<string>(), "Compression of the smt2 logs (none, gzip, zstd).")
+      ("solver-cache", "Cache the results of solver queries, identical queries are answered without checking.")
+      ("solver-cache-models", "Also cache the models of satisfiable queries (with --solver-cache).")
+      ("solver-pool", "Keep solvers with their base context (e.g. the transition relation) for reuse across queries and restarts.")
       ("no-lets", "Don't use let expressions in printouts.");
       ;
 
@@ -0,0 +1,269 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <boost/program_options.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "expr/term_manager.h"
+#include "utils/output.h"
+#include "smt/factory.h"
+#include "smt/smt2_log.h"
+#include "smt/smt2_replay.h"
+#include "utils/trace.h"
+#include "utils/statistics.h"
+
+using namespace std;
+using namespace boost::program_options;
+
+using namespace sally;
+
+/** Parses the program arguments. */
+void parse_options(int argc, char* argv[], variables_map& variables);
+
+/** The replayed queries of a solver on a log */
+typedef vector<smt::smt2_replay::query> query_vector;
+
+/** Prints the summary of the queries of a solver */
+void print_summary(ostream& out, string solver, const vector<query_vector>& queries, double total_time);
+
+int main(int argc, char* argv[]) {
+
+  try {
+
+    // Get the options from command line
+    variables_map boost_opts;
+    parse_options(argc, argv, boost_opts);
+    options opts(boost_opts);
+
+    // Get the logs to replay
+    vector<string>& files = boost_opts.at("input").as<vector<string> >();
+
+    // Get the solvers to replay on
+    vector<string> solvers;
+    if (boost_opts.count("solver") > 0) {
+      solvers = boost_opts.at("solver").as<vector<string> >();
+    } else {
+      solvers.push_back(smt::factory::get_default_solver_id());
+    }
+
+    // Set the verbosity
+    output::set_verbosity(cout, opts.get_unsigned("verbosity"));
+    output::set_verbosity(cerr, opts.get_unsigned("verbosity"));
+    output::set_output_language(cout, output::MCMT);
+    output::set_output_language(cerr, output::MCMT);
+
+    // Set any trace tags if passed in
+    if (boost_opts.count("debug") > 0) {
+      vector<string>& tags = boost_opts.at("debug").as<vector<string> >();
+      for (size_t i = 0; i < tags.size(); ++i) {
+        output::trace_tag_enable(tags[i]);
+      }
+    }
+
+    // Create the statistics and the term manager
+    utils::statistics stats;
+    expr::term_manager tm(stats);
+    cout << expr::set_tm(tm);
+    cerr << expr::set_tm(tm);
+
+    // Read all the logs
+    vector<smt::smt2_replay*> logs;
+    size_t total_checks = 0;
+    for (size_t i = 0; i < files.size(); ++ i) {
+      MSG(1) << "Reading " << files[i] << endl;
+      boost::iostreams::filtering_istream in;
+      smt::smt2_log::open_input(in, files[i]);
+      logs.push_back(new smt::smt2_replay(tm, in));
+      total_checks += logs.back()->get_checks();
+    }
+    cout << "Replaying " << logs.size() << " logs with " << total_checks << " queries" << endl;
+
+    // Per-query output
+    ofstream* csv = 0;
+    if (opts.has_option("csv")) {
+      csv = new ofstream(opts.get_string("csv").c_str());
+      if (!*csv) {
+        throw sally::exception("could not open " + opts.get_string("csv"));
+      }
+      *csv << "log,query,solver,result,time" << endl;
+    }
+
+    // Replay on all the solvers, queries[solver][log]
+    bool models = opts.has_option("models");
+    vector< vector<query_vector> > queries(solvers.size(), vector<query_vector>(logs.size()));
+    for (size_t s = 0; s < solvers.size(); ++ s) {
+      double total_time = 0;
+      for (size_t i = 0; i < logs.size(); ++ i) {
+        MSG(1) << "Replaying " << files[i] << " on " << solvers[s] << endl;
+        smt::solver* solver = smt::factory::mk_solver(solvers[s], tm, opts, stats);
+        boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+        logs[i]->run(*solver, models, queries[s][i]);
+        boost::posix_time::ptime end = boost::posix_time::microsec_clock::universal_time();
+        delete solver;
+        total_time += (end - start).total_microseconds() / 1000000.0;
+        if (csv) {
+          for (size_t q = 0; q < queries[s][i].size(); ++ q) {
+            const smt::smt2_replay::query& query = queries[s][i][q];
+            *csv << files[i] << "," << query.index << "," << solvers[s] << "," << query.result << "," << query.time << endl;
+          }
+        }
+      }
+      print_summary(cout, solvers[s], queries[s], total_time);
+    }
+    delete csv;
+
+    // Compare the definitive results to the ones of the first solver
+    size_t mismatches = 0;
+    for (size_t s = 1; s < solvers.size(); ++ s) {
+      for (size_t i = 0; i < logs.size(); ++ i) {
+        for (size_t q = 0; q < queries[s][i].size() && q < queries[0][i].size(); ++ q) {
+          smt::solver::result expected = queries[0][i][q].result;
+          smt::solver::result result = queries[s][i][q].result;
+          if (expected != smt::solver::UNKNOWN && result != smt::solver::UNKNOWN && expected != result) {
+            cout << "mismatch in " << files[i] << ", query " << q << ": "
+                 << solvers[0] << " " << expected << ", " << solvers[s] << " " << result << endl;
+            mismatches ++;
+          }
+        }
+      }
+    }
+    if (solvers.size() > 1) {
+      cout << "mismatches: " << mismatches << endl;
+    }
+
+    for (size_t i = 0; i < logs.size(); ++ i) {
+      delete logs[i];
+    }
+
+    if (mismatches > 0) {
+      exit(2);
+    }
+
+  } catch (sally::exception& e) {
+    cerr << e << endl;
+    exit(1);
+  } catch (const char* s) {
+    cerr << s << endl;
+    exit(1);
+  } catch (...) {
+    cerr << "Unexpected error!" << endl;
+    exit(1);
+  }
+}
+
+void print_summary(ostream& out, string solver, const vector<query_vector>& queries, double total_time) {
+
+  // All the check times, and the results
+  vector<double> times;
+  size_t results[3] = { 0, 0, 0 };
+  double check_time = 0;
+  for (size_t i = 0; i < queries.size(); ++ i) {
+    for (size_t q = 0; q < queries[i].size(); ++ q) {
+      times.push_back(queries[i][q].time);
+      check_time += queries[i][q].time;
+      results[queries[i][q].result] ++;
+    }
+  }
+  sort(times.begin(), times.end());
+
+  out << fixed << setprecision(3);
+  out << solver << ": " << times.size() << " queries in " << total_time << " s (checks " << check_time << " s)" << endl;
+  out << "  sat " << results[smt::solver::SAT] << ", unsat " << results[smt::solver::UNSAT] << ", unknown " << results[smt::solver::UNKNOWN] << endl;
+  if (times.empty()) {
+    return;
+  }
+
+  // Nearest rank percentiles (in miliseconds)
+  const double percentiles[] = { 0.5, 0.9, 0.99 };
+  const char* percentile_names[] = { "median", "p90", "p99" };
+  out << "  latency (ms): min " << times.front() * 1000;
+  for (size_t i = 0; i < 3; ++ i) {
+    size_t rank = (size_t) ceil(percentiles[i] * times.size());
+    out << ", " << percentile_names[i] << " " << times[rank > 0 ? rank - 1 : 0] * 1000;
+  }
+  out << ", max " << times.back() * 1000 << ", mean " << check_time / times.size() * 1000 << endl;
+}
+
+std::string get_solver_list() {
+  std::vector<string> solvers;
+  smt::factory::get_solvers(solvers);
+  std::stringstream out;
+  out << "The SMT solver to replay on, can be given more than once to compare: ";
+  for (size_t i = 0; i < solvers.size(); ++ i) {
+    if (i) { out << ", "; }
+    out << solvers[i];
+  }
+  return out.str();
+}
+
+void parse_options(int argc, char* argv[], variables_map& variables)
+{
+  // Define the main options
+  options_description description("General options");
+  description.add_options()
+      ("help,h", "Prints this help message.")
+      ("verbosity,v", value<unsigned>()->default_value(0), "Set the verbosity of the output.")
+      ("input,i", value<vector<string> >()->required(), "An smt2 query log to replay (as generated with --smt2-output, possibly compressed).")
+#ifndef NDEBUG
+      ("debug,d", value<vector<string> >(), "Any tags to trace (only for debug builds).")
+#endif
+      ("solver", value<vector<string> >(), get_solver_list().c_str())
+      ("solver-logic", value<string>(), "Optional smt2 logic to set to the solver (e.g. QF_LRA, QF_LIA, ...).")
+      ("models", "Also get the models when the log asks for them (not all solvers have models).")
+      ("csv", value<string>(), "Output the time of each query to the given file, as comma separated values.")
+      ;
+
+  // Get the individual solver options
+  smt::factory::setup_options(description);
+
+  // The input files can be positional
+  positional_options_description positional;
+  positional.add("input", -1);
+
+  // Parse the options
+  bool parseError = false;
+  try {
+    store(command_line_parser(argc, argv).options(description).positional(positional).run(), variables);
+  } catch (...) {
+    parseError = true;
+  }
+
+  // If help needed, print it out
+  if (parseError || variables.count("help") > 0 || variables.count("input") == 0) {
+    if (parseError) {
+      cout << "Error parsing command line!" << endl;
+    }
+    cout << "Usage: " << argv[0] << " [options] log ..." << endl;
+    cout << "Replays smt2 query logs on the solvers and compares their time and results." << endl;
+    cout << "Exits with 2 if the solvers disagree on a query." << endl;
+    cout << description << endl;
+    if (parseError) {
+      exit(1);
+    } else {
+      exit(0);
+    }
+  }
+}
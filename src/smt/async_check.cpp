@@ -0,0 +1,269 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "smt/async_check.h"
+#include "utils/budget.h"
+#include "utils/trace.h"
+
+#include <boost/bind/bind.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <cassert>
+
+namespace sally {
+namespace smt {
+
+/** How often to repeat the interrupt of a cancelled check (in milliseconds) */
+static const long interrupt_period = 10;
+
+void check_completion::notify() {
+  boost::mutex::scoped_lock lock(d_mutex);
+  d_finished ++;
+  d_cond.notify_all();
+}
+
+void check_completion::wait(size_t n) {
+  boost::mutex::scoped_lock lock(d_mutex);
+  while (d_finished < n) {
+    d_cond.wait(lock);
+  }
+}
+
+check_future::check_future(solver* s, check_completion* completion)
+: d_solver(s)
+, d_with_assumptions(false)
+, d_completion(completion)
+, d_finished(false)
+, d_cancelled(false)
+, d_result(solver::UNKNOWN)
+, d_failed(false)
+, d_failed_budget(false)
+, d_thread(0)
+{
+  d_thread = new boost::thread(boost::bind(&check_future::run, this));
+}
+
+check_future::check_future(solver* s, const std::vector<expr::term_ref>& assumptions, check_completion* completion)
+: d_solver(s)
+, d_with_assumptions(true)
+, d_assumptions(assumptions)
+, d_completion(completion)
+, d_finished(false)
+, d_cancelled(false)
+, d_result(solver::UNKNOWN)
+, d_failed(false)
+, d_failed_budget(false)
+, d_thread(0)
+{
+  d_thread = new boost::thread(boost::bind(&check_future::run, this));
+}
+
+check_future::~check_future() {
+  cancel();
+  wait();
+  delete d_thread;
+}
+
+void check_future::run() {
+  TRACE("smt::async") << "check_future: starting check in " << d_solver->get_name() << std::endl;
+
+  solver::result result = solver::UNKNOWN;
+  bool failed = false, failed_budget = false;
+  std::string error;
+  try {
+    if (d_with_assumptions) {
+      result = d_solver->check(d_assumptions);
+    } else {
+      result = d_solver->check();
+    }
+  } catch (const utils::budget_exhausted& e) {
+    failed = failed_budget = true;
+    error = e.get_message();
+  } catch (const exception& e) {
+    failed = true;
+    error = e.get_message();
+  }
+
+  {
+    boost::mutex::scoped_lock lock(d_mutex);
+    d_result = result;
+    d_failed = failed;
+    d_failed_budget = failed_budget;
+    d_error = error;
+    d_finished = true;
+    d_finished_cond.notify_all();
+  }
+
+  if (d_completion) {
+    d_completion->notify();
+  }
+}
+
+void check_future::wait() {
+  {
+    boost::mutex::scoped_lock lock(d_mutex);
+    while (!d_finished) {
+      if (d_cancelled) {
+        // The interrupt is lost if it comes before the backend starts the
+        // search, so we keep repeating it until the check is done
+        lock.unlock();
+        d_solver->interrupt();
+        lock.lock();
+        d_finished_cond.timed_wait(lock, boost::posix_time::milliseconds(interrupt_period));
+      } else {
+        d_finished_cond.wait(lock);
+      }
+    }
+  }
+  if (d_thread->joinable()) {
+    d_thread->join();
+  }
+}
+
+bool check_future::is_ready() const {
+  boost::mutex::scoped_lock lock(d_mutex);
+  return d_finished;
+}
+
+bool check_future::is_definitive() const {
+  boost::mutex::scoped_lock lock(d_mutex);
+  return d_finished && !d_failed && d_result != solver::UNKNOWN;
+}
+
+solver::result check_future::get() {
+  wait();
+  if (d_failed) {
+    if (d_failed_budget) {
+      throw utils::budget_exhausted(d_error);
+    } else {
+      throw exception(d_error);
+    }
+  }
+  return d_result;
+}
+
+void check_future::cancel() {
+  {
+    boost::mutex::scoped_lock lock(d_mutex);
+    if (d_finished || d_cancelled) {
+      return;
+    }
+    d_cancelled = true;
+  }
+  TRACE("smt::async") << "check_future: cancelling check in " << d_solver->get_name() << std::endl;
+  d_solver->interrupt();
+}
+
+bool check_future::is_cancelled() const {
+  boost::mutex::scoped_lock lock(d_mutex);
+  return d_cancelled;
+}
+
+solver::result check_future::get_relaxed() {
+  try {
+    return get();
+  } catch (const exception&) {
+    return solver::UNKNOWN;
+  }
+}
+
+const size_t check_race::none = 2;
+
+check_race::check_race(solver* s1, solver* s2)
+: d_first(s1, &d_completion)
+, d_second(s2, &d_completion)
+{}
+
+size_t check_race::wait() {
+  // Wait for the first one, and if it's not definitive, for the other one
+  d_completion.wait(1);
+  if (!d_first.is_definitive() && !d_second.is_definitive()) {
+    d_completion.wait(2);
+  }
+  if (d_first.is_definitive()) {
+    return 0;
+  }
+  if (d_second.is_definitive()) {
+    return 1;
+  }
+  return none;
+}
+
+solver::result race(solver* s1, solver* s2, solver::result& r1, solver::result& r2) {
+
+  check_race checks(s1, s2);
+  size_t winner = checks.wait();
+
+  // Cancel the loser (does nothing if it's done)
+  if (winner == 0) {
+    checks.get(1).cancel();
+  } else {
+    checks.get(0).cancel();
+  }
+
+  // Collect the results, keeping the first exception in case nobody knows
+  bool failed = false;
+  std::string error;
+  bool failed_budget = false;
+  try {
+    r1 = checks.get(0).get();
+  } catch (const utils::budget_exhausted& e) {
+    r1 = solver::UNKNOWN;
+    failed = failed_budget = true;
+    error = e.get_message();
+  } catch (const exception& e) {
+    r1 = solver::UNKNOWN;
+    failed = true;
+    error = e.get_message();
+  }
+  try {
+    r2 = checks.get(1).get();
+  } catch (const utils::budget_exhausted& e) {
+    r2 = solver::UNKNOWN;
+    if (!failed) {
+      failed = failed_budget = true;
+      error = e.get_message();
+    }
+  } catch (const exception& e) {
+    r2 = solver::UNKNOWN;
+    if (!failed) {
+      failed = true;
+      error = e.get_message();
+    }
+  }
+
+  // A cancelled check can still finish with a result, but the winner is the
+  // one we picked above
+  if (winner != check_race::none) {
+    TRACE("smt::async") << "race: " << (winner == 0 ? s1 : s2)->get_name() << " won with " << (winner == 0 ? r1 : r2) << std::endl;
+    return winner == 0 ? r1 : r2;
+  }
+
+  if (failed) {
+    if (failed_budget) {
+      throw utils::budget_exhausted(error);
+    } else {
+      throw exception(error);
+    }
+  }
+
+  return solver::UNKNOWN;
+}
+
+}
+}
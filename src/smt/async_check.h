@@ -0,0 +1,205 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "smt/solver.h"
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include <cassert>
+
+namespace sally {
+namespace smt {
+
+/**
+ * Signal shared by several asynchronous checks, to wait for the first one
+ * (or the first few) to finish.
+ */
+class check_completion {
+
+  boost::mutex d_mutex;
+  boost::condition_variable d_cond;
+
+  /** Number of checks finished so far */
+  size_t d_finished;
+
+public:
+
+  check_completion(): d_finished(0) {}
+
+  /** Notify that a check has finished */
+  void notify();
+
+  /** Wait until at least n checks have finished */
+  void wait(size_t n);
+};
+
+/**
+ * A check() running in a separate thread, obtained with solver::check_async().
+ * While the check is running, the solver must not be used, except for
+ * interrupt(). The result is obtained with get(), and exceptions thrown by
+ * the check are re-thrown there.
+ *
+ * Cancellation is cooperative: cancel() asks the solver to stop with
+ * interrupt(), and a cancelled check returns UNKNOWN as soon as the backend
+ * notices (or the real result if the backend can't be interrupted, or was
+ * done already). Destroying the future cancels the check and waits for it.
+ */
+class check_future {
+
+  /** The solver running the check */
+  solver* d_solver;
+
+  /** Check with assumptions */
+  bool d_with_assumptions;
+
+  /** The assumptions (if any) */
+  std::vector<expr::term_ref> d_assumptions;
+
+  /** Who to notify when done (if anyone) */
+  check_completion* d_completion;
+
+  /** Mutex for the state below */
+  mutable boost::mutex d_mutex;
+
+  /** Signaled when the check is done */
+  boost::condition_variable d_finished_cond;
+
+  /** Is the check done */
+  bool d_finished;
+
+  /** Has the check been cancelled */
+  bool d_cancelled;
+
+  /** The result of the check */
+  solver::result d_result;
+
+  /** Did the check throw */
+  bool d_failed;
+
+  /** Was the exception due to the budget */
+  bool d_failed_budget;
+
+  /** The message of the exception */
+  std::string d_error;
+
+  /** The thread running the check */
+  boost::thread* d_thread;
+
+  /** Body of the thread */
+  void run();
+
+  /** Wait for the thread to finish (no exceptions) */
+  void wait();
+
+  check_future(const check_future&);
+  check_future& operator = (const check_future&);
+
+public:
+
+  /** Smart pointer reference */
+  typedef utils::smart_ptr<check_future> ref;
+
+  /** Start check() on the solver */
+  check_future(solver* s, check_completion* completion = 0);
+
+  /** Start check() with assumptions on the solver */
+  check_future(solver* s, const std::vector<expr::term_ref>& assumptions, check_completion* completion = 0);
+
+  /** Cancels and waits for the check */
+  ~check_future();
+
+  /** The solver running the check */
+  solver* get_solver() const { return d_solver; }
+
+  /** Is the result available (get() won't block) */
+  bool is_ready() const;
+
+  /** Is the check finished with SAT or UNSAT */
+  bool is_definitive() const;
+
+  /** Wait for the check to finish and return the result */
+  solver::result get();
+
+  /** As get(), but UNKNOWN if the check threw */
+  solver::result get_relaxed();
+
+  /** Ask the check to stop, get() will return UNKNOWN if it does */
+  void cancel();
+
+  /** Has the check been cancelled */
+  bool is_cancelled() const;
+};
+
+/**
+ * The checks of two solvers racing in parallel. Once wait() says who gave
+ * the first definitive answer, the other check can be cancelled, or left
+ * running to get its answer later. Destroying the race cancels the checks
+ * that are still running and waits for them.
+ */
+class check_race {
+
+  /** Notified by both checks */
+  check_completion d_completion;
+
+  /** Check of the first solver */
+  check_future d_first;
+
+  /** Check of the second solver */
+  check_future d_second;
+
+  check_race(const check_race&);
+  check_race& operator = (const check_race&);
+
+public:
+
+  /** Returned by wait() when neither check gives a definitive answer */
+  static const size_t none;
+
+  /** Start check() on both solvers */
+  check_race(solver* s1, solver* s2);
+
+  /**
+   * Wait for the first definitive answer, and return the index of the check
+   * that gave it (0 or 1). If neither does, wait for both and return none.
+   */
+  size_t wait();
+
+  /** Get the check of the i-th solver (0 or 1) */
+  check_future& get(size_t i) {
+    assert(i < 2);
+    return i == 0 ? d_first : d_second;
+  }
+};
+
+/**
+ * Race the checks of two solvers: both check() in parallel, the first
+ * definitive answer (SAT or UNSAT) is returned, and the other check is
+ * cancelled. The individual results are returned in r1 and r2, with UNKNOWN
+ * for a check that was cancelled before it finished. The solvers must be
+ * independent of each other (different backends), and their check() must
+ * not construct terms, as the term manager is not thread-safe. An exception
+ * is only re-thrown if neither solver gives a definitive answer.
+ */
+solver::result race(solver* s1, solver* s2, solver::result& r1, solver::result& r2);
+
+}
+}
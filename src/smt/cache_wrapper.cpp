@@ -0,0 +1,342 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "smt/cache_wrapper.h"
+#include "expr/gc_relocator.h"
+#include "utils/trace.h"
+
+#include <algorithm>
+
+namespace sally {
+namespace smt {
+
+/** Caches per term manager id */
+static std::map<size_t, query_cache*> s_caches;
+
+/** Statistics per term manager id, so that they are added only once */
+static std::map<size_t, std::vector<utils::stat_int*> > s_cache_stats;
+
+static
+void normalize(std::vector<expr::term_ref>& terms) {
+  std::sort(terms.begin(), terms.end());
+  terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+}
+
+void query_cache::query::normalize() {
+  for (size_t i = 0; i < 3; ++ i) {
+    smt::normalize(assertions[i]);
+  }
+  smt::normalize(assumptions);
+}
+
+static
+bool reloc_all(const expr::gc_relocator& gc_reloc, std::vector<expr::term_ref>& terms) {
+  for (size_t i = 0; i < terms.size(); ++ i) {
+    if (!gc_reloc.reloc(terms[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool query_cache::query::reloc(const expr::gc_relocator& gc_reloc) {
+  for (size_t i = 0; i < 3; ++ i) {
+    if (!reloc_all(gc_reloc, assertions[i])) {
+      return false;
+    }
+  }
+  return reloc_all(gc_reloc, assumptions);
+}
+
+bool query_cache::query::operator < (const query& other) const {
+  for (size_t i = 0; i < 3; ++ i) {
+    if (assertions[i] != other.assertions[i]) {
+      return assertions[i] < other.assertions[i];
+    }
+  }
+  return assumptions < other.assumptions;
+}
+
+query_cache::query_cache(expr::term_manager& tm, utils::statistics& stats, bool models)
+: gc_participant(tm)
+, d_models(models)
+, d_tm_id(tm.id())
+, d_users(0)
+{
+  std::vector<utils::stat_int*>& tm_stats = s_cache_stats[d_tm_id];
+  if (tm_stats.empty()) {
+    tm_stats.push_back(new utils::stat_int("smt::cache::hits", 0));
+    tm_stats.push_back(new utils::stat_int("smt::cache::misses", 0));
+    tm_stats.push_back(new utils::stat_int("smt::cache::evicted", 0));
+    stats.add(new utils::stat_delimiter());
+    for (size_t i = 0; i < tm_stats.size(); ++ i) {
+      stats.add(tm_stats[i]);
+    }
+  }
+  d_stats.hits = tm_stats[0];
+  d_stats.misses = tm_stats[1];
+  d_stats.evicted = tm_stats[2];
+}
+
+query_cache::~query_cache() {
+  s_caches.erase(d_tm_id);
+}
+
+query_cache* query_cache::attach(expr::term_manager& tm, utils::statistics& stats, bool models) {
+  query_cache*& cache = s_caches[tm.id()];
+  if (cache == 0) {
+    cache = new query_cache(tm, stats, models);
+  }
+  cache->d_users ++;
+  return cache;
+}
+
+void query_cache::detach() {
+  assert(d_users > 0);
+  if (-- d_users == 0) {
+    delete this;
+  }
+}
+
+bool query_cache::lookup(const query& q, entry& e) {
+  boost::mutex::scoped_lock lock(d_mutex);
+  query_map::const_iterator find = d_cache.find(q);
+  if (find == d_cache.end()) {
+    d_stats.misses->get_value() ++;
+    return false;
+  }
+  d_stats.hits->get_value() ++;
+  e = find->second;
+  return true;
+}
+
+void query_cache::insert(const query& q, const entry& e) {
+  assert(e.result != solver::UNKNOWN);
+  boost::mutex::scoped_lock lock(d_mutex);
+  d_cache[q] = e;
+}
+
+void query_cache::gc_collect(const expr::gc_relocator& gc_reloc) {
+  boost::mutex::scoped_lock lock(d_mutex);
+  // Relocation changes the order, so we rebuild the map. Models are not
+  // relocated, they are dropped and recomputed on demand.
+  query_map relocated;
+  query_map::const_iterator it = d_cache.begin();
+  for (; it != d_cache.end(); ++ it) {
+    query q = it->first;
+    if (q.reloc(gc_reloc)) {
+      q.normalize();
+      relocated[q].result = it->second.result;
+    } else {
+      d_stats.evicted->get_value() ++;
+    }
+  }
+  d_cache.swap(relocated);
+  TRACE("smt::cache") << "query_cache::gc_collect(): " << d_cache.size() << " entries" << std::endl;
+}
+
+cache_wrapper::cache_wrapper(expr::term_manager& tm, const options& opts, utils::statistics& stats, solver* s, query_cache* cache)
+: solver(s->get_name(), tm, opts, stats)
+, d_solver(s)
+, d_cache(cache)
+, d_last_result(UNKNOWN)
+, d_last_with_assumptions(false)
+, d_checked(true)
+{
+}
+
+cache_wrapper::~cache_wrapper() {
+  delete d_solver;
+  d_cache->detach();
+}
+
+bool cache_wrapper::supports(feature f) const {
+  return d_solver->supports(f);
+}
+
+void cache_wrapper::add(expr::term_ref f, formula_class f_class) {
+  d_assertions.push_back(assertion(f, f_class));
+  d_solver->add(f, f_class);
+  d_last_result = UNKNOWN;
+  d_checked = true;
+}
+
+void cache_wrapper::get_query(const std::vector<expr::term_ref>* assumptions, query_cache::query& q) const {
+  for (size_t i = 0; i < d_assertions.size(); ++ i) {
+    q.assertions[d_assertions[i].f_class].push_back(d_assertions[i].f);
+  }
+  if (assumptions) {
+    q.assumptions = *assumptions;
+  }
+  q.normalize();
+}
+
+solver::result cache_wrapper::check_cached(const std::vector<expr::term_ref>* assumptions) {
+
+  // Remember the check, in case we need to redo it
+  d_last_with_assumptions = assumptions != 0;
+  if (assumptions) {
+    d_last_assumptions = *assumptions;
+  } else {
+    d_last_assumptions.clear();
+  }
+  d_last_model = expr::model::ref();
+
+  query_cache::query q;
+  get_query(assumptions, q);
+
+  query_cache::entry e;
+  if (d_cache->lookup(q, e)) {
+    TRACE("smt::cache") << "cache_wrapper[" << d_name << "]: hit " << e.result << std::endl;
+    d_last_result = e.result;
+    d_last_model = e.model;
+    d_checked = false;
+    return d_last_result;
+  }
+
+  d_last_result = assumptions ? d_solver->check(*assumptions) : d_solver->check();
+  d_checked = true;
+
+  if (d_last_result != UNKNOWN) {
+    e.result = d_last_result;
+    if (d_last_result == SAT && d_cache->keep_models()) {
+      e.model = d_solver->get_model();
+    }
+    d_cache->insert(q, e);
+  }
+
+  return d_last_result;
+}
+
+solver::result cache_wrapper::check() {
+  return check_cached(0);
+}
+
+solver::result cache_wrapper::check_with_assumptions(const std::vector<expr::term_ref>& assumptions) {
+  return check_cached(&assumptions);
+}
+
+void cache_wrapper::ensure_checked() {
+  if (d_checked) {
+    return;
+  }
+  TRACE("smt::cache") << "cache_wrapper[" << d_name << "]: checking for the solver state" << std::endl;
+  result r = d_last_with_assumptions ? d_solver->check(d_last_assumptions) : d_solver->check();
+  d_checked = true;
+  if (r != d_last_result) {
+    throw exception("cache_wrapper: solver " + d_solver->get_name() + " doesn't reproduce the cached result");
+  }
+}
+
+bool cache_wrapper::is_complete(expr::model::ref m) const {
+  // The model has the variables of the classes used in the assertions
+  bool used[3] = { false, false, false };
+  for (size_t i = 0; i < d_assertions.size(); ++ i) {
+    used[d_assertions[i].f_class] = true;
+  }
+  const std::set<expr::term_ref>* vars[3] = { &d_A_variables, &d_T_variables, &d_B_variables };
+  for (size_t i = 0; i < 3; ++ i) {
+    if (used[i]) {
+      std::set<expr::term_ref>::const_iterator it = vars[i]->begin();
+      for (; it != vars[i]->end(); ++ it) {
+        if (!m->has_value(*it)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+void cache_wrapper::check_model() {
+  ensure_checked();
+  d_solver->check_model();
+}
+
+expr::model::ref cache_wrapper::get_model() const {
+  if (!d_checked && d_last_model && is_complete(d_last_model)) {
+    return d_last_model;
+  }
+  const_cast<cache_wrapper*>(this)->ensure_checked();
+  return d_solver->get_model();
+}
+
+void cache_wrapper::push() {
+  d_assertions_size.push_back(d_assertions.size());
+  d_solver->push();
+  d_last_result = UNKNOWN;
+  d_checked = true;
+}
+
+void cache_wrapper::pop() {
+  size_t size = d_assertions_size.back();
+  d_assertions_size.pop_back();
+  d_assertions.resize(size, assertion(expr::term_ref(), CLASS_A));
+  d_solver->pop();
+  d_last_result = UNKNOWN;
+  d_checked = true;
+}
+
+void cache_wrapper::generalize(generalization_type type, std::vector<expr::term_ref>& projection_out) {
+  ensure_checked();
+  d_solver->generalize(type, projection_out);
+}
+
+void cache_wrapper::generalize(generalization_type type, expr::model::ref m, std::vector<expr::term_ref>& projection_out) {
+  d_solver->generalize(type, m, projection_out);
+}
+
+void cache_wrapper::interpolate(std::vector<expr::term_ref>& out) {
+  ensure_checked();
+  d_solver->interpolate(out);
+}
+
+void cache_wrapper::get_unsat_core(std::vector<expr::term_ref>& out) {
+  ensure_checked();
+  d_solver->get_unsat_core(out);
+}
+
+void cache_wrapper::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  ensure_checked();
+  d_solver->get_unsat_assumptions(out);
+}
+
+void cache_wrapper::interrupt() {
+  d_solver->interrupt();
+}
+
+void cache_wrapper::add_variable(expr::term_ref var, variable_class f_class) {
+  solver::add_variable(var, f_class);
+  d_solver->add_variable(var, f_class);
+}
+
+void cache_wrapper::set_hint(expr::model::ref m) {
+  d_solver->set_hint(m);
+}
+
+void cache_wrapper::gc_collect(const expr::gc_relocator& gc_reloc) {
+  solver::gc_collect(gc_reloc);
+  for (size_t i = 0; i < d_assertions.size(); ++ i) {
+    gc_reloc.reloc(d_assertions[i].f);
+  }
+  gc_reloc.reloc(d_last_assumptions);
+  d_last_model = expr::model::ref();
+}
+
+}
+}
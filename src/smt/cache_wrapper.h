@@ -0,0 +1,200 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "smt/solver.h"
+#include "expr/model.h"
+
+#include <boost/thread/mutex.hpp>
+
+#include <map>
+#include <vector>
+
+namespace sally {
+namespace smt {
+
+/**
+ * Cache of check() results, shared by all the caching solvers of a term
+ * manager, and destroyed when the last one is. A query is identified by its assertions (sorted and without
+ * duplicates, per formula class) and its assumptions. Only definitive results
+ * are kept, optionally with the model for satisfiable queries. Entries that
+ * refer to collected terms are evicted on garbage collection.
+ */
+class query_cache : public expr::gc_participant {
+
+public:
+
+  /** Canonical form of a query */
+  struct query {
+    /** Assertions per class: A, T, B */
+    std::vector<expr::term_ref> assertions[3];
+    /** Assumptions of the check */
+    std::vector<expr::term_ref> assumptions;
+    /** Sort the terms and remove duplicates */
+    void normalize();
+    /** Relocate all terms, returns false if any term was collected */
+    bool reloc(const expr::gc_relocator& gc_reloc);
+    bool operator < (const query& other) const;
+  };
+
+  /** Cached result */
+  struct entry {
+    solver::result result;
+    expr::model::ref model;
+    entry(): result(solver::UNKNOWN) {}
+  };
+
+private:
+
+  typedef std::map<query, entry> query_map;
+
+  /** The cache */
+  query_map d_cache;
+
+  /** Keep the models of satisfiable queries */
+  bool d_models;
+
+  /** The cache is used by concurrent checks */
+  boost::mutex d_mutex;
+
+  struct stats {
+    utils::stat_int* hits;
+    utils::stat_int* misses;
+    utils::stat_int* evicted;
+  };
+
+  /** Statistics (owned by the statistics object) */
+  stats d_stats;
+
+  /** Id of the term manager */
+  size_t d_tm_id;
+
+  /** Number of solvers using the cache */
+  size_t d_users;
+
+  query_cache(expr::term_manager& tm, utils::statistics& stats, bool models);
+  ~query_cache();
+
+public:
+
+  /** Get the cache of the term manager, creating it if necessary */
+  static
+  query_cache* attach(expr::term_manager& tm, utils::statistics& stats, bool models);
+
+  /** Stop using the cache, the last user destroys it */
+  void detach();
+
+  /** Look up the query, returns true and sets the entry if found */
+  bool lookup(const query& q, entry& e);
+
+  /** Add a definitive result for the query */
+  void insert(const query& q, const entry& e);
+
+  /** Should models be kept */
+  bool keep_models() const { return d_models; }
+
+  /** Relocate the queries and evict the ones with collected terms */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+};
+
+/**
+ * A solver that wraps another solver and answers check() from the shared
+ * query cache if the same query was already decided. On a hit the wrapped
+ * solver is not checked, unless something that depends on its state is
+ * requested afterwards (generalization, interpolation, unsat cores, or a
+ * model that is not cached), in which case the check is done then.
+ */
+class cache_wrapper : public solver {
+
+  struct assertion {
+    expr::term_ref f;
+    formula_class f_class;
+    assertion(expr::term_ref f, formula_class f_class)
+    : f(f), f_class(f_class) {}
+  };
+
+  /** Keep track of assertions */
+  std::vector<assertion> d_assertions;
+
+  /** Assertion sizes per push */
+  std::vector<size_t> d_assertions_size;
+
+  /** The solver doing the actual work */
+  solver* d_solver;
+
+  /** The cache */
+  query_cache* d_cache;
+
+  /** Result of the last check */
+  result d_last_result;
+
+  /** Assumptions of the last check */
+  std::vector<expr::term_ref> d_last_assumptions;
+
+  /** Was the last check done with assumptions */
+  bool d_last_with_assumptions;
+
+  /** Model of the last check, if it came from the cache */
+  expr::model::ref d_last_model;
+
+  /** True if the wrapped solver has done the last check */
+  bool d_checked;
+
+  /** Get the canonical form of the current query */
+  void get_query(const std::vector<expr::term_ref>* assumptions, query_cache::query& q) const;
+
+  /** Check the query with the cache */
+  result check_cached(const std::vector<expr::term_ref>* assumptions);
+
+  /** Make sure that the wrapped solver has done the last check */
+  void ensure_checked();
+
+  /** Returns true if the model has values for all the variables */
+  bool is_complete(expr::model::ref m) const;
+
+public:
+
+  /** Takes over the solver and will destruct it on destruction, the cache is detached */
+  cache_wrapper(expr::term_manager& tm, const options& opts, utils::statistics& stats, solver* s, query_cache* cache);
+  ~cache_wrapper();
+
+  bool supports(feature f) const;
+  void add(expr::term_ref f, formula_class f_class);
+  result check();
+  void check_model();
+  expr::model::ref get_model() const;
+  void push();
+  void pop();
+  void generalize(generalization_type type, std::vector<expr::term_ref>& projection_out);
+  void generalize(generalization_type type, expr::model::ref m, std::vector<expr::term_ref>& projection_out);
+  void interpolate(std::vector<expr::term_ref>& out);
+  void get_unsat_core(std::vector<expr::term_ref>& out);
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+  void interrupt();
+  void add_variable(expr::term_ref var, variable_class f_class);
+  void set_hint(expr::model::ref m);
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+
+protected:
+
+  result check_with_assumptions(const std::vector<expr::term_ref>& assumptions);
+};
+
+}
+}
@@ -120,6 +120,12 @@ void d4y2::pop() {
   d_last_yices2_result = UNKNOWN;
 }
 
+void d4y2::interrupt() {
+  // dReal can't be stopped, but yices can
+  d_dreal4->interrupt();
+  d_yices2->interrupt();
+}
+
 void d4y2::add_variable(expr::term_ref var, variable_class f_class) {
   solver::add_variable(var, f_class);
   d_yices2->add_variable(var, f_class);
@@ -70,6 +70,9 @@ public:
   /** Check the assertions for satisfiability, allow unknown */
   result check_relaxed();
 
+  /** Stop a running check */
+  void interrupt();
+
   /** Get the model */
   expr::model::ref get_model() const;
 
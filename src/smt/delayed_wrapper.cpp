@@ -34,6 +34,10 @@ delayed_wrapper::~delayed_wrapper() {
 }
 
 bool delayed_wrapper::supports(feature f) const {
+  // Check does the work of add(), so it's not safe to run concurrently
+  if (f == CONCURRENT_CHECK) {
+    return false;
+  }
   return d_solver->supports(f);
 }
 
@@ -56,6 +60,15 @@ solver::result delayed_wrapper::check() {
   return d_solver->check();
 }
 
+void delayed_wrapper::interrupt() {
+  d_solver->interrupt();
+}
+
+solver::result delayed_wrapper::check_with_assumptions(const std::vector<expr::term_ref>& assumptions) {
+  flush();
+  return d_solver->check(assumptions);
+}
+
 void delayed_wrapper::check_model() {
   d_solver->check_model();
 }
@@ -98,6 +111,10 @@ void delayed_wrapper::get_unsat_core(std::vector<expr::term_ref>& out) {
   d_solver->get_unsat_core(out);
 }
 
+void delayed_wrapper::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  d_solver->get_unsat_assumptions(out);
+}
+
 void delayed_wrapper::add_variable(expr::term_ref var, variable_class f_class) {
   d_solver->add_variable(var, f_class);
 }
@@ -72,9 +72,15 @@ public:
   void generalize(generalization_type type, std::vector<expr::term_ref>& projection_out);
   void interpolate(std::vector<expr::term_ref>& out);
   void get_unsat_core(std::vector<expr::term_ref>& out);
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+  void interrupt();
   void add_variable(expr::term_ref var, variable_class f_class);
   void set_hint(expr::model::ref m);
   void gc_collect(const expr::gc_relocator& gc_reloc);
+
+protected:
+
+  result check_with_assumptions(const std::vector<expr::term_ref>& assumptions);
 };
 
 }
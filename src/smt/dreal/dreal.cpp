@@ -28,6 +28,7 @@
 #include "smt/dreal/dreal.h"
 #include "smt/dreal/dreal_internal.h"
 #include "utils/trace.h"
+#include "utils/budget.h"
 
 #define unused_var(x) { (void) x; }
 
@@ -51,6 +52,7 @@ void dreal::add(expr::term_ref f, formula_class f_class) {
 
 solver::result dreal::check() {
   TRACE("dreal") << "dreal[" << d_internal->instance() << "]: check()" << std::endl;
+  utils::budget::check();
   return d_internal->check();
 }
 
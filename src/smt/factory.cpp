@@ -19,6 +19,7 @@
 #include "smt/factory.h"
 #include "utils/module_setup.h"
 #include "smt/smt2_output_wrapper.h"
+#include "smt/cache_wrapper.h"
 
 #include <iostream>
 #include <iomanip>
@@ -43,6 +44,15 @@ bool factory::s_generate_smt = false;
 
 std::string factory::s_smt2_prefix;
 
+bool factory::s_cache_queries = false;
+
+bool factory::s_cache_models = false;
+
+bool factory::s_use_pool = false;
+
+/** Solver pools per term manager id */
+static std::map<size_t, solver_pool*> s_pools;
+
 void factory::set_default_solver(std::string id) {
   s_default_solver = id;
 }
@@ -51,7 +61,11 @@ solver* factory::mk_default_solver(expr::term_manager& tm, const options& opts,
   if (s_default_solver.size() == 0) {
     throw exception("No default solver set.");
   }
-  return mk_solver(s_default_solver, tm, opts, stats);
+  solver* s = mk_solver(s_default_solver, tm, opts, stats);
+  if (s_cache_queries) {
+    s = new cache_wrapper(tm, opts, stats, s, query_cache::attach(tm, stats, s_cache_models));
+  }
+  return s;
 }
 
 solver* factory::mk_solver(std::string id, expr::term_manager& tm, const options& opts, utils::statistics& stats) {
@@ -92,6 +106,48 @@ void factory::enable_smt2_output(std::string prefix) {
   s_smt2_prefix = prefix;
 }
 
+void factory::enable_query_cache(bool models) {
+  s_cache_queries = true;
+  s_cache_models = models;
+}
+
+solver* factory::acquire_solver(const pooled_solver::base& b, expr::term_manager& tm, const options& opts, utils::statistics& stats) {
+  if (!s_use_pool) {
+    solver* s = mk_default_solver(tm, opts, stats);
+    b.setup(s);
+    return s;
+  }
+  if (s_default_solver.size() == 0) {
+    throw exception("No default solver set.");
+  }
+  solver_pool*& pool = s_pools[tm.id()];
+  if (pool == 0) {
+    pool = new solver_pool(tm, opts, stats);
+  }
+  return pool->acquire(s_default_solver, b);
+}
+
+void factory::release_solver(solver* s) {
+  pooled_solver* pooled = dynamic_cast<pooled_solver*>(s);
+  if (pooled) {
+    pooled->release();
+  } else {
+    delete s;
+  }
+}
+
+void factory::enable_solver_pool() {
+  s_use_pool = true;
+}
+
+void factory::clear_solver_pool(expr::term_manager& tm) {
+  std::map<size_t, solver_pool*>::iterator find = s_pools.find(tm.id());
+  if (find != s_pools.end()) {
+    delete find->second;
+    s_pools.erase(find);
+  }
+}
+
 
 }
 }
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "smt/solver.h"
+#include "smt/solver_pool.h"
 
 namespace boost { namespace program_options {
   class options_description;
@@ -44,6 +45,15 @@ class factory {
   /** Prefix of smt2 files */
   static std::string s_smt2_prefix;
 
+  /** Wrap default solvers to cache query results */
+  static bool s_cache_queries;
+
+  /** Cache the models too */
+  static bool s_cache_models;
+
+  /** Reuse solvers acquired with acquire_solver() */
+  static bool s_use_pool;
+
 public:
 
   static
@@ -67,6 +77,50 @@ public:
   static
   void enable_smt2_output(std::string prefix);
 
+  static
+  void enable_query_cache(bool models);
+
+  /**
+   * Get a default solver with the given base context asserted, at a clean
+   * push level. If the pool is enabled, the solver might be reused from a
+   * previous release_solver() with the same base.
+   */
+  static
+  solver* acquire_solver(const pooled_solver::base& b, expr::term_manager& tm, const options& opts, utils::statistics& stats);
+
+  /** Release a solver obtained with acquire_solver() */
+  static
+  void release_solver(solver* s);
+
+  static
+  void enable_solver_pool();
+
+  /** Destroy the pooled solvers of the term manager */
+  static
+  void clear_solver_pool(expr::term_manager& tm);
+
+};
+
+/** A solver obtained with factory::acquire_solver() and released on destruction */
+class solver_lease {
+
+  solver* d_solver;
+
+  solver_lease(const solver_lease&);
+  solver_lease& operator = (const solver_lease&);
+
+public:
+
+  solver_lease(const pooled_solver::base& b, expr::term_manager& tm, const options& opts, utils::statistics& stats)
+  : d_solver(factory::acquire_solver(b, tm, opts, stats))
+  {}
+
+  ~solver_lease() {
+    factory::release_solver(d_solver);
+  }
+
+  solver* operator -> () { return d_solver; }
+  solver& operator * () { return *d_solver; }
 };
 
 }
@@ -19,27 +19,401 @@
 #include "expr/term_manager.h"
 #include "expr/gc_relocator.h"
 #include "smt/generic/generic_solver.h"
+#include "smt/smt2_log.h"
+#include "utils/budget.h"
 
-#include <boost/iostreams/stream.hpp>
-#include <boost/iostreams/device/file_descriptor.hpp>
-#include <boost/iostreams/tee.hpp>
+#include "utils/trace.h"
 
-#include <fstream>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/bind/bind.hpp>
+
+#include <deque>
 #include <iostream>
+#include <map>
 #include <sstream>
 
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
 namespace sally {
 namespace smt {
 
-// FD-based stream for writing
-typedef boost::iostreams::stream<boost::iostreams::file_descriptor_sink> fd_write_stream;
-// FD-based stream for reading
-typedef boost::iostreams::stream<boost::iostreams::file_descriptor_source> fd_read_stream;
-// Tee for getting a copy of the input
-typedef boost::iostreams::tee_device<fd_write_stream, std::ofstream> tee_device;
-typedef boost::iostreams::stream<tee_device> fd_write_stream_tee;
+/**
+ * A child process running the solver script. We write to its stdin, and a
+ * separate thread reads its stdout and splits it into responses (atoms or
+ * balanced s-expressions), so the solver never blocks on its output.
+ */
+class generic_solver_process {
+
+  /** The script running */
+  std::string d_script;
+
+  /** Process id of the solver */
+  pid_t d_pid;
+
+  /** Where we write the solver input */
+  int d_input_fd;
+
+  /** Where we read the solver output */
+  int d_output_fd;
+
+  /** Protects the responses */
+  boost::mutex d_mutex;
+
+  /** Signaled when a response arrives or the output is closed */
+  boost::condition_variable d_cond;
+
+  /** Responses read but not consumed yet */
+  std::deque<std::string> d_responses;
+
+  /** Has the solver closed its output */
+  bool d_closed;
+
+  /** Expecting the response to the reset of a reuse */
+  bool d_resetting;
+
+  /** Thread reading the responses */
+  boost::thread* d_reader;
+
+  /** Body of the reader thread */
+  void read_responses();
+
+  /** Add a complete response */
+  void add_response(std::string& response);
+
+  /** Wait for the solver to exit (kill it if it doesn't) */
+  void wait_exit();
+
+public:
+
+  /** Start the script */
+  generic_solver_process(const std::string& script);
+
+  /** Ask the solver to exit and wait for it */
+  ~generic_solver_process();
+
+  /** The script running */
+  const std::string& get_script() const { return d_script; }
+
+  /** Write the text to the solver input */
+  void write(const std::string& text);
+
+  /** Get the next response (waits for it), throws if the solver is gone */
+  std::string read_response();
+
+  /** Reset the solver for reuse (doesn't wait for the solver) */
+  void reset();
+
+  /** Wait for the reset to finish, returns false if the solver failed */
+  bool finish_reset();
+};
+
+/** Marker echoed by the solver after a reset */
+static const std::string reset_marker = "sally-reset";
+
+/** Pending input above this size is sent right away */
+static const size_t max_pending_input = 1 << 16;
+
+generic_solver_process::generic_solver_process(const std::string& script)
+: d_script(script)
+, d_pid(-1)
+, d_input_fd(-1)
+, d_output_fd(-1)
+, d_closed(false)
+, d_resetting(false)
+, d_reader(0)
+{
+  // Create pipe for sal -> solver
+  int sal_to_solver_fds[2]; // [0]: solver read, [1]: sal write
+  if (pipe(sal_to_solver_fds) == -1) {
+    throw exception("could not create solver");
+  }
+  // Create the pipe for solver -> sal
+  int solver_to_sal_fds[2]; // [0]: sal read, [1]: solver write
+  if (pipe(solver_to_sal_fds) == -1) {
+    close(sal_to_solver_fds[0]);
+    close(sal_to_solver_fds[1]);
+    throw exception("could not create solver");
+  }
+
+  // Our ends shouldn't leak into other solvers
+  fcntl(sal_to_solver_fds[1], F_SETFD, FD_CLOEXEC);
+  fcntl(solver_to_sal_fds[0], F_SETFD, FD_CLOEXEC);
+
+  // Fork the solver
+  d_pid = fork();
+  if (d_pid == -1) {
+    throw exception("could not create solver");
+  }
+
+  // Child, solver side, never exits the if
+  if (d_pid == 0) {
+    // Close unused pipe ends
+    close(sal_to_solver_fds[1]);
+    close(solver_to_sal_fds[0]);
+
+    // Take stdin from sal
+    dup2(sal_to_solver_fds[0], 0);
+    // Put stdout to sal
+    dup2(solver_to_sal_fds[1], 1);
+
+    // Run the actual solver
+    char* const args[3] = { strdup(script.c_str()), 0 };
+    execvp(script.c_str(), args);
+    // We're in child, on this error just exit
+    std::cerr << "failed to execute " << script << "." << std::endl;
+    exit(1);
+  }
+
+  // Parent, sal side
+  close(sal_to_solver_fds[0]);
+  close(solver_to_sal_fds[1]);
+  d_input_fd = sal_to_solver_fds[1];
+  d_output_fd = solver_to_sal_fds[0];
+
+  // Start reading
+  d_reader = new boost::thread(boost::bind(&generic_solver_process::read_responses, this));
+}
+
+generic_solver_process::~generic_solver_process() {
+  // Notify the solver, it might be gone already
+  try {
+    write("(exit)\n");
+  } catch (const exception&) {
+  }
+  close(d_input_fd);
+  wait_exit();
+  d_reader->join();
+  delete d_reader;
+  close(d_output_fd);
+}
+
+void generic_solver_process::wait_exit() {
+  // Give the solver some time to exit
+  for (size_t i = 0; i < 100; ++ i) {
+    pid_t ret = waitpid(d_pid, 0, WNOHANG);
+    if (ret != 0) {
+      return;
+    }
+    boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+  }
+  TRACE("generic_solver") << "generic_solver: killing " << d_script << std::endl;
+  kill(d_pid, SIGKILL);
+  waitpid(d_pid, 0, 0);
+}
+
+void generic_solver_process::write(const std::string& text) {
+  const char* data = text.c_str();
+  size_t size = text.size();
+  while (size > 0) {
+    ssize_t written = ::write(d_input_fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw exception("could not write to the solver " + d_script);
+    }
+    data += written;
+    size -= written;
+  }
+}
+
+void generic_solver_process::add_response(std::string& response) {
+  if (!response.empty()) {
+    boost::mutex::scoped_lock lock(d_mutex);
+    d_responses.push_back(response);
+    d_cond.notify_all();
+    response.clear();
+  }
+}
+
+void generic_solver_process::read_responses() {
+  char buffer[4096];
+  std::string response;
+  size_t depth = 0;
+  bool in_string = false, in_symbol = false;
+  for (;;) {
+    ssize_t size = ::read(d_output_fd, buffer, sizeof(buffer));
+    if (size < 0 && errno == EINTR) {
+      continue;
+    }
+    if (size <= 0) {
+      break;
+    }
+    for (ssize_t i = 0; i < size; ++ i) {
+      char c = buffer[i];
+      if (in_string) {
+        // Strings end with a " (and "" is an escaped ")
+        response += c;
+        in_string = c != '"';
+        continue;
+      }
+      if (in_symbol) {
+        response += c;
+        in_symbol = c != '|';
+        continue;
+      }
+      switch (c) {
+      case '"':
+        in_string = true;
+        response += c;
+        break;
+      case '|':
+        in_symbol = true;
+        response += c;
+        break;
+      case '(':
+        if (depth == 0) {
+          add_response(response);
+        }
+        depth ++;
+        response += c;
+        break;
+      case ')':
+        response += c;
+        if (depth > 0) {
+          depth --;
+        }
+        if (depth == 0) {
+          add_response(response);
+        }
+        break;
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+        if (depth == 0) {
+          add_response(response);
+        } else if (!response.empty() && response[response.size()-1] != ' ') {
+          response += ' ';
+        }
+        break;
+      default:
+        response += c;
+      }
+    }
+  }
+  add_response(response);
+
+  boost::mutex::scoped_lock lock(d_mutex);
+  d_closed = true;
+  d_cond.notify_all();
+}
+
+std::string generic_solver_process::read_response() {
+  boost::mutex::scoped_lock lock(d_mutex);
+  while (d_responses.empty() && !d_closed) {
+    d_cond.wait(lock);
+  }
+  if (d_responses.empty()) {
+    throw exception("the solver " + d_script + " has terminated");
+  }
+  std::string response = d_responses.front();
+  d_responses.pop_front();
+  return response;
+}
+
+void generic_solver_process::reset() {
+  // The marker tells us when the reset is done
+  write("(reset)\n(echo \"" + reset_marker + "\")\n");
+  d_resetting = true;
+}
+
+bool generic_solver_process::finish_reset() {
+  assert(d_resetting);
+  d_resetting = false;
+  try {
+    // Skip whatever the last user didn't read
+    for (;;) {
+      std::string response = read_response();
+      // Solvers echo with or without the quotes
+      if (response == reset_marker || response == "\"" + reset_marker + "\"") {
+        return true;
+      }
+      if (response.compare(0, 6, "(error") == 0) {
+        TRACE("generic_solver") << "generic_solver: reset failed: " << response << std::endl;
+      }
+    }
+  } catch (const exception&) {
+    return false;
+  }
+}
+
+/**
+ * Solver processes that are not in use, to be reused (after a reset) instead
+ * of starting new ones.
+ */
+class generic_solver_process_pool {
+
+  typedef std::map<std::string, std::vector<generic_solver_process*> > idle_map;
+
+  /** Idle processes by script */
+  idle_map d_idle;
+
+  /** Protects the idle processes */
+  boost::mutex d_mutex;
+
+public:
+
+  ~generic_solver_process_pool() {
+    idle_map::iterator it = d_idle.begin();
+    for (; it != d_idle.end(); ++ it) {
+      for (size_t i = 0; i < it->second.size(); ++ i) {
+        delete it->second[i];
+      }
+    }
+  }
+
+  /** Get a process running the script, reused if possible */
+  generic_solver_process* acquire(const std::string& script) {
+    for (;;) {
+      generic_solver_process* process = 0;
+      {
+        boost::mutex::scoped_lock lock(d_mutex);
+        std::vector<generic_solver_process*>& idle = d_idle[script];
+        if (idle.empty()) {
+          break;
+        }
+        process = idle.back();
+        idle.pop_back();
+      }
+      if (process->finish_reset()) {
+        TRACE("generic_solver") << "generic_solver: reusing " << script << std::endl;
+        return process;
+      }
+      delete process;
+    }
+    TRACE("generic_solver") << "generic_solver: starting " << script << std::endl;
+    return new generic_solver_process(script);
+  }
+
+  /** Done with the process, keep it if there are less than max_idle idle */
+  void release(generic_solver_process* process, size_t max_idle) {
+    {
+      boost::mutex::scoped_lock lock(d_mutex);
+      std::vector<generic_solver_process*>& idle = d_idle[process->get_script()];
+      if (idle.size() < max_idle) {
+        try {
+          process->reset();
+          idle.push_back(process);
+          return;
+        } catch (const exception&) {
+        }
+      }
+    }
+    delete process;
+  }
+};
+
+/** The pool of all generic solvers */
+static generic_solver_process_pool s_process_pool;
 
 /**
  * Internal class that does all the work.
@@ -49,23 +423,20 @@ class generic_solver_internal {
   /** Term manager */
   expr::term_manager& d_tm;
 
-  /** Stream where the solver responces can be read off */
-  fd_read_stream* d_solver_response;
-
-  /** Stream where we send the solver input */
-  fd_write_stream* d_solver_input_fd;
+  /** The solver process */
+  generic_solver_process* d_process;
 
-  /** The tee device */
-  tee_device* d_solver_input_tee_device;
+  /** Input not yet sent to the solver */
+  std::stringstream d_pending;
 
-  /** Wrapper so that we can split the output */
-  std::ostream* d_solver_input_tee;
+  /** Log of the input (if enabled) */
+  smt2_log* d_log;
 
-  /** Stream of the output file */
-  std::ofstream* d_copy_out;
+  /** Whether to send the terms with definitions */
+  bool d_compact;
 
-  /** Stream where we send the solver input */
-  std::ostream* d_solver_input;
+  /** Definitions of the sent terms (if compact) */
+  smt2_definitions d_definitions;
 
   /** List of declared variables */
   std::vector<expr::term_ref> d_vars_list;
@@ -76,6 +447,18 @@ class generic_solver_internal {
   /** Number of declared variables per push */
   std::vector<size_t> d_vars_list_size;
 
+  /** Assumptions of the last check with assumptions */
+  std::vector<expr::term_ref_strong> d_last_assumptions;
+
+  /** The SMT2 text of the assumptions, as sent to the solver */
+  std::vector<std::string> d_last_assumptions_smt2;
+
+  /** Does the solver produce unsat assumptions */
+  bool d_unsat_assumptions;
+
+  /** Max number of processes kept for reuse (0 for no reuse) */
+  size_t d_max_idle;
+
   /** Returns true if a variable is already declared */
   bool is_declared(expr::term_ref var) const {
     return d_vars_set.find(var) != d_vars_set.end();
@@ -84,12 +467,73 @@ class generic_solver_internal {
   /** Declares a variable to the solver */
   void declare(expr::term_ref var) {
     // Declare in the solver
-    *d_solver_input << "(declare-fun " << var << " () " << d_tm.type_of(var) << ")" << std::endl;
+    d_pending << "(declare-fun " << var << " () " << d_tm.type_of(var) << ")" << std::endl;
     // Add to the list/set of declared variables
     d_vars_list.push_back(var);
     d_vars_set.insert(var);
   }
 
+  /** Declare the undeclared variables of f */
+  void declare_variables(expr::term_ref f) {
+    std::vector<expr::term_ref> vars;
+    d_tm.get_variables(f, vars);
+    for (unsigned i = 0; i < vars.size(); ++ i) {
+      if (!is_declared(vars[i])) {
+        declare(vars[i]);
+      }
+    }
+  }
+
+  /** Send the input if there is enough of it */
+  void send_if_full() {
+    if (d_pending.tellp() > (std::streamoff) max_pending_input) {
+      send();
+    }
+  }
+
+  /** Send the pending input to the solver */
+  void send() {
+    std::string input = d_pending.str();
+    if (!input.empty()) {
+      d_process->write(input);
+      if (d_log) {
+        d_log->stream() << input;
+        d_log->flush_if_full();
+      }
+      d_pending.str(std::string());
+    }
+  }
+
+  /** Get the next response, skipping the ones we don't care about */
+  std::string read_response() {
+    for (;;) {
+      std::string response = d_process->read_response();
+      if (response == "success" || response == "unsupported") {
+        continue;
+      }
+      if (response.compare(0, 6, "(error") == 0) {
+        throw exception("solver error: " + response);
+      }
+      return response;
+    }
+  }
+
+  /** Read the response to a check */
+  solver::result read_check_response() {
+    std::string solver_out = read_response();
+    if (solver_out == "sat") {
+      return solver::SAT;
+    }
+    if (solver_out == "unsat") {
+      return solver::UNSAT;
+    }
+    if (solver_out == "unknown") {
+      return solver::UNKNOWN;
+    }
+    throw exception("unknown solver response: " + solver_out);
+    return solver::UNKNOWN;
+  }
+
   /** Number of solver instances */
   static unsigned s_instances;
 
@@ -99,16 +543,16 @@ class generic_solver_internal {
 public:
 
   /**
-   * Create the files and fork the solver.
+   * Create the files and get a solver process.
    */
   generic_solver_internal(expr::term_manager& tm, const options& opts)
   : d_tm(tm)
-  , d_solver_response(0)
-  , d_solver_input_fd(0)
-  , d_solver_input_tee_device(0)
-  , d_solver_input_tee(0)
-  , d_copy_out(0)
-  , d_solver_input(0)
+  , d_process(0)
+  , d_log(0)
+  , d_compact(opts.get_bool("generic-solver-compact"))
+  , d_definitions(tm, "sally!t")
+  , d_unsat_assumptions(opts.get_bool("generic-solver-unsat-assumptions"))
+  , d_max_idle(0)
   , d_options(opts)
   {
     // The solver to run
@@ -125,140 +569,150 @@ public:
     // Should we log the interaction
     bool solver_log_enabled = d_options.has_option("generic-solver-log");
     std::string solver_log;
+    smt2_log::compression solver_log_compression = smt2_log::COMPRESSION_NONE;
     if (solver_log_enabled) {
       std::stringstream ss;
       ss << opts.get_string("generic-solver-log");
       ss << "." << s_instances << ".smt2";
+      solver_log_compression = smt2_log::get_compression(opts, "generic-solver-log-compression");
       solver_log = ss.str();
     }
 
-    // One more instance
-    s_instances ++;
-
-    // Create pipe for sal -> solver
-    int sal_to_solver_fds[2]; // [0]: solver read, [1]: sal write
-    if (pipe(sal_to_solver_fds) == -1) {
-      throw exception("could not create solver");
-    }
-    // Create the pipe for solver -> sal
-    int solver_to_sal_fds[2]; // [0]: sal read, [1]: solver write
-    if (pipe(solver_to_sal_fds) == -1) {
-      throw exception("could not create solver");
-    }
-
-    // Fork the solver
-    pid_t pid = fork();
-    if (pid == -1) {
-      throw exception("could not create solver");
-    }
-
-    // Child, solver side, never exits the if
-    if (pid == 0) {
-      // Close unused pipe ends
-      close(sal_to_solver_fds[1]);
-      close(solver_to_sal_fds[0]);
-
-      // Take stdin from sal
-      dup2(sal_to_solver_fds[0], 0);
-      // Put stdout to sal
-      dup2(solver_to_sal_fds[1], 1);
-
-      // Run the actual solver
-      char* const args[3] = { strdup(solver_script.c_str()), 0 };
-      execvp(solver_script.c_str(), args);
-      // We're in child, on this error just exit
-      std::cerr << "failed to execute " << solver_script << "." << std::endl;
-      exit(1);
+    // Reuse the processes
+    if (d_options.get_bool("generic-solver-reuse")) {
+      d_max_idle = d_options.get_unsigned("generic-solver-pool-size");
     }
 
-    // Parent, sal side
-    close(sal_to_solver_fds[0]);
-    close(solver_to_sal_fds[1]);
+    // One more instance
+    s_instances ++;
 
-    // Where we write SMT2 to the solver
-    d_solver_input_fd = new fd_write_stream(sal_to_solver_fds[1], boost::iostreams::close_handle);
+    // The solver
+    d_process = s_process_pool.acquire(solver_script);
 
     if (solver_log_enabled) {
       // Where the SMT2 copy goes
-      d_copy_out = new std::ofstream(solver_log.c_str());
-      // Make the device to tee to
-      d_solver_input_tee_device = new tee_device(*d_solver_input_fd, *d_copy_out);
-      // Where we write to get the double output
-      d_solver_input_tee = new fd_write_stream_tee(*d_solver_input_tee_device);
-      // This is the one we use
-      d_solver_input = d_solver_input_tee;
-    } else {
-      // We write to the solver directly
-      d_solver_input = d_solver_input_fd;
+      d_log = new smt2_log(solver_log, solver_log_compression);
     }
 
-    // Where we read from
-    d_solver_response = new fd_read_stream(solver_to_sal_fds[0], boost::iostreams::close_handle);
-
     // Setup the solver stream
-    *d_solver_input << expr::set_tm(tm);
-    *d_solver_input << expr::set_output_language(output::MCMT);
+    d_pending << expr::set_tm(tm);
+    d_pending << expr::set_output_language(output::MCMT);
 
     // SMT2 preamble
-    *d_solver_input << "(set-info :smt-lib-version 2.0)" << std::endl;
-    *d_solver_input << "(set-logic " << solver_logic << ")" << std::endl;
+    d_pending << "(set-info :smt-lib-version 2.0)" << std::endl;
+    if (d_unsat_assumptions) {
+      d_pending << "(set-option :produce-unsat-assumptions true)" << std::endl;
+    }
+    d_pending << "(set-logic " << solver_logic << ")" << std::endl;
   }
 
   ~generic_solver_internal() {
-    // Notify the solver
-    *d_solver_input << "(exit)" << std::endl;
-    // Delete the streams you own
-    delete d_solver_response;
-    delete d_solver_input_tee;
-    delete d_solver_input_tee_device;
-    delete d_solver_input_fd;
-    delete d_copy_out;
+    // Give back the solver (it gets the rest of the input, if any)
+    try {
+      send();
+    } catch (const exception&) {
+    }
+    s_process_pool.release(d_process, d_max_idle);
+    delete d_log;
   }
 
   void add(expr::term_ref f) {
     // Declare any undeclared variables
-    std::vector<expr::term_ref> vars;
-    d_tm.get_variables(f, vars);
-    for (unsigned i = 0; i < vars.size(); ++ i) {
-      if (!is_declared(vars[i])) {
-        declare(vars[i]);
-      }
+    declare_variables(f);
+    if (d_compact) {
+      d_definitions.define(d_pending, f);
+      d_pending << "(assert ";
+      d_definitions.print(d_pending, f);
+      d_pending << ")" << std::endl;
+    } else {
+      d_pending << "(assert " << f << ")" << std::endl;
     }
-
-    *d_solver_input << "(assert " << f << ")" << std::endl;
+    send_if_full();
   }
 
   solver::result check() {
-    *d_solver_input << "(check-sat)" << std::endl;
-    std::string solver_out;
-    *d_solver_response >> solver_out;
-    if (solver_out == "sat") {
-      return solver::SAT;
+    d_pending << "(check-sat)" << std::endl;
+    send();
+    return read_check_response();
+  }
+
+  solver::result check(const std::vector<expr::term_ref>& assumptions) {
+    d_last_assumptions.clear();
+    d_last_assumptions_smt2.clear();
+    for (size_t i = 0; i < assumptions.size(); ++ i) {
+      declare_variables(assumptions[i]);
     }
-    if (solver_out == "unsat") {
-      return solver::UNSAT;
+    d_pending << "(check-sat-assuming (";
+    for (size_t i = 0; i < assumptions.size(); ++ i) {
+      std::stringstream ss;
+      ss << expr::set_tm(d_tm) << expr::set_output_language(output::MCMT);
+      ss << assumptions[i];
+      d_last_assumptions.push_back(expr::term_ref_strong(d_tm, assumptions[i]));
+      d_last_assumptions_smt2.push_back(ss.str());
+      d_pending << (i ? " " : "") << ss.str();
     }
-    if (solver_out == "unknown") {
-      return solver::UNKNOWN;
+    d_pending << "))" << std::endl;
+    send();
+    return read_check_response();
+  }
+
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+    if (!d_unsat_assumptions) {
+      // All of them
+      out.insert(out.end(), d_last_assumptions.begin(), d_last_assumptions.end());
+      return;
+    }
+    d_pending << "(get-unsat-assumptions)" << std::endl;
+    send();
+    std::string response = read_response();
+    if (response.size() < 2 || response[0] != '(') {
+      throw exception("unknown solver response: " + response);
+    }
+    // The response is a list of our assumptions, as we sent them
+    std::string list = response.substr(1, response.size() - 2);
+    size_t begin = 0;
+    while (begin < list.size()) {
+      if (list[begin] == ' ') {
+        begin ++;
+        continue;
+      }
+      size_t end = begin;
+      size_t depth = 0;
+      while (end < list.size() && (depth > 0 || list[end] != ' ')) {
+        if (list[end] == '(') depth ++;
+        if (list[end] == ')') depth --;
+        end ++;
+      }
+      std::string assumption = list.substr(begin, end - begin);
+      size_t i = 0;
+      while (i < d_last_assumptions_smt2.size() && d_last_assumptions_smt2[i] != assumption) {
+        i ++;
+      }
+      if (i == d_last_assumptions_smt2.size()) {
+        throw exception("unknown assumption in solver response: " + assumption);
+      }
+      out.push_back(d_last_assumptions[i]);
+      begin = end;
     }
-    throw exception("unknown solver response: " + solver_out);
-    return solver::UNKNOWN;
   }
 
   void push() {
     // Push the solver
-    *d_solver_input << "(push 1)" << std::endl;
+    d_pending << "(push 1)" << std::endl;
+    d_definitions.push();
     // Remember the declared variables
     d_vars_list_size.push_back(d_vars_list.size());
   }
 
   void pop() {
     // Pop the solver
-    *d_solver_input << "(pop 1)" << std::endl;
-    // Forget all the variables declared since last push
+    d_pending << "(pop 1)" << std::endl;
     if (d_vars_list_size.size() == 0) {
       throw exception("Calls to push/pop don't match.");
     }
+    // Forget all the definitions since last push
+    d_definitions.pop();
+    // Forget all the variables declared since last push
     size_t size = d_vars_list_size.back();
     d_vars_list_size.pop_back();
     while (d_vars_list.size() > size) {
@@ -268,9 +722,20 @@ public:
     }
   }
 
+  /** Is the term a Boolean variable or its negation */
+  bool is_literal(expr::term_ref t) const {
+    const expr::term& t_term = d_tm.term_of(t);
+    if (t_term.op() == expr::TERM_NOT) {
+      return is_literal(t_term[0]);
+    }
+    return t_term.op() == expr::VARIABLE && d_tm.type_of(t) == d_tm.boolean_type();
+  }
+
   void gc_collect(const expr::gc_relocator& gc_reloc) {
     gc_reloc.reloc(d_vars_list);
     gc_reloc.reloc(d_vars_set);
+    gc_reloc.reloc(d_last_assumptions);
+    d_definitions.gc_collect(gc_reloc);
   }
 
 };
@@ -279,6 +744,7 @@ unsigned generic_solver_internal::s_instances = 0;
 
 generic_solver::generic_solver(expr::term_manager& tm, const options& opts, utils::statistics& stats)
 : solver("generic smt2 solver", tm, opts, stats)
+, d_native_assumptions(false)
 {
   d_internal = new generic_solver_internal(tm, opts);
 }
@@ -292,9 +758,41 @@ void generic_solver::add(expr::term_ref f, formula_class f_class) {
 }
 
 solver::result generic_solver::check() {
+  utils::budget::check();
   return d_internal->check();
 }
 
+solver::result generic_solver::check_with_assumptions(const std::vector<expr::term_ref>& assumptions) {
+  // SMT2 only takes Boolean literals as assumptions, emulate otherwise
+  for (size_t i = 0; i < assumptions.size(); ++ i) {
+    if (!d_internal->is_literal(assumptions[i])) {
+      d_native_assumptions = false;
+      return solver::check_with_assumptions(assumptions);
+    }
+  }
+  utils::budget::check();
+  d_unsat_assumptions.clear();
+  d_native_assumptions = true;
+  return d_internal->check(assumptions);
+}
+
+void generic_solver::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  if (d_native_assumptions) {
+    d_internal->get_unsat_assumptions(out);
+  } else {
+    solver::get_unsat_assumptions(out);
+  }
+}
+
+bool generic_solver::supports(feature f) const {
+  switch (f) {
+  case ASSUMPTIONS:
+    return true;
+  default:
+    return false;
+  }
+}
+
 void generic_solver::push() {
   d_internal->push();
 }
@@ -304,6 +802,7 @@ void generic_solver::pop() {
 }
 
 void generic_solver::gc_collect(const expr::gc_relocator& gc_reloc) {
+  solver::gc_collect(gc_reloc);
   d_internal->gc_collect(gc_reloc);
 }
 
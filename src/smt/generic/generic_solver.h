@@ -35,6 +35,9 @@ class generic_solver : public solver {
   /** Internal implementation */
   generic_solver_internal* d_internal;
 
+  /** Was the last check with assumptions done natively */
+  bool d_native_assumptions;
+
 public:
 
   /** Constructor */
@@ -49,6 +52,12 @@ public:
   /** Check the assertions for satisfiability */
   result check();
 
+  /** Get the unsat assumptions of the last check with assumptions */
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+
+  /** Check if the solver supports a feature */
+  bool supports(feature f) const;
+
   /** Push the solving context */
   void push();
 
@@ -58,6 +67,11 @@ public:
   /** Collect terms */
   void gc_collect(const expr::gc_relocator& gc_reloc);
 
+protected:
+
+  /** Check with assumptions, with check-sat-assuming if they are literals */
+  result check_with_assumptions(const std::vector<expr::term_ref>& assumptions);
+
 };
 
 }
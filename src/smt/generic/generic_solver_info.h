@@ -47,7 +47,12 @@ struct generic_solver_info {
         ("generic-solver-script", value<std::string>(), "The SMT solver script to use (takes SMT2 from stdin).")
         ("generic-solver-logic", value<std::string>(), "The SMT logic to use (e.g. QF_LRA).")
         ("generic-solver-log", value<std::string>(), "Prefix of a file where the SMT2 output will be logged. Given 'output', the files generated will be 'output.1.smt2', ...")
+        ("generic-solver-log-compression", value<std::string>(), "Compression of the SMT2 logs (none, gzip, zstd).")
+        ("generic-solver-compact", "Send each subterm to the solver once (as a definition) instead of printing the assertions in full.")
         ("generic-solver-flatten", "Run the solver in non-incremental mode.")
+        ("generic-solver-reuse", "Reuse the solver processes (after a reset) instead of starting a new one for each solver.")
+        ("generic-solver-pool-size", value<unsigned>()->default_value(4), "Maximal number of idle solver processes kept for reuse.")
+        ("generic-solver-unsat-assumptions", "Ask the solver for the unsat assumptions (otherwise all assumptions are reported).")
         ;
   }
 
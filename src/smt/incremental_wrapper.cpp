@@ -36,6 +36,10 @@ incremental_wrapper::~incremental_wrapper() {
 }
 
 bool incremental_wrapper::supports(feature f) const {
+  // Check does the work of add(), so it's not safe to run concurrently
+  if (f == CONCURRENT_CHECK) {
+    return false;
+  }
   return d_solver->supports(f);
 }
 
@@ -43,10 +47,13 @@ void incremental_wrapper::add(expr::term_ref f, formula_class f_class) {
   d_assertions.push_back(assertion(f, f_class));
 }
 
-solver::result incremental_wrapper::check() {
+void incremental_wrapper::reset_solver() {
 
-  delete d_solver;
-  d_solver = d_constructor->mk_solver();
+  {
+    boost::mutex::scoped_lock lock(d_solver_mutex);
+    delete d_solver;
+    d_solver = d_constructor->mk_solver();
+  }
 
   // Initialize solver
   d_solver->add_variables(d_A_variables.begin(), d_A_variables.end(), CLASS_A);
@@ -57,11 +64,23 @@ solver::result incremental_wrapper::check() {
   for (size_t i = 0; i < d_assertions.size(); ++ i) {
     d_solver->add(d_assertions[i].f, d_assertions[i].f_class);
   }
+}
 
-  // Check and interpolate
+solver::result incremental_wrapper::check() {
+  reset_solver();
   return d_solver->check();
 }
 
+void incremental_wrapper::interrupt() {
+  boost::mutex::scoped_lock lock(d_solver_mutex);
+  d_solver->interrupt();
+}
+
+solver::result incremental_wrapper::check_with_assumptions(const std::vector<expr::term_ref>& assumptions) {
+  reset_solver();
+  return d_solver->check(assumptions);
+}
+
 expr::model::ref incremental_wrapper::get_model() const {
   return d_solver->get_model();
 }
@@ -90,6 +109,10 @@ void incremental_wrapper::get_unsat_core(std::vector<expr::term_ref>& out) {
   d_solver->get_unsat_core(out);
 }
 
+void incremental_wrapper::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  d_solver->get_unsat_assumptions(out);
+}
+
 void incremental_wrapper::gc_collect(const expr::gc_relocator& gc_reloc) {
   solver::gc_collect(gc_reloc);
   for (size_t i = 0; i < d_assertions.size(); ++ i) {
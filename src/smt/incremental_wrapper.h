@@ -20,6 +20,8 @@
 
 #include "smt/solver.h"
 
+#include <boost/thread/mutex.hpp>
+
 namespace sally {
 namespace smt {
 
@@ -55,9 +57,15 @@ class incremental_wrapper : public solver {
   /** Solver previously used */
   solver* d_solver;
 
+  /** Protects d_solver from interrupt() while it's being replaced */
+  boost::mutex d_solver_mutex;
+
   /** Instance */
   static size_t d_instance;
 
+  /** Make a new solver with all the assertions */
+  void reset_solver();
+
 public:
 
   incremental_wrapper(std::string name, expr::term_manager& tm, const options& opts, utils::statistics& stats, solver_constructor* constructor);
@@ -72,7 +80,13 @@ public:
   void generalize(generalization_type type, std::vector<expr::term_ref>& projection_out);
   void interpolate(std::vector<expr::term_ref>& out);
   void get_unsat_core(std::vector<expr::term_ref>& out);
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+  void interrupt();
   void gc_collect(const expr::gc_relocator& gc_reloc);
+
+protected:
+
+  result check_with_assumptions(const std::vector<expr::term_ref>& assumptions);
 };
 
 }
@@ -22,10 +22,13 @@
 #include <mathsat.h>
 #include <msatexistelim.h>
 #include <boost/unordered_map.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include <iostream>
 #include <fstream>
 #include <iomanip>
+#include <map>
+#include <set>
 
 #include "expr/term.h"
 #include "expr/term_manager.h"
@@ -35,6 +38,7 @@
 #include "smt/mathsat5/mathsat5.h"
 #include "smt/mathsat5/mathsat5_term_cache.h"
 #include "utils/trace.h"
+#include "utils/budget.h"
 
 #define unused_var(x) { (void)x; }
 
@@ -48,6 +52,8 @@ std::ostream& operator << (std::ostream& out, const msat_term& t) {
   return out;
 }
 
+class mathsat5_model_source;
+
 class mathsat5_internal {
 
   /** The term manager */
@@ -88,6 +94,9 @@ class mathsat5_internal {
   /** Last check return */
   msat_result d_last_check_status;
 
+  /** Assumptions of the last check with assumptions */
+  std::vector<expr::term_ref_strong> d_last_assumptions;
+
   /** The instance */
   size_t d_instance;
 
@@ -106,6 +115,20 @@ class mathsat5_internal {
   /** ITP group B */
   int d_itp_B;
 
+  /** Protects d_searching */
+  boost::mutex d_search_mutex;
+
+  /** Is msat_solve() running */
+  bool d_searching;
+
+  /** Mark the start/end of msat_solve() */
+  void set_searching(bool flag);
+
+  /** Models that still use this instance */
+  std::set<mathsat5_model_source*> d_model_sources;
+
+  friend class mathsat5_model_source;
+
 public:
 
   /** Construct an instance of mathsat5 with the given temr manager and options */
@@ -135,6 +158,18 @@ public:
   /** Check satisfiability */
   solver::result check();
 
+  /** Is the term a Boolean variable or its negation */
+  bool is_literal(expr::term_ref t) const;
+
+  /** Check satisfiability under the assumptions (Boolean literals) */
+  solver::result check(const std::vector<expr::term_ref>& assumptions);
+
+  /** Get the unsat assumptions of the last check with assumptions */
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+
+  /** Stop the search (can be called from another thread) */
+  void interrupt();
+
   /** Check the model when sat */
   void check_model();
 
@@ -163,6 +198,8 @@ public:
   bool supports(solver::feature f) const {
     switch (f) {
     case solver::INTERPOLATION:
+    case solver::ASSUMPTIONS:
+    case solver::INTERRUPT:
       return true;
     case solver::UNSAT_CORE:
       return d_opts.get_bool("mathsat5-unsat-cores");
@@ -183,6 +220,156 @@ public:
 
 int mathsat5_internal::s_instances = 0;
 
+/**
+ * A model kept in mathsat5. Values are converted when asked for, and formulas
+ * are evaluated by mathsat5 while the solver instance is alive. When the
+ * instance is destroyed, the remaining values are converted and the mathsat5
+ * model is released.
+ */
+class mathsat5_model_source : public expr::model_source {
+
+  /** The solver instance, null once destroyed */
+  mathsat5_internal* d_internal;
+
+  expr::term_manager& d_tm;
+
+  /** The mathsat5 model, valid while attached */
+  msat_model d_model;
+
+  typedef std::map<expr::term_ref, msat_term> variable_map;
+
+  /** The variables of the model */
+  variable_map d_variables;
+
+  /** Values converted before the solver went away */
+  expr::model::term_to_value_map d_values;
+
+  /** Convert the value of the variable from the mathsat5 model */
+  expr::value convert_value(expr::term_ref var, msat_term m_var) {
+
+    expr::term_ref var_type = d_tm.type_of(var);
+    expr::value var_value;
+
+    msat_term m_value = msat_model_eval(d_model, m_var);
+    if (MSAT_ERROR_TERM(m_value)) {
+      throw exception("Error obtaining value from MathSAT5 model.");
+    }
+
+    msat_env env = d_internal->d_env;
+    switch (d_tm.term_of(var_type).op()) {
+    case expr::TYPE_BOOL: {
+      assert(msat_term_is_true(env, m_value) || msat_term_is_false(env, m_value));
+      var_value = expr::value(msat_term_is_true(env, m_value));
+      break;
+    }
+    case expr::TYPE_INTEGER: {
+      assert(msat_term_is_number(env, m_value));
+      mpq_t value_q;
+      mpq_init(value_q);
+      msat_term_to_number(env, m_value, value_q);
+      // The rational
+      var_value = expr::value(expr::rational(value_q));
+      assert(var_value.get_rational().is_integer());
+      // Clear the temps
+      mpq_clear(value_q);
+      break;
+    }
+    case expr::TYPE_REAL: {
+      assert(msat_term_is_number(env, m_value));
+      mpq_t value;
+      mpq_init(value);
+      msat_term_to_number(env, m_value, value);
+      var_value = expr::value(expr::rational(value));
+      mpq_clear(value);
+      break;
+    }
+    case expr::TYPE_BITVECTOR: {
+      assert(msat_term_is_number(env, m_value));
+      mpq_t value_q;
+      mpq_init(value_q);
+      msat_term_to_number(env, m_value, value_q);
+      // The rational
+      expr::rational rational_value(value_q);
+      assert(rational_value.is_integer());
+      expr::bitvector bv_value(d_tm.get_bitvector_type_size(var_type), rational_value.get_numerator());
+      var_value = expr::value(bv_value);
+      // Clear the temps
+      mpq_clear(value_q);
+      break;
+    }
+    default:
+      assert(false);
+    }
+
+    return var_value;
+  }
+
+public:
+
+  mathsat5_model_source(mathsat5_internal* internal, msat_model model)
+  : d_internal(internal)
+  , d_tm(internal->d_tm)
+  , d_model(model)
+  {
+    d_internal->d_model_sources.insert(this);
+  }
+
+  ~mathsat5_model_source() {
+    if (d_internal) {
+      d_internal->d_model_sources.erase(this);
+      msat_destroy_model(d_model);
+    }
+  }
+
+  /** The solver instance is going away, convert what's left */
+  void detach() {
+    variable_map::const_iterator it = d_variables.begin();
+    for (; it != d_variables.end(); ++ it) {
+      if (d_values.find(it->first) == d_values.end()) {
+        d_values[it->first] = convert_value(it->first, it->second);
+      }
+    }
+    msat_destroy_model(d_model);
+    d_internal = 0;
+  }
+
+  void add_variable(expr::term_ref var, msat_term m_var) {
+    d_variables[var] = m_var;
+  }
+
+  expr::value get_value(expr::term_ref var) {
+    if (d_internal == 0) {
+      expr::model::term_to_value_map::const_iterator find = d_values.find(var);
+      assert(find != d_values.end());
+      return find->second;
+    }
+    variable_map::const_iterator find = d_variables.find(var);
+    assert(find != d_variables.end());
+    return convert_value(var, find->second);
+  }
+
+  bool is_true(expr::term_ref f, bool& result) {
+    if (d_internal == 0) {
+      return false;
+    }
+    msat_term m_f = d_internal->to_mathsat5_term(f);
+    msat_term m_value = msat_model_eval(d_model, m_f);
+    if (MSAT_ERROR_TERM(m_value)) {
+      return false;
+    }
+    msat_env env = d_internal->d_env;
+    if (msat_term_is_true(env, m_value)) {
+      result = true;
+      return true;
+    }
+    if (msat_term_is_false(env, m_value)) {
+      result = false;
+      return true;
+    }
+    return false;
+  }
+};
+
 mathsat5_internal::mathsat5_internal(expr::term_manager& tm, const options& opts)
 : d_tm(tm)
 , d_opts(opts)
@@ -191,6 +378,7 @@ mathsat5_internal::mathsat5_internal(expr::term_manager& tm, const options& opts
 , d_term_cache(mathsat5_term_cache::get_cache(tm))
 , d_itp_A(0)
 , d_itp_B(0)
+, d_searching(false)
 {
 
   s_instances ++;
@@ -245,6 +433,12 @@ mathsat5_internal::mathsat5_internal(expr::term_manager& tm, const options& opts
 }
 
 mathsat5_internal::~mathsat5_internal() {
+  // Models take what they still need
+  std::set<mathsat5_model_source*>::const_iterator it = d_model_sources.begin();
+  for (; it != d_model_sources.end(); ++ it) {
+    (*it)->detach();
+  }
+
   msat_destroy_env(d_env);
   msat_destroy_config(d_cfg);
 
@@ -883,8 +1077,23 @@ void mathsat5_internal::add(expr::term_ref ref, solver::formula_class f_class) {
   d_last_check_status = MSAT_UNKNOWN;
 }
 
+void mathsat5_internal::set_searching(bool flag) {
+  boost::mutex::scoped_lock lock(d_search_mutex);
+  d_searching = flag;
+}
+
+void mathsat5_internal::interrupt() {
+  // Only during the search, otherwise the request could stop the next one
+  boost::mutex::scoped_lock lock(d_search_mutex);
+  if (d_searching) {
+    msat_request_termination(d_env);
+  }
+}
+
 solver::result mathsat5_internal::check() {
+  set_searching(true);
   d_last_check_status = msat_solve(d_env);
+  set_searching(false);
 
   switch (d_last_check_status) {
   case MSAT_UNKNOWN:
@@ -900,6 +1109,64 @@ solver::result mathsat5_internal::check() {
   return solver::UNKNOWN;
 }
 
+bool mathsat5_internal::is_literal(expr::term_ref t) const {
+  const expr::term& t_term = d_tm.term_of(t);
+  if (t_term.op() == expr::TERM_NOT) {
+    return is_literal(t_term[0]);
+  }
+  return t_term.op() == expr::VARIABLE && d_tm.type_of(t) == d_tm.boolean_type();
+}
+
+solver::result mathsat5_internal::check(const std::vector<expr::term_ref>& assumptions) {
+
+  d_last_assumptions.clear();
+  std::vector<msat_term> msat_assumptions;
+  for (size_t i = 0; i < assumptions.size(); ++ i) {
+    assert(is_literal(assumptions[i]));
+    d_last_assumptions.push_back(expr::term_ref_strong(d_tm, assumptions[i]));
+    msat_assumptions.push_back(to_mathsat5_term(assumptions[i]));
+  }
+
+  set_searching(true);
+  d_last_check_status = msat_solve_with_assumptions(d_env, msat_assumptions.empty() ? 0 : &msat_assumptions[0], msat_assumptions.size());
+  set_searching(false);
+
+  switch (d_last_check_status) {
+  case MSAT_UNKNOWN:
+    return solver::UNKNOWN;
+  case MSAT_UNSAT:
+    return solver::UNSAT;
+  case MSAT_SAT:
+    return solver::SAT;
+  default:
+    throw exception("MathSAT error (check with assumptions).");
+  }
+
+  return solver::UNKNOWN;
+}
+
+void mathsat5_internal::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  assert(d_last_check_status == MSAT_UNSAT);
+
+  size_t core_size = 0;
+  msat_term* core = msat_get_unsat_assumptions(d_env, &core_size);
+  if (core == 0) {
+    throw exception("MathSAT error (unsat assumptions).");
+  }
+
+  for (size_t i = 0; i < d_last_assumptions.size(); ++ i) {
+    msat_term assumption = to_mathsat5_term(d_last_assumptions[i]);
+    for (size_t j = 0; j < core_size; ++ j) {
+      if (msat_term_id(core[j]) == msat_term_id(assumption)) {
+        out.push_back(d_last_assumptions[i]);
+        break;
+      }
+    }
+  }
+
+  msat_free(core);
+}
+
 void mathsat5_internal::check_model() {
   std::cerr << "Checking model" << std::endl;
   assert(d_last_check_status == MSAT_SAT);
@@ -920,9 +1187,10 @@ void mathsat5_internal::check_model() {
   // Get the model
   expr::model::ref m = get_model();
 
-  // Go through the assertions and evaluate
+  // Go through the assertions and evaluate (ourselves, not in mathsat)
+  expr::term_manager::substitution_map no_renaming;
   for (size_t i = 0; i < d_assertions.size(); ++ i) {
-    if (!m->is_true(d_assertions[i])) {
+    if (!m->is_true(d_assertions[i], no_renaming)) {
       throw exception("Check error: an assertion is false in the obtained model!");
     }
   }
@@ -936,63 +1204,20 @@ expr::model::ref mathsat5_internal::get_model() {
   expr::model::ref m = new expr::model(d_tm, false);
 
   // Get the model from mathsat
-  for (size_t i = 0; i < d_variables.size(); ++ i) {
-    expr::term_ref var = d_variables[i];
-    expr::term_ref var_type = d_tm.type_of(var);
-    expr::value var_value;
-
-    msat_term m_var = to_mathsat5_term(var);
-    msat_term m_value = msat_get_model_value(d_env, m_var);
-    assert(!MSAT_ERROR_TERM(m_value));
+  msat_model m_model = msat_get_model(d_env);
+  if (MSAT_ERROR_MODEL(m_model)) {
+    throw exception("Error obtaining MathSAT5 model.");
+  }
 
-    switch (d_tm.term_of(var_type).op()) {
-    case expr::TYPE_BOOL: {
-      assert(msat_term_is_true(d_env, m_value) || msat_term_is_false(d_env, m_value));
-      var_value = expr::value(msat_term_is_true(d_env, m_value));
-      break;
-    }
-    case expr::TYPE_INTEGER: {
-      assert(msat_term_is_number(d_env, m_value));
-      mpq_t value_q;
-      mpq_init(value_q);
-      msat_term_to_number(d_env, m_value, value_q);
-      // The rational
-      var_value = expr::value(expr::rational(value_q));
-      assert(var_value.get_rational().is_integer());
-      // Clear the temps
-      mpq_clear(value_q);
-      break;
-    }
-    case expr::TYPE_REAL: {
-      assert(msat_term_is_number(d_env, m_value));
-      mpq_t value;
-      mpq_init(value);
-      msat_term_to_number(d_env, m_value, value);
-      var_value = expr::value(expr::rational(value));
-      mpq_clear(value);
-      break;
-    }
-    case expr::TYPE_BITVECTOR: {
-      assert(msat_term_is_number(d_env, m_value));
-      mpq_t value_q;
-      mpq_init(value_q);
-      msat_term_to_number(d_env, m_value, value_q);
-      // The rational
-      expr::rational rational_value(value_q);
-      assert(rational_value.is_integer());
-      expr::bitvector bv_value(d_tm.get_bitvector_type_size(var_type), rational_value.get_numerator());
-      var_value = expr::value(bv_value);
-      // Clear the temps
-      mpq_clear(value_q);
-      break;
-    }
-    default:
-      assert(false);
-    }
+  // The source keeps the mathsat model
+  mathsat5_model_source* source = new mathsat5_model_source(this, m_model);
+  expr::model_source::ref source_ref(source);
 
-    // Add the association
-    m->set_variable_value(var, var_value);
+  // Values are obtained on demand
+  for (size_t i = 0; i < d_variables.size(); ++ i) {
+    source->add_variable(d_variables[i], to_mathsat5_term(d_variables[i]));
   }
+  m->set_source(source_ref, d_variables);
 
   return m;
 }
@@ -1139,6 +1364,7 @@ void mathsat5_internal::gc() {
 
 void mathsat5_internal::gc_collect(const expr::gc_relocator& gc_reloc) {
   gc_reloc.reloc(d_assertions);
+  gc_reloc.reloc(d_last_assumptions);
   gc_reloc.reloc(d_bv1);
   gc_reloc.reloc(d_bv0);
   gc_reloc.reloc(d_variables);
@@ -1146,6 +1372,7 @@ void mathsat5_internal::gc_collect(const expr::gc_relocator& gc_reloc) {
 
 mathsat5::mathsat5(expr::term_manager& tm, const options& opts, utils::statistics& stats)
 : solver("mathsat5", tm, opts, stats)
+, d_native_assumptions(false)
 {
   d_internal = new mathsat5_internal(tm, opts);
 }
@@ -1161,9 +1388,38 @@ void mathsat5::add(expr::term_ref f, formula_class f_class) {
 
 solver::result mathsat5::check() {
   TRACE("mathsat5") << "mathsat5[" << d_internal->instance() << "]: check()" << std::endl;
+  utils::budget::check();
   return d_internal->check();
 }
 
+solver::result mathsat5::check_with_assumptions(const std::vector<expr::term_ref>& assumptions) {
+  // MathSAT only takes Boolean literals as assumptions, emulate otherwise
+  for (size_t i = 0; i < assumptions.size(); ++ i) {
+    if (!d_internal->is_literal(assumptions[i])) {
+      d_native_assumptions = false;
+      return solver::check_with_assumptions(assumptions);
+    }
+  }
+  TRACE("mathsat5") << "mathsat5[" << d_internal->instance() << "]: check() with " << assumptions.size() << " assumptions" << std::endl;
+  utils::budget::check();
+  d_unsat_assumptions.clear();
+  d_native_assumptions = true;
+  return d_internal->check(assumptions);
+}
+
+void mathsat5::interrupt() {
+  d_internal->interrupt();
+}
+
+void mathsat5::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  TRACE("mathsat5") << "mathsat5[" << d_internal->instance() << "]: get_unsat_assumptions()" << std::endl;
+  if (d_native_assumptions) {
+    d_internal->get_unsat_assumptions(out);
+  } else {
+    solver::get_unsat_assumptions(out);
+  }
+}
+
 void mathsat5::check_model() {
   TRACE("mathsat5") << "mathsat5[" << d_internal->instance() << "]: check_model()" << std::endl;
   d_internal->check_model();
@@ -35,6 +35,9 @@ class mathsat5 : public solver {
   /** Internal yices data */
   mathsat5_internal* d_internal;
 
+  /** Was the last check with assumptions native (all literals) */
+  bool d_native_assumptions;
+
 public:
 
   /** Constructor */
@@ -73,11 +76,22 @@ public:
   /** Unsat core of the last UNSAT result */
   void get_unsat_core(std::vector<expr::term_ref>& out);
 
+  /** Unsat assumptions of the last UNSAT check with assumptions */
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+
+  /** Stop a running check */
+  void interrupt();
+
   /** Collect terms */
   void gc_collect(const expr::gc_relocator& gc_reloc);
 
   /** Collect garbage */
   void gc();
+
+protected:
+
+  /** Check the assertions with the assumptions (native for Boolean literals) */
+  result check_with_assumptions(const std::vector<expr::term_ref>& assumptions);
 };
 
 }
@@ -22,6 +22,7 @@
 #include "smt/opensmt2/opensmt2_internal.h"
 
 #include "utils/trace.h"
+#include "utils/budget.h"
 
 
 #define unused_var(x) { (void) x; }
@@ -51,6 +52,7 @@ void opensmt2::add_variable(expr::term_ref var, variable_class f_class) {
 
 solver::result opensmt2::check() {
   TRACE("opensmt2")<< "opensmt2[" << d_internal->instance() << "]: check()" << std::endl;
+  utils::budget::check();
   return d_internal->check();
 }
 
@@ -0,0 +1,299 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "smt/smt2_log.h"
+#include "expr/gc_relocator.h"
+#include "utils/exception.h"
+
+#include <boost/version.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#if BOOST_VERSION >= 107000
+#include <boost/iostreams/filter/zstd.hpp>
+#endif
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/once.hpp>
+#include <boost/bind/bind.hpp>
+
+#include <deque>
+#include <fstream>
+
+namespace sally {
+namespace smt {
+
+/** Commands above this size are handed to the writer right away */
+static const std::streamoff max_buffered = 1 << 16;
+
+/**
+ * The thread writing (and compressing) the logs, shared by all logs. It's
+ * never destroyed, the logs wait for their commands to be written.
+ */
+class smt2_log_writer {
+
+  struct chunk {
+    smt2_log* log;
+    std::string text;
+  };
+
+  /** Protects the chunks and the queued counts of the logs */
+  boost::mutex d_mutex;
+
+  /** Signaled when a chunk is added or written */
+  boost::condition_variable d_cond;
+
+  /** Chunks to write */
+  std::deque<chunk> d_chunks;
+
+  /** The writing thread */
+  boost::thread d_thread;
+
+  /** Body of the writing thread */
+  void run();
+
+  /** The writer */
+  static smt2_log_writer* s_writer;
+
+  /** To create the writer once */
+  static boost::once_flag s_writer_once;
+
+  static void create() {
+    s_writer = new smt2_log_writer();
+  }
+
+  smt2_log_writer()
+  : d_thread(boost::bind(&smt2_log_writer::run, this))
+  {}
+
+public:
+
+  /** Get the writer */
+  static smt2_log_writer& get() {
+    boost::call_once(s_writer_once, &smt2_log_writer::create);
+    return *s_writer;
+  }
+
+  /** Write the text to the log (the text is taken) */
+  void write(smt2_log* log, std::string& text);
+
+  /** Wait for all the chunks of the log to be written */
+  void wait(smt2_log* log);
+};
+
+smt2_log_writer* smt2_log_writer::s_writer = 0;
+boost::once_flag smt2_log_writer::s_writer_once = BOOST_ONCE_INIT;
+
+void smt2_log_writer::run() {
+  for (;;) {
+    chunk c;
+    {
+      boost::mutex::scoped_lock lock(d_mutex);
+      while (d_chunks.empty()) {
+        d_cond.wait(lock);
+      }
+      c.log = d_chunks.front().log;
+      c.text.swap(d_chunks.front().text);
+      d_chunks.pop_front();
+    }
+    c.log->d_file << c.text;
+    {
+      boost::mutex::scoped_lock lock(d_mutex);
+      c.log->d_queued --;
+      d_cond.notify_all();
+    }
+  }
+}
+
+void smt2_log_writer::write(smt2_log* log, std::string& text) {
+  boost::mutex::scoped_lock lock(d_mutex);
+  d_chunks.push_back(chunk());
+  d_chunks.back().log = log;
+  d_chunks.back().text.swap(text);
+  log->d_queued ++;
+  d_cond.notify_all();
+}
+
+void smt2_log_writer::wait(smt2_log* log) {
+  boost::mutex::scoped_lock lock(d_mutex);
+  while (log->d_queued > 0) {
+    d_cond.wait(lock);
+  }
+}
+
+smt2_log::smt2_log(std::string filename, compression c)
+: d_queued(0)
+{
+  switch (c) {
+  case COMPRESSION_NONE:
+    break;
+  case COMPRESSION_GZIP:
+    d_file.push(boost::iostreams::gzip_compressor());
+    break;
+  case COMPRESSION_ZSTD:
+#if BOOST_VERSION >= 107000
+    d_file.push(boost::iostreams::zstd_compressor());
+    break;
+#else
+    throw exception("zstd compression needs Boost 1.70 or later");
+#endif
+  }
+  filename += get_extension(c);
+  boost::iostreams::file_sink file(filename, std::ios_base::out | std::ios_base::binary);
+  if (!file.is_open()) {
+    throw exception("could not open " + filename);
+  }
+  d_file.push(file);
+}
+
+smt2_log::~smt2_log() {
+  flush();
+  smt2_log_writer::get().wait(this);
+  // Finishes the compression
+  d_file.reset();
+}
+
+void smt2_log::flush() {
+  std::string text = d_buffer.str();
+  if (!text.empty()) {
+    d_buffer.str(std::string());
+    smt2_log_writer::get().write(this, text);
+  }
+}
+
+void smt2_log::flush_if_full() {
+  if (d_buffer.tellp() > max_buffered) {
+    flush();
+  }
+}
+
+smt2_log::compression smt2_log::get_compression(std::string name) {
+  if (name == "none") {
+    return COMPRESSION_NONE;
+  }
+  if (name == "gzip") {
+    return COMPRESSION_GZIP;
+  }
+  if (name == "zstd") {
+    return COMPRESSION_ZSTD;
+  }
+  throw exception("unknown compression " + name + " (must be one of none, gzip, zstd)");
+}
+
+smt2_log::compression smt2_log::get_compression(const options& opts, std::string option) {
+  if (opts.has_option(option)) {
+    return get_compression(opts.get_string(option));
+  } else {
+    return COMPRESSION_NONE;
+  }
+}
+
+std::string smt2_log::get_extension(compression c) {
+  switch (c) {
+  case COMPRESSION_GZIP:
+    return ".gz";
+  case COMPRESSION_ZSTD:
+    return ".zst";
+  default:
+    return "";
+  }
+}
+
+void smt2_log::open_input(boost::iostreams::filtering_istream& in, std::string filename) {
+  size_t dot = filename.find_last_of('.');
+  std::string extension = dot == std::string::npos ? "" : filename.substr(dot);
+  if (extension == get_extension(COMPRESSION_GZIP)) {
+    in.push(boost::iostreams::gzip_decompressor());
+  } else if (extension == get_extension(COMPRESSION_ZSTD)) {
+#if BOOST_VERSION >= 107000
+    in.push(boost::iostreams::zstd_decompressor());
+#else
+    throw exception("zstd compression needs Boost 1.70 or later");
+#endif
+  }
+  boost::iostreams::file_source file(filename, std::ios_base::in | std::ios_base::binary);
+  if (!file.is_open()) {
+    throw exception("could not open " + filename);
+  }
+  in.push(file);
+}
+
+smt2_definitions::smt2_definitions(expr::term_manager& tm, std::string prefix)
+: d_tm(tm)
+, d_prefix(prefix)
+, d_count(0)
+{}
+
+void smt2_definitions::define(std::ostream& out, expr::term_ref t) {
+  // Collect the new subterms, children first
+  std::vector<expr::term_ref> definitions;
+  d_tm.term_of(t).mk_let_cache(d_tm, d_names, definitions);
+  d_tm.reset_fresh_variables();
+  // Name and define them
+  for (size_t i = 0; i < definitions.size(); ++ i) {
+    expr::term_ref def = definitions[i];
+    std::stringstream ss;
+    ss << d_prefix << d_count ++;
+    d_names[def] = ss.str();
+    d_defined.push_back(def);
+    out << "(define-fun " << ss.str() << " () " << d_tm.type_of(def) << " ";
+    d_tm.term_of(def).to_stream_smt_without_let(out, d_tm, d_names, false);
+    out << ")" << std::endl;
+  }
+}
+
+void smt2_definitions::print(std::ostream& out, expr::term_ref t) const {
+  d_tm.term_of(t).to_stream_smt_without_let(out, d_tm, d_names, true);
+}
+
+void smt2_definitions::push() {
+  d_defined_size.push_back(d_defined.size());
+}
+
+void smt2_definitions::pop() {
+  assert(d_defined_size.size() > 0);
+  size_t size = d_defined_size.back();
+  d_defined_size.pop_back();
+  while (d_defined.size() > size) {
+    d_names.erase(d_defined.back());
+    d_defined.pop_back();
+  }
+}
+
+void smt2_definitions::gc_collect(const expr::gc_relocator& gc_reloc) {
+  // Collected terms are forgotten, their definitions stay in the stream but
+  // nobody refers to them anymore
+  expr::term::expr_let_cache names;
+  for (size_t i = 0; i < d_defined.size(); ++ i) {
+    expr::term_ref t = d_defined[i];
+    if (t.is_null()) {
+      continue;
+    }
+    std::string name = d_names[t];
+    if (gc_reloc.reloc(t)) {
+      names[t] = name;
+      d_defined[i] = t;
+    } else {
+      d_defined[i] = expr::term_ref();
+    }
+  }
+  d_names.swap(names);
+}
+
+}
+}
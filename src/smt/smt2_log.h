@@ -0,0 +1,144 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "expr/term.h"
+#include "expr/term_manager.h"
+#include "utils/options.h"
+
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sally {
+
+namespace expr {
+  class gc_relocator;
+}
+
+namespace smt {
+
+/**
+ * A log file of SMT2 commands. Commands are written to stream() and handed
+ * to a background thread (shared by all logs) on flush(), which writes them
+ * to the file, compressed if asked for. The file is complete once the log is
+ * destroyed.
+ */
+class smt2_log {
+
+public:
+
+  enum compression {
+    COMPRESSION_NONE,
+    COMPRESSION_GZIP,
+    COMPRESSION_ZSTD
+  };
+
+  /** Open the log, the extension of the compression is added to the name */
+  smt2_log(std::string filename, compression c);
+
+  /** Write everything and close */
+  ~smt2_log();
+
+  /** The stream to write the commands to */
+  std::ostream& stream() { return d_buffer; }
+
+  /** Hand the commands written so far to the writer */
+  void flush();
+
+  /** Hand the commands to the writer if there are enough of them */
+  void flush_if_full();
+
+  /** Get the compression from its name (none, gzip, zstd) */
+  static compression get_compression(std::string name);
+
+  /** Get the compression from the option (none if not set) */
+  static compression get_compression(const options& opts, std::string option);
+
+  /** The file extension of the compression (empty if none) */
+  static std::string get_extension(compression c);
+
+  /** Open a log for reading, decompressed according to the extension */
+  static void open_input(boost::iostreams::filtering_istream& in, std::string filename);
+
+private:
+
+  /** The file (with the compression filter) */
+  boost::iostreams::filtering_ostream d_file;
+
+  /** Commands not yet handed to the writer */
+  std::stringstream d_buffer;
+
+  /** Number of chunks handed to the writer and not yet written */
+  size_t d_queued;
+
+  friend class smt2_log_writer;
+};
+
+/**
+ * Definitions of the subterms printed to an SMT2 stream. Each compound term
+ * is printed once, as a define-fun, and then referred to by name, so shared
+ * terms (e.g. the transition relation) don't get printed over and over. The
+ * definitions follow the push/pop scopes of the stream.
+ */
+class smt2_definitions {
+
+  /** The term manager */
+  expr::term_manager& d_tm;
+
+  /** Names of the defined terms */
+  expr::term::expr_let_cache d_names;
+
+  /** The defined terms, in order of definition */
+  std::vector<expr::term_ref> d_defined;
+
+  /** Number of defined terms per push */
+  std::vector<size_t> d_defined_size;
+
+  /** Prefix of the names */
+  std::string d_prefix;
+
+  /** Number of definitions so far (for the names) */
+  size_t d_count;
+
+public:
+
+  /** Definitions with names starting with the prefix */
+  smt2_definitions(expr::term_manager& tm, std::string prefix);
+
+  /** Print the define-fun commands of the subterms of t not defined yet */
+  void define(std::ostream& out, expr::term_ref t);
+
+  /** Print the term using the definitions (must be defined) */
+  void print(std::ostream& out, expr::term_ref t) const;
+
+  /** Push a scope */
+  void push();
+
+  /** Pop a scope, forgetting the definitions since the push */
+  void pop();
+
+  /** Forget the collected terms */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+};
+
+}
+}
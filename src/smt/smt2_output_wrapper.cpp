@@ -26,7 +26,10 @@ namespace smt {
 smt2_output_wrapper::smt2_output_wrapper(expr::term_manager& tm, const options& opts, utils::statistics& stats, solver* solver, std::string filename)
 : smt::solver("smt2_wrapper[" + filename + "]", tm, opts, stats)
 , d_solver(solver)
-, d_output(filename.c_str())
+, d_log(filename, smt2_log::get_compression(opts, "smt2-output-compression"))
+, d_output(d_log.stream())
+, d_compact(opts.has_option("smt2-output-compact"))
+, d_definitions(tm, "sally!t")
 , d_total_assertions_count(0)
 , d_vars_added(false)
 {
@@ -58,6 +61,20 @@ smt2_output_wrapper::~smt2_output_wrapper() {
   delete d_solver;
 }
 
+void smt2_output_wrapper::define(expr::term_ref f) {
+  if (d_compact) {
+    d_definitions.define(d_output, f);
+  }
+}
+
+void smt2_output_wrapper::print(expr::term_ref f) {
+  if (d_compact) {
+    d_definitions.print(d_output, f);
+  } else {
+    d_output << f;
+  }
+}
+
 bool smt2_output_wrapper::supports(feature f) const {
   return d_solver->supports(f);
 }
@@ -70,11 +87,12 @@ void smt2_output_wrapper::add(expr::term_ref f, formula_class f_class) {
 
   bool needs_annotation = d_solver->supports(solver::UNSAT_CORE) || d_solver->supports(solver::INTERPOLATION);
 
+  define(f);
   d_output << "(assert ";
   if (needs_annotation) {
     d_output << "(! ";
   }
-  d_output << f;
+  print(f);
   if (d_solver->supports(solver::UNSAT_CORE)) {
     d_output << " :named a" << a.index;
   }
@@ -89,33 +107,53 @@ void smt2_output_wrapper::add(expr::term_ref f, formula_class f_class) {
     d_output << ")";
   }
   d_output << ")" << std::endl;
+  d_log.flush_if_full();
 
   d_solver->add(f, f_class);
 }
 
 solver::result smt2_output_wrapper::check() {
   d_output << "(check-sat)" << std::endl;
+  d_log.flush();
   return d_solver->check();
 }
 
+void smt2_output_wrapper::interrupt() {
+  // Not logged, it comes from another thread
+  d_solver->interrupt();
+}
+
+solver::result smt2_output_wrapper::check_with_assumptions(const std::vector<expr::term_ref>& assumptions) {
+  for (size_t i = 0; i < assumptions.size(); ++ i) {
+    define(assumptions[i]);
+  }
+  d_output << "(check-sat-assuming (";
+  for (size_t i = 0; i < assumptions.size(); ++ i) {
+    if (i > 0) { d_output << " "; }
+    print(assumptions[i]);
+  }
+  d_output << "))" << std::endl;
+  d_log.flush();
+  return d_solver->check(assumptions);
+}
+
 expr::model::ref smt2_output_wrapper::get_model() const {
-  std::ofstream& out_nonconst = const_cast<smt2_output_wrapper*>(this)->d_output;
-  out_nonconst << "(get-value (";
+  d_output << "(get-value (";
   std::set<expr::term_ref>::const_iterator it;
   bool space = false;
   for (it = d_A_variables.begin(); it != d_A_variables.end(); ++ it, space = true) {
-    if (space) { out_nonconst << " "; }
-    out_nonconst << *it << std::endl;
+    if (space) { d_output << " "; }
+    d_output << *it << std::endl;
   }
   for (it = d_T_variables.begin(); it != d_T_variables.end(); ++ it, space = true) {
-    if (space) { out_nonconst << " "; }
-    out_nonconst << *it << std::endl;
+    if (space) { d_output << " "; }
+    d_output << *it << std::endl;
   }
   for (it = d_B_variables.begin(); it != d_B_variables.end(); ++ it, space = true) {
-    if (space) { out_nonconst << " "; }
-    out_nonconst << *it << std::endl;
+    if (space) { d_output << " "; }
+    d_output << *it << std::endl;
   }
-  out_nonconst << "))" << std::endl;
+  d_output << "))" << std::endl;
 
   return d_solver->get_model();
 }
@@ -123,6 +161,7 @@ expr::model::ref smt2_output_wrapper::get_model() const {
 void smt2_output_wrapper::push() {
   d_output << "(push 1)" << std::endl;
   d_solver->push();
+  d_definitions.push();
 
   d_assertions_size.push_back(d_assertions.size());
 }
@@ -130,6 +169,7 @@ void smt2_output_wrapper::push() {
 void smt2_output_wrapper::pop() {
   d_output << "(pop 1)" << std::endl;
   d_solver->pop();
+  d_definitions.pop();
 
   size_t size = d_assertions_size.back();
   d_assertions_size.pop_back();
@@ -156,6 +196,11 @@ void smt2_output_wrapper::get_unsat_core(std::vector<expr::term_ref>& out) {
   d_solver->get_unsat_core(out);
 }
 
+void smt2_output_wrapper::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  d_output << "(get-unsat-assumptions)" << std::endl;
+  d_solver->get_unsat_assumptions(out);
+}
+
 void smt2_output_wrapper::add_variable(expr::term_ref var, variable_class f_class) {
   d_output << "(declare-fun " << var << " () " << d_tm.type_of(var) << ")" << std::endl;
   solver::add_variable(var, f_class);
@@ -170,6 +215,8 @@ void smt2_output_wrapper::gc_collect(const expr::gc_relocator& gc_reloc) {
   for (size_t i = 0; i < d_assertions.size(); ++ i) {
     gc_reloc.reloc(d_assertions[i].f);
   }
+  // Collect the definitions
+  d_definitions.gc_collect(gc_reloc);
 }
 
 }
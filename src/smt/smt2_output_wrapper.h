@@ -19,22 +19,38 @@
 #pragma once
 
 #include "smt/solver.h"
-
-#include <fstream>
+#include "smt/smt2_log.h"
 
 namespace sally {
 namespace smt {
 
 /**
- * A solver that wraps another solver and outputs the queries to a file.
+ * A solver that wraps another solver and outputs the queries to a file. In
+ * compact mode, the subterms are defined once with define-fun and then
+ * referred to by name.
  */
 class smt2_output_wrapper : public solver {
 
   /** Solver actually used */
   solver* d_solver;
 
-  /** Output */
-  std::ofstream d_output;
+  /** The log file */
+  smt2_log d_log;
+
+  /** Output (the log stream) */
+  std::ostream& d_output;
+
+  /** Whether to print the terms with definitions */
+  bool d_compact;
+
+  /** Definitions of the printed terms (if compact) */
+  smt2_definitions d_definitions;
+
+  /** Print the definitions needed for f (if compact) */
+  void define(expr::term_ref f);
+
+  /** Print f (with the definitions, if compact) */
+  void print(expr::term_ref f);
 
   /** Total number of assertions */
   int d_total_assertions_count;
@@ -72,9 +88,14 @@ public:
   void generalize(generalization_type type, expr::model::ref m, std::vector<expr::term_ref>& projection_out);
   void interpolate(std::vector<expr::term_ref>& out);
   void get_unsat_core(std::vector<expr::term_ref>& out);
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+  void interrupt();
   void add_variable(expr::term_ref var, variable_class f_class);
   void gc_collect(const expr::gc_relocator& gc_reloc);
 
+protected:
+
+  result check_with_assumptions(const std::vector<expr::term_ref>& assumptions);
 };
 
 }
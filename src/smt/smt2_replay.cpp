@@ -0,0 +1,590 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "smt/smt2_replay.h"
+#include "expr/term_manager.h"
+#include "expr/rational.h"
+#include "expr/bitvector.h"
+#include "utils/exception.h"
+#include "utils/trace.h"
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+namespace sally {
+namespace smt {
+
+smt2_replay::smt2_replay(expr::term_manager& tm, std::istream& in)
+: d_tm(tm)
+, d_checks(0)
+, d_in(in)
+, d_line(1)
+{
+  sexpr e;
+  while (read(e)) {
+    process(e);
+    e = sexpr();
+  }
+  // Symbols are only needed for reading
+  d_symbols.clear();
+}
+
+void smt2_replay::error(const std::string& message) const {
+  std::stringstream ss;
+  ss << "smt2 log, line " << d_line << ": " << message;
+  throw exception(ss.str());
+}
+
+bool smt2_replay::read_token(std::string& token) {
+  token.clear();
+  int c;
+  // Skip the whitespace and comments
+  for (c = d_in.get(); c != EOF; c = d_in.get()) {
+    if (c == '\n') {
+      d_line ++;
+    } else if (c == ';') {
+      while (c != EOF && c != '\n') {
+        c = d_in.get();
+      }
+      d_line ++;
+    } else if (!isspace(c)) {
+      break;
+    }
+  }
+  if (c == EOF) {
+    return false;
+  }
+  switch (c) {
+  case '(':
+  case ')':
+    token.push_back(c);
+    break;
+  case '|':
+    // Quoted symbol, same as the unquoted one
+    for (c = d_in.get(); c != EOF && c != '|'; c = d_in.get()) {
+      if (c == '\n') { d_line ++; }
+      token.push_back(c);
+    }
+    if (c == EOF) {
+      error("unterminated quoted symbol");
+    }
+    break;
+  case '"':
+    // String literal, with the quotes
+    token.push_back(c);
+    for (c = d_in.get(); c != EOF; c = d_in.get()) {
+      if (c == '\n') { d_line ++; }
+      token.push_back(c);
+      if (c == '"') {
+        if (d_in.peek() != '"') {
+          break;
+        }
+        token.push_back(d_in.get());
+      }
+    }
+    if (c == EOF) {
+      error("unterminated string literal");
+    }
+    break;
+  default:
+    token.push_back(c);
+    for (c = d_in.peek(); c != EOF && !isspace(c) && c != '(' && c != ')' && c != ';' && c != '|'; c = d_in.peek()) {
+      token.push_back(d_in.get());
+    }
+  }
+  return true;
+}
+
+bool smt2_replay::read(sexpr& e) {
+  std::string token;
+  if (!read_token(token)) {
+    return false;
+  }
+  read(e, token);
+  return true;
+}
+
+void smt2_replay::read(sexpr& e, std::string& token) {
+  if (token == ")") {
+    error("unexpected )");
+  }
+  if (token != "(") {
+    e.atom.swap(token);
+    return;
+  }
+  e.is_list = true;
+  for (;;) {
+    if (!read_token(token)) {
+      error("unexpected end of input");
+    }
+    if (token == ")") {
+      return;
+    }
+    e.children.push_back(sexpr());
+    read(e.children.back(), token);
+  }
+}
+
+expr::term_ref smt2_replay::to_type(const sexpr& e) {
+  if (!e.is_list) {
+    if (e.atom == "Bool") { return d_tm.boolean_type(); }
+    if (e.atom == "Int") { return d_tm.integer_type(); }
+    if (e.atom == "Real") { return d_tm.real_type(); }
+  } else if (e.children.size() == 3 && e.children[0].atom == "_" && e.children[1].atom == "BitVec") {
+    return d_tm.bitvector_type(atoi(e.children[2].atom.c_str()));
+  } else if (e.children.size() == 3 && e.children[0].atom == "Array") {
+    return d_tm.array_type(to_type(e.children[1]), to_type(e.children[2]));
+  }
+  error("unsupported type");
+  return expr::term_ref();
+}
+
+/** The operators that map to a term directly */
+static const std::map<std::string, expr::term_op>& get_operators() {
+  static std::map<std::string, expr::term_op> ops;
+  if (ops.empty()) {
+    ops["="] = expr::TERM_EQ;
+    ops["and"] = expr::TERM_AND;
+    ops["or"] = expr::TERM_OR;
+    ops["not"] = expr::TERM_NOT;
+    ops["=>"] = expr::TERM_IMPLIES;
+    ops["xor"] = expr::TERM_XOR;
+    ops["ite"] = expr::TERM_ITE;
+    ops["+"] = expr::TERM_ADD;
+    ops["-"] = expr::TERM_SUB;
+    ops["*"] = expr::TERM_MUL;
+    ops["/"] = expr::TERM_DIV;
+    ops["%"] = expr::TERM_MOD;
+    ops["<="] = expr::TERM_LEQ;
+    ops["<"] = expr::TERM_LT;
+    ops[">="] = expr::TERM_GEQ;
+    ops[">"] = expr::TERM_GT;
+    ops["to_int"] = expr::TERM_TO_INT;
+    ops["to_real"] = expr::TERM_TO_REAL;
+    ops["is_int"] = expr::TERM_IS_INT;
+    ops["bvadd"] = expr::TERM_BV_ADD;
+    ops["bvsub"] = expr::TERM_BV_SUB;
+    ops["bvneg"] = expr::TERM_BV_SUB;
+    ops["bvmul"] = expr::TERM_BV_MUL;
+    ops["bvxor"] = expr::TERM_BV_XOR;
+    ops["bvshl"] = expr::TERM_BV_SHL;
+    ops["bvlshr"] = expr::TERM_BV_LSHR;
+    ops["bvashr"] = expr::TERM_BV_ASHR;
+    ops["bvnot"] = expr::TERM_BV_NOT;
+    ops["bvand"] = expr::TERM_BV_AND;
+    ops["bvor"] = expr::TERM_BV_OR;
+    ops["bvnand"] = expr::TERM_BV_NAND;
+    ops["bvnor"] = expr::TERM_BV_NOR;
+    ops["bvxnor"] = expr::TERM_BV_XNOR;
+    ops["concat"] = expr::TERM_BV_CONCAT;
+    ops["bvule"] = expr::TERM_BV_ULEQ;
+    ops["bvsle"] = expr::TERM_BV_SLEQ;
+    ops["bvult"] = expr::TERM_BV_ULT;
+    ops["bvslt"] = expr::TERM_BV_SLT;
+    ops["bvuge"] = expr::TERM_BV_UGEQ;
+    ops["bvsge"] = expr::TERM_BV_SGEQ;
+    ops["bvugt"] = expr::TERM_BV_UGT;
+    ops["bvsgt"] = expr::TERM_BV_SGT;
+    ops["bvudiv"] = expr::TERM_BV_UDIV;
+    ops["bvsdiv"] = expr::TERM_BV_SDIV;
+    ops["bvurem"] = expr::TERM_BV_UREM;
+    ops["bvsrem"] = expr::TERM_BV_SREM;
+    ops["bvsmod"] = expr::TERM_BV_SMOD;
+    ops["select"] = expr::TERM_ARRAY_READ;
+    ops["store"] = expr::TERM_ARRAY_WRITE;
+  }
+  return ops;
+}
+
+expr::term_ref smt2_replay::to_term(const std::string& op, const std::vector<expr::term_ref>& args) {
+
+  if (op == "distinct") {
+    std::vector<expr::term_ref> diseqs;
+    for (size_t i = 0; i < args.size(); ++ i) {
+      for (size_t j = i + 1; j < args.size(); ++ j) {
+        diseqs.push_back(d_tm.mk_not(d_tm.mk_term(expr::TERM_EQ, args[i], args[j])));
+      }
+    }
+    return d_tm.mk_and(diseqs);
+  }
+
+  std::map<std::string, expr::term_op>::const_iterator find = get_operators().find(op);
+  if (find == get_operators().end()) {
+    error("unsupported operator " + op);
+  }
+  expr::term_op term_op = find->second;
+
+  switch (term_op) {
+  case expr::TERM_SUB:
+    // Constants are printed as (- 1)
+    if (args.size() == 1 && d_tm.term_of(args[0]).op() == expr::CONST_RATIONAL) {
+      return d_tm.mk_rational_constant(d_tm.get_rational_constant(d_tm.term_of(args[0])).negate());
+    }
+    // Binary, left associative
+    if (args.size() > 2) {
+      expr::term_ref result = args[0];
+      for (size_t i = 1; i < args.size(); ++ i) {
+        result = d_tm.mk_term(expr::TERM_SUB, result, args[i]);
+      }
+      return result;
+    }
+    break;
+  case expr::TERM_DIV:
+    // Constants are printed as (/ 1 2)
+    if (args.size() == 2 && d_tm.term_of(args[0]).op() == expr::CONST_RATIONAL && d_tm.term_of(args[1]).op() == expr::CONST_RATIONAL) {
+      expr::rational num = d_tm.get_rational_constant(d_tm.term_of(args[0]));
+      expr::rational den = d_tm.get_rational_constant(d_tm.term_of(args[1]));
+      if (den.sgn() != 0) {
+        return d_tm.mk_rational_constant(num / den);
+      }
+    }
+    break;
+  case expr::TERM_EQ:
+    // Chained
+    if (args.size() > 2) {
+      std::vector<expr::term_ref> eqs;
+      for (size_t i = 0; i + 1 < args.size(); ++ i) {
+        eqs.push_back(d_tm.mk_term(expr::TERM_EQ, args[i], args[i+1]));
+      }
+      return d_tm.mk_and(eqs);
+    }
+    break;
+  case expr::TERM_IMPLIES:
+    // Right associative
+    if (args.size() > 2) {
+      expr::term_ref result = args.back();
+      for (size_t i = args.size() - 1; i > 0; -- i) {
+        result = d_tm.mk_term(expr::TERM_IMPLIES, args[i-1], result);
+      }
+      return result;
+    }
+    break;
+  case expr::TERM_ARRAY_READ:
+    if (args.size() == 2) {
+      return d_tm.mk_array_read(args[0], args[1]);
+    }
+    break;
+  case expr::TERM_ARRAY_WRITE:
+    if (args.size() == 3) {
+      return d_tm.mk_array_write(args[0], args[1], args[2]);
+    }
+    break;
+  default:
+    break;
+  }
+
+  return d_tm.mk_term(term_op, args);
+}
+
+expr::term_ref smt2_replay::to_term(const sexpr& e) {
+
+  if (!e.is_list) {
+    const std::string& atom = e.atom;
+    if (atom.empty()) {
+      error("empty term");
+    }
+    // Symbols
+    std::map<std::string, expr::term_ref_strong>::const_iterator find = d_symbols.find(atom);
+    if (find != d_symbols.end()) {
+      return find->second;
+    }
+    if (atom == "true") {
+      return d_tm.mk_boolean_constant(true);
+    }
+    if (atom == "false") {
+      return d_tm.mk_boolean_constant(false);
+    }
+    // Numerals and decimals
+    if (isdigit(atom[0])) {
+      size_t dot = atom.find('.');
+      if (dot == std::string::npos) {
+        return d_tm.mk_rational_constant(expr::rational(atom));
+      }
+      std::string num = atom.substr(0, dot) + atom.substr(dot + 1);
+      std::string den = "1" + std::string(atom.size() - dot - 1, '0');
+      return d_tm.mk_rational_constant(expr::rational(num + "/" + den));
+    }
+    // Bit-vectors
+    if (atom.size() > 2 && atom[0] == '#' && atom[1] == 'b') {
+      return d_tm.mk_bitvector_constant(expr::bitvector(atom.substr(2)));
+    }
+    if (atom.size() > 2 && atom[0] == '#' && atom[1] == 'x') {
+      expr::integer value(atom.substr(2), 16);
+      return d_tm.mk_bitvector_constant(expr::bitvector(4*(atom.size() - 2), value));
+    }
+    error("unknown symbol " + atom);
+  }
+
+  if (e.children.empty()) {
+    error("empty term");
+  }
+
+  const sexpr& head = e.children[0];
+
+  if (!head.is_list) {
+
+    // (let ((x t) ...) body), the bindings are parallel
+    if (head.atom == "let" && e.children.size() == 3 && e.children[1].is_list) {
+      const std::vector<sexpr>& bindings = e.children[1].children;
+      std::vector<expr::term_ref_strong> values;
+      for (size_t i = 0; i < bindings.size(); ++ i) {
+        if (!bindings[i].is_list || bindings[i].children.size() != 2) {
+          error("malformed let");
+        }
+        values.push_back(expr::term_ref_strong(d_tm, to_term(bindings[i].children[1])));
+      }
+      // Bind, remembering the shadowed symbols
+      std::vector<std::pair<std::string, expr::term_ref_strong> > shadowed;
+      std::vector<std::string> fresh;
+      for (size_t i = 0; i < bindings.size(); ++ i) {
+        const std::string& name = bindings[i].children[0].atom;
+        std::map<std::string, expr::term_ref_strong>::iterator find = d_symbols.find(name);
+        if (find != d_symbols.end()) {
+          shadowed.push_back(*find);
+          find->second = values[i];
+        } else {
+          fresh.push_back(name);
+          d_symbols[name] = values[i];
+        }
+      }
+      expr::term_ref body = to_term(e.children[2]);
+      expr::term_ref_strong body_strong(d_tm, body);
+      for (size_t i = 0; i < fresh.size(); ++ i) {
+        d_symbols.erase(fresh[i]);
+      }
+      for (size_t i = 0; i < shadowed.size(); ++ i) {
+        d_symbols[shadowed[i].first] = shadowed[i].second;
+      }
+      return body_strong;
+    }
+
+    // (! t annotations)
+    if (head.atom == "!" && e.children.size() >= 2) {
+      return to_term(e.children[1]);
+    }
+
+    // (_ bvN size)
+    if (head.atom == "_" && e.children.size() == 3 && e.children[1].atom.compare(0, 2, "bv") == 0) {
+      expr::integer value(e.children[1].atom.substr(2), 10);
+      size_t size = atoi(e.children[2].atom.c_str());
+      return d_tm.mk_bitvector_constant(expr::bitvector(size, value));
+    }
+
+    // Regular application
+    std::vector<expr::term_ref> args;
+    std::vector<expr::term_ref_strong> args_strong;
+    for (size_t i = 1; i < e.children.size(); ++ i) {
+      args_strong.push_back(expr::term_ref_strong(d_tm, to_term(e.children[i])));
+      args.push_back(args_strong.back());
+    }
+    return to_term(head.atom, args);
+  }
+
+  // ((_ op indices) t)
+  if (head.children.size() >= 2 && head.children[0].atom == "_" && e.children.size() == 2) {
+    const std::string& op = head.children[1].atom;
+    expr::term_ref t = to_term(e.children[1]);
+    if (op == "extract" && head.children.size() == 4) {
+      size_t high = atoi(head.children[2].atom.c_str());
+      size_t low = atoi(head.children[3].atom.c_str());
+      return d_tm.mk_bitvector_extract(t, expr::bitvector_extract(high, low));
+    }
+    if (op == "sign_extend" && head.children.size() == 3) {
+      size_t size = atoi(head.children[2].atom.c_str());
+      return d_tm.mk_bitvector_sgn_extend(t, expr::bitvector_sgn_extend(size));
+    }
+    if (op == "zero_extend" && head.children.size() == 3) {
+      size_t size = atoi(head.children[2].atom.c_str());
+      if (size == 0) {
+        return t;
+      }
+      expr::term_ref zero = d_tm.mk_bitvector_constant(expr::bitvector(size, 0));
+      return d_tm.mk_term(expr::TERM_BV_CONCAT, zero, t);
+    }
+    error("unsupported indexed operator " + op);
+  }
+
+  error("unsupported term");
+  return expr::term_ref();
+}
+
+void smt2_replay::process(const sexpr& e) {
+
+  if (!e.is_list || e.children.empty() || e.children[0].is_list) {
+    error("expected a command");
+  }
+
+  const std::string& name = e.children[0].atom;
+  size_t size = e.children.size();
+
+  if (name == "set-option" || name == "set-info" || name == "set-logic" || name == "get-info" ||
+      name == "get-interpolant" || name == "echo" || name == "exit") {
+    // Nothing to replay
+    return;
+  }
+
+  if ((name == "declare-fun" && size == 4 && e.children[2].is_list && e.children[2].children.empty()) ||
+      (name == "declare-const" && size == 3)) {
+    const std::string& var_name = e.children[1].atom;
+    expr::term_ref type = to_type(e.children[size - 1]);
+    command c(DECLARE);
+    c.terms.push_back(expr::term_ref_strong(d_tm, d_tm.mk_variable(var_name, type)));
+    d_symbols[var_name] = c.terms.back();
+    d_commands.push_back(c);
+    return;
+  }
+
+  if (name == "define-fun" && size == 5 && e.children[2].is_list && e.children[2].children.empty()) {
+    // Just a name for the term
+    const std::string& def_name = e.children[1].atom;
+    d_symbols[def_name] = expr::term_ref_strong(d_tm, to_term(e.children[4]));
+    return;
+  }
+
+  if (name == "assert" && size == 2) {
+    command c(ASSERT);
+    c.terms.push_back(expr::term_ref_strong(d_tm, to_term(e.children[1])));
+    // The interpolation group gives the class
+    const sexpr& f = e.children[1];
+    if (f.is_list && f.children.size() > 0 && f.children[0].atom == "!") {
+      for (size_t i = 2; i + 1 < f.children.size(); ++ i) {
+        if (f.children[i].atom == ":interpolation-group" && f.children[i+1].atom == "B") {
+          c.f_class = solver::CLASS_B;
+        }
+      }
+    }
+    d_commands.push_back(c);
+    return;
+  }
+
+  if (name == "check-sat" && size == 1) {
+    d_commands.push_back(command(CHECK));
+    d_checks ++;
+    return;
+  }
+
+  if (name == "check-sat-assuming" && size == 2 && e.children[1].is_list) {
+    command c(CHECK_ASSUMING);
+    const std::vector<sexpr>& assumptions = e.children[1].children;
+    for (size_t i = 0; i < assumptions.size(); ++ i) {
+      c.terms.push_back(expr::term_ref_strong(d_tm, to_term(assumptions[i])));
+    }
+    d_commands.push_back(c);
+    d_checks ++;
+    return;
+  }
+
+  if ((name == "push" || name == "pop") && size <= 2) {
+    command c(name == "push" ? PUSH : POP);
+    if (size == 2) {
+      c.levels = atoi(e.children[1].atom.c_str());
+    }
+    d_commands.push_back(c);
+    return;
+  }
+
+  if (name == "get-value" || name == "get-model") {
+    d_commands.push_back(command(GET_MODEL));
+    return;
+  }
+
+  if (name == "get-unsat-core") {
+    d_commands.push_back(command(GET_UNSAT_CORE));
+    return;
+  }
+
+  if (name == "get-unsat-assumptions") {
+    d_commands.push_back(command(GET_UNSAT_ASSUMPTIONS));
+    return;
+  }
+
+  error("unsupported command " + name);
+}
+
+void smt2_replay::run(solver& s, bool models, std::vector<query>& out) const {
+
+  size_t index = 0;
+  solver::result last_result = solver::UNKNOWN;
+  bool last_assuming = false;
+
+  for (size_t i = 0; i < d_commands.size(); ++ i) {
+    const command& c = d_commands[i];
+    switch (c.type) {
+    case DECLARE:
+      s.add_variable(c.terms[0], solver::CLASS_A);
+      break;
+    case ASSERT:
+      s.add(c.terms[0], c.f_class);
+      break;
+    case CHECK:
+    case CHECK_ASSUMING: {
+      TRACE("smt::replay") << "check " << index << " on " << s.get_name() << std::endl;
+      boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+      if (c.type == CHECK) {
+        last_result = s.check();
+      } else {
+        std::vector<expr::term_ref> assumptions(c.terms.begin(), c.terms.end());
+        last_result = s.check(assumptions);
+      }
+      boost::posix_time::ptime end = boost::posix_time::microsec_clock::universal_time();
+      last_assuming = c.type == CHECK_ASSUMING;
+      query q;
+      q.index = index ++;
+      q.result = last_result;
+      q.time = (end - start).total_microseconds() / 1000000.0;
+      out.push_back(q);
+      break;
+    }
+    case PUSH:
+      for (size_t k = 0; k < c.levels; ++ k) {
+        s.push();
+      }
+      break;
+    case POP:
+      for (size_t k = 0; k < c.levels; ++ k) {
+        s.pop();
+      }
+      break;
+    case GET_MODEL:
+      if (models && last_result == solver::SAT) {
+        s.get_model();
+      }
+      break;
+    case GET_UNSAT_CORE:
+      if (last_result == solver::UNSAT && s.supports(solver::UNSAT_CORE)) {
+        std::vector<expr::term_ref> core;
+        s.get_unsat_core(core);
+      }
+      break;
+    case GET_UNSAT_ASSUMPTIONS:
+      if (last_result == solver::UNSAT && last_assuming) {
+        std::vector<expr::term_ref> assumptions;
+        s.get_unsat_assumptions(assumptions);
+      }
+      break;
+    }
+  }
+}
+
+}
+}
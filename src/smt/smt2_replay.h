@@ -0,0 +1,155 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "smt/solver.h"
+#include "expr/term.h"
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sally {
+namespace smt {
+
+/**
+ * A query log of smt2_output_wrapper (or any SMT2 script in the same
+ * fragment), read into commands that can be replayed on any solver. The
+ * definitions and lets are expanded, so the solvers see the same terms as
+ * in the original run.
+ */
+class smt2_replay {
+
+public:
+
+  /** The replayed commands */
+  enum command_type {
+    DECLARE,
+    ASSERT,
+    CHECK,
+    CHECK_ASSUMING,
+    PUSH,
+    POP,
+    GET_MODEL,
+    GET_UNSAT_CORE,
+    GET_UNSAT_ASSUMPTIONS
+  };
+
+  struct command {
+    command_type type;
+    /** The variable, the assertion, or the assumptions */
+    std::vector<expr::term_ref_strong> terms;
+    /** Class of the assertion */
+    solver::formula_class f_class;
+    /** Number of push/pop levels */
+    size_t levels;
+    command(command_type type)
+    : type(type), f_class(solver::CLASS_A), levels(1) {}
+  };
+
+  /** Result of a replayed check */
+  struct query {
+    /** Index of the check in the log */
+    size_t index;
+    /** The result */
+    solver::result result;
+    /** Time of the check (in seconds) */
+    double time;
+  };
+
+private:
+
+  /** An s-expression of the log */
+  struct sexpr {
+    std::string atom;
+    std::vector<sexpr> children;
+    bool is_list;
+    sexpr(): is_list(false) {}
+  };
+
+  /** The term manager */
+  expr::term_manager& d_tm;
+
+  /** The commands of the log */
+  std::vector<command> d_commands;
+
+  /** Number of checks in the log */
+  size_t d_checks;
+
+  /** The symbols in scope (variables, definitions and lets) */
+  std::map<std::string, expr::term_ref_strong> d_symbols;
+
+  /** The input */
+  std::istream& d_in;
+
+  /** Current line of the input (for errors) */
+  size_t d_line;
+
+  /** Read an s-expression, returns false at the end of the input */
+  bool read(sexpr& e);
+
+  /** Read an s-expression starting with the given token */
+  void read(sexpr& e, std::string& token);
+
+  /** Read the next token, returns false at the end of the input */
+  bool read_token(std::string& token);
+
+  /** Get the type of e */
+  expr::term_ref to_type(const sexpr& e);
+
+  /** Get the term of e */
+  expr::term_ref to_term(const sexpr& e);
+
+  /** Get the term of an application of an operator */
+  expr::term_ref to_term(const std::string& op, const std::vector<expr::term_ref>& args);
+
+  /** Process a command of the log */
+  void process(const sexpr& e);
+
+  /** Throw a parse error */
+  void error(const std::string& message) const;
+
+public:
+
+  /** Read the log from the stream */
+  smt2_replay(expr::term_manager& tm, std::istream& in);
+
+  /** The commands of the log */
+  const std::vector<command>& get_commands() const {
+    return d_commands;
+  }
+
+  /** Number of checks in the log */
+  size_t get_checks() const {
+    return d_checks;
+  }
+
+  /**
+   * Replay the commands on the solver and add the results of the checks to
+   * out. Models are only asked for if models is true (not all solvers have
+   * them). Interpolants are not replayed, the log doesn't say the classes of
+   * the variables.
+   */
+  void run(solver& s, bool models, std::vector<query>& out) const;
+};
+
+}
+}
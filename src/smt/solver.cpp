@@ -17,6 +17,7 @@
  */
 
 #include "smt/solver.h"
+#include "smt/async_check.h"
 #include "expr/gc_relocator.h"
 
 #include <cassert>
@@ -58,6 +59,14 @@ expr::term_ref solver::interpolate() {
   return d_tm.mk_and(interpolation_out);
 }
 
+check_future::ref solver::check_async() {
+  return new check_future(this);
+}
+
+check_future::ref solver::check_async(const std::vector<expr::term_ref>& assumptions) {
+  return new check_future(this, assumptions);
+}
+
 void solver::add_variable(expr::term_ref var, variable_class f_class) {
 
   assert(d_A_variables.find(var) == d_A_variables.end());
@@ -79,7 +88,28 @@ void solver::add_variable(expr::term_ref var, variable_class f_class) {
   }
 }
 
+solver::result solver::check_with_assumptions(const std::vector<expr::term_ref>& assumptions) {
+  d_unsat_assumptions.clear();
+  push();
+  for (size_t i = 0; i < assumptions.size(); ++ i) {
+    add(assumptions[i], CLASS_A);
+  }
+  result r;
+  try {
+    r = check();
+  } catch (...) {
+    pop();
+    throw;
+  }
+  pop();
+  if (r == UNSAT) {
+    d_unsat_assumptions = assumptions;
+  }
+  return r;
+}
+
 void solver::gc_collect(const expr::gc_relocator& gc_reloc) {
+  gc_reloc.reloc(d_unsat_assumptions);
   gc_reloc.reloc(d_A_variables);
   gc_reloc.reloc(d_B_variables);
   gc_reloc.reloc(d_T_variables);
@@ -30,6 +30,8 @@
 namespace sally {
 namespace smt {
 
+class check_future;
+
 /**
  * The context needed to create a solver.
  */
@@ -75,6 +77,9 @@ protected:
   /** All T variables */
   std::set<expr::term_ref> d_T_variables;
 
+  /** The unsat assumptions of the last emulated check with assumptions */
+  std::vector<expr::term_ref> d_unsat_assumptions;
+
 public:
 
   /** Smart pointer reference */
@@ -105,6 +110,12 @@ public:
     GENERALIZATION,
     INTERPOLATION,
     UNSAT_CORE,
+    /** check() can run concurrently with check() of other instances */
+    CONCURRENT_CHECK,
+    /** check() with assumptions is native (no push/pop, and the model is available) */
+    ASSUMPTIONS,
+    /** interrupt() can stop a check() running in another thread */
+    INTERRUPT,
   };
 
   /**
@@ -164,6 +175,45 @@ public:
   virtual
   result check() = 0;
 
+  /**
+   * Check for satisfiability of the assertions together with the given
+   * Boolean assumptions, without changing the assertions. If unsat, the
+   * assumptions responsible can be obtained with get_unsat_assumptions().
+   * If the solver doesn't support ASSUMPTIONS natively, the check is
+   * emulated with push/pop, and the model is not available afterwards.
+   * The assumptions are not considered in generalization or interpolation.
+   */
+  result check(const std::vector<expr::term_ref>& assumptions) {
+    return check_with_assumptions(assumptions);
+  }
+
+  /**
+   * Get the subset of the assumptions of the last check with assumptions
+   * that is unsatisfiable together with the assertions.
+   */
+  virtual
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+    out.insert(out.end(), d_unsat_assumptions.begin(), d_unsat_assumptions.end());
+  }
+
+  /**
+   * Start check() in a separate thread and return right away. The solver
+   * can't be used until the check is done, see check_future.
+   */
+  utils::smart_ptr<check_future> check_async();
+
+  /** Start check() with assumptions in a separate thread, as above */
+  utils::smart_ptr<check_future> check_async(const std::vector<expr::term_ref>& assumptions);
+
+  /**
+   * Ask a check() running in another thread to stop, in which case it
+   * returns UNKNOWN. This is the only method that can be called during a
+   * check. It does nothing if there is no check running, or if the solver
+   * doesn't support INTERRUPT.
+   */
+  virtual
+  void interrupt() {}
+
   /** Check for satisfiability, but it's OK to return unknown */
   virtual
   result check_relaxed() {
@@ -291,6 +341,15 @@ public:
 
   /** Collect base terms */
   void gc_collect(const expr::gc_relocator& gc_reloc);
+
+protected:
+
+  /**
+   * Check with assumptions. The default implementation emulates it with
+   * push(), add() and pop(), and all the assumptions are in the core.
+   */
+  virtual
+  result check_with_assumptions(const std::vector<expr::term_ref>& assumptions);
 };
 
 
@@ -0,0 +1,318 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "smt/solver_pool.h"
+#include "smt/factory.h"
+#include "expr/gc_relocator.h"
+#include "utils/trace.h"
+
+namespace sally {
+namespace smt {
+
+void pooled_solver::base::add_variable(expr::term_ref var, variable_class var_class) {
+  d_variables[var_class].push_back(var);
+}
+
+void pooled_solver::base::add_variables(const std::vector<expr::term_ref>& vars, variable_class var_class) {
+  d_variables[var_class].insert(d_variables[var_class].end(), vars.begin(), vars.end());
+}
+
+void pooled_solver::base::add(expr::term_ref f, formula_class f_class) {
+  d_assertions[f_class].push_back(f);
+}
+
+void pooled_solver::base::setup(solver* s) const {
+  for (size_t i = 0; i < 3; ++ i) {
+    s->add_variables(d_variables[i], (variable_class) i);
+  }
+  for (size_t i = 0; i < 3; ++ i) {
+    for (size_t j = 0; j < d_assertions[i].size(); ++ j) {
+      s->add(d_assertions[i][j], (formula_class) i);
+    }
+  }
+}
+
+static
+bool reloc_all(const expr::gc_relocator& gc_reloc, std::vector<expr::term_ref>& terms) {
+  for (size_t i = 0; i < terms.size(); ++ i) {
+    if (!gc_reloc.reloc(terms[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool pooled_solver::base::reloc(const expr::gc_relocator& gc_reloc) {
+  for (size_t i = 0; i < 3; ++ i) {
+    if (!reloc_all(gc_reloc, d_variables[i]) || !reloc_all(gc_reloc, d_assertions[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool pooled_solver::base::operator < (const base& other) const {
+  if (d_solver_id != other.d_solver_id) {
+    return d_solver_id < other.d_solver_id;
+  }
+  for (size_t i = 0; i < 3; ++ i) {
+    if (d_variables[i] != other.d_variables[i]) {
+      return d_variables[i] < other.d_variables[i];
+    }
+    if (d_assertions[i] != other.d_assertions[i]) {
+      return d_assertions[i] < other.d_assertions[i];
+    }
+  }
+  return false;
+}
+
+pooled_solver::pooled_solver(expr::term_manager& tm, const options& opts, utils::statistics& stats, solver* s, solver_pool* pool, const base& b)
+: solver(s->get_name(), tm, opts, stats)
+, d_solver(s)
+, d_pool(pool)
+, d_base(b)
+, d_base_alive(true)
+, d_depth(0)
+{
+  // Variables of the base are already in the solver, so we only record them
+  for (size_t i = 0; i < 3; ++ i) {
+    for (size_t j = 0; j < b.d_variables[i].size(); ++ j) {
+      solver::add_variable(b.d_variables[i][j], (variable_class) i);
+    }
+  }
+}
+
+pooled_solver::~pooled_solver() {
+  delete d_solver;
+}
+
+void pooled_solver::lease() {
+  assert(d_depth == 0);
+  d_solver->push();
+}
+
+void pooled_solver::release() {
+  d_pool->release(this);
+}
+
+void pooled_solver::restore() {
+  for (; d_depth > 0; -- d_depth) {
+    d_solver->pop();
+  }
+  d_solver->pop();
+  // Forget the user variables, they stay declared in the backend
+  for (size_t i = 0; i < d_user_variables.size(); ++ i) {
+    expr::term_ref var = d_user_variables[i];
+    d_A_variables.erase(var);
+    d_B_variables.erase(var);
+    d_T_variables.erase(var);
+  }
+  d_user_variables.clear();
+}
+
+bool pooled_solver::supports(feature f) const {
+  return d_solver->supports(f);
+}
+
+void pooled_solver::add(expr::term_ref f, formula_class f_class) {
+  d_solver->add(f, f_class);
+}
+
+solver::result pooled_solver::check() {
+  return d_solver->check();
+}
+
+solver::result pooled_solver::check_with_assumptions(const std::vector<expr::term_ref>& assumptions) {
+  return d_solver->check(assumptions);
+}
+
+void pooled_solver::check_model() {
+  d_solver->check_model();
+}
+
+expr::model::ref pooled_solver::get_model() const {
+  return d_solver->get_model();
+}
+
+void pooled_solver::push() {
+  d_solver->push();
+  d_depth ++;
+}
+
+void pooled_solver::pop() {
+  if (d_depth == 0) {
+    throw exception("pooled_solver: pop() below the base context");
+  }
+  d_solver->pop();
+  d_depth --;
+}
+
+void pooled_solver::generalize(generalization_type type, std::vector<expr::term_ref>& projection_out) {
+  d_solver->generalize(type, projection_out);
+}
+
+void pooled_solver::generalize(generalization_type type, expr::model::ref m, std::vector<expr::term_ref>& projection_out) {
+  d_solver->generalize(type, m, projection_out);
+}
+
+void pooled_solver::interpolate(std::vector<expr::term_ref>& out) {
+  d_solver->interpolate(out);
+}
+
+void pooled_solver::get_unsat_core(std::vector<expr::term_ref>& out) {
+  d_solver->get_unsat_core(out);
+}
+
+void pooled_solver::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  d_solver->get_unsat_assumptions(out);
+}
+
+void pooled_solver::interrupt() {
+  d_solver->interrupt();
+}
+
+void pooled_solver::add_variable(expr::term_ref var, variable_class f_class) {
+  solver::add_variable(var, f_class);
+  d_user_variables.push_back(var);
+  // Declare in the backend, unless a previous user already did
+  std::map<expr::term_ref, variable_class>::const_iterator find = d_backend_variables.find(var);
+  if (find == d_backend_variables.end()) {
+    d_solver->add_variable(var, f_class);
+    d_backend_variables[var] = f_class;
+  } else if (find->second != f_class) {
+    throw exception("pooled_solver: variable added again with a different class");
+  }
+}
+
+void pooled_solver::set_hint(expr::model::ref m) {
+  d_solver->set_hint(m);
+}
+
+void pooled_solver::gc() {
+  d_solver->gc();
+}
+
+void pooled_solver::gc_collect(const expr::gc_relocator& gc_reloc) {
+  solver::gc_collect(gc_reloc);
+  gc_reloc.reloc(d_user_variables);
+  std::map<expr::term_ref, variable_class> backend_variables;
+  std::map<expr::term_ref, variable_class>::const_iterator it = d_backend_variables.begin();
+  for (; it != d_backend_variables.end(); ++ it) {
+    expr::term_ref var = it->first;
+    if (gc_reloc.reloc(var)) {
+      backend_variables[var] = it->second;
+    }
+  }
+  d_backend_variables.swap(backend_variables);
+  if (d_base_alive) {
+    d_base_alive = d_base.reloc(gc_reloc);
+  }
+}
+
+solver_pool::solver_pool(expr::term_manager& tm, const options& opts, utils::statistics& stats)
+: gc_participant(tm)
+, d_tm(tm)
+, d_opts(opts)
+, d_stats_owner(stats)
+{
+  d_stats.created = new utils::stat_int("smt::pool::created", 0);
+  d_stats.reused = new utils::stat_int("smt::pool::reused", 0);
+  stats.add(new utils::stat_delimiter());
+  stats.add(d_stats.created);
+  stats.add(d_stats.reused);
+}
+
+solver_pool::~solver_pool() {
+  empty_garbage();
+  idle_map::iterator it = d_idle.begin();
+  for (; it != d_idle.end(); ++ it) {
+    for (size_t i = 0; i < it->second.size(); ++ i) {
+      delete it->second[i];
+    }
+  }
+}
+
+void solver_pool::empty_garbage() {
+  for (size_t i = 0; i < d_garbage.size(); ++ i) {
+    delete d_garbage[i];
+  }
+  d_garbage.clear();
+}
+
+solver* solver_pool::acquire(std::string solver_id, const pooled_solver::base& b) {
+
+  empty_garbage();
+
+  pooled_solver::base key = b;
+  key.d_solver_id = solver_id;
+
+  pooled_solver* s = 0;
+  idle_map::iterator find = d_idle.find(key);
+  if (find != d_idle.end() && !find->second.empty()) {
+    s = find->second.back();
+    find->second.pop_back();
+    d_stats.reused->get_value() ++;
+    TRACE("smt::pool") << "solver_pool: reusing " << solver_id << std::endl;
+  } else {
+    solver* backend = factory::mk_default_solver(d_tm, d_opts, d_stats_owner);
+    b.setup(backend);
+    s = new pooled_solver(d_tm, d_opts, d_stats_owner, backend, this, key);
+    d_stats.created->get_value() ++;
+    TRACE("smt::pool") << "solver_pool: created " << solver_id << std::endl;
+  }
+
+  s->lease();
+  return s;
+}
+
+void solver_pool::release(pooled_solver* s) {
+  assert(s->d_pool == this);
+  empty_garbage();
+  if (!s->d_base_alive) {
+    delete s;
+    return;
+  }
+  try {
+    s->restore();
+  } catch (...) {
+    // Solver is in a bad state, don't keep it
+    delete s;
+    return;
+  }
+  d_idle[s->d_base].push_back(s);
+}
+
+void solver_pool::gc_collect(const expr::gc_relocator& gc_reloc) {
+  // Relocation changes the order, so we rebuild the map. Solvers are also
+  // participants, so they are destroyed later.
+  idle_map relocated;
+  idle_map::iterator it = d_idle.begin();
+  for (; it != d_idle.end(); ++ it) {
+    pooled_solver::base b = it->first;
+    if (b.reloc(gc_reloc)) {
+      std::vector<pooled_solver*>& solvers = relocated[b];
+      solvers.insert(solvers.end(), it->second.begin(), it->second.end());
+    } else {
+      d_garbage.insert(d_garbage.end(), it->second.begin(), it->second.end());
+    }
+  }
+  d_idle.swap(relocated);
+}
+
+}
+}
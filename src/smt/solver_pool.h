@@ -0,0 +1,173 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "smt/solver.h"
+
+#include <map>
+#include <vector>
+
+namespace sally {
+namespace smt {
+
+class solver_pool;
+
+/**
+ * Solvers of the pool are kept warm with their base context (the variables
+ * and assertions at level 0) intact. A solver is handed out after a push(),
+ * and returned to the pool by popping back to the base context, so users can
+ * leave it at any push level. Variables added by users are forgotten on
+ * release, but the backend can't undeclare them, so a variable added again
+ * on a later use must have the same class.
+ */
+class pooled_solver : public solver {
+
+public:
+
+  /** The base context of a solver */
+  class base {
+    std::vector<expr::term_ref> d_variables[3];
+    std::vector<expr::term_ref> d_assertions[3];
+    std::string d_solver_id;
+    friend class pooled_solver;
+    friend class solver_pool;
+  public:
+    void add_variable(expr::term_ref var, variable_class var_class);
+    void add_variables(const std::vector<expr::term_ref>& vars, variable_class var_class);
+    void add(expr::term_ref f, formula_class f_class);
+    /** Add the base context to the solver */
+    void setup(solver* s) const;
+    /** Relocate all terms, returns false if any term was collected */
+    bool reloc(const expr::gc_relocator& gc_reloc);
+    bool operator < (const base& other) const;
+  };
+
+private:
+
+  /** The solver with the base context */
+  solver* d_solver;
+
+  /** The pool we came from */
+  solver_pool* d_pool;
+
+  /** Base context of the solver */
+  base d_base;
+
+  /** True if all the base terms are still alive */
+  bool d_base_alive;
+
+  /** Number of pushes done by the user */
+  size_t d_depth;
+
+  /** Variables added by the user since the lease */
+  std::vector<expr::term_ref> d_user_variables;
+
+  /** Variables above the base that were declared in the backend */
+  std::map<expr::term_ref, variable_class> d_backend_variables;
+
+  friend class solver_pool;
+
+  /** Takes over the solver with the base context already added */
+  pooled_solver(expr::term_manager& tm, const options& opts, utils::statistics& stats, solver* s, solver_pool* pool, const base& b);
+
+  /** Push the user level */
+  void lease();
+
+  /** Pop back to the base context and forget the user variables */
+  void restore();
+
+public:
+
+  ~pooled_solver();
+
+  /** Return to the pool */
+  void release();
+
+  bool supports(feature f) const;
+  void add(expr::term_ref f, formula_class f_class);
+  result check();
+  void check_model();
+  expr::model::ref get_model() const;
+  void push();
+  void pop();
+  void generalize(generalization_type type, std::vector<expr::term_ref>& projection_out);
+  void generalize(generalization_type type, expr::model::ref m, std::vector<expr::term_ref>& projection_out);
+  void interpolate(std::vector<expr::term_ref>& out);
+  void get_unsat_core(std::vector<expr::term_ref>& out);
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+  void interrupt();
+  void add_variable(expr::term_ref var, variable_class f_class);
+  void set_hint(expr::model::ref m);
+  void gc();
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+
+protected:
+
+  result check_with_assumptions(const std::vector<expr::term_ref>& assumptions);
+};
+
+/**
+ * Pool of idle solvers of a term manager, keyed by the solver id and the base
+ * context. Idle solvers whose base refers to collected terms are destroyed on
+ * garbage collection.
+ */
+class solver_pool : public expr::gc_participant {
+
+  typedef std::map<pooled_solver::base, std::vector<pooled_solver*> > idle_map;
+
+  /** Idle solvers */
+  idle_map d_idle;
+
+  /** Solvers to destroy, collected during garbage collection */
+  std::vector<pooled_solver*> d_garbage;
+
+  /** Destroy the garbage solvers */
+  void empty_garbage();
+
+  expr::term_manager& d_tm;
+  const options& d_opts;
+  utils::statistics& d_stats_owner;
+
+  struct stats {
+    utils::stat_int* created;
+    utils::stat_int* reused;
+  };
+
+  stats d_stats;
+
+public:
+
+  solver_pool(expr::term_manager& tm, const options& opts, utils::statistics& stats);
+  ~solver_pool();
+
+  /**
+   * Get a default solver with the given base context at a clean push level.
+   * The id of the default solver is part of the key.
+   */
+  solver* acquire(std::string solver_id, const pooled_solver::base& b);
+
+  /** Return the solver to the pool */
+  void release(pooled_solver* s);
+
+  /** Relocate the bases and destroy the solvers with collected terms */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+};
+
+}
+}
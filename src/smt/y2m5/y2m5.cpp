@@ -31,6 +31,7 @@
 #include "smt/incremental_wrapper.h"
 #include "smt/delayed_wrapper.h"
 #include "smt/factory.h"
+#include "smt/async_check.h"
 
 namespace sally {
 namespace smt {
@@ -52,9 +53,18 @@ y2m5::y2m5(expr::term_manager& tm, const options& opts, utils::statistics& stats
 : solver("y2m5", tm, opts, stats)
 , d_last_mathsat5_result(UNKNOWN)
 , d_last_yices2_result(UNKNOWN)
+, d_parallel(opts.get_bool("y2m5-parallel"))
+, d_race(0)
 {
   d_yices2 = factory::mk_solver("yices2", tm, opts, stats);
-  if (opts.get_bool("y2m5-mathsat5-flatten")) {
+  if (d_parallel) {
+    // Checks run in parallel, so we can't delay the assertions (they would be
+    // converted in the check thread)
+    if (opts.get_bool("y2m5-mathsat5-flatten")) {
+      throw exception("y2m5-parallel can't be used with y2m5-mathsat5-flatten");
+    }
+    d_mathsat5 = factory::mk_solver("mathsat5", tm, opts, stats);
+  } else if (opts.get_bool("y2m5-mathsat5-flatten")) {
     solver_constructor* constructor = new mathsat_constructor(tm, opts, stats);
     d_mathsat5 = new incremental_wrapper("mathsat5_nonincremental", tm, opts, stats, constructor);
   } else {
@@ -64,6 +74,7 @@ y2m5::y2m5(expr::term_manager& tm, const options& opts, utils::statistics& stats
 }
 
 y2m5::~y2m5() {
+  delete d_race;
   delete d_mathsat5;
   delete d_yices2;
   s_instance --;
@@ -71,6 +82,7 @@ y2m5::~y2m5() {
 
 void y2m5::add(expr::term_ref f, formula_class f_class) {
   TRACE("y2m5") << "y2m5[" << s_instance << "]: adding " << f << std::endl;
+  settle();
   d_yices2->add(f, f_class);
   d_mathsat5->add(f, f_class);
   d_last_mathsat5_result = UNKNOWN;
@@ -79,19 +91,75 @@ void y2m5::add(expr::term_ref f, formula_class f_class) {
 
 solver::result y2m5::check() {
   TRACE("y2m5") << "y2m5[" << s_instance << "]: check()" << std::endl;
+  settle();
+  if (d_parallel) {
+    return check_parallel();
+  }
   d_last_yices2_result = d_yices2->check();
   d_last_mathsat5_result = UNKNOWN;
   return d_last_yices2_result;
 }
 
+solver::result y2m5::check_with_assumptions(const std::vector<expr::term_ref>& assumptions) {
+  TRACE("y2m5") << "y2m5[" << s_instance << "]: check() with " << assumptions.size() << " assumptions" << std::endl;
+  settle();
+  d_last_yices2_result = d_yices2->check(assumptions);
+  d_last_mathsat5_result = UNKNOWN;
+  return d_last_yices2_result;
+}
+
+solver::result y2m5::check_parallel() {
+  assert(d_race == 0);
+  d_last_yices2_result = UNKNOWN;
+  d_last_mathsat5_result = UNKNOWN;
+  d_race = new check_race(d_yices2, d_mathsat5);
+  solver::result result = UNKNOWN;
+  switch (d_race->wait()) {
+  case 0:
+    // Yices knows first, MathSAT is only needed to interpolate unsat
+    result = d_last_yices2_result = d_race->get(0).get();
+    if (result == SAT) {
+      d_race->get(1).cancel();
+    }
+    break;
+  case 1:
+    // MathSAT knows first, yices is only needed to generalize sat
+    result = d_last_mathsat5_result = d_race->get(1).get();
+    if (result == UNSAT) {
+      d_race->get(0).cancel();
+    }
+    break;
+  default:
+    // Nobody knows, we go with yices (and its errors) as in sequential mode
+    result = d_race->get(0).get();
+    settle();
+  }
+  TRACE("y2m5") << "y2m5[" << s_instance << "]: parallel check: " << result << std::endl;
+  return result;
+}
+
+void y2m5::settle() {
+  if (d_race) {
+    d_last_yices2_result = d_race->get(0).get_relaxed();
+    d_last_mathsat5_result = d_race->get(1).get_relaxed();
+    delete d_race;
+    d_race = 0;
+  }
+}
+
 expr::model::ref y2m5::get_model() const {
   TRACE("y2m5") << "y2m5[" << s_instance << "]: get_model()" << std::endl;
+  if (d_last_yices2_result != SAT && d_last_mathsat5_result == SAT) {
+    // MathSAT won the race (parallel mode)
+    return d_mathsat5->get_model();
+  }
   assert(d_last_yices2_result == SAT);
   return d_yices2->get_model();
 }
 
 void y2m5::push() {
   TRACE("y2m5") << "y2m5[" << s_instance << "]: push()" << std::endl;
+  settle();
   d_yices2->push();
   d_mathsat5->push();
   d_last_mathsat5_result = UNKNOWN;
@@ -100,6 +168,7 @@ void y2m5::push() {
 
 void y2m5::pop() {
   TRACE("y2m5") << "y2m5[" << s_instance << "]: pop()" << std::endl;
+  settle();
   d_yices2->pop();
   d_mathsat5->pop();
   d_last_mathsat5_result = UNKNOWN;
@@ -109,17 +178,24 @@ void y2m5::pop() {
 
 void y2m5::generalize(generalization_type type, std::vector<expr::term_ref>& out) {
   TRACE("y2m5") << "y2m5[" << s_instance << "]: generalizing" << std::endl;
+  settle();
+  if (d_last_yices2_result == UNKNOWN) {
+    // Yices lost the race (parallel mode)
+    d_last_yices2_result = d_yices2->check();
+  }
   assert(d_last_yices2_result == SAT);
   d_yices2->generalize(type, out);
 }
 
 void y2m5::generalize(generalization_type type, expr::model::ref m, std::vector<expr::term_ref>& out) {
   TRACE("y2m5") << "y2m5[" << s_instance << "]: generalizing" << std::endl;
+  settle();
   d_yices2->generalize(type, m, out);
 }
 
 void y2m5::interpolate(std::vector<expr::term_ref>& out) {
   TRACE("y2m5") << "y2m5[" << s_instance << "]: interpolating" << std::endl;
+  settle();
   if (d_last_mathsat5_result == UNKNOWN) {
     d_last_mathsat5_result = d_mathsat5->check();
   }
@@ -128,6 +204,7 @@ void y2m5::interpolate(std::vector<expr::term_ref>& out) {
 
 void y2m5::get_unsat_core(std::vector<expr::term_ref>& out) {
   TRACE("y2m5") << "y2m5[" << s_instance << "]: unsat core" << std::endl;
+  settle();
   if (d_last_mathsat5_result == UNKNOWN) {
     d_last_mathsat5_result = d_mathsat5->check();
   }
@@ -135,7 +212,21 @@ void y2m5::get_unsat_core(std::vector<expr::term_ref>& out) {
   d_mathsat5->get_unsat_core(out);
 }
 
+void y2m5::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  TRACE("y2m5") << "y2m5[" << s_instance << "]: unsat assumptions" << std::endl;
+  settle();
+  assert(d_last_yices2_result == UNSAT);
+  d_yices2->get_unsat_assumptions(out);
+}
+
+void y2m5::interrupt() {
+  // Only one of them is running, but we don't know which
+  d_yices2->interrupt();
+  d_mathsat5->interrupt();
+}
+
 void y2m5::add_variable(expr::term_ref var, variable_class f_class) {
+  settle();
   solver::add_variable(var, f_class);
   d_yices2->add_variable(var, f_class);
   d_mathsat5->add_variable(var, f_class);
@@ -144,6 +235,8 @@ void y2m5::add_variable(expr::term_ref var, variable_class f_class) {
 bool y2m5::supports(feature f) const {
   switch (f) {
   case GENERALIZATION:
+  case ASSUMPTIONS:
+  case INTERRUPT:
     return d_yices2->supports(f);
   case INTERPOLATION:
     return d_mathsat5->supports(f);
@@ -155,6 +248,7 @@ bool y2m5::supports(feature f) const {
 }
 
 void y2m5::gc() {
+  settle();
   d_yices2->gc();
   d_mathsat5->gc();
 }
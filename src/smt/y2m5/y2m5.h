@@ -26,6 +26,8 @@
 namespace sally {
 namespace smt {
 
+class check_race;
+
 /**
  * Combination solver: Yices for generalization, MathSAT5 for interpolation.
  * Note that all checks are done twice, so expect penalty.
@@ -43,6 +45,18 @@ class y2m5 : public solver {
   /* Last result of yices */
   result d_last_yices2_result;
 
+  /** Check both in parallel */
+  bool d_parallel;
+
+  /** The checks of the last parallel check, while any of them is running */
+  check_race* d_race;
+
+  /** Parallel check: the first answer wins, the other check goes on only if needed */
+  result check_parallel();
+
+  /** Wait for the checks of the last parallel check and get their results */
+  void settle();
+
 public:
 
   /** Constructor */
@@ -84,11 +98,22 @@ public:
   /** Unsat core of the last UNSAT result */
   void get_unsat_core(std::vector<expr::term_ref>& out);
 
+  /** Unsat assumptions of the last UNSAT check with assumptions */
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+
+  /** Stop a running check */
+  void interrupt();
+
   /** Term collection (nothing to do) */
   void gc_collect(const expr::gc_relocator& gc_reloc);
 
   /** Collect garbage */
   void gc();
+
+protected:
+
+  /** Check with assumptions (in yices) */
+  result check_with_assumptions(const std::vector<expr::term_ref>& assumptions);
 };
 
 }
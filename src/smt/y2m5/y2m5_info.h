@@ -34,6 +34,7 @@ struct y2m5_info {
     using namespace boost::program_options;
     options.add_options()
         ("y2m5-mathsat5-flatten", "Run MathSAT in non-incremental mode.")
+        ("y2m5-parallel", "Check with yices2 and MathSAT in parallel and use the first answer.")
         ;
   }
 
@@ -32,7 +32,9 @@ struct y2o2_info {
 
   static void setup_options(boost::program_options::options_description& options) {
     using namespace boost::program_options;
-
+    options.add_options()
+        ("y2o2-parallel", "Check with yices2 and OpenSMT in parallel and use the first answer (OpenSMT can't be interrupted).")
+        ;
   }
 
   static std::string get_id() {
@@ -31,6 +31,10 @@ namespace smt {
 struct y2z3_info {
 
   static void setup_options(boost::program_options::options_description& options) {
+    using namespace boost::program_options;
+    options.add_options()
+        ("y2z3-parallel", "Check with yices2 and Z3 in parallel and use the first answer.")
+        ;
   }
 
   static std::string get_id() {
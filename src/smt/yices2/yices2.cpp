@@ -40,6 +40,7 @@
 #include "smt/yices2/yices2.h"
 #include "smt/yices2/yices2_internal.h"
 #include "utils/trace.h"
+#include "utils/budget.h"
 
 #define unused_var(x) { (void) x; }
 
@@ -56,6 +57,20 @@ yices2::~yices2() {
   delete d_internal;
 }
 
+bool yices2::supports(feature f) const {
+  switch (f) {
+  case GENERALIZATION:
+  case ASSUMPTIONS:
+  case INTERRUPT:
+    return true;
+  case CONCURRENT_CHECK:
+    // Only if the library was built thread-safe
+    return yices_is_thread_safe();
+  default:
+    return false;
+  }
+}
+
 void yices2::add(expr::term_ref f, formula_class f_class) {
   TRACE("yices2") << "yices2[" << d_internal->instance() << "]: adding " << f << std::endl;
   d_internal->add(f, f_class);
@@ -63,9 +78,25 @@ void yices2::add(expr::term_ref f, formula_class f_class) {
 
 solver::result yices2::check() {
   TRACE("yices2") << "yices2[" << d_internal->instance() << "]: check()" << std::endl;
+  utils::budget::check();
   return d_internal->check();
 }
 
+solver::result yices2::check_with_assumptions(const std::vector<expr::term_ref>& assumptions) {
+  TRACE("yices2") << "yices2[" << d_internal->instance() << "]: check() with " << assumptions.size() << " assumptions" << std::endl;
+  utils::budget::check();
+  return d_internal->check(assumptions);
+}
+
+void yices2::interrupt() {
+  d_internal->interrupt();
+}
+
+void yices2::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  TRACE("yices2") << "yices2[" << d_internal->instance() << "]: get_unsat_assumptions()" << std::endl;
+  d_internal->get_unsat_assumptions(out);
+}
+
 bool yices2::is_consistent() {
   TRACE("yices2") << "yices2[" << d_internal->instance() << "]: is_consistent()" << std::endl;
   return d_internal->is_consistent();
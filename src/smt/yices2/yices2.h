@@ -45,14 +45,7 @@ public:
   ~yices2();
 
   /** Features */
-  bool supports(feature f) const {
-    switch (f) {
-    case GENERALIZATION:
-      return true;
-    default:
-      return false;
-    }
-  }
+  bool supports(feature f) const;
 
   /** Add an assertion f to the solver */
   void add(expr::term_ref f, formula_class f_class);
@@ -63,6 +56,12 @@ public:
   /** Check the assertions for satisfiability */
   result check();
 
+  /** Get the unsat assumptions */
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+
+  /** Stop a running check */
+  void interrupt();
+
   /** Consistent? */
   bool is_consistent();
 
@@ -93,6 +92,11 @@ public:
 
   /** Collect garbage */
   void gc();
+
+protected:
+
+  /** Check the assertions with the assumptions */
+  result check_with_assumptions(const std::vector<expr::term_ref>& assumptions);
 };
 
 }
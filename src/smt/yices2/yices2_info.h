@@ -32,7 +32,8 @@ struct yices2_info {
   static void setup_options(boost::program_options::options_description& options) {
     using namespace boost::program_options;
     options.add_options()
-        ("yices2-mode", value<std::string>()->default_value("hybrid"), "Mode of Yices2 to use (dpllt, mcsat, hybrid).")
+        ("yices2-mode", value<std::string>()->default_value("hybrid"), "Mode of Yices2 to use (dpllt, mcsat, hybrid, parallel). In parallel mode dpllt and mcsat check at the same time and the first answer is used.")
+        ("yices2-parallel-race-always", "In parallel mode, always race dpllt and mcsat (don't learn which one wins on each kind of query).")
         ("yices2-trace-tags", value<std::string>(), "Comma separated to pass to (debug version of) Yices2.")
         ;
   }
@@ -28,9 +28,14 @@
 #include "expr/gc_relocator.h"
 #include "expr/term_visitor.h"
 #include "utils/output.h"
+#include "smt/async_check.h"
+
+#include <boost/bind/bind.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 
 #include <iostream>
 #include <fstream>
+#include <map>
 
 namespace sally {
 namespace smt {
@@ -57,12 +62,217 @@ void yices2_internal::check_error(int ret, const char* error_msg) const {
   }
 }
 
+void yices2_internal::attach_yices() {
+  if (s_instances == 0) {
+    TRACE("yices2") << "yices2: first instance." << std::endl;
+
+    // Initialize it
+    yices_init();
+
+    // The basic types
+    s_bool_type = yices_bool_type();
+    s_int_type = yices_int_type();
+    s_real_type = yices_real_type();
+  }
+  s_instances ++;
+}
+
+void yices2_internal::detach_yices(yices2_term_cache* cache) {
+  s_instances--;
+  if (s_instances == 0) {
+    TRACE("yices2") << "yices2: last instance removed." << std::endl;
+    // Delete yices
+    yices_exit();
+    // Clear the cache
+    cache->clear();
+  }
+}
+
+static
+expr::bitvector bitvector_from_int32(size_t size, int32_t* value) {
+  char* value_str = new char[size+1];
+  for (size_t i = 0; i < size; ++ i) {
+    value_str[size - i - 1] = value[i] ? '1' : '0';
+  }
+  value_str[size] = 0;
+  expr::bitvector bv(value_str);
+  delete[] value_str;
+  return bv;
+}
+
+/** Check for yices errors in model evaluation */
+static
+void check_yices_model_error(int32_t ret, const char* error_msg) {
+  if (ret < 0) {
+    std::stringstream ss;
+    ss << error_msg << ": " << yices2_internal::yices_error();
+    throw exception(ss.str());
+  }
+}
+
+/**
+ * A model kept in yices. Values are converted when asked for, and formulas
+ * are evaluated by yices while the solver instance is alive. The model keeps
+ * yices itself alive.
+ */
+class yices2_model_source : public expr::model_source {
+
+  /** The solver instance, null once destroyed */
+  yices2_internal* d_internal;
+
+  expr::term_manager& d_tm;
+
+  yices2_term_cache* d_conversion_cache;
+
+  model_t* d_model;
+
+  typedef std::map<expr::term_ref, term_t> variable_map;
+
+  /** The variables of the model */
+  variable_map d_variables;
+
+public:
+
+  yices2_model_source(yices2_internal* internal, model_t* model)
+  : d_internal(internal)
+  , d_tm(internal->d_tm)
+  , d_conversion_cache(internal->d_conversion_cache)
+  , d_model(model)
+  {
+    yices2_internal::attach_yices();
+    d_internal->d_model_sources.insert(this);
+  }
+
+  ~yices2_model_source() {
+    if (d_internal) {
+      d_internal->d_model_sources.erase(this);
+    }
+    yices_free_model(d_model);
+    yices2_internal::detach_yices(d_conversion_cache);
+  }
+
+  /** The solver instance is gone */
+  void detach() {
+    d_internal = 0;
+  }
+
+  void add_variable(expr::term_ref var, term_t yices_var) {
+    d_variables[var] = yices_var;
+  }
+
+  expr::value get_value(expr::term_ref var) {
+
+    variable_map::const_iterator find = d_variables.find(var);
+    assert(find != d_variables.end());
+
+    term_t yices_var = find->second;
+    expr::term_ref var_type = d_tm.type_of(var);
+
+    int32_t ret = 0;
+    expr::value var_value;
+    switch (d_tm.term_of(var_type).op()) {
+    case expr::TYPE_BOOL: {
+      int32_t value;
+      ret = yices_get_bool_value(d_model, yices_var, &value);
+      check_yices_model_error(ret, "Error obtaining Bool value from Yices2 model.");
+      var_value = expr::value(value);
+      break;
+    }
+    case expr::TYPE_INTEGER: {
+      // The integer mpz_t value
+      mpz_t value;
+      mpz_init(value);
+      ret = yices_get_mpz_value(d_model, yices_var, value);
+      if (ret < 0) {
+        mpz_clear(value);
+      }
+      check_yices_model_error(ret, "Error obtaining integer value from Yices2 model.");
+      expr::rational rational_value(value);
+      var_value = expr::value(rational_value);
+      // Clear the temps
+      mpz_clear(value);
+      break;
+    }
+    case expr::TYPE_REAL: {
+      // The integer mpz_t value
+      mpq_t value;
+      mpq_init(value);
+      ret = yices_get_mpq_value(d_model, yices_var, value);
+      // rational
+      if (ret == 0) {
+        expr::rational rational_value(value);
+        var_value = expr::value(rational_value);
+      } else {
+        mpq_clear(value);
+#ifdef WITH_LIBPOLY
+        lp_algebraic_number_t a;
+        lp_algebraic_number_construct_zero(&a);
+        ret = yices_get_algebraic_number_value(d_model, yices_var, &a);
+        if (ret < 0) {
+          lp_algebraic_number_destruct(&a);
+          throw exception("Error obtaining real value from Yices2 model.");
+        }
+        // TODO: proper algebraic numbers
+        lp_rational_t a_q;
+        lp_rational_construct(&a_q);
+        lp_algebraic_number_to_rational(&a, &a_q);
+        var_value = expr::rational(&a_q);
+        lp_algebraic_number_destruct(&a);
+        lp_rational_destruct(&a_q);
+        break;
+#else
+        throw exception("Error obtaining real value from Yices2 model.");
+#endif
+      }
+      // Clear the temps
+      mpq_clear(value);
+      break;
+    }
+    case expr::TYPE_BITVECTOR: {
+      size_t size = d_tm.get_bitvector_type_size(var_type);
+      int32_t* value = new int32_t[size];
+      ret = yices_get_bv_value(d_model, yices_var, value);
+      if (ret < 0) {
+        delete[] value;
+      }
+      check_yices_model_error(ret, "Error obtaining bit-vector value from Yices2 model.");
+      expr::bitvector bv = bitvector_from_int32(size, value);
+      var_value = expr::value(bv);
+      delete[] value;
+      break;
+    }
+    default:
+      assert(false);
+    }
+
+    return var_value;
+  }
+
+  bool is_true(expr::term_ref f, bool& result) {
+    if (d_internal == 0) {
+      return false;
+    }
+    term_t yices_f = d_internal->to_yices2_term(f);
+    int32_t ret = yices_formula_true_in_model(d_model, yices_f);
+    if (ret < 0) {
+      yices_clear_error();
+      return false;
+    }
+    result = (ret == 1);
+    return true;
+  }
+};
+
 yices2_internal::yices2_internal(expr::term_manager& tm, const options& opts)
 : d_tm(tm)
 , d_ctx_dpllt(NULL)
 , d_ctx_mcsat(NULL)
+, d_dpllt_interruptible(false)
+, d_mcsat_interruptible(false)
 , d_dpllt_incomplete(false)
 , d_mcsat_incomplete(false)
+, d_parallel(false)
+, d_parallel_adaptive(true)
 , d_conversion_cache(0)
 , d_last_check_status_dpllt(STATUS_UNKNOWN)
 , d_last_check_status_mcsat(STATUS_UNKNOWN)
@@ -71,18 +281,7 @@ yices2_internal::yices2_internal(expr::term_manager& tm, const options& opts)
 , d_instance(s_instances)
 {
   // Initialize
-  if (s_instances == 0) {
-    TRACE("yices2") << "yices2: first instance." << std::endl;
-
-    // Initialize it
-    yices_init();
-
-    // The basic types
-    s_bool_type = yices_bool_type();
-    s_int_type = yices_int_type();
-    s_real_type = yices_real_type();
-  }
-  s_instances ++;
+  attach_yices();
   d_conversion_cache = yices2_term_cache::get_cache(tm);
 
   // Bitvector bits
@@ -96,10 +295,10 @@ yices2_internal::yices2_internal(expr::term_manager& tm, const options& opts)
   if (opts.has_option("yices2-mode")) {
     mode = opts.get_string("yices2-mode");
   }
-  bool use_dpllt = mode == "dpllt" || mode == "hybrid";
-  bool use_mcsat = mode == "mcsat" || mode == "hybrid";
+  bool use_dpllt = mode == "dpllt" || mode == "hybrid" || mode == "parallel";
+  bool use_mcsat = mode == "mcsat" || mode == "hybrid" || mode == "parallel";
   if (!use_dpllt && !use_mcsat) {
-    throw exception("yices2-mode must be one of dpllt, mcsat, or hybrid (got " + mode + ")");
+    throw exception("yices2-mode must be one of dpllt, mcsat, hybrid, or parallel (got " + mode + ")");
   }
 
   if (use_dpllt) {
@@ -112,12 +311,7 @@ yices2_internal::yices2_internal(expr::term_manager& tm, const options& opts)
       ret = yices_set_config(d_config_dpllt, "trace", opts.get_string("yices2-trace-tags").c_str());
       check_error(ret, "Yices error (mcsat option)");
     }
-    d_ctx_dpllt = yices_new_context(d_config_dpllt);
-    if (d_ctx_dpllt == 0) {
-      std::stringstream ss;
-      ss << "Yices error (context creation): " << yices_error();
-      throw exception(ss.str());
-    }
+    d_ctx_dpllt = new_context(d_config_dpllt, d_dpllt_interruptible);
   }
   if (use_mcsat) {
     d_config_mcsat = yices_new_config();
@@ -127,15 +321,41 @@ yices2_internal::yices2_internal(expr::term_manager& tm, const options& opts)
     }
     ret = yices_set_config(d_config_mcsat, "solver-type", "mcsat");
     check_error(ret, "Yices error (mcsat option)");
-    d_ctx_mcsat = yices_new_context(d_config_mcsat);
-    if (d_ctx_mcsat == 0) {
-      std::stringstream ss;
-      ss << "Yices error (context creation): " << yices_error();
-      throw exception(ss.str());
+    d_ctx_mcsat = new_context(d_config_mcsat, d_mcsat_interruptible);
+  }
+
+  if (mode == "parallel") {
+    // The loser of a race is interrupted, and both contexts search at the
+    // same time, otherwise we're better off checking them in sequence
+    d_parallel = yices_is_thread_safe() && d_dpllt_interruptible && d_mcsat_interruptible;
+    d_parallel_adaptive = !opts.get_bool("yices2-parallel-race-always");
+    if (!d_parallel) {
+      TRACE("yices2") << "yices2: can't check in parallel, using hybrid mode." << std::endl;
     }
   }
 }
 
+context_t* yices2_internal::new_context(ctx_config_t* config, bool& interruptible) {
+  // The interactive mode is push-pop with clean interrupts, i.e. the context
+  // is restored after an interrupted check. Not all solvers support it, and
+  // we don't interrupt those.
+  int32_t ret = yices_set_config(config, "mode", "interactive");
+  context_t* ctx = ret < 0 ? NULL : yices_new_context(config);
+  interruptible = ctx != NULL;
+  if (ctx == NULL) {
+    yices_clear_error();
+    ret = yices_set_config(config, "mode", "push-pop");
+    check_error(ret, "Yices error (mode option)");
+    ctx = yices_new_context(config);
+  }
+  if (ctx == NULL) {
+    std::stringstream ss;
+    ss << "Yices error (context creation): " << yices_error();
+    throw exception(ss.str());
+  }
+  return ctx;
+}
+
 yices2_internal::~yices2_internal() {
 
   // The context
@@ -154,15 +374,14 @@ yices2_internal::~yices2_internal() {
     yices_free_config(d_config_mcsat);
   }
 
-  // Cleanup if the last one
-  s_instances--;
-  if (s_instances == 0) {
-    TRACE("yices2") << "yices2: last instance removed." << std::endl;
-    // Delete yices
-    yices_exit();
-    // Clear the cache
-    d_conversion_cache->clear();
+  // Models can't evaluate formulas anymore
+  std::set<yices2_model_source*>::const_iterator it = d_model_sources.begin();
+  for (; it != d_model_sources.end(); ++ it) {
+    (*it)->detach();
   }
+
+  // Cleanup if the last one
+  detach_yices(d_conversion_cache);
 }
 
 term_t yices2_internal::mk_yices2_term(expr::term_op op, size_t n, term_t* children) {
@@ -1090,6 +1309,10 @@ void yices2_internal::add(expr::term_ref ref, solver::formula_class f_class) {
 
 solver::result yices2_internal::check() {
 
+  if (d_parallel) {
+    return check_parallel(0);
+  }
+
   smt_status_t result;
 
   // Call DPLL(T) first, then MCSAT if unsupported
@@ -1108,6 +1331,8 @@ solver::result yices2_internal::check() {
       return solver::UNSAT;
     case STATUS_UNKNOWN:
       break; // Do MCSAT
+    case STATUS_INTERRUPTED:
+      return solver::UNKNOWN;
     default: {
       std::stringstream ss;
       ss << "Yices error (check): " << yices_error();
@@ -1128,6 +1353,7 @@ solver::result yices2_internal::check() {
     case STATUS_UNSAT:
       return solver::UNSAT;
     case STATUS_UNKNOWN:
+    case STATUS_INTERRUPTED:
       return solver::UNKNOWN;
     default: {
       std::stringstream ss;
@@ -1140,6 +1366,359 @@ solver::result yices2_internal::check() {
   return solver::UNKNOWN;
 }
 
+solver::result yices2_internal::check(const std::vector<expr::term_ref>& assumptions) {
+
+  d_last_assumptions.clear();
+  std::vector<term_t> yices_assumptions;
+  for (size_t i = 0; i < assumptions.size(); ++ i) {
+    d_last_assumptions.push_back(expr::term_ref_strong(d_tm, assumptions[i]));
+    yices_assumptions.push_back(to_yices2_term(assumptions[i]));
+  }
+  const term_t* a = yices_assumptions.empty() ? 0 : &yices_assumptions[0];
+
+  if (d_parallel) {
+    return check_parallel(&yices_assumptions);
+  }
+
+  smt_status_t result;
+
+  // Call DPLL(T) first, then MCSAT if unsupported
+  if (d_ctx_dpllt) {
+    result = d_last_check_status_dpllt = yices_check_context_with_assumptions(d_ctx_dpllt, 0, yices_assumptions.size(), a);
+    d_last_check_status_mcsat = STATUS_UNKNOWN;
+    switch (result) {
+    case STATUS_SAT:
+      if (!d_dpllt_incomplete) {
+        return solver::SAT;
+      } else {
+        d_last_check_status_dpllt = STATUS_UNKNOWN;
+        break; // Do MCSAT
+      }
+    case STATUS_UNSAT:
+      return solver::UNSAT;
+    case STATUS_UNKNOWN:
+      break; // Do MCSAT
+    case STATUS_INTERRUPTED:
+      return solver::UNKNOWN;
+    default: {
+      std::stringstream ss;
+      ss << "Yices error (check with assumptions): " << yices_error();
+      throw exception(ss.str());
+    }
+    }
+  }
+  if (d_ctx_mcsat) {
+    result = d_last_check_status_mcsat = yices_check_context_with_assumptions(d_ctx_mcsat, 0, yices_assumptions.size(), a);
+    switch (result) {
+    case STATUS_SAT:
+      if (!d_mcsat_incomplete) {
+        return solver::SAT;
+      } else {
+        d_last_check_status_mcsat = STATUS_UNKNOWN;
+        break; // Nobody knows
+      }
+    case STATUS_UNSAT:
+      return solver::UNSAT;
+    case STATUS_UNKNOWN:
+    case STATUS_INTERRUPTED:
+      return solver::UNKNOWN;
+    default: {
+      std::stringstream ss;
+      ss << "Yices error (check with assumptions): " << yices_error();
+      throw exception(ss.str());
+    }
+    }
+  }
+
+  return solver::UNKNOWN;
+}
+
+/** Check the context, with the assumptions if not null */
+static
+smt_status_t check_context(context_t* ctx, const std::vector<term_t>* assumptions) {
+  if (assumptions) {
+    const term_t* a = assumptions->empty() ? 0 : &(*assumptions)[0];
+    return yices_check_context_with_assumptions(ctx, 0, assumptions->size(), a);
+  } else {
+    return yices_check_context(ctx, 0);
+  }
+}
+
+/** How often to repeat the interrupt of a stopped check (in milliseconds) */
+static const long interrupt_period = 10;
+
+/** Number of races before the favorite of a kind of query can check alone */
+static const size_t races_to_learn = 8;
+
+/** Percentage of the races the favorite must have won to check alone */
+static const size_t win_percentage = 90;
+
+/** Checks with the favorite alone before racing again */
+static const size_t solo_checks = 32;
+
+/** The race records are halved when reaching this, to forget old races */
+static const size_t races_to_remember = 64;
+
+/**
+ * A check of one yices context running in a separate thread. The thread only
+ * searches, all the terms must be converted beforehand.
+ */
+class yices2_context_check {
+
+  context_t* d_ctx;
+
+  /** The assumptions, if checking with assumptions */
+  const std::vector<term_t>* d_assumptions;
+
+  /** Notified when done */
+  check_completion& d_completion;
+
+  boost::mutex d_mutex;
+  boost::condition_variable d_finished_cond;
+
+  /** Is the check done */
+  bool d_finished;
+
+  /** The status of the check */
+  smt_status_t d_status;
+
+  /** The yices error, if any (errors are per thread) */
+  std::string d_error;
+
+  boost::thread d_thread;
+
+  void run() {
+    smt_status_t status = check_context(d_ctx, d_assumptions);
+    std::string error;
+    if (status == STATUS_ERROR) {
+      error = yices2_internal::yices_error();
+    }
+    {
+      boost::mutex::scoped_lock lock(d_mutex);
+      d_status = status;
+      d_error = error;
+      d_finished = true;
+      d_finished_cond.notify_all();
+    }
+    d_completion.notify();
+  }
+
+public:
+
+  yices2_context_check(context_t* ctx, const std::vector<term_t>* assumptions, check_completion& completion)
+  : d_ctx(ctx)
+  , d_assumptions(assumptions)
+  , d_completion(completion)
+  , d_finished(false)
+  , d_status(STATUS_UNKNOWN)
+  , d_thread(boost::bind(&yices2_context_check::run, this))
+  {}
+
+  ~yices2_context_check() {
+    stop();
+  }
+
+  /** Is the check done */
+  bool is_finished() {
+    boost::mutex::scoped_lock lock(d_mutex);
+    return d_finished;
+  }
+
+  /** Wait for the check and return the status */
+  smt_status_t get_status() {
+    if (d_thread.joinable()) {
+      d_thread.join();
+    }
+    return d_status;
+  }
+
+  /** The error message (if the status is an error) */
+  const std::string& get_error() const {
+    return d_error;
+  }
+
+  /** Stop the search and wait for the check */
+  void stop() {
+    {
+      boost::mutex::scoped_lock lock(d_mutex);
+      while (!d_finished) {
+        // The interrupt is lost if it comes before the search starts
+        lock.unlock();
+        yices_stop_search(d_ctx);
+        lock.lock();
+        d_finished_cond.timed_wait(lock, boost::posix_time::milliseconds(interrupt_period));
+      }
+    }
+    if (d_thread.joinable()) {
+      d_thread.join();
+    }
+  }
+};
+
+bool yices2_internal::is_definitive(int i, smt_status_t status) const {
+  switch (status) {
+  case STATUS_SAT:
+    return i == 0 ? !d_dpllt_incomplete : !d_mcsat_incomplete;
+  case STATUS_UNSAT:
+    return true;
+  default:
+    return false;
+  }
+}
+
+void yices2_internal::set_last_status(int i, smt_status_t status) {
+  smt_status_t& last = i == 0 ? d_last_check_status_dpllt : d_last_check_status_mcsat;
+  last = is_definitive(i, status) ? status : STATUS_UNKNOWN;
+}
+
+unsigned yices2_internal::query_kind(bool with_assumptions) const {
+  // Solvers are usually dedicated to one kind of query (e.g. induction or
+  // reachability), so we tell them apart by the classes of the assertions
+  unsigned kind = with_assumptions ? 1 : 0;
+  for (size_t i = 0; i < d_assertion_classes.size(); ++ i) {
+    kind |= 2 << d_assertion_classes[i];
+  }
+  return kind;
+}
+
+int yices2_internal::select_context(const race_record& record) const {
+  if (!d_parallel_adaptive || record.races < races_to_learn || record.solo >= solo_checks) {
+    return -1;
+  }
+  for (int i = 0; i < 2; ++ i) {
+    if (record.wins[i] * 100 >= record.races * win_percentage) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+solver::result yices2_internal::check_parallel(const std::vector<term_t>* assumptions) {
+
+  race_record& record = d_race_records[query_kind(assumptions != 0)];
+
+  int winner = -1;
+  smt_status_t status[2] = { STATUS_UNKNOWN, STATUS_UNKNOWN };
+  std::string error;
+
+  int favorite = select_context(record);
+  if (favorite >= 0) {
+    // Check with the favorite, and with the other one only if needed
+    TRACE("yices2::parallel") << "yices2[" << d_instance << "]: checking " << (favorite == 0 ? "dpllt" : "mcsat") << " alone" << std::endl;
+    for (int k = 0; k < 2 && winner < 0; ++ k) {
+      int i = k == 0 ? favorite : 1 - favorite;
+      status[i] = check_context(get_context(i), assumptions);
+      if (status[i] == STATUS_INTERRUPTED) {
+        break;
+      }
+      if (status[i] == STATUS_ERROR && error.empty()) {
+        error = yices_error();
+      }
+      if (is_definitive(i, status[i])) {
+        winner = i;
+      }
+    }
+    if (winner == favorite) {
+      record.solo ++;
+      winner = -1; // Not a race
+    } else {
+      record.solo = 0;
+    }
+  } else {
+    // Race them, the first definitive answer wins, and the other one stops
+    check_completion completion;
+    yices2_context_check dpllt(d_ctx_dpllt, assumptions, completion);
+    yices2_context_check mcsat(d_ctx_mcsat, assumptions, completion);
+    yices2_context_check* checks[2] = { &dpllt, &mcsat };
+    completion.wait(1);
+    for (int i = 0; i < 2 && winner < 0; ++ i) {
+      if (checks[i]->is_finished() && is_definitive(i, checks[i]->get_status())) {
+        winner = i;
+      }
+    }
+    if (winner < 0) {
+      completion.wait(2);
+      for (int i = 0; i < 2 && winner < 0; ++ i) {
+        if (is_definitive(i, checks[i]->get_status())) {
+          winner = i;
+        }
+      }
+    } else {
+      checks[1 - winner]->stop();
+    }
+    for (int i = 0; i < 2; ++ i) {
+      status[i] = checks[i]->get_status();
+      if (status[i] == STATUS_ERROR && error.empty()) {
+        error = checks[i]->get_error();
+      }
+    }
+    record.solo = 0;
+  }
+
+  // Learn from the winner
+  if (winner >= 0) {
+    TRACE("yices2::parallel") << "yices2[" << d_instance << "]: " << (winner == 0 ? "dpllt" : "mcsat") << " wins" << std::endl;
+    record.races ++;
+    record.wins[winner] ++;
+    if (record.races >= races_to_remember) {
+      record.races /= 2;
+      record.wins[0] /= 2;
+      record.wins[1] /= 2;
+    }
+  }
+
+  set_last_status(0, status[0]);
+  set_last_status(1, status[1]);
+
+  for (int i = 0; i < 2; ++ i) {
+    if (is_definitive(i, status[i])) {
+      return status[i] == STATUS_SAT ? solver::SAT : solver::UNSAT;
+    }
+  }
+
+  if (!error.empty()) {
+    throw exception("Yices error (check): " + error);
+  }
+
+  return solver::UNKNOWN;
+}
+
+void yices2_internal::interrupt() {
+  // Yices ignores this if the context is not searching
+  if (d_ctx_dpllt && d_dpllt_interruptible) {
+    yices_stop_search(d_ctx_dpllt);
+  }
+  if (d_ctx_mcsat && d_mcsat_interruptible) {
+    yices_stop_search(d_ctx_mcsat);
+  }
+}
+
+void yices2_internal::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  assert(d_last_check_status_dpllt == STATUS_UNSAT || d_last_check_status_mcsat == STATUS_UNSAT);
+
+  context_t* ctx = d_last_check_status_dpllt == STATUS_UNSAT ? d_ctx_dpllt : d_ctx_mcsat;
+  term_vector_t core;
+  yices_init_term_vector(&core);
+  int32_t ret = yices_get_unsat_core(ctx, &core);
+  if (ret < 0) {
+    yices_delete_term_vector(&core);
+    check_error(ret, "Yices error (unsat core)");
+  }
+
+  // Yices terms are hash-consed, so we can match them directly
+  for (size_t i = 0; i < d_last_assumptions.size(); ++ i) {
+    term_t assumption = to_yices2_term(d_last_assumptions[i]);
+    for (uint32_t j = 0; j < core.size; ++ j) {
+      if (core.data[j] == assumption) {
+        out.push_back(d_last_assumptions[i]);
+        break;
+      }
+    }
+  }
+
+  yices_delete_term_vector(&core);
+}
+
 bool yices2_internal::is_consistent() {
   if (d_ctx_dpllt) {
     smt_status_t status = yices_context_status(d_ctx_dpllt);
@@ -1156,18 +1735,6 @@ bool yices2_internal::is_consistent() {
   return true;
 }
 
-static
-expr::bitvector bitvector_from_int32(size_t size, int32_t* value) {
-  char* value_str = new char[size+1];
-  for (size_t i = 0; i < size; ++ i) {
-    value_str[size - i - 1] = value[i] ? '1' : '0';
-  }
-  value_str[size] = 0;
-  expr::bitvector bv(value_str);
-  delete[] value_str;
-  return bv;
-}
-
 void yices2_internal::get_variables(std::vector<expr::term_ref>& variables) {
   bool class_A_used = false;
   bool class_B_used = false;
@@ -1237,14 +1804,8 @@ model_t* yices2_internal::get_yices_model(expr::model::ref m) {
   return yices_model;
 }
 
-expr::model::ref yices2_internal::get_model() {
+model_t* yices2_internal::get_last_yices_model() {
   assert(d_last_check_status_dpllt == STATUS_SAT || d_last_check_status_mcsat == STATUS_SAT);
-  assert(d_A_variables.size() > 0 || d_B_variables.size() > 0);
-
-  int32_t ret = 0;
-
-  // Clear any data already there
-  expr::model::ref m = new expr::model(d_tm, false);
 
   // Get the model from yices
   model_t* yices_model =  (d_last_check_status_dpllt == STATUS_SAT) ?
@@ -1255,118 +1816,28 @@ expr::model::ref yices2_internal::get_model() {
     yices_pp_model(stderr, yices_model, 80, 100000, 0);
   }
 
-  // Get the variables
-  std::vector<expr::term_ref> variables;
-  bool class_A_used = false;
-  bool class_B_used = false;
-  bool class_T_used = false;
-  for (size_t i = 0; i < d_assertion_classes.size(); ++ i) {
-    switch (d_assertion_classes[i]) {
-    case solver::CLASS_A:
-      class_A_used = true;
-      break;
-    case solver::CLASS_B:
-      class_B_used = true;
-      break;
-    case solver::CLASS_T:
-      class_A_used = true;
-      class_B_used = true;
-      class_T_used = true;
-      break;
-    default:
-      assert(false);
-    }
-  }
+  return yices_model;
+}
 
-  if (class_A_used) {
-    variables.insert(variables.end(), d_A_variables.begin(), d_A_variables.end());
-  }
-  if (class_B_used) {
-    variables.insert(variables.end(), d_B_variables.begin(), d_B_variables.end());
-  }
-  if (class_T_used) {
-    variables.insert(variables.end(), d_T_variables.begin(), d_T_variables.end());
-  }
+expr::model::ref yices2_internal::get_model() {
+  assert(d_A_variables.size() > 0 || d_B_variables.size() > 0);
 
-  // See which variables we have to reason about
-  for (size_t i = 0; i < variables.size(); ++ i) {
-    expr::term_ref var = variables[i];
-    term_t yices_var = to_yices2_term(var);
-    expr::term_ref var_type = d_tm.type_of(var);
+  // Clear any data already there
+  expr::model::ref m = new expr::model(d_tm, false);
 
-    expr::value var_value;
-    switch (d_tm.term_of(var_type).op()) {
-    case expr::TYPE_BOOL: {
-      int32_t value;
-      ret = yices_get_bool_value(yices_model, yices_var, &value);
-      check_error(ret, "Error obtaining Bool value from Yices2 model.");
-      var_value = expr::value(value);
-      break;
-    }
-    case expr::TYPE_INTEGER: {
-      // The integer mpz_t value
-      mpz_t value;
-      mpz_init(value);
-      ret = yices_get_mpz_value(yices_model, yices_var, value);
-      check_error(ret, "Error obtaining integer value from Yices2 model.");
-      expr::rational rational_value(value);
-      var_value = expr::value(rational_value);
-      // Clear the temps
-      mpz_clear(value);
-      break;
-    }
-    case expr::TYPE_REAL: {
-      // The integer mpz_t value
-      mpq_t value;
-      mpq_init(value);
-      ret = yices_get_mpq_value(yices_model, yices_var, value);
-      // rational
-      if (ret == 0) {
-        expr::rational rational_value(value);
-        var_value = expr::value(rational_value);
-      } else {
-#ifdef WITH_LIBPOLY
-        lp_algebraic_number_t a;
-        lp_algebraic_number_construct_zero(&a);
-        ret = yices_get_algebraic_number_value(yices_model, yices_var, &a);
-        if (ret < 0) {
-          throw exception("Error obtaining real value from Yices2 model.");
-        }
-        // TODO: proper algebraic numbers
-        lp_rational_t a_q;
-        lp_rational_construct(&a_q);
-        lp_algebraic_number_to_rational(&a, &a_q);
-        var_value = expr::rational(&a_q);
-        lp_algebraic_number_destruct(&a);
-        lp_rational_destruct(&a_q);
-#else
-        throw exception("Error obtaining real value from Yices2 model.");
-#endif
-      }
-      // Clear the temps
-      mpq_clear(value);
-      break;
-    }
-    case expr::TYPE_BITVECTOR: {
-      size_t size = d_tm.get_bitvector_type_size(var_type);
-      int32_t* value = new int32_t[size];
-      ret = yices_get_bv_value(yices_model, yices_var, value);
-      check_error(ret, "Error obtaining bit-vector value from Yices2 model.");
-      expr::bitvector bv = bitvector_from_int32(size, value);
-      var_value = expr::value(bv);
-      delete[] value;
-      break;
-    }
-    default:
-      assert(false);
-    }
+  // The source keeps the yices model
+  yices2_model_source* source = new yices2_model_source(this, get_last_yices_model());
+  expr::model_source::ref source_ref(source);
 
-    // Add the association
-    m->set_variable_value(var, var_value);
-  }
+  // Get the variables
+  std::vector<expr::term_ref> variables;
+  get_variables(variables);
 
-  // Free the yices model
-  yices_free_model(yices_model);
+  // Values are obtained on demand
+  for (size_t i = 0; i < variables.size(); ++ i) {
+    source->add_variable(variables[i], to_yices2_term(variables[i]));
+  }
+  m->set_source(source_ref, variables);
 
   return m;
 }
@@ -1412,19 +1883,28 @@ void yices2_internal::generalize(smt::solver::generalization_type type, std::vec
 
   assert(!d_assertions.empty());
 
-  // Get the model
-  expr::model::ref m = get_model();
-
-  if (output::trace_tag_is_enabled("yices2")) {
-    std::cerr << "model:" << (*m) << std::endl;
-  }
+  // Get the model, no need to go through our values
+  model_t* yices_model = get_last_yices_model();
 
   // Generalize with the current model
-  generalize(type, m, projection_out);
+  generalize(type, yices_model, projection_out);
+
+  yices_free_model(yices_model);
 }
 
 void yices2_internal::generalize(smt::solver::generalization_type type, expr::model::ref m, std::vector<expr::term_ref>& projection_out) {
 
+  // Get yices model from model
+  model_t* yices_model = get_yices_model(m);
+
+  // Generalize with the given model
+  generalize(type, yices_model, projection_out);
+
+  yices_free_model(yices_model);
+}
+
+void yices2_internal::generalize(smt::solver::generalization_type type, model_t* yices_model, std::vector<expr::term_ref>& projection_out) {
+
   assert(!d_assertions.empty());
 
   // When we generalize backward we eliminate from T and B
@@ -1494,9 +1974,6 @@ void yices2_internal::generalize(smt::solver::generalization_type type, expr::mo
     break;
   }
 
-  // Get yices model from model
-  model_t* yices_model = get_yices_model(m);
-
   if (output::trace_tag_is_enabled("yices2::gen")) {
     std::cerr << "assertions:" << std::endl;
     for (size_t i = 0; i < assertions_size; ++ i) {
@@ -1556,7 +2033,6 @@ void yices2_internal::generalize(smt::solver::generalization_type type, expr::mo
   // Free temps
   delete[] variables;
   delete[] assertions;
-  yices_free_model(yices_model);
 }
 
 void yices2_internal::set_hint(expr::model::ref m) {
@@ -1620,6 +2096,7 @@ void yices2_internal::add_variable(expr::term_ref var, smt::solver::variable_cla
 
 void yices2_internal::gc_collect(const expr::gc_relocator& gc_reloc) {
   gc_reloc.reloc(d_assertions);
+  gc_reloc.reloc(d_last_assumptions);
   gc_reloc.reloc(d_A_variables);
   gc_reloc.reloc(d_B_variables);
   gc_reloc.reloc(d_T_variables);
@@ -27,6 +27,8 @@
 #include <gmp.h>
 #include <yices.h>
 #include <vector>
+#include <set>
+#include <map>
 
 #include "expr/term_manager.h"
 #include "expr/model.h"
@@ -36,15 +38,22 @@ namespace sally {
 namespace smt {
 
 class yices2_term_cache;
+class yices2_model_source;
 
 class yices2_internal {
 
   /** The term manager */
   expr::term_manager& d_tm;
 
-  /** Number of yices instances */
+  /** Number of yices instances (and models kept in yices) */
   static int s_instances;
 
+  /** Initialize yices if this is the first instance */
+  static void attach_yices();
+
+  /** Exit yices if this was the last instance */
+  static void detach_yices(yices2_term_cache* cache);
+
   /** Yices boolean type */
   static type_t s_bool_type;
 
@@ -60,6 +69,12 @@ class yices2_internal {
   /** Yices context (dpllt) */
   context_t *d_ctx_mcsat;
 
+  /** Can dpllt be interrupted (it restores the context after the interrupt) */
+  bool d_dpllt_interruptible;
+
+  /** Can mcsat be interrupted (it restores the context after the interrupt) */
+  bool d_mcsat_interruptible;
+
   /** Is dpllt incomplete */
   bool d_dpllt_incomplete;
 
@@ -70,6 +85,46 @@ class yices2_internal {
   std::vector<bool> d_dpllt_incomplete_log;
   std::vector<bool> d_mcsat_incomplete_log;
 
+  /** Check dpllt and mcsat in parallel (parallel mode) */
+  bool d_parallel;
+
+  /** Learn which context wins and stop racing when confident */
+  bool d_parallel_adaptive;
+
+  /** Outcome of the races for one kind of query */
+  struct race_record {
+    /** Number of races with a winner */
+    size_t races;
+    /** Races won by dpllt (0) and mcsat (1) */
+    size_t wins[2];
+    /** Checks done with the favorite alone since the last race */
+    size_t solo;
+    race_record(): races(0), solo(0) { wins[0] = wins[1] = 0; }
+  };
+
+  typedef std::map<unsigned, race_record> race_record_map;
+
+  /** The race records, per kind of query */
+  race_record_map d_race_records;
+
+  /** Get the context (0 for dpllt, 1 for mcsat) */
+  context_t* get_context(int i) const { return i == 0 ? d_ctx_dpllt : d_ctx_mcsat; }
+
+  /** Is the status of the context SAT (and the context complete) or UNSAT */
+  bool is_definitive(int i, smt_status_t status) const;
+
+  /** Record the status of the last check of the context */
+  void set_last_status(int i, smt_status_t status);
+
+  /** The kind of the current query (used assertion classes, assumptions) */
+  unsigned query_kind(bool with_assumptions) const;
+
+  /** The context to check alone for the record (-1 to race them) */
+  int select_context(const race_record& record) const;
+
+  /** Check dpllt and mcsat in parallel (or the favorite alone) */
+  solver::result check_parallel(const std::vector<term_t>* assumptions);
+
   /** All assertions we have in context (strong)  */
   std::vector<expr::term_ref_strong> d_assertions;
 
@@ -105,6 +160,9 @@ class yices2_internal {
   /** Last check return (mcsat) */
   smt_status_t d_last_check_status_mcsat;
 
+  /** Assumptions of the last check with assumptions */
+  std::vector<expr::term_ref_strong> d_last_assumptions;
+
   /** Yices config (dpllt) */
   ctx_config_t* d_config_dpllt;
   /** Yices config (mcsat) */
@@ -122,9 +180,20 @@ class yices2_internal {
   /** Check the error */
   void check_error(int ret, const char* error_msg) const;
 
+  /** Make a context, in interactive mode if possible (sets interruptible) */
+  context_t* new_context(ctx_config_t* config, bool& interruptible);
+
   /** Get the variables used in assertions */
   void get_variables(std::vector<expr::term_ref>& variables);
 
+  /** Models that can still use this instance to evaluate formulas */
+  std::set<yices2_model_source*> d_model_sources;
+
+  /** Return the generalization in the given yices model */
+  void generalize(smt::solver::generalization_type type, model_t* yices_model, std::vector<expr::term_ref>& projection_out);
+
+  friend class yices2_model_source;
+
 public:
 
   /** Construct an instance of yices with the given term manager and options */
@@ -163,12 +232,24 @@ public:
   /** Check satisfiability */
   solver::result check();
 
+  /** Check satisfiability under the assumptions */
+  solver::result check(const std::vector<expr::term_ref>& assumptions);
+
+  /** Get the unsat assumptions of the last check with assumptions */
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+
+  /** Stop the search in both contexts (can be called from another thread) */
+  void interrupt();
+
   /** Is the state consistent */
   bool is_consistent();
 
   /** Returns the model */
   expr::model::ref get_model();
 
+  /** Returns the yices model of the last satisfiable check (to be freed) */
+  model_t* get_last_yices_model();
+
   /** Returns yices model from sally model */
   model_t* get_yices_model(expr::model::ref m);
 
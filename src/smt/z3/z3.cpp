@@ -40,6 +40,7 @@
 #include "smt/z3/z3.h"
 #include "smt/z3/z3_internal.h"
 #include "utils/trace.h"
+#include "utils/budget.h"
 
 #define unused_var(x) { (void) x; }
 
@@ -63,9 +64,25 @@ void z3::add(expr::term_ref f, formula_class f_class) {
 
 solver::result z3::check() {
   TRACE("z3") << "z3[" << d_internal->instance() << "]: check()" << std::endl;
+  utils::budget::check();
   return d_internal->check();
 }
 
+solver::result z3::check_with_assumptions(const std::vector<expr::term_ref>& assumptions) {
+  TRACE("z3") << "z3[" << d_internal->instance() << "]: check() with " << assumptions.size() << " assumptions" << std::endl;
+  utils::budget::check();
+  return d_internal->check(assumptions);
+}
+
+void z3::interrupt() {
+  d_internal->interrupt();
+}
+
+void z3::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  TRACE("z3") << "z3[" << d_internal->instance() << "]: get_unsat_assumptions()" << std::endl;
+  d_internal->get_unsat_assumptions(out);
+}
+
 expr::model::ref z3::get_model() const {
   TRACE("z3") << "z3[" << d_internal->instance() << "]: get_model()" << std::endl;
   return d_internal->get_model(d_A_variables, d_T_variables, d_B_variables);
@@ -45,7 +45,7 @@ public:
 
   /** Features */
   bool supports(feature f) const {
-    return false;
+    return f == ASSUMPTIONS || f == INTERRUPT;
   }
 
   /** Add an assertion f to the solver */
@@ -57,6 +57,12 @@ public:
   /** Check the assertions for satisfiability */
   result check();
 
+  /** Get the unsat assumptions */
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+
+  /** Stop a running check */
+  void interrupt();
+
   /** Get the model */
   expr::model::ref get_model() const;
 
@@ -71,6 +77,11 @@ public:
 
   /** Collect garbage */
   void gc();
+
+protected:
+
+  /** Check the assertions with the assumptions */
+  result check_with_assumptions(const std::vector<expr::term_ref>& assumptions);
 };
 
 }
@@ -66,6 +66,8 @@ void z3_common::set_term_cache(expr::term_ref t, Z3_ast t_z3) {
     d_permanent_terms.push_back(t);
     d_permanent_terms_z3.push_back(t_z3);
     d_z3_to_term_cache[t_z3] = t;
+    // Both caches are released in clear()
+    Z3_inc_ref(d_ctx, t_z3);
   } else {
     // Mark cache as dirty
     d_cache_is_clean = false;
@@ -111,6 +113,8 @@ void z3_common::set_term_cache(Z3_ast t_z3, expr::term_ref t) {
     d_permanent_terms.push_back(t);
     d_permanent_terms_z3.push_back(t_z3);
     d_term_to_z3_cache[t] = t_z3;
+    // Both caches are released in clear()
+    Z3_inc_ref(d_ctx, t_z3);
   } else {
     // Mark cache as dirty
     d_cache_is_clean = false;
@@ -32,6 +32,141 @@ namespace smt {
 
 int z3_internal::s_instances = 0;
 
+/** Check for z3 errors in model evaluation */
+static
+void check_z3_model_error(Z3_context ctx) {
+  Z3_error_code error = Z3_get_error_code(ctx);
+  if (error != Z3_OK) {
+    std::stringstream ss;
+    Z3_string msg = Z3_get_error_msg(ctx, error);
+    ss << "Z3 error (model): " << msg << ".";
+    throw exception(ss.str());
+  }
+}
+
+/**
+ * A model kept in z3. Values are converted when asked for, and formulas are
+ * evaluated by z3 while the solver instance is alive.
+ */
+class z3_model_source : public expr::model_source {
+
+  /** The solver instance, null once destroyed */
+  z3_internal* d_internal;
+
+  expr::term_manager& d_tm;
+
+  Z3_context d_ctx;
+
+  Z3_model d_model;
+
+  typedef std::map<expr::term_ref, Z3_ast> variable_map;
+
+  /** The variables of the model */
+  variable_map d_variables;
+
+public:
+
+  z3_model_source(z3_internal* internal, Z3_model model)
+  : d_internal(internal)
+  , d_tm(internal->d_tm)
+  , d_ctx(internal->d_ctx)
+  , d_model(model)
+  {
+    Z3_model_inc_ref(d_ctx, d_model);
+    d_internal->d_model_sources.insert(this);
+  }
+
+  ~z3_model_source() {
+    if (d_internal) {
+      d_internal->d_model_sources.erase(this);
+    }
+    for (variable_map::const_iterator it = d_variables.begin(); it != d_variables.end(); ++ it) {
+      Z3_dec_ref(d_ctx, it->second);
+    }
+    Z3_model_dec_ref(d_ctx, d_model);
+  }
+
+  /** The solver instance is gone */
+  void detach() {
+    d_internal = 0;
+  }
+
+  void add_variable(expr::term_ref var, Z3_ast z3_var) {
+    Z3_inc_ref(d_ctx, z3_var);
+    d_variables[var] = z3_var;
+  }
+
+  expr::value get_value(expr::term_ref var) {
+
+    variable_map::const_iterator find = d_variables.find(var);
+    assert(find != d_variables.end());
+
+    expr::term_ref var_type = d_tm.type_of(var);
+    Z3_ast value;
+    bool ok = Z3_model_eval(d_ctx, d_model, find->second, 1, &value);
+    if (ok) {
+      Z3_inc_ref(d_ctx, value);
+    }
+
+    expr::value var_value;
+    switch (d_tm.term_of(var_type).op()) {
+    case expr::TYPE_BOOL: {
+      var_value = expr::value(Z3_get_bool_value(d_ctx, value) == Z3_L_TRUE);
+      break;
+    }
+    case expr::TYPE_INTEGER: {
+      Z3_string value_string = Z3_get_numeral_string(d_ctx, value);
+      expr::rational q_value(value_string);
+      var_value = expr::value(q_value);
+      break;
+    }
+    case expr::TYPE_REAL: {
+      Z3_string value_string = Z3_get_numeral_string(d_ctx, value);
+      expr::rational q_value(value_string);
+      var_value = expr::value(q_value);
+      break;
+    }
+    case expr::TYPE_BITVECTOR: {
+      Z3_string value_string = Z3_get_numeral_string(d_ctx, value);
+      size_t bv_size = d_tm.get_bitvector_size(var);
+      expr::integer z_value(value_string, 10);
+      var_value = expr::value(expr::bitvector(bv_size, z_value));
+      break;
+    }
+    default:
+      assert(false);
+    }
+
+    if (ok) {
+      Z3_dec_ref(d_ctx, value);
+    }
+
+    check_z3_model_error(d_ctx);
+
+    return var_value;
+  }
+
+  bool is_true(expr::term_ref f, bool& result) {
+    if (d_internal == 0) {
+      return false;
+    }
+    Z3_ast z3_f = d_internal->to_z3_term(f);
+    Z3_ast value;
+    if (!Z3_model_eval(d_ctx, d_model, z3_f, 1, &value)) {
+      return false;
+    }
+    Z3_inc_ref(d_ctx, value);
+    Z3_lbool b = Z3_get_bool_value(d_ctx, value);
+    Z3_dec_ref(d_ctx, value);
+    check_z3_model_error(d_ctx);
+    if (b == Z3_L_UNDEF) {
+      return false;
+    }
+    result = (b == Z3_L_TRUE);
+    return true;
+  }
+};
+
 z3_internal::z3_internal(expr::term_manager& tm, const options& opts)
 : d_tm(tm)
 , d_ctx(0)
@@ -66,6 +201,12 @@ z3_internal::z3_internal(expr::term_manager& tm, const options& opts)
 
 z3_internal::~z3_internal() {
 
+  // Models can't evaluate formulas anymore
+  std::set<z3_model_source*>::const_iterator it = d_model_sources.begin();
+  for (; it != d_model_sources.end(); ++ it) {
+    (*it)->detach();
+  }
+
   // The context
   Z3_solver_dec_ref(d_ctx, d_solver);
 
@@ -770,7 +911,7 @@ expr::term_ref z3_internal::to_term(Z3_ast z3_term) {
   case Z3_NUMERAL_AST:
     switch (sort_kind) {
     case Z3_BOOL_SORT:
-      result = d_tm.mk_boolean_constant(Z3_get_bool_value(d_ctx, z3_term));
+      result = d_tm.mk_boolean_constant(Z3_get_bool_value(d_ctx, z3_term) == Z3_L_TRUE);
       break;
     case Z3_INT_SORT: {
       Z3_string value_string = Z3_get_numeral_string(d_ctx, z3_term);
@@ -877,6 +1018,64 @@ solver::result z3_internal::check() {
   return solver::UNKNOWN;
 }
 
+solver::result z3_internal::check(const std::vector<expr::term_ref>& assumptions) {
+
+  d_last_assumptions.clear();
+  std::vector<Z3_ast> z3_assumptions;
+  for (size_t i = 0; i < assumptions.size(); ++ i) {
+    d_last_assumptions.push_back(expr::term_ref_strong(d_tm, assumptions[i]));
+    z3_assumptions.push_back(to_z3_term(assumptions[i]));
+  }
+
+  d_last_check_status = Z3_solver_check_assumptions(d_ctx, d_solver, z3_assumptions.size(), z3_assumptions.empty() ? 0 : &z3_assumptions[0]);
+  Z3_error_code error = Z3_get_error_code(d_ctx);
+  if (error != Z3_OK) {
+    std::stringstream ss;
+    Z3_string msg = Z3_get_error_msg(d_ctx, error);
+    ss << "Z3 error (check): " << msg << ".";
+    throw exception(ss.str());
+  }
+
+  switch (d_last_check_status) {
+  case Z3_L_FALSE:
+    return solver::UNSAT;
+  case Z3_L_UNDEF:
+    return solver::UNKNOWN;
+  case Z3_L_TRUE:
+    return solver::SAT;
+  default:
+    assert(false);
+  }
+
+  return solver::UNKNOWN;
+}
+
+void z3_internal::interrupt() {
+  // The check then returns Z3_L_UNDEF
+  Z3_interrupt(d_ctx);
+}
+
+void z3_internal::get_unsat_assumptions(std::vector<expr::term_ref>& out) {
+  assert(d_last_check_status == Z3_L_FALSE);
+
+  Z3_ast_vector core = Z3_solver_get_unsat_core(d_ctx, d_solver);
+  Z3_ast_vector_inc_ref(d_ctx, core);
+
+  // Terms are hash-consed, so we can match them directly
+  unsigned size = Z3_ast_vector_size(d_ctx, core);
+  for (size_t i = 0; i < d_last_assumptions.size(); ++ i) {
+    Z3_ast assumption = to_z3_term(d_last_assumptions[i]);
+    for (unsigned j = 0; j < size; ++ j) {
+      if (Z3_is_eq_ast(d_ctx, assumption, Z3_ast_vector_get(d_ctx, core, j))) {
+        out.push_back(d_last_assumptions[i]);
+        break;
+      }
+    }
+  }
+
+  Z3_ast_vector_dec_ref(d_ctx, core);
+}
+
 expr::model::ref z3_internal::get_model(const std::set<expr::term_ref>& x_variables, const std::set<expr::term_ref>& T_variables, const std::set<expr::term_ref>& y_variables) {
   assert(d_last_check_status == Z3_L_TRUE);
   assert(x_variables.size() > 0 || y_variables.size() > 0);
@@ -886,19 +1085,16 @@ expr::model::ref z3_internal::get_model(const std::set<expr::term_ref>& x_variab
 
   // Get the model from z3
   Z3_model z3_model = Z3_solver_get_model(d_ctx, d_solver);
-  Z3_error_code error = Z3_get_error_code(d_ctx);
-  if (error != Z3_OK) {
-    std::stringstream ss;
-    Z3_string msg = Z3_get_error_msg(d_ctx, error);
-    ss << "Z3 error (model): " << msg << ".";
-    throw exception(ss.str());
-  }
-  Z3_model_inc_ref(d_ctx, z3_model);
+  check_z3_model_error(d_ctx);
 
   if (output::trace_tag_is_enabled("z3::model")) {
     std::cerr << Z3_model_to_string(d_ctx, z3_model) << std::endl;
   }
 
+  // The source keeps the z3 model
+  z3_model_source* source = new z3_model_source(this, z3_model);
+  expr::model_source::ref source_ref(source);
+
   // Get the variables
   std::vector<expr::term_ref> variables;
   bool class_A_used = false;
@@ -932,64 +1128,11 @@ expr::model::ref z3_internal::get_model(const std::set<expr::term_ref>& x_variab
     variables.insert(variables.end(), T_variables.begin(), T_variables.end());
   }
 
-  // See which variables we have to reason about
+  // Values are obtained on demand
   for (size_t i = 0; i < variables.size(); ++ i) {
-    expr::term_ref var = variables[i];
-    Z3_ast z3_var = to_z3_term(var);
-    expr::term_ref var_type = d_tm.type_of(var);
-    Z3_ast value;
-    bool ok = Z3_model_eval(d_ctx, z3_model, z3_var, 1, &value);
-    if (ok) {
-      Z3_inc_ref(d_ctx, value);
-    }
-
-    expr::value var_value;
-    switch (d_tm.term_of(var_type).op()) {
-    case expr::TYPE_BOOL: {
-      var_value = expr::value(Z3_get_bool_value(d_ctx, value));
-      break;
-    }
-    case expr::TYPE_INTEGER: {
-      Z3_string value_string = Z3_get_numeral_string(d_ctx, value);
-      expr::rational q_value(value_string);
-      var_value = expr::value(q_value);
-      break;
-    }
-    case expr::TYPE_REAL: {
-      Z3_string value_string = Z3_get_numeral_string(d_ctx, value);
-      expr::rational q_value(value_string);
-      var_value = expr::value(q_value);
-      break;
-    }
-    case expr::TYPE_BITVECTOR: {
-      Z3_string value_string = Z3_get_numeral_string(d_ctx, value);
-      size_t bv_size = d_tm.get_bitvector_size(var);
-      expr::integer z_value(value_string, 10);
-      var_value = expr::value(expr::bitvector(bv_size, z_value));
-      break;
-    }
-    default:
-      assert(false);
-    }
-
-    if (ok) {
-      Z3_dec_ref(d_ctx, value);
-    }
-
-    // Add the association
-    m->set_variable_value(var, var_value);
-
-    Z3_error_code error = Z3_get_error_code(d_ctx);
-    if (error != Z3_OK) {
-      std::stringstream ss;
-      Z3_string msg = Z3_get_error_msg(d_ctx, error);
-      ss << "Z3 error (model): " << msg << ".";
-      throw exception(ss.str());
-    }
-}
-
-  // Free the yices model
-  Z3_model_dec_ref(d_ctx, z3_model);
+    source->add_variable(variables[i], to_z3_term(variables[i]));
+  }
+  m->set_source(source_ref, variables);
 
   return m;
 }
@@ -1055,6 +1198,7 @@ void z3_internal::add_variable(expr::term_ref var, smt::solver::variable_class f
 
 void z3_internal::gc_collect(const expr::gc_relocator& gc_reloc) {
   gc_reloc.reloc(d_assertions);
+  gc_reloc.reloc(d_last_assumptions);
   gc_reloc.reloc(d_A_variables);
   gc_reloc.reloc(d_B_variables);
   gc_reloc.reloc(d_T_variables);
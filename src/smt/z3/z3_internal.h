@@ -41,6 +41,7 @@ namespace sally {
 namespace smt {
 
 class z3_common;
+class z3_model_source;
 
 class z3_internal {
 
@@ -89,9 +90,17 @@ class z3_internal {
   /** Last check return */
   Z3_lbool d_last_check_status;
 
+  /** Assumptions of the last check with assumptions */
+  std::vector<expr::term_ref_strong> d_last_assumptions;
+
   /** The instance */
   size_t d_instance;
 
+  /** Models that can still use this instance to evaluate formulas */
+  std::set<z3_model_source*> d_model_sources;
+
+  friend class z3_model_source;
+
 public:
 
   /** Construct an instance of yices with the given temr manager and options */
@@ -127,6 +136,15 @@ public:
   /** Check satisfiability */
   solver::result check();
 
+  /** Check satisfiability under the assumptions */
+  solver::result check(const std::vector<expr::term_ref>& assumptions);
+
+  /** Get the unsat assumptions of the last check with assumptions */
+  void get_unsat_assumptions(std::vector<expr::term_ref>& out);
+
+  /** Interrupt the check (can be called from another thread) */
+  void interrupt();
+
   /** Returns the model */
   expr::model::ref get_model(const std::set<expr::term_ref>& x_variables, const std::set<expr::term_ref>& T_variables, const std::set<expr::term_ref>& y_variables);
 
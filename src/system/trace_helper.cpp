@@ -39,6 +39,10 @@ size_t trace_helper::size() const {
   return d_state_variables_structs.size();
 }
 
+size_t trace_helper::get_model_size() const {
+  return d_model_size;
+}
+
 void trace_helper::clear_model() {
   d_model_size = 0;
   d_model = new expr::model(tm(), false);
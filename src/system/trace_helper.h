@@ -101,6 +101,9 @@ public:
   /** Get the size of the trace */
   size_t size() const;
 
+  /** Get the number of frames in the model */
+  size_t get_model_size() const;
+
   /** Clear the trace helper (remove all model information) */
   void clear_model();
 
@@ -0,0 +1,153 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "system/transition_functions.h"
+
+#include "expr/gc_relocator.h"
+
+#include <set>
+#include <map>
+
+namespace sally {
+namespace system {
+
+transition_functions::transition_functions(expr::term_manager& tm)
+: d_tm(tm)
+{}
+
+/** Topological order of the functions, returns false if cyclic */
+static
+bool order_functions(size_t i, const std::vector< std::vector<size_t> >& deps, std::vector<int>& mark, std::vector<size_t>& order) {
+  if (mark[i] == 2) { return true; }
+  if (mark[i] == 1) { return false; }
+  mark[i] = 1;
+  for (size_t j = 0; j < deps[i].size(); ++ j) {
+    if (!order_functions(deps[i][j], deps, mark, order)) {
+      return false;
+    }
+  }
+  mark[i] = 2;
+  order.push_back(i);
+  return true;
+}
+
+bool transition_functions::extract(const transition_system* ts) {
+
+  const state_type* st = ts->get_state_type();
+  const std::vector<expr::term_ref>& x_next = st->get_variables(state_type::STATE_NEXT);
+
+  d_functions.clear();
+  d_functions.resize(x_next.size());
+  d_order.clear();
+  d_constraints.clear();
+
+  std::map<expr::term_ref, size_t> next_index;
+  for (size_t i = 0; i < x_next.size(); ++ i) {
+    next_index[x_next[i]] = i;
+  }
+
+  // Go through the conjuncts, and pick x' = f
+  std::vector<expr::term_ref> to_process;
+  to_process.push_back(ts->get_transition_relation());
+  while (!to_process.empty()) {
+    expr::term_ref f = to_process.back();
+    to_process.pop_back();
+    const expr::term& t = d_tm.term_of(f);
+    if (t.op() == expr::TERM_AND) {
+      for (size_t i = t.size(); i > 0; -- i) {
+        to_process.push_back(t[i-1]);
+      }
+      continue;
+    }
+    if (t.op() == expr::TERM_EQ) {
+      std::map<expr::term_ref, size_t>::const_iterator find = next_index.find(t[0]);
+      if (find != next_index.end() && d_functions[find->second].is_null()) {
+        d_functions[find->second] = t[1];
+        continue;
+      }
+      find = next_index.find(t[1]);
+      if (find != next_index.end() && d_functions[find->second].is_null()) {
+        d_functions[find->second] = t[0];
+        continue;
+      }
+    }
+    d_constraints.push_back(f);
+  }
+
+  // Next variables that are not mentioned at all are unconstrained
+  std::set<expr::term_ref> constrained;
+  for (size_t i = 0; i < d_constraints.size(); ++ i) {
+    d_tm.get_variables(d_constraints[i], constrained);
+  }
+  for (size_t i = 0; i < x_next.size(); ++ i) {
+    if (!d_functions[i].is_null()) {
+      d_tm.get_variables(d_functions[i], constrained);
+    }
+  }
+
+  // All other next variables must be defined, and with no cycles
+  std::vector< std::vector<size_t> > deps(x_next.size());
+  for (size_t i = 0; i < x_next.size(); ++ i) {
+    if (d_functions[i].is_null()) {
+      if (constrained.count(x_next[i]) > 0) {
+        return false;
+      }
+      continue;
+    }
+    std::set<expr::term_ref> vars;
+    d_tm.get_variables(d_functions[i], vars);
+    std::set<expr::term_ref>::const_iterator it = vars.begin();
+    for (; it != vars.end(); ++ it) {
+      std::map<expr::term_ref, size_t>::const_iterator find = next_index.find(*it);
+      if (find != next_index.end()) {
+        deps[i].push_back(find->second);
+      }
+    }
+  }
+  std::vector<int> mark(x_next.size(), 0);
+  for (size_t i = 0; i < x_next.size(); ++ i) {
+    if (!order_functions(i, deps, mark, d_order)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool transition_functions::evaluate(expr::model& m, const std::vector<expr::term_ref>& x_next) const {
+  for (size_t i = 0; i < d_order.size(); ++ i) {
+    size_t var = d_order[i];
+    if (!d_functions[var].is_null()) {
+      m.set_variable_value(x_next[var], m.get_term_value(d_functions[var]));
+    }
+  }
+  for (size_t i = 0; i < d_constraints.size(); ++ i) {
+    if (!m.is_true(d_constraints[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void transition_functions::gc_collect(const expr::gc_relocator& gc_reloc) {
+  gc_reloc.reloc(d_functions);
+  gc_reloc.reloc(d_constraints);
+}
+
+}
+}
@@ -0,0 +1,81 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "expr/term_manager.h"
+#include "expr/model.h"
+#include "system/transition_system.h"
+
+#include <vector>
+
+namespace sally {
+namespace system {
+
+/**
+ * Next-state functions of a transition system. If the transition relation
+ * is a conjunction that defines each next-state variable as x' = f, where f
+ * is over the current, input and other next-state variables (with no
+ * cycles), then the successors can be computed by evaluation. Next-state
+ * variables that are not mentioned at all are unconstrained (no function),
+ * and the rest of the conjuncts are kept as constraints on the step.
+ */
+class transition_functions {
+
+  /** The term manager */
+  expr::term_manager& d_tm;
+
+  /** Next-state function of each state variable (null if unconstrained) */
+  std::vector<expr::term_ref> d_functions;
+
+  /** Order in which to evaluate the next-state functions */
+  std::vector<size_t> d_order;
+
+  /** Constraints of the transition relation that are not functions */
+  std::vector<expr::term_ref> d_constraints;
+
+public:
+
+  transition_functions(expr::term_manager& tm);
+
+  /** Try to get the next-state functions of the transition system, returns true if all found */
+  bool extract(const transition_system* ts);
+
+  /** Is the i-th next-state variable unconstrained */
+  bool is_unconstrained(size_t i) const { return d_functions[i].is_null(); }
+
+  /** Get the next-state function of the i-th variable (null if unconstrained) */
+  expr::term_ref get_function(size_t i) const { return d_functions[i]; }
+
+  /** Get the constraints of the transition relation that are not functions */
+  const std::vector<expr::term_ref>& get_constraints() const { return d_constraints; }
+
+  /**
+   * Evaluate the next-state functions in the model, and set the values of
+   * the next-state variables. The values of the current state, the inputs,
+   * and the unconstrained next-state variables must be in the model already.
+   * Returns true if the constraints of the step hold. Only reads the terms.
+   */
+  bool evaluate(expr::model& m, const std::vector<expr::term_ref>& x_next) const;
+
+  /** Relocate the terms */
+  void gc_collect(const expr::gc_relocator& gc_reloc);
+};
+
+}
+}
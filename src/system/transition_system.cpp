@@ -69,9 +69,22 @@ void transition_system::add_assumption(state_formula* assumption) {
 }
 
 void transition_system::add_invariant(state_formula* invariant) {
+  boost::mutex::scoped_lock lock(d_invariants_mutex);
   d_invariants.push_back(invariant);
 }
 
+size_t transition_system::get_invariants_size() const {
+  boost::mutex::scoped_lock lock(d_invariants_mutex);
+  return d_invariants.size();
+}
+
+void transition_system::get_invariants(size_t begin, std::vector<expr::term_ref>& out) const {
+  boost::mutex::scoped_lock lock(d_invariants_mutex);
+  for (size_t i = begin; i < d_invariants.size(); ++ i) {
+    out.push_back(d_invariants[i]->get_formula());
+  }
+}
+
 expr::term_ref transition_system::get_assumption() const {
   std::vector<expr::term_ref> assumption_terms;
   for (size_t i = 0; i < d_assumptions.size(); ++ i) {
@@ -24,6 +24,7 @@
 #include "trace_helper.h"
 
 #include <iosfwd>
+#include <boost/thread/mutex.hpp>
 
 namespace sally {
 namespace system {
@@ -55,9 +56,8 @@ class transition_system {
   /** Invariants */
   std::vector<state_formula*> d_invariants;
 
-  const std::vector<state_formula*>& get_invariants() const {
-    return d_invariants;
-  }
+  /** Invariants can be added by generators running alongside the engines */
+  mutable boost::mutex d_invariants_mutex;
 
   /** Get the assumptions in one state formula */
   expr::term_ref get_assumption() const;
@@ -87,9 +87,23 @@ public:
   /** Add an assumption on the state type (takes over the pointer) */
   void add_assumption(state_formula* assumption);
 
-  /** Add an invariant to the system (takes over the pointer) */
+  /**
+   * Add an invariant to the system (takes over the pointer). The invariant
+   * is trusted, i.e. it must hold in all reachable states. Safe to call
+   * while an engine is running a query on the system.
+   */
   void add_invariant(state_formula* invariant);
 
+  /** Number of invariants added so far */
+  size_t get_invariants_size() const;
+
+  /**
+   * Get the formulas of the invariants with index begin, begin + 1, ...
+   * Engines keep the index of the first invariant they haven't seen, so
+   * that they can pick up invariants that arrive during a query.
+   */
+  void get_invariants(size_t begin, std::vector<expr::term_ref>& out) const;
+
   /** Print it to the stream */
   void to_stream(std::ostream& out) const;
 };
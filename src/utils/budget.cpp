@@ -0,0 +1,158 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "utils/budget.h"
+
+#include <boost/thread/mutex.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <fstream>
+#include <unistd.h>
+#include <sys/resource.h>
+
+namespace sally {
+namespace utils {
+
+namespace {
+
+/** How often to sample the memory (in milliseconds) */
+const long memory_sample_period = 100;
+
+/** The budget currently in effect */
+struct budget_state {
+
+  /** Is there a budget */
+  bool active;
+
+  /** Is there a deadline */
+  bool has_deadline;
+
+  /** The deadline */
+  boost::posix_time::ptime deadline;
+
+  /** Memory limit in MB (0 for no limit) */
+  size_t memory_limit;
+
+  /** Last time we sampled the memory */
+  boost::posix_time::ptime last_sample;
+
+  /** Memory at the last sample */
+  size_t last_memory;
+
+  /** Solvers can check from multiple threads */
+  boost::mutex mutex;
+
+  budget_state()
+  : active(false)
+  , has_deadline(false)
+  , memory_limit(0)
+  , last_memory(0)
+  {}
+};
+
+budget_state s_budget;
+
+boost::posix_time::ptime now() {
+  return boost::posix_time::microsec_clock::universal_time();
+}
+
+/** Sample the memory if it's been a while, call with the lock */
+size_t sample_memory() {
+  boost::posix_time::ptime current = now();
+  if (s_budget.last_sample.is_not_a_date_time() || (current - s_budget.last_sample).total_milliseconds() >= memory_sample_period) {
+    s_budget.last_memory = budget::get_memory_usage();
+    s_budget.last_sample = current;
+  }
+  return s_budget.last_memory;
+}
+
+}
+
+void budget::start(double time_limit, size_t memory_limit) {
+  boost::mutex::scoped_lock lock(s_budget.mutex);
+  s_budget.active = time_limit > 0 || memory_limit > 0;
+  s_budget.has_deadline = time_limit > 0;
+  if (s_budget.has_deadline) {
+    s_budget.deadline = now() + boost::posix_time::microseconds((long) (time_limit * 1000000));
+  }
+  s_budget.memory_limit = memory_limit;
+  s_budget.last_sample = boost::posix_time::ptime();
+}
+
+void budget::stop() {
+  boost::mutex::scoped_lock lock(s_budget.mutex);
+  s_budget.active = false;
+}
+
+budget::status budget::get_status() {
+  boost::mutex::scoped_lock lock(s_budget.mutex);
+  if (!s_budget.active) {
+    return BUDGET_OK;
+  }
+  if (s_budget.has_deadline && now() >= s_budget.deadline) {
+    return BUDGET_TIME;
+  }
+  if (s_budget.memory_limit > 0 && sample_memory() >= s_budget.memory_limit) {
+    return BUDGET_MEMORY;
+  }
+  return BUDGET_OK;
+}
+
+void budget::check() {
+  switch (get_status()) {
+  case BUDGET_TIME:
+    throw budget_exhausted("time limit reached");
+  case BUDGET_MEMORY:
+    throw budget_exhausted("memory limit reached");
+  default:
+    break;
+  }
+}
+
+bool budget::memory_pressure() {
+  boost::mutex::scoped_lock lock(s_budget.mutex);
+  if (!s_budget.active || s_budget.memory_limit == 0) {
+    return false;
+  }
+  return sample_memory() * 4 >= s_budget.memory_limit * 3;
+}
+
+size_t budget::get_memory_usage() {
+  // Current resident size from proc if we have it
+  std::ifstream statm("/proc/self/statm");
+  if (statm) {
+    size_t size = 0, resident = 0;
+    statm >> size >> resident;
+    if (statm) {
+      return resident * sysconf(_SC_PAGESIZE) / (1024 * 1024);
+    }
+  }
+  // Otherwise, the peak resident size
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024 * 1024);
+#else
+    return usage.ru_maxrss / 1024;
+#endif
+  }
+  return 0;
+}
+
+}
+}
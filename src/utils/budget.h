@@ -0,0 +1,79 @@
+/**
+ * This file is part of sally.
+ * Copyright (C) 2015 SRI International.
+ *
+ * Sally is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sally is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with sally.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "utils/exception.h"
+
+#include <string>
+
+namespace sally {
+namespace utils {
+
+/** Exception thrown when the budget of a query runs out */
+class budget_exhausted : public exception {
+public:
+  budget_exhausted(std::string msg)
+  : exception(msg) {}
+};
+
+/**
+ * Cooperative budget for a query: a wall-clock deadline and a limit on the
+ * resident memory of the process. The budget is global, the commands start
+ * one for each query, and the engines and solvers check it at safe points
+ * (the solvers before each check). When the budget runs out, check() throws
+ * budget_exhausted, and the query is reported as interrupted.
+ */
+class budget {
+
+public:
+
+  enum status {
+    /** Within the budget */
+    BUDGET_OK,
+    /** Out of time */
+    BUDGET_TIME,
+    /** Out of memory */
+    BUDGET_MEMORY
+  };
+
+  /** Start a budget, time in seconds, memory in MB, 0 for no limit */
+  static void start(double time_limit, size_t memory_limit);
+
+  /** Stop the budget, no more limits */
+  static void stop();
+
+  /** Get the status of the budget (memory is only sampled every now and then) */
+  static status get_status();
+
+  /** Throw budget_exhausted if the budget has run out */
+  static void check();
+
+  /**
+   * Returns true if the memory is getting close to the limit (over 3/4).
+   * Engines should drop what they can rebuild (e.g. solvers) at this point.
+   */
+  static bool memory_pressure();
+
+  /** Get the resident memory of the process in MB */
+  static size_t get_memory_usage();
+
+};
+
+}
+}
@@ -95,6 +95,14 @@ void statistics::values_to_stream(std::ostream& out) const {
   }
 }
 
+void statistics::named_values_to_stream(std::ostream& out) const {
+  for (size_t i = 0; i < d_stats.size(); ++ i) {
+    if (dynamic_cast<const stat_delimiter*>(d_stats[i]) == 0) {
+      out << d_stats[i]->get_id() << " = " << *d_stats[i] << std::endl;
+    }
+  }
+}
+
 std::ostream& operator << (std::ostream& out, const stat& s) {
   s.to_stream(out);
   return out;
@@ -108,6 +108,9 @@ public:
   /** Output current values to stream */
   void values_to_stream(std::ostream& out) const;
 
+  /** Output current values to stream as id = value, one per line */
+  void named_values_to_stream(std::ostream& out) const;
+
 };
 
 std::ostream& operator << (std::ostream& out, const statistics& stats);
@@ -0,0 +1,48 @@
+# Runs pdkind on each of the INPUTS (separated by commas) while writing a
+# checkpoint, then resumes from the checkpoint, and checks that both runs
+# give the answer in the .gold file of the input. Inputs solved in the first
+# frame don't write a checkpoint, but at least one of them must.
+#
+# Usage: cmake -DSALLY=... -DSOLVER=... -DINPUTS=... -DCHECKPOINT=... -P resume.cmake
+
+string(REPLACE "," ";" INPUTS "${INPUTS}")
+
+set(RESUMED 0)
+foreach(INPUT ${INPUTS})
+
+  file(READ ${INPUT}.gold EXPECTED)
+  string(STRIP "${EXPECTED}" EXPECTED)
+  file(REMOVE ${CHECKPOINT})
+
+  # First run, saving every frame
+  execute_process(
+    COMMAND ${SALLY} --engine pdkind --solver ${SOLVER} --pdkind-checkpoint ${CHECKPOINT} --pdkind-checkpoint-interval 1 ${INPUT}
+    OUTPUT_VARIABLE FIRST_OUTPUT
+    RESULT_VARIABLE FIRST_RESULT
+  )
+  string(STRIP "${FIRST_OUTPUT}" FIRST_OUTPUT)
+  if (NOT FIRST_RESULT EQUAL 0 OR NOT FIRST_OUTPUT STREQUAL EXPECTED)
+    message(FATAL_ERROR "${INPUT}: checkpointed run gave '${FIRST_OUTPUT}' (exit ${FIRST_RESULT}), expected '${EXPECTED}'")
+  endif()
+
+  if (EXISTS ${CHECKPOINT})
+    # Second run, continuing from the checkpoint
+    execute_process(
+      COMMAND ${SALLY} --engine pdkind --solver ${SOLVER} --pdkind-resume ${CHECKPOINT} ${INPUT}
+      OUTPUT_VARIABLE SECOND_OUTPUT
+      RESULT_VARIABLE SECOND_RESULT
+    )
+    string(STRIP "${SECOND_OUTPUT}" SECOND_OUTPUT)
+    if (NOT SECOND_RESULT EQUAL 0 OR NOT SECOND_OUTPUT STREQUAL EXPECTED)
+      message(FATAL_ERROR "${INPUT}: resumed run gave '${SECOND_OUTPUT}' (exit ${SECOND_RESULT}), expected '${EXPECTED}'")
+    endif()
+    math(EXPR RESUMED "${RESUMED} + 1")
+    file(REMOVE ${CHECKPOINT})
+  endif()
+
+endforeach(INPUT)
+
+if (RESUMED EQUAL 0)
+  message(FATAL_ERROR "No input wrote a checkpoint")
+endif()
+message(STATUS "Resumed ${RESUMED} inputs")
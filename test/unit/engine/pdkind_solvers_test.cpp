@@ -0,0 +1,198 @@
+#ifdef WITH_Z3
+
+#include <boost/test/unit_test.hpp>
+#include <boost/program_options.hpp>
+
+#include "expr/term.h"
+#include "expr/term_manager.h"
+
+#include "engine/factory.h"
+#include "engine/pdkind/solvers.h"
+
+#include "smt/factory.h"
+
+#include "system/context.h"
+#include "system/transition_system.h"
+
+#include "utils/budget.h"
+#include "utils/options.h"
+#include "utils/statistics.h"
+
+#include <vector>
+#include <string>
+
+using namespace std;
+using namespace sally;
+using namespace expr;
+using namespace system;
+
+struct pdkind_solvers_test_fixture {
+
+  utils::statistics stats;
+  term_manager tm;
+  boost::program_options::variables_map vm;
+  options* opts;
+  context* ctx;
+  transition_system* ts;
+
+public:
+
+  pdkind_solvers_test_fixture()
+  : tm(stats)
+  {
+    // Default options of the engines and solvers
+    boost::program_options::options_description description;
+    engine_factory::setup_options(description);
+    smt::factory::setup_options(description);
+    const char* argv[] = { "sally_test" };
+    boost::program_options::store(boost::program_options::parse_command_line(1, argv, description), vm);
+    boost::program_options::notify(vm);
+    opts = new options(vm);
+    ctx = new context(tm, *opts, stats);
+    smt::factory::set_default_solver("z3");
+
+    // Two variables that swap, x >= 0 is 2-inductive but not 1-inductive
+    std::vector<std::string> names;
+    std::vector<term_ref> types;
+    names.push_back("x"); types.push_back(tm.real_type());
+    names.push_back("y"); types.push_back(tm.real_type());
+    ctx->add_state_type("state_type", names, types, std::vector<std::string>(), std::vector<term_ref>());
+    const state_type* st = ctx->get_state_type("state_type");
+
+    const std::vector<term_ref>& x = st->get_variables(state_type::STATE_CURRENT);
+    const std::vector<term_ref>& x_next = st->get_variables(state_type::STATE_NEXT);
+    term_ref zero = tm.mk_rational_constant(rational());
+    term_ref init = tm.mk_and(tm.mk_term(TERM_EQ, x[0], zero), tm.mk_term(TERM_EQ, x[1], zero));
+    term_ref trans = tm.mk_and(tm.mk_term(TERM_EQ, x_next[0], x[1]), tm.mk_term(TERM_EQ, x_next[1], x[0]));
+    ts = new transition_system(st, new state_formula(tm, st, init), new transition_formula(tm, st, trans));
+  }
+
+  ~pdkind_solvers_test_fixture() {
+    delete ts;
+    delete ctx;
+    delete opts;
+  }
+
+  /** The property x >= 0 */
+  term_ref x_positive() {
+    const std::vector<term_ref>& x = ts->get_state_type()->get_variables(state_type::STATE_CURRENT);
+    return tm.mk_term(TERM_GEQ, x[0], tm.mk_rational_constant(rational()));
+  }
+
+  /** The property y >= 1 */
+  term_ref y_big() {
+    const std::vector<term_ref>& x = ts->get_state_type()->get_variables(state_type::STATE_CURRENT);
+    return tm.mk_term(TERM_GEQ, x[1], tm.mk_rational_constant(rational(1, 1)));
+  }
+
+  /** Check f for induction without generalizing (z3 can't) */
+  smt::solver::result check_inductive(pdkind::solvers& s, term_ref f) {
+    std::vector<term_ref> batch(1, f);
+    std::vector<smt::solver::result> results;
+    std::vector<size_t> finished;
+    s.check_inductive_batch(batch, results, finished);
+    return results[0];
+  }
+
+  /** Add f to all the frames of the induction solver */
+  void add_frame(pdkind::solvers& s, term_ref f) {
+    s.add_to_induction_solver(f, pdkind::solvers::INDUCTION_FIRST);
+    s.add_to_induction_solver(f, pdkind::solvers::INDUCTION_INTERMEDIATE);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(pdkind_solvers_tests, pdkind_solvers_test_fixture)
+
+BOOST_AUTO_TEST_CASE(induction_solver_reuse) {
+
+  pdkind::solvers s(*ctx, ts, ts->get_trace_helper());
+  term_ref P = x_positive();
+
+  // Depth 1, new solver, P is not inductive
+  BOOST_CHECK(!s.reset_induction_solver(1));
+  add_frame(s, P);
+  BOOST_CHECK_EQUAL(check_inductive(s, P), smt::solver::SAT);
+
+  // Something strong in the frame makes anything inductive
+  add_frame(s, y_big());
+  BOOST_CHECK_EQUAL(check_inductive(s, P), smt::solver::UNSAT);
+
+  // Next frame at depth 2 reuses the solver, the old frame is gone, and P is
+  // 2-inductive
+  BOOST_CHECK(s.reset_induction_solver(2));
+  BOOST_CHECK_EQUAL(check_inductive(s, y_big()), smt::solver::SAT);
+  add_frame(s, P);
+  BOOST_CHECK_EQUAL(check_inductive(s, P), smt::solver::UNSAT);
+
+  // Same depth again, reused, and the frame is empty
+  BOOST_CHECK(s.reset_induction_solver(2));
+  BOOST_CHECK_EQUAL(check_inductive(s, P), smt::solver::SAT);
+  add_frame(s, P);
+  BOOST_CHECK_EQUAL(check_inductive(s, P), smt::solver::UNSAT);
+
+  // Going back to a smaller depth needs a new solver
+  BOOST_CHECK(!s.reset_induction_solver(1));
+  add_frame(s, P);
+  BOOST_CHECK_EQUAL(check_inductive(s, P), smt::solver::SAT);
+}
+
+BOOST_AUTO_TEST_CASE(induction_solver_garbage) {
+
+  term_ref P = x_positive();
+
+  // Frames of 2 assertions at depth 2, rebuild with more than 3 retired
+  opts->set_unsigned("pdkind-induction-solver-garbage", 3);
+  pdkind::solvers s(*ctx, ts, ts->get_trace_helper());
+  BOOST_CHECK(!s.reset_induction_solver(2));
+  add_frame(s, P);
+  BOOST_CHECK(s.reset_induction_solver(2));
+  add_frame(s, P);
+  BOOST_CHECK(!s.reset_induction_solver(2));
+  add_frame(s, P);
+  BOOST_CHECK(s.reset_induction_solver(2));
+  add_frame(s, P);
+  BOOST_CHECK_EQUAL(check_inductive(s, P), smt::solver::UNSAT);
+
+  // No reuse at all
+  opts->set_unsigned("pdkind-induction-solver-garbage", 0);
+  pdkind::solvers s0(*ctx, ts, ts->get_trace_helper());
+  BOOST_CHECK(!s0.reset_induction_solver(1));
+  BOOST_CHECK(!s0.reset_induction_solver(2));
+  add_frame(s0, P);
+  BOOST_CHECK_EQUAL(check_inductive(s0, P), smt::solver::UNSAT);
+}
+
+BOOST_AUTO_TEST_CASE(induction_budget_exhausted) {
+
+  term_ref P = x_positive();
+
+  // Two workers, P not inductive
+  opts->set_unsigned("pdkind-workers", 2);
+  pdkind::solvers s(*ctx, ts, ts->get_trace_helper());
+  BOOST_CHECK(!s.reset_induction_solver(1));
+  BOOST_CHECK_EQUAL(s.induction_workers(), 2u);
+  add_frame(s, P);
+
+  // Out of budget right away, the process is over 1 MB
+  utils::budget::start(0, 1);
+
+  // The workers report the exhausted budget as unknown
+  std::vector<term_ref> batch(2, P);
+  std::vector<smt::solver::result> results;
+  std::vector<size_t> finished;
+  s.check_inductive_batch(batch, results, finished);
+  BOOST_CHECK_EQUAL(results[0], smt::solver::UNKNOWN);
+  BOOST_CHECK_EQUAL(results[1], smt::solver::UNKNOWN);
+  BOOST_CHECK_EQUAL(finished.size(), 2u);
+
+  // Redoing the check on this thread stops the query
+  BOOST_CHECK_THROW(s.check_inductive(P), utils::budget_exhausted);
+
+  // Within budget again, the solvers are still usable
+  utils::budget::stop();
+  BOOST_CHECK_EQUAL(check_inductive(s, P), smt::solver::SAT);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,137 @@
+#include <boost/test/unit_test.hpp>
+
+#include "expr/term.h"
+#include "expr/term_manager.h"
+
+#include "engine/pdkind/subsumption_index.h"
+
+#include "utils/statistics.h"
+
+#include <vector>
+#include <sstream>
+
+using namespace std;
+using namespace sally;
+using namespace expr;
+using namespace pdkind;
+
+struct subsumption_index_test_fixture {
+
+  utils::statistics stats;
+  term_manager tm;
+
+public:
+  subsumption_index_test_fixture()
+  : tm(stats)
+  {}
+};
+
+BOOST_FIXTURE_TEST_SUITE(subsumption_index_tests, subsumption_index_test_fixture)
+
+BOOST_AUTO_TEST_CASE(weaker_and_stronger) {
+
+  term_ref x = tm.mk_variable("x", tm.boolean_type());
+  term_ref y = tm.mk_variable("y", tm.boolean_type());
+  term_ref z = tm.mk_variable("z", tm.boolean_type());
+  term_ref not_z = tm.mk_term(TERM_NOT, z);
+
+  term_ref x_y = tm.mk_and(x, y);
+  term_ref x_y_z = tm.mk_and(x_y, z);
+  term_ref x_y_not_z = tm.mk_and(x_y, not_z);
+
+  subsumption_index index(tm);
+  index.add(0, x_y);
+
+  // Same cube is both weaker and stronger
+  BOOST_CHECK(index.contains_weaker(0, x_y));
+  BOOST_CHECK(index.contains_stronger(0, x_y));
+
+  // x & y is weaker than x & y & z
+  BOOST_CHECK(index.contains_weaker(0, x_y_z));
+  BOOST_CHECK(!index.contains_stronger(0, x_y_z));
+
+  // x & y is stronger than x, and than y
+  BOOST_CHECK(index.contains_stronger(0, x));
+  BOOST_CHECK(index.contains_stronger(0, y));
+  BOOST_CHECK(!index.contains_weaker(0, x));
+
+  // Unrelated literals
+  BOOST_CHECK(!index.contains_weaker(0, z));
+  BOOST_CHECK(!index.contains_stronger(0, z));
+
+  // A different polarity is a different literal
+  index.add(0, x_y_not_z);
+  BOOST_CHECK(!index.contains_stronger(0, tm.mk_and(x, z)));
+  BOOST_CHECK(index.contains_stronger(0, tm.mk_and(x, not_z)));
+}
+
+BOOST_AUTO_TEST_CASE(frames) {
+
+  term_ref x = tm.mk_variable("x", tm.boolean_type());
+  term_ref y = tm.mk_variable("y", tm.boolean_type());
+
+  subsumption_index index(tm);
+  index.add(2, x);
+
+  // Only frame 2 knows about x, including frames that were never added
+  BOOST_CHECK(index.contains_weaker(2, tm.mk_and(x, y)));
+  BOOST_CHECK(!index.contains_weaker(0, tm.mk_and(x, y)));
+  BOOST_CHECK(!index.contains_weaker(1, x));
+  BOOST_CHECK(!index.contains_weaker(3, x));
+  BOOST_CHECK(!index.contains_stronger(10, x));
+
+  // Clear removes everything
+  index.clear();
+  BOOST_CHECK(!index.contains_weaker(2, x));
+  BOOST_CHECK(!index.contains_stronger(2, x));
+}
+
+BOOST_AUTO_TEST_CASE(signature_collisions) {
+
+  // More literals than signature bits, so some of them share a bit
+  std::vector<term_ref> vars;
+  for (size_t i = 0; i < 3*sizeof(size_t)*8; ++ i) {
+    std::stringstream ss;
+    ss << "x" << i;
+    vars.push_back(tm.mk_variable(ss.str(), tm.boolean_type()));
+  }
+
+  // Find two variables with the same signature bit
+  size_t bits = sizeof(size_t)*8;
+  term_ref a, b;
+  for (size_t i = 0; i < vars.size() && a.is_null(); ++ i) {
+    for (size_t j = i + 1; j < vars.size(); ++ j) {
+      if (vars[i].index() % bits == vars[j].index() % bits) {
+        a = vars[i];
+        b = vars[j];
+        break;
+      }
+    }
+  }
+  BOOST_REQUIRE(!a.is_null());
+
+  term_ref c = vars[0] == a || vars[0] == b ? vars[1] : vars[0];
+  if (c == a || c == b) {
+    c = vars[2];
+  }
+
+  subsumption_index index(tm);
+  index.add(0, tm.mk_and(a, c));
+
+  // Signature of (b & c) matches, but the literals don't
+  BOOST_CHECK(!index.contains_weaker(0, tm.mk_and(b, c)));
+  BOOST_CHECK(!index.contains_stronger(0, tm.mk_and(b, c)));
+  BOOST_CHECK(!index.contains_stronger(0, b));
+
+  // The real subset is still found
+  BOOST_CHECK(index.contains_weaker(0, tm.mk_and(tm.mk_and(a, b), c)));
+  BOOST_CHECK(index.contains_stronger(0, a));
+
+  // A cube with all the variables subsumes every cube of them
+  index.add(1, tm.mk_and(vars));
+  BOOST_CHECK(index.contains_stronger(1, tm.mk_and(a, b)));
+  BOOST_CHECK(index.contains_stronger(1, tm.mk_and(vars)));
+  BOOST_CHECK(!index.contains_weaker(1, tm.mk_and(a, b)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+#include <boost/test/unit_test.hpp>
+
+#include "expr/term.h"
+#include "expr/term_manager.h"
+#include "expr/term_serializer.h"
+
+#include "utils/exception.h"
+#include "utils/statistics.h"
+
+#include <sstream>
+#include <iostream>
+
+using namespace std;
+using namespace sally;
+using namespace expr;
+
+struct term_serializer_test_fixture {
+
+  utils::statistics stats;
+  term_manager tm;
+
+public:
+  term_serializer_test_fixture()
+  : tm(stats)
+  {}
+};
+
+BOOST_FIXTURE_TEST_SUITE(term_serializer_tests, term_serializer_test_fixture)
+
+BOOST_AUTO_TEST_CASE(round_trip) {
+
+  // Set term manager for output
+  cout << set_tm(tm);
+
+  // Some variables, one with a space in the name
+  term_ref x = tm.mk_variable("x", tm.real_type());
+  term_ref y = tm.mk_variable("state y", tm.integer_type());
+  term_ref b = tm.mk_variable("b", tm.bitvector_type(8));
+
+  // A formula sharing sub-terms
+  term_ref half = tm.mk_rational_constant(rational(-1, 2));
+  term_ref sum = tm.mk_term(TERM_ADD, x, tm.mk_term(TERM_MUL, half, y));
+  term_ref bv = tm.mk_bitvector_extract(tm.mk_term(TERM_BV_ADD, b, tm.mk_bitvector_constant(bitvector(8, 200))), bitvector_extract(3, 1));
+  term_ref bv_ext = tm.mk_bitvector_sgn_extend(bv, bitvector_sgn_extend(2));
+  term_ref f = tm.mk_and(tm.mk_term(TERM_LEQ, sum, x), tm.mk_term(TERM_LT, sum, y));
+  f = tm.mk_and(f, tm.mk_term(TERM_EQ, bv_ext, tm.mk_bitvector_constant(bitvector(5, 3))));
+  f = tm.mk_or(f, tm.mk_boolean_constant(false));
+  cout << "f: " << f << endl;
+
+  // Write it, the second write should be free
+  std::stringstream ss;
+  term_writer writer(tm, ss);
+  size_t f_id = writer.write(f);
+  size_t written = writer.size();
+  BOOST_CHECK_EQUAL(writer.write(f), f_id);
+  BOOST_CHECK_EQUAL(writer.size(), written);
+  cout << ss.str();
+
+  // Read it back
+  term_reader::variable_map variables;
+  variables["x"] = x;
+  variables["state y"] = y;
+  variables["b"] = b;
+  term_reader reader(tm, ss, variables);
+  term_ref last;
+  for (size_t i = 0; i < written; ++ i) {
+    last = reader.read();
+  }
+  BOOST_CHECK_EQUAL(reader.get_term(f_id), f);
+  BOOST_CHECK_EQUAL(last, f);
+}
+
+BOOST_AUTO_TEST_CASE(unknown_variable) {
+
+  term_ref x = tm.mk_variable("x", tm.real_type());
+  term_ref f = tm.mk_term(TERM_GEQ, x, tm.mk_rational_constant(rational(0, 1)));
+
+  std::stringstream ss;
+  term_writer writer(tm, ss);
+  writer.write(f);
+
+  // Reading with no variables should fail
+  term_reader::variable_map variables;
+  term_reader reader(tm, ss, variables);
+  BOOST_CHECK_THROW(for (size_t i = 0; i < writer.size(); ++ i) reader.read(), sally::exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
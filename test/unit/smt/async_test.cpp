@@ -0,0 +1,212 @@
+#include <boost/test/unit_test.hpp>
+
+#include "expr/term.h"
+#include "expr/term_manager.h"
+
+#include "smt/solver.h"
+#include "smt/async_check.h"
+
+#include "utils/options.h"
+#include "utils/statistics.h"
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include <iostream>
+
+
+using namespace std;
+using namespace sally;
+using namespace expr;
+using namespace smt;
+
+/**
+ * A solver that answers check() with a fixed result, or blocks until
+ * interrupted, or throws.
+ */
+class fixed_solver : public solver {
+
+public:
+
+  enum behavior {
+    ANSWER,
+    BLOCK,
+    THROW
+  };
+
+private:
+
+  behavior d_behavior;
+  result d_result;
+
+  boost::mutex d_mutex;
+  boost::condition_variable d_cond;
+  bool d_interrupted;
+
+public:
+
+  fixed_solver(std::string name, term_manager& tm, const options& opts, utils::statistics& stats, behavior b, result r = UNKNOWN)
+  : solver(name, tm, opts, stats)
+  , d_behavior(b)
+  , d_result(r)
+  , d_interrupted(false)
+  {}
+
+  bool supports(feature f) const {
+    return f == INTERRUPT;
+  }
+
+  void add(term_ref f, formula_class f_class) {}
+
+  result check() {
+    switch (d_behavior) {
+    case ANSWER:
+      return d_result;
+    case BLOCK: {
+      boost::mutex::scoped_lock lock(d_mutex);
+      while (!d_interrupted) {
+        d_cond.wait(lock);
+      }
+      return UNKNOWN;
+    }
+    case THROW:
+    default:
+      throw sally::exception("fixed_solver: failed");
+    }
+  }
+
+  void interrupt() {
+    boost::mutex::scoped_lock lock(d_mutex);
+    d_interrupted = true;
+    d_cond.notify_all();
+  }
+};
+
+struct async_test_fixture {
+
+  utils::statistics stats;
+  term_manager tm;
+  options opts;
+
+public:
+
+  async_test_fixture()
+  : tm(stats)
+  {}
+
+  fixed_solver* mk_solver(fixed_solver::behavior b, solver::result r = solver::UNKNOWN) {
+    return new fixed_solver("fixed", tm, opts, stats, b, r);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(async_tests, async_test_fixture)
+
+BOOST_AUTO_TEST_CASE(check_async) {
+
+  fixed_solver* s = mk_solver(fixed_solver::ANSWER, solver::SAT);
+  check_future::ref f = s->check_async();
+  BOOST_CHECK_EQUAL(f->get(), solver::SAT);
+  BOOST_CHECK(f->is_ready());
+  BOOST_CHECK(f->is_definitive());
+  f = check_future::ref();
+  delete s;
+
+  // Cancel a check that only stops when interrupted
+  s = mk_solver(fixed_solver::BLOCK);
+  f = s->check_async();
+  f->cancel();
+  BOOST_CHECK(f->is_cancelled());
+  BOOST_CHECK_EQUAL(f->get(), solver::UNKNOWN);
+  f = check_future::ref();
+  delete s;
+
+  // Exceptions come out of get()
+  s = mk_solver(fixed_solver::THROW);
+  f = s->check_async();
+  BOOST_CHECK_THROW(f->get(), sally::exception);
+  f = check_future::ref();
+  delete s;
+
+  // Destroying the future cancels the check
+  s = mk_solver(fixed_solver::BLOCK);
+  f = s->check_async();
+  f = check_future::ref();
+  delete s;
+}
+
+BOOST_AUTO_TEST_CASE(race) {
+
+  solver::result r1, r2, r;
+
+  // The definitive one wins, and the other one is stopped
+  fixed_solver* s1 = mk_solver(fixed_solver::ANSWER, solver::SAT);
+  fixed_solver* s2 = mk_solver(fixed_solver::BLOCK);
+  r = smt::race(s1, s2, r1, r2);
+  BOOST_CHECK_EQUAL(r, solver::SAT);
+  BOOST_CHECK_EQUAL(r1, solver::SAT);
+  BOOST_CHECK_EQUAL(r2, solver::UNKNOWN);
+  delete s1;
+  delete s2;
+
+  s1 = mk_solver(fixed_solver::BLOCK);
+  s2 = mk_solver(fixed_solver::ANSWER, solver::UNSAT);
+  r = smt::race(s1, s2, r1, r2);
+  BOOST_CHECK_EQUAL(r, solver::UNSAT);
+  BOOST_CHECK_EQUAL(r1, solver::UNKNOWN);
+  BOOST_CHECK_EQUAL(r2, solver::UNSAT);
+  delete s1;
+  delete s2;
+
+  // Unknown doesn't win
+  s1 = mk_solver(fixed_solver::ANSWER, solver::UNKNOWN);
+  s2 = mk_solver(fixed_solver::ANSWER, solver::UNSAT);
+  r = smt::race(s1, s2, r1, r2);
+  BOOST_CHECK_EQUAL(r, solver::UNSAT);
+  delete s1;
+  delete s2;
+
+  // Exceptions are ignored if the other one knows
+  s1 = mk_solver(fixed_solver::THROW);
+  s2 = mk_solver(fixed_solver::ANSWER, solver::SAT);
+  r = smt::race(s1, s2, r1, r2);
+  BOOST_CHECK_EQUAL(r, solver::SAT);
+  BOOST_CHECK_EQUAL(r1, solver::UNKNOWN);
+  delete s1;
+  delete s2;
+
+  // But not if nobody knows
+  s1 = mk_solver(fixed_solver::THROW);
+  s2 = mk_solver(fixed_solver::ANSWER, solver::UNKNOWN);
+  BOOST_CHECK_THROW(smt::race(s1, s2, r1, r2), sally::exception);
+  delete s1;
+  delete s2;
+}
+
+BOOST_AUTO_TEST_CASE(check_race) {
+
+  // The loser can be left running, and waited for later
+  fixed_solver* s1 = mk_solver(fixed_solver::BLOCK);
+  fixed_solver* s2 = mk_solver(fixed_solver::ANSWER, solver::UNSAT);
+  smt::check_race* race = new smt::check_race(s1, s2);
+  BOOST_CHECK(race->wait() == 1);
+  BOOST_CHECK_EQUAL(race->get(1).get(), solver::UNSAT);
+  BOOST_CHECK(!race->get(0).is_ready());
+  s1->interrupt();
+  BOOST_CHECK_EQUAL(race->get(0).get(), solver::UNKNOWN);
+  delete race;
+  delete s1;
+  delete s2;
+
+  // Nobody knows
+  s1 = mk_solver(fixed_solver::ANSWER, solver::UNKNOWN);
+  s2 = mk_solver(fixed_solver::THROW);
+  race = new smt::check_race(s1, s2);
+  BOOST_CHECK(race->wait() == smt::check_race::none);
+  BOOST_CHECK(race->get(0).is_ready() && race->get(1).is_ready());
+  BOOST_CHECK_EQUAL(race->get(1).get_relaxed(), solver::UNKNOWN);
+  delete race;
+  delete s1;
+  delete s2;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,198 @@
+#include <boost/test/unit_test.hpp>
+
+#include "expr/term.h"
+#include "expr/term_manager.h"
+#include "expr/gc_relocator.h"
+
+#include "smt/solver.h"
+#include "smt/cache_wrapper.h"
+
+#include "utils/options.h"
+#include "utils/statistics.h"
+
+#include <iostream>
+#include <sstream>
+
+
+using namespace std;
+using namespace sally;
+using namespace expr;
+using namespace smt;
+
+/**
+ * A solver that answers UNSAT if the false constant is asserted (or assumed),
+ * and SAT otherwise, and counts the checks.
+ */
+class counting_solver : public solver {
+
+  std::vector<term_ref> d_assertions;
+  std::vector<size_t> d_assertions_size;
+
+public:
+
+  size_t checks;
+
+  counting_solver(std::string name, term_manager& tm, const options& opts, utils::statistics& stats)
+  : solver(name, tm, opts, stats)
+  , checks(0)
+  {}
+
+  bool supports(feature f) const {
+    return f == UNSAT_CORE;
+  }
+
+  void add(term_ref f, formula_class f_class) {
+    d_assertions.push_back(f);
+  }
+
+  result check() {
+    checks ++;
+    for (size_t i = 0; i < d_assertions.size(); ++ i) {
+      if (d_assertions[i] == d_tm.mk_boolean_constant(false)) {
+        return UNSAT;
+      }
+    }
+    return SAT;
+  }
+
+  void push() {
+    d_assertions_size.push_back(d_assertions.size());
+  }
+
+  void pop() {
+    d_assertions.resize(d_assertions_size.back());
+    d_assertions_size.pop_back();
+  }
+
+  void get_unsat_core(std::vector<term_ref>& out) {
+    out.push_back(d_tm.mk_boolean_constant(false));
+  }
+};
+
+struct cache_test_fixture {
+
+  utils::statistics stats;
+  term_manager tm;
+  options opts;
+
+public:
+
+  cache_test_fixture()
+  : tm(stats)
+  {}
+
+  solver* mk_solver(counting_solver*& s) {
+    s = new counting_solver("counting", tm, opts, stats);
+    return new cache_wrapper(tm, opts, stats, s, query_cache::attach(tm, stats, false));
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(cache_tests, cache_test_fixture)
+
+BOOST_AUTO_TEST_CASE(cache_hits) {
+
+  term_ref x = tm.mk_variable("x", tm.boolean_type());
+  term_ref y = tm.mk_variable("y", tm.boolean_type());
+  term_ref f = tm.mk_boolean_constant(false);
+
+  counting_solver* c1;
+  solver* s1 = mk_solver(c1);
+
+  s1->add(x, solver::CLASS_A);
+  s1->push();
+  s1->add(y, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s1->check(), solver::SAT);
+  s1->pop();
+
+  // Same assertions in a different order, and duplicated
+  s1->push();
+  s1->add(y, solver::CLASS_A);
+  s1->add(x, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s1->check(), solver::SAT);
+  BOOST_CHECK_EQUAL(c1->checks, 1);
+  s1->pop();
+
+  // Classes are part of the query
+  s1->push();
+  s1->add(y, solver::CLASS_B);
+  BOOST_CHECK_EQUAL(s1->check(), solver::SAT);
+  BOOST_CHECK_EQUAL(c1->checks, 2);
+  s1->pop();
+
+  // Assumptions are part of the query
+  std::vector<term_ref> assumptions;
+  assumptions.push_back(f);
+  BOOST_CHECK_EQUAL(s1->check(assumptions), solver::UNSAT);
+  BOOST_CHECK_EQUAL(c1->checks, 3);
+
+  // Another solver of the same term manager shares the cache
+  counting_solver* c2;
+  solver* s2 = mk_solver(c2);
+  s2->add(x, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s2->check(assumptions), solver::UNSAT);
+  BOOST_CHECK_EQUAL(c2->checks, 0);
+
+  // Asking for the core needs the solver state, so the check is done then
+  std::vector<term_ref> core;
+  s2->add(f, solver::CLASS_A);
+  s2->add(x, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s2->check(), solver::UNSAT);
+  BOOST_CHECK_EQUAL(c2->checks, 1);
+  BOOST_CHECK_EQUAL(s2->check(), solver::UNSAT);
+  BOOST_CHECK_EQUAL(c2->checks, 1);
+  s2->get_unsat_core(core);
+  BOOST_CHECK_EQUAL(c2->checks, 2);
+  BOOST_CHECK_EQUAL(core.size(), 1);
+
+  std::stringstream ss;
+  stats.named_values_to_stream(ss);
+  BOOST_CHECK(ss.str().find("smt::cache::hits = 3") != std::string::npos);
+  BOOST_CHECK(ss.str().find("smt::cache::misses = 4") != std::string::npos);
+
+  delete s1;
+  delete s2;
+}
+
+BOOST_AUTO_TEST_CASE(cache_gc) {
+
+  term_ref x = tm.mk_variable("x", tm.integer_type());
+  term_ref one = tm.mk_rational_constant(rational(1, 1));
+  term_ref geq = tm.mk_term(TERM_GEQ, x, one);
+  term_ref lt = tm.mk_term(TERM_LT, x, one);
+
+  counting_solver* c;
+  solver* s = mk_solver(c);
+  query_cache* cache = query_cache::attach(tm, stats, false);
+
+  s->push();
+  s->add(geq, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s->check(), solver::SAT);
+  s->pop();
+
+  s->push();
+  s->add(lt, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s->check(), solver::SAT);
+  s->pop();
+
+  // Collect geq, keep lt
+  gc_relocator::relocation_map reloc_map;
+  reloc_map[x] = x;
+  reloc_map[one] = one;
+  reloc_map[lt] = lt;
+  cache->gc_collect(gc_relocator(tm, reloc_map));
+
+  s->push();
+  s->add(lt, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s->check(), solver::SAT);
+  BOOST_CHECK_EQUAL(c->checks, 2);
+  s->pop();
+
+  std::stringstream ss;
+  stats.named_values_to_stream(ss);
+  BOOST_CHECK(ss.str().find("smt::cache::evicted = 1") != std::string::npos);
+
+  cache->detach();
+  delete s;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,136 @@
+#ifdef WITH_Z3
+
+#include <boost/test/unit_test.hpp>
+
+#include "expr/term.h"
+#include "expr/term_manager.h"
+
+#include "smt/factory.h"
+#include "smt/solver_pool.h"
+
+#include "utils/options.h"
+#include "utils/statistics.h"
+
+#include <iostream>
+
+
+using namespace std;
+using namespace sally;
+using namespace expr;
+using namespace smt;
+
+struct solver_pool_test_fixture {
+
+  utils::statistics stats;
+  term_manager tm;
+  options opts;
+
+public:
+
+  solver_pool_test_fixture()
+  : tm(stats)
+  {
+    factory::set_default_solver("z3");
+    factory::enable_solver_pool();
+    cout << set_tm(tm);
+    cerr << set_tm(tm);
+  }
+
+  ~solver_pool_test_fixture() {
+    factory::clear_solver_pool(tm);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(solver_pool_tests, solver_pool_test_fixture)
+
+BOOST_AUTO_TEST_CASE(solver_pool_reuse) {
+
+  term_ref x = tm.mk_variable("x", tm.real_type());
+  term_ref zero = tm.mk_rational_constant(rational());
+  term_ref x_pos = tm.mk_term(TERM_GT, x, zero);
+  term_ref x_neg = tm.mk_term(TERM_LT, x, zero);
+
+  pooled_solver::base base;
+  base.add_variable(x, solver::CLASS_A);
+  base.add(x_pos, solver::CLASS_A);
+
+  // Leave the solver in a pushed state with extra assertions
+  solver* s1 = factory::acquire_solver(base, tm, opts, stats);
+  s1->push();
+  s1->add(x_neg, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s1->check(), solver::UNSAT);
+  factory::release_solver(s1);
+
+  // Same base, we get the same solver at the base context
+  solver* s2 = factory::acquire_solver(base, tm, opts, stats);
+  BOOST_CHECK(s1 == s2);
+  BOOST_CHECK_EQUAL(s2->check(), solver::SAT);
+  BOOST_CHECK_THROW(s2->pop(), sally::exception);
+
+  // Same base while the other one is in use, we get a new one
+  solver* s3 = factory::acquire_solver(base, tm, opts, stats);
+  BOOST_CHECK(s3 != s2);
+  s3->add(x_neg, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s3->check(), solver::UNSAT);
+
+  // Different base, we get a new one
+  pooled_solver::base other;
+  other.add_variable(x, solver::CLASS_A);
+  other.add(x_neg, solver::CLASS_A);
+  solver* s4 = factory::acquire_solver(other, tm, opts, stats);
+  BOOST_CHECK(s4 != s2 && s4 != s3);
+  s4->add(x_pos, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s4->check(), solver::UNSAT);
+
+  factory::release_solver(s2);
+  factory::release_solver(s3);
+  factory::release_solver(s4);
+
+  // The assertions of s3 are gone
+  solver* s5 = factory::acquire_solver(base, tm, opts, stats);
+  solver* s6 = factory::acquire_solver(base, tm, opts, stats);
+  BOOST_CHECK_EQUAL(s5->check(), solver::SAT);
+  BOOST_CHECK_EQUAL(s6->check(), solver::SAT);
+  factory::release_solver(s5);
+  factory::release_solver(s6);
+}
+
+BOOST_AUTO_TEST_CASE(solver_pool_user_variables) {
+
+  term_ref x = tm.mk_variable("x", tm.real_type());
+  term_ref y = tm.mk_variable("y", tm.real_type());
+  term_ref zero = tm.mk_rational_constant(rational());
+  term_ref x_pos = tm.mk_term(TERM_GT, x, zero);
+  term_ref y_neg = tm.mk_term(TERM_LT, y, zero);
+  term_ref x_eq_y = tm.mk_term(TERM_EQ, x, y);
+
+  pooled_solver::base base;
+  base.add_variable(x, solver::CLASS_A);
+  base.add(x_pos, solver::CLASS_A);
+
+  // Add a variable above the base, as the engines do with the unrolling
+  solver* s1 = factory::acquire_solver(base, tm, opts, stats);
+  s1->add_variable(y, solver::CLASS_A);
+  s1->add(y_neg, solver::CLASS_A);
+  s1->add(x_eq_y, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s1->check(), solver::UNSAT);
+  factory::release_solver(s1);
+
+  // Reused solver takes the same variable again
+  solver* s2 = factory::acquire_solver(base, tm, opts, stats);
+  BOOST_CHECK(s1 == s2);
+  s2->add_variable(y, solver::CLASS_A);
+  s2->add(x_eq_y, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s2->check(), solver::SAT);
+  factory::release_solver(s2);
+
+  // But not with a different class
+  solver* s3 = factory::acquire_solver(base, tm, opts, stats);
+  BOOST_CHECK(s1 == s3);
+  BOOST_CHECK_THROW(s3->add_variable(y, solver::CLASS_B), sally::exception);
+  factory::release_solver(s3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
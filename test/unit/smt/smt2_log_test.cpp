@@ -0,0 +1,175 @@
+#include <boost/test/unit_test.hpp>
+
+#include "expr/term.h"
+#include "expr/term_manager.h"
+#include "expr/gc_relocator.h"
+
+#include "smt/smt2_log.h"
+#include "smt/smt2_replay.h"
+#include "smt/factory.h"
+
+#include "utils/exception.h"
+#include "utils/options.h"
+#include "utils/statistics.h"
+
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/copy.hpp>
+
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+
+
+using namespace std;
+using namespace sally;
+using namespace expr;
+using namespace smt;
+
+struct smt2_log_test_fixture {
+
+  utils::statistics stats;
+  term_manager tm;
+
+public:
+
+  smt2_log_test_fixture()
+  : tm(stats)
+  {}
+
+  /** Count the occurrences of what in str */
+  static size_t count(std::string str, std::string what) {
+    size_t n = 0;
+    for (size_t i = str.find(what); i != std::string::npos; i = str.find(what, i + 1)) {
+      n ++;
+    }
+    return n;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(smt2_log_tests, smt2_log_test_fixture)
+
+BOOST_AUTO_TEST_CASE(definitions) {
+
+  term_ref x = tm.mk_variable("x", tm.integer_type());
+  term_ref one = tm.mk_rational_constant(rational(1, 1));
+  term_ref sum = tm.mk_term(TERM_ADD, x, one);
+  term_ref geq = tm.mk_term(TERM_GEQ, sum, one);
+  term_ref lt = tm.mk_term(TERM_LT, sum, x);
+
+  std::stringstream out;
+  out << set_tm(tm) << set_output_language(output::MCMT);
+  smt2_definitions definitions(tm, "t");
+
+  // The sum is defined once
+  definitions.define(out, geq);
+  definitions.push();
+  definitions.define(out, lt);
+  BOOST_CHECK_EQUAL(count(out.str(), "(define-fun"), 3);
+  BOOST_CHECK_EQUAL(count(out.str(), "(+ x 1)"), 1);
+
+  std::stringstream printed;
+  definitions.print(printed, lt);
+  BOOST_CHECK_EQUAL(printed.str(), "t2");
+
+  // Definitions since the push are gone with the pop
+  definitions.pop();
+  out.str(std::string());
+  definitions.define(out, lt);
+  definitions.define(out, geq);
+  BOOST_CHECK_EQUAL(count(out.str(), "(define-fun"), 1);
+  BOOST_CHECK(out.str().find("(< t0 x)") != std::string::npos);
+
+  // Collected terms are defined again
+  gc_relocator::relocation_map reloc_map;
+  reloc_map[x] = x;
+  reloc_map[one] = one;
+  reloc_map[sum] = sum;
+  reloc_map[geq] = geq;
+  definitions.gc_collect(gc_relocator(tm, reloc_map));
+  out.str(std::string());
+  definitions.define(out, geq);
+  definitions.define(out, lt);
+  BOOST_CHECK_EQUAL(count(out.str(), "(define-fun"), 1);
+  BOOST_CHECK(out.str().find("(< t0 x)") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(compressed_log) {
+
+  std::string command = "(assert (>= (+ x 1) 1))\n";
+  {
+    smt2_log log("smt2_log_test.smt2", smt2_log::COMPRESSION_GZIP);
+    for (size_t i = 0; i < 10000; ++ i) {
+      log.stream() << command;
+      log.flush_if_full();
+    }
+    log.stream() << "(check-sat)" << std::endl;
+  }
+
+  std::stringstream text;
+  {
+    boost::iostreams::filtering_istream in;
+    in.push(boost::iostreams::gzip_decompressor());
+    in.push(boost::iostreams::file_source("smt2_log_test.smt2.gz", std::ios_base::in | std::ios_base::binary));
+    boost::iostreams::copy(in, text);
+  }
+  std::remove("smt2_log_test.smt2.gz");
+
+  BOOST_CHECK_EQUAL(text.str().size(), 10000 * command.size() + 12);
+  BOOST_CHECK_EQUAL(count(text.str(), command), 10000);
+  BOOST_CHECK_THROW(smt2_log::get_compression("lzw"), sally::exception);
+}
+
+BOOST_AUTO_TEST_CASE(replay) {
+
+  std::stringstream log;
+  log << "; comment" << std::endl
+      << "(set-option :produce-models true)" << std::endl
+      << "(set-logic QF_LRA)" << std::endl
+      << "(declare-fun |s0.x| () Real)" << std::endl
+      << "(declare-fun b () Bool)" << std::endl
+      << "(declare-fun v () (_ BitVec 4))" << std::endl
+      << "(define-fun t0 () Real (+ |s0.x| (/ 1 2)))" << std::endl
+      << "(assert (! (>= t0 (- 1)) :named a0 :interpolation-group A))" << std::endl
+      << "(assert (let ((l0 (bvadd v #b0001))) (= l0 (_ bv3 4))))" << std::endl
+      << "(push 1)" << std::endl
+      << "(assert (! (< t0 (- 2)) :named a1 :interpolation-group B))" << std::endl
+      << "(check-sat)" << std::endl
+      << "(get-unsat-core)" << std::endl
+      << "(pop 1)" << std::endl
+      << "(check-sat-assuming (b (not b)))" << std::endl
+      << "(check-sat)" << std::endl
+      << "(get-value (|s0.x| v))" << std::endl;
+
+  smt2_replay replay(tm, log);
+  BOOST_CHECK_EQUAL(replay.get_checks(), 3);
+  BOOST_CHECK_EQUAL(replay.get_commands().size(), 13);
+  BOOST_CHECK_EQUAL(replay.get_commands()[3].f_class, solver::CLASS_A);
+  BOOST_CHECK_EQUAL(replay.get_commands()[6].f_class, solver::CLASS_B);
+
+  // The definitions are expanded
+  std::stringstream printed;
+  printed << set_tm(tm) << set_output_language(output::MCMT);
+  output::set_use_lets(printed, false);
+  printed << replay.get_commands()[6].terms[0];
+  BOOST_CHECK_EQUAL(printed.str(), "(< (+ |s0.x| (/ 1 2)) (- 2))");
+
+#ifdef WITH_Z3
+  options opts;
+  solver* z3 = factory::mk_solver("z3", tm, opts, stats);
+  std::vector<smt2_replay::query> queries;
+  replay.run(*z3, true, queries);
+  BOOST_CHECK_EQUAL(queries.size(), 3);
+  BOOST_CHECK_EQUAL(queries[0].result, solver::UNSAT);
+  BOOST_CHECK_EQUAL(queries[1].result, solver::UNSAT);
+  BOOST_CHECK_EQUAL(queries[2].result, solver::SAT);
+  delete z3;
+#endif
+
+  std::stringstream bad_log;
+  bad_log << "(declare-fun x () Real)" << std::endl << "(assert (foo x))" << std::endl;
+  BOOST_CHECK_THROW(smt2_replay(tm, bad_log), sally::exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
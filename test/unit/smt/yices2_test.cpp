@@ -224,6 +224,49 @@ BOOST_AUTO_TEST_CASE(yices2_generalization_experiment) {
 }
 
 
+BOOST_AUTO_TEST_CASE(yices2_assumptions) {
+
+  term_ref x = tm.mk_variable("x", tm.real_type());
+  term_ref y = tm.mk_variable("y", tm.real_type());
+  term_ref zero = tm.mk_rational_constant(rational());
+
+  yices2->add_variable(x, smt::solver::CLASS_A);
+  yices2->add_variable(y, smt::solver::CLASS_A);
+
+  // x + y <= 0
+  term_ref sum = tm.mk_term(TERM_ADD, x, y);
+  yices2->add(tm.mk_term(TERM_LEQ, sum, zero), smt::solver::CLASS_A);
+
+  term_ref x_gt_0 = tm.mk_term(TERM_GT, x, zero);
+  term_ref y_gt_0 = tm.mk_term(TERM_GT, y, zero);
+  term_ref x_eq_y = tm.mk_term(TERM_EQ, x, y);
+
+  BOOST_CHECK(yices2->supports(smt::solver::ASSUMPTIONS));
+
+  // Satisfiable under x > 0, but not together with x = y
+  std::vector<term_ref> assumptions;
+  assumptions.push_back(x_gt_0);
+  solver::result result = yices2->check(assumptions);
+  BOOST_CHECK_EQUAL(result, solver::SAT);
+  expr::model::ref m = yices2->get_model();
+  BOOST_CHECK(m->is_true(x_gt_0));
+
+  assumptions.push_back(x_eq_y);
+  result = yices2->check(assumptions);
+  BOOST_CHECK_EQUAL(result, solver::UNSAT);
+
+  // Both are needed
+  std::vector<term_ref> core;
+  yices2->get_unsat_assumptions(core);
+  BOOST_CHECK(core.size() == 2);
+
+  // The assertions are unchanged
+  assumptions.clear();
+  assumptions.push_back(y_gt_0);
+  result = yices2->check(assumptions);
+  BOOST_CHECK_EQUAL(result, solver::SAT);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
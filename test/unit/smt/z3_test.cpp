@@ -0,0 +1,172 @@
+#ifdef WITH_Z3
+
+#include <boost/test/unit_test.hpp>
+
+#include "expr/term.h"
+#include "expr/term_manager.h"
+#include "expr/model.h"
+
+#include "smt/factory.h"
+#include "smt/async_check.h"
+
+#include "utils/options.h"
+#include "utils/statistics.h"
+
+#include <iostream>
+#include <algorithm>
+
+
+using namespace std;
+using namespace sally;
+using namespace expr;
+using namespace smt;
+
+struct term_manager_with_z3_test_fixture {
+
+  utils::statistics stats;
+  term_manager tm;
+  solver* z3;
+  options opts;
+
+public:
+
+  term_manager_with_z3_test_fixture()
+  : tm(stats)
+  {
+    z3 = factory::mk_solver("z3", tm, opts, stats);
+    cout << set_tm(tm);
+    cerr << set_tm(tm);
+  }
+
+  ~term_manager_with_z3_test_fixture() {
+    delete z3;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(smt_tests, term_manager_with_z3_test_fixture)
+
+BOOST_AUTO_TEST_CASE(z3_assumptions) {
+
+  term_ref x = tm.mk_variable("x", tm.real_type());
+  term_ref y = tm.mk_variable("y", tm.real_type());
+  term_ref zero = tm.mk_rational_constant(rational());
+  term_ref three = tm.mk_rational_constant(rational(3, 1));
+  term_ref five = tm.mk_rational_constant(rational(5, 1));
+
+  z3->add_variable(x, smt::solver::CLASS_A);
+  z3->add_variable(y, smt::solver::CLASS_A);
+
+  // x + y <= 10
+  term_ref sum = tm.mk_term(TERM_ADD, x, y);
+  z3->add(tm.mk_term(TERM_LEQ, sum, tm.mk_rational_constant(rational(10, 1))), smt::solver::CLASS_A);
+
+  term_ref x_gt_5 = tm.mk_term(TERM_GT, x, five);
+  term_ref x_lt_3 = tm.mk_term(TERM_LT, x, three);
+  term_ref y_gt_0 = tm.mk_term(TERM_GT, y, zero);
+
+  BOOST_CHECK(z3->supports(smt::solver::ASSUMPTIONS));
+
+  // Satisfiable under x > 5, y > 0, and the model respects the assumptions
+  std::vector<term_ref> assumptions;
+  assumptions.push_back(x_gt_5);
+  assumptions.push_back(y_gt_0);
+  solver::result result = z3->check(assumptions);
+  BOOST_CHECK_EQUAL(result, solver::SAT);
+  expr::model::ref m = z3->get_model();
+  BOOST_CHECK(m->is_true(x_gt_5));
+  BOOST_CHECK(m->is_true(y_gt_0));
+
+  // Unsatisfiable with x < 3, and the core doesn't need y > 0
+  assumptions.push_back(x_lt_3);
+  result = z3->check(assumptions);
+  BOOST_CHECK_EQUAL(result, solver::UNSAT);
+  std::vector<term_ref> core;
+  z3->get_unsat_assumptions(core);
+  cout << "Core size: " << core.size() << endl;
+  BOOST_CHECK(std::find(core.begin(), core.end(), x_gt_5) != core.end());
+  BOOST_CHECK(std::find(core.begin(), core.end(), x_lt_3) != core.end());
+  BOOST_CHECK(std::find(core.begin(), core.end(), y_gt_0) == core.end());
+
+  // The assertions are unchanged
+  result = z3->check();
+  BOOST_CHECK_EQUAL(result, solver::SAT);
+}
+
+BOOST_AUTO_TEST_CASE(z3_interrupt) {
+
+  BOOST_CHECK(z3->supports(smt::solver::INTERRUPT));
+
+  // x^3 + y^3 = z^3 with positive integers, z3 won't be done soon
+  term_ref x = tm.mk_variable("x", tm.integer_type());
+  term_ref y = tm.mk_variable("y", tm.integer_type());
+  term_ref z = tm.mk_variable("z", tm.integer_type());
+  term_ref zero = tm.mk_rational_constant(rational());
+
+  z3->add_variable(x, smt::solver::CLASS_A);
+  z3->add_variable(y, smt::solver::CLASS_A);
+  z3->add_variable(z, smt::solver::CLASS_A);
+
+  std::vector<term_ref> x3(3, x), y3(3, y), z3_(3, z);
+  term_ref lhs = tm.mk_term(TERM_ADD, tm.mk_term(TERM_MUL, x3), tm.mk_term(TERM_MUL, y3));
+  z3->add(tm.mk_term(TERM_EQ, lhs, tm.mk_term(TERM_MUL, z3_)), smt::solver::CLASS_A);
+  z3->add(tm.mk_term(TERM_GT, x, zero), smt::solver::CLASS_A);
+  z3->add(tm.mk_term(TERM_GT, y, zero), smt::solver::CLASS_A);
+  z3->add(tm.mk_term(TERM_GT, z, zero), smt::solver::CLASS_A);
+
+  check_future::ref f = z3->check_async();
+  f->cancel();
+  BOOST_CHECK_EQUAL(f->get(), solver::UNKNOWN);
+  f = check_future::ref();
+
+  // The solver is still usable
+  z3->push();
+  z3->add(tm.mk_term(TERM_LT, x, zero), smt::solver::CLASS_A);
+  BOOST_CHECK_EQUAL(z3->check(), solver::UNSAT);
+  z3->pop();
+}
+
+BOOST_AUTO_TEST_CASE(z3_lazy_model) {
+
+  term_ref x = tm.mk_variable("x", tm.real_type());
+  term_ref y = tm.mk_variable("y", tm.real_type());
+  term_ref two = tm.mk_rational_constant(rational(2, 1));
+  term_ref x_gt_y = tm.mk_term(TERM_GT, x, y);
+  term_ref y_gt_2 = tm.mk_term(TERM_GT, y, two);
+
+  solver* s = factory::mk_solver("z3", tm, opts, stats);
+  s->add_variable(x, smt::solver::CLASS_A);
+  s->add_variable(y, smt::solver::CLASS_A);
+  s->add(x_gt_y, smt::solver::CLASS_A);
+  s->add(y_gt_2, smt::solver::CLASS_A);
+  BOOST_CHECK_EQUAL(s->check(), smt::solver::SAT);
+
+  // Formulas are evaluated by z3, values are obtained on demand
+  expr::model::ref m = s->get_model();
+  BOOST_CHECK(m->has_value(x));
+  BOOST_CHECK(m->is_true(x_gt_y));
+  BOOST_CHECK(m->is_false(tm.mk_term(TERM_NOT, y_gt_2)));
+  rational y_value = m->get_variable_value(y).get_rational();
+  BOOST_CHECK(y_value > rational(2, 1));
+
+  // The model survives the solver, and evaluates by itself
+  delete s;
+  BOOST_CHECK(m->is_true(x_gt_y));
+  rational x_value = m->get_variable_value(x).get_rational();
+  BOOST_CHECK(x_value > y_value);
+
+  // Setting a value takes over the evaluation
+  expr::model copy(*m);
+  copy.set_variable_value(x, expr::value(rational()));
+  BOOST_CHECK(copy.is_false(x_gt_y));
+  BOOST_CHECK(m->is_true(x_gt_y));
+
+  size_t count = 0;
+  for (expr::model::const_iterator it = m->values_begin(); it != m->values_end(); ++ it) {
+    count ++;
+  }
+  BOOST_CHECK_EQUAL(count, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif